@@ -103,7 +103,12 @@ void def_geometry_render(py::module m) {
       .def_readwrite("default_label", &RenderEngineVtkParams::default_label,
           doc.RenderEngineVtkParams.default_label.doc)
       .def_readwrite("default_diffuse", &RenderEngineVtkParams::default_diffuse,
-          doc.RenderEngineVtkParams.default_diffuse.doc);
+          doc.RenderEngineVtkParams.default_diffuse.doc)
+      .def_readwrite("frustum_culling", &RenderEngineVtkParams::frustum_culling,
+          doc.RenderEngineVtkParams.frustum_culling.doc)
+      .def_readwrite("lod_min_triangles",
+          &RenderEngineVtkParams::lod_min_triangles,
+          doc.RenderEngineVtkParams.lod_min_triangles.doc);
 
   m.def("MakeRenderEngineGl", &MakeRenderEngineGl, doc.MakeRenderEngineGl.doc);
 
@@ -1,6 +1,10 @@
+#include <optional>
+#include <vector>
+
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 
 #include "drake/bindings/pydrake/common/cpp_param_pybind.h"
 #include "drake/bindings/pydrake/common/value_pybind.h"
@@ -8,6 +12,7 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/perception/depth_image_to_point_cloud.h"
 #include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_fusion.h"
 
 namespace drake {
 namespace pydrake {
@@ -56,6 +61,7 @@ void init_perception(py::module m) {
   using systems::sensors::CameraInfo;
   using systems::sensors::PixelType;
 
+  py::module::import("pydrake.math");
   py::module::import("pydrake.systems.framework");
   py::module::import("pydrake.systems.sensors");
 
@@ -114,7 +120,25 @@ void init_perception(py::module m) {
             [](PointCloud* self, const PointCloud& other) {
               self->SetFrom(other);
             },
-            py::arg("other"), cls_doc.SetFrom.doc);
+            py::arg("other"), cls_doc.SetFrom.doc)
+        // Spatial operations.
+        .def("Crop",
+            py::overload_cast<const Vector3<float>&, const Vector3<float>&,
+                int>(&Class::Crop, py::const_),
+            py::arg("lower_xyz"), py::arg("upper_xyz"),
+            py::arg("num_threads") = 1, cls_doc.Crop.doc_3args)
+        .def("Crop",
+            py::overload_cast<const math::RigidTransformd&,
+                const Vector3<float>&, const Vector3<float>&, int>(
+                &Class::Crop, py::const_),
+            py::arg("X_CB"), py::arg("lower_B"), py::arg("upper_B"),
+            py::arg("num_threads") = 1, cls_doc.Crop.doc_4args)
+        .def("VoxelizedDownSample", &Class::VoxelizedDownSample,
+            py::arg("voxel_size"), py::arg("num_threads") = 1,
+            cls_doc.VoxelizedDownSample.doc)
+        .def("EstimateNormals", &Class::EstimateNormals, py::arg("radius"),
+            py::arg("num_closest"), py::arg("num_threads") = 1,
+            cls_doc.EstimateNormals.doc);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -125,11 +149,11 @@ void init_perception(py::module m) {
     py::class_<Class, LeafSystem<double>>(
         m, "DepthImageToPointCloud", cls_doc.doc)
         .def(py::init<const CameraInfo&, PixelType, float,
-                 pc_flags::BaseFieldT>(),
+                 pc_flags::BaseFieldT, int>(),
             py::arg("camera_info"),
             py::arg("pixel_type") = PixelType::kDepth32F,
             py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
-            cls_doc.ctor.doc)
+            py::arg("num_threads") = 1, cls_doc.ctor.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
             py_reference_internal, cls_doc.depth_image_input_port.doc)
         .def("color_image_input_port", &Class::color_image_input_port,
@@ -137,6 +161,33 @@ void init_perception(py::module m) {
         .def("point_cloud_output_port", &Class::point_cloud_output_port,
             py_reference_internal, cls_doc.point_cloud_output_port.doc);
   }
+
+  {
+    using Class = PointCloudFusion;
+    constexpr auto& cls_doc = doc.PointCloudFusion;
+    py::class_<Class, LeafSystem<double>>(m, "PointCloudFusion", cls_doc.doc)
+        .def(py::init<std::vector<CameraInfo>, PixelType, float,
+                 pc_flags::BaseFieldT, std::optional<double>, int>(),
+            py::arg("camera_infos"),
+            py::arg("depth_pixel_type") = PixelType::kDepth32F,
+            py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
+            py::arg("voxel_size") = std::nullopt, py::arg("num_threads") = 1,
+            cls_doc.ctor.doc)
+        .def("num_cameras", &Class::num_cameras, cls_doc.num_cameras.doc)
+        .def("point_offset", &Class::point_offset, py::arg("i"),
+            cls_doc.point_offset.doc)
+        .def("depth_image_input_port", &Class::depth_image_input_port,
+            py::arg("i"), py_reference_internal,
+            cls_doc.depth_image_input_port.doc)
+        .def("color_image_input_port", &Class::color_image_input_port,
+            py::arg("i"), py_reference_internal,
+            cls_doc.color_image_input_port.doc)
+        .def("camera_pose_input_port", &Class::camera_pose_input_port,
+            py::arg("i"), py_reference_internal,
+            cls_doc.camera_pose_input_port.doc)
+        .def("point_cloud_output_port", &Class::point_cloud_output_port,
+            py_reference_internal, cls_doc.point_cloud_output_port.doc);
+  }
 }
 
 PYBIND11_MODULE(perception, m) {
@@ -14,6 +14,7 @@
 #include "drake/bindings/pydrake/symbolic_types_pybind.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/psd_inner_approximation.h"
 #include "drake/solvers/solve.h"
 #include "drake/solvers/solver_type_converter.h"
 
@@ -40,6 +41,8 @@ using solvers::MathematicalProgramResult;
 using solvers::MatrixXDecisionVariable;
 using solvers::MatrixXIndeterminate;
 using solvers::PositiveSemidefiniteConstraint;
+using solvers::PsdInnerApproximation;
+using solvers::PsdInnerApproximationOptions;
 using solvers::QuadraticCost;
 using solvers::SolutionResult;
 using solvers::SolverId;
@@ -830,6 +833,18 @@ top-level documentation for :py:mod:`pydrake.math`.
                   MathematicalProgram::*)(const Expression&)>(
               &MathematicalProgram::AddSosConstraint),
           doc.MathematicalProgram.AddSosConstraint.doc_1args_e)
+      .def("AddSparseSosConstraint",
+          static_cast<std::vector<std::pair<MatrixXDecisionVariable,
+              VectorX<symbolic::Monomial>>> (MathematicalProgram::*)(
+              const Polynomial&)>(&MathematicalProgram::AddSparseSosConstraint),
+          py::arg("p"),
+          doc.MathematicalProgram.AddSparseSosConstraint.doc_1args_p)
+      .def("AddSparseSosConstraint",
+          static_cast<std::vector<std::pair<MatrixXDecisionVariable,
+              VectorX<symbolic::Monomial>>> (MathematicalProgram::*)(
+              const Expression&)>(&MathematicalProgram::AddSparseSosConstraint),
+          py::arg("e"),
+          doc.MathematicalProgram.AddSparseSosConstraint.doc_1args_e)
       .def("AddEqualityConstraintBetweenPolynomials",
           &MathematicalProgram::AddEqualityConstraintBetweenPolynomials,
           py::arg("p1"), py::arg("p2"),
@@ -1277,6 +1292,34 @@ top-level documentation for :py:mod:`pydrake.math`.
               const std::optional<SolverOptions>&>(&solvers::Solve),
           py::arg("prog"), py::arg("initial_guess") = py::none(),
           py::arg("solver_options") = py::none(), doc.Solve.doc_3args);
+
+  // Bind the types and functions in psd_inner_approximation.h.
+  py::enum_<PsdInnerApproximation>(
+      m, "PsdInnerApproximation", doc.PsdInnerApproximation.doc)
+      .value("kDiagonallyDominant", PsdInnerApproximation::kDiagonallyDominant,
+          doc.PsdInnerApproximation.kDiagonallyDominant.doc)
+      .value("kScaledDiagonallyDominant",
+          PsdInnerApproximation::kScaledDiagonallyDominant,
+          doc.PsdInnerApproximation.kScaledDiagonallyDominant.doc);
+  {
+    using Class = PsdInnerApproximationOptions;
+    constexpr auto& cls_doc = doc.PsdInnerApproximationOptions;
+    py::class_<Class>(m, "PsdInnerApproximationOptions", cls_doc.doc)
+        .def(py::init<>())
+        .def_readwrite("type", &Class::type, cls_doc.type.doc)
+        .def_readwrite("max_iterations", &Class::max_iterations,
+            cls_doc.max_iterations.doc)
+        .def_readwrite("relative_cost_tolerance",
+            &Class::relative_cost_tolerance,
+            cls_doc.relative_cost_tolerance.doc)
+        .def_readwrite("solver_id", &Class::solver_id, cls_doc.solver_id.doc)
+        .def_readwrite("solver_options", &Class::solver_options,
+            cls_doc.solver_options.doc);
+  }
+  m.def("SolveWithPsdInnerApproximation",
+      &solvers::SolveWithPsdInnerApproximation, py::arg("prog"),
+      py::arg("options") = PsdInnerApproximationOptions(),
+      doc.SolveWithPsdInnerApproximation.doc);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   m.def("GetInfeasibleConstraints",
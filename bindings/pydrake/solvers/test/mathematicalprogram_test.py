@@ -406,6 +406,27 @@ class TestMathematicalProgram(unittest.TestCase):
         self.assertTrue(np.all(eigs >= -tol))
         self.assertTrue(S[0, 1] >= -tol)
 
+    def test_psd_inner_approximation(self):
+        prog = mp.MathematicalProgram()
+        S = prog.NewSymmetricContinuousVariables(2, "S")
+        prog.AddPositiveSemidefiniteConstraint(S)
+        prog.AddLinearEqualityConstraint(S[0, 0] + S[1, 1] == 1)
+        prog.AddLinearCost(S[0, 0] + 4 * S[0, 1] + 5 * S[1, 1])
+        options = mp.PsdInnerApproximationOptions()
+        options.type = mp.PsdInnerApproximation.kDiagonallyDominant
+        options.max_iterations = 5
+        options.relative_cost_tolerance = 1e-3
+        self.assertIsNone(options.solver_id)
+        self.assertIsNone(options.solver_options)
+        options.solver_options = SolverOptions()
+        result = mp.SolveWithPsdInnerApproximation(prog=prog, options=options)
+        self.assertTrue(result.is_success())
+        # The inner approximation is feasible for the semidefinite program.
+        S = result.GetSolution(S)
+        self.assertTrue(np.all(np.linalg.eigvalsh(S) >= -1e-6))
+        self.assertGreaterEqual(result.get_optimal_cost(),
+                                3 - 2 * np.sqrt(2) - 1e-6)
+
     def test_sos(self):
         # Find a,b,c,d subject to
         # a(0) + a(1)*x,
@@ -427,6 +448,8 @@ class TestMathematicalProgram(unittest.TestCase):
         d = prog.NewContinuousVariables(2, "d")
         prog.AddSosConstraint(d[0]*x.dot(x))
         prog.AddSosConstraint(d[1]*x.dot(x), [sym.Monomial(x[0])])
+        grams = prog.AddSparseSosConstraint(d[0]*x.dot(x))
+        self.assertGreater(len(grams), 0)
         prog.AddLinearEqualityConstraint(d[0] + d[1] == 1)
         result = mp.Solve(prog)
         self.assertTrue(result.is_success())
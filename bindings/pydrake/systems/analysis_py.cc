@@ -26,6 +26,7 @@ PYBIND11_MODULE(analysis, m) {
 
   m.doc() = "Bindings for the analysis portion of the Systems framework.";
 
+  py::module::import("pydrake.solvers.mathematicalprogram");
   py::module::import("pydrake.systems.framework");
 
   {
@@ -259,7 +260,13 @@ PYBIND11_MODULE(analysis, m) {
             doc.RegionOfAttractionOptions.lyapunov_candidate.doc)
         .def_readwrite("state_variables",
             &RegionOfAttractionOptions::state_variables,
-            doc.RegionOfAttractionOptions.state_variables.doc);
+            doc.RegionOfAttractionOptions.state_variables.doc)
+        .def_readwrite("use_chordal_decomposition",
+            &RegionOfAttractionOptions::use_chordal_decomposition,
+            doc.RegionOfAttractionOptions.use_chordal_decomposition.doc)
+        .def_readwrite("psd_inner_approximation",
+            &RegionOfAttractionOptions::psd_inner_approximation,
+            doc.RegionOfAttractionOptions.psd_inner_approximation.doc);
 
     m.def("RegionOfAttraction", &RegionOfAttraction, py::arg("system"),
         py::arg("context"), py::arg("options") = RegionOfAttractionOptions(),
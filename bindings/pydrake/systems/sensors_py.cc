@@ -123,11 +123,24 @@ PYBIND11_MODULE(sensors, m) {
         return py::make_tuple(
             self->height(), self->width(), int{ImageTraitsT::kNumChannels});
       };
+      // The `data` array owns a copy of the image, which shares its pixels,
+      // such that the array stays valid even if the image is later resized or
+      // gets its own pixels through MakeUnique(); the array then keeps showing
+      // the pixels at the time of the access.
       auto get_data = [=](const ImageT* self) {
-        return ToArray(self->at(0, 0), self->size(), get_shape(self));
+        auto* pinned = new ImageT(*self);
+        py::capsule owner(
+            pinned, [](void* ptr) { delete static_cast<ImageT*>(ptr); });
+        Map<const VectorX<T>> data(pinned->at(0, 0), pinned->size());
+        return py::cast(Eigen::Ref<const VectorX<T>>(data),
+            py_reference_internal, owner)
+            .attr("reshape")(get_shape(self));
       };
+      // N.B. Since copies of an image share their pixels until one of them is
+      // modified, a `mutable_data` array must not be written to after the
+      // image has been copied (e.g., into a Value); access it again instead.
       auto get_mutable_data = [=](ImageT* self) {
-        return ToArray(self->at(0, 0), self->size(), get_shape(self));
+        return ToArray(self->mutable_data(), self->size(), get_shape(self));
       };
 
       py::class_<ImageT> image(m, TemporaryClassName<ImageT>().c_str());
@@ -201,26 +214,39 @@ PYBIND11_MODULE(sensors, m) {
       .def_readwrite("X_BC", &RgbdSensor::CameraPoses::X_BC)
       .def_readwrite("X_BD", &RgbdSensor::CameraPoses::X_BD);
 
+  py::enum_<RgbdSensor::RenderMode>(
+      rgbd_sensor, "RenderMode", doc.RgbdSensor.RenderMode.doc)
+      .value("kSeparate", RgbdSensor::RenderMode::kSeparate,
+          doc.RgbdSensor.RenderMode.kSeparate.doc)
+      .value("kFused", RgbdSensor::RenderMode::kFused,
+          doc.RgbdSensor.RenderMode.kFused.doc);
+
   rgbd_sensor
       .def(py::init<FrameId, const RigidTransformd&, const CameraProperties&,
                const DepthCameraProperties&, const RgbdSensor::CameraPoses&,
-               bool>(),
+               bool, RgbdSensor::RenderMode>(),
           py::arg("parent_id"), py::arg("X_PB"), py::arg("color_properties"),
           py::arg("depth_properties"),
           py::arg("camera_poses") = RgbdSensor::CameraPoses{},
-          py::arg("show_window") = false, doc.RgbdSensor.ctor.doc_6args)
+          py::arg("show_window") = false,
+          py::arg("render_mode") = RgbdSensor::RenderMode::kSeparate,
+          doc.RgbdSensor.ctor.doc_7args)
       .def(py::init<FrameId, const RigidTransformd&,
                const DepthCameraProperties&, const RgbdSensor::CameraPoses&,
-               bool>(),
+               bool, RgbdSensor::RenderMode>(),
           py::arg("parent_id"), py::arg("X_PB"), py::arg("properties"),
           py::arg("camera_poses") = RgbdSensor::CameraPoses{},
-          py::arg("show_window") = false, doc.RgbdSensor.ctor.doc_5args)
+          py::arg("show_window") = false,
+          py::arg("render_mode") = RgbdSensor::RenderMode::kSeparate,
+          doc.RgbdSensor.ctor.doc_6args)
       .def("color_camera_info", &RgbdSensor::color_camera_info,
           py_reference_internal, doc.RgbdSensor.color_camera_info.doc)
       .def("depth_camera_info", &RgbdSensor::depth_camera_info,
           py_reference_internal, doc.RgbdSensor.depth_camera_info.doc)
       .def("X_BC", &RgbdSensor::X_BC, doc.RgbdSensor.X_BC.doc)
       .def("X_BD", &RgbdSensor::X_BD, doc.RgbdSensor.X_BD.doc)
+      .def("render_mode", &RgbdSensor::render_mode,
+          doc.RgbdSensor.render_mode.doc)
       .def("parent_frame_id", &RgbdSensor::parent_frame_id,
           py_reference_internal, doc.RgbdSensor.parent_frame_id.doc);
   def_camera_ports(&rgbd_sensor, doc.RgbdSensor);
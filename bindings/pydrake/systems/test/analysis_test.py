@@ -1,5 +1,9 @@
 import unittest
 
+from pydrake.solvers.mathematicalprogram import (
+    PsdInnerApproximation,
+    PsdInnerApproximationOptions,
+)
 from pydrake.symbolic import Variable, Expression
 from pydrake.systems.primitives import (
     ConstantVectorSource,
@@ -26,6 +30,14 @@ class TestAnalysis(unittest.TestCase):
         options.lyapunov_candidate = x*x
         options.state_variables = [x]
         V = RegionOfAttraction(system=sys, context=context, options=options)
+        options.use_chordal_decomposition = True
+        V = RegionOfAttraction(system=sys, context=context, options=options)
+        self.assertIsNone(options.psd_inner_approximation)
+        psd_options = PsdInnerApproximationOptions()
+        psd_options.type = PsdInnerApproximation.kDiagonallyDominant
+        options.psd_inner_approximation = psd_options
+        self.assertEqual(options.psd_inner_approximation.type,
+                         PsdInnerApproximation.kDiagonallyDominant)
 
     def test_symbolic_integrators(self):
         x = Variable("x")
@@ -91,8 +91,8 @@ class TestSensors(unittest.TestCase):
             w //= 2
             h //= 2
             # WARNING: Resizing an image with an existing reference to
-            # `image.data` will cause `image.data` + `image.mutable_data` to be
-            # invalid.
+            # `image.mutable_data` will cause it to be invalid. (An existing
+            # `image.data` keeps showing the pixels before resizing.)
             image.resize(w, h)
             self.assertEqual(image.shape, (h, w, nc))
 
@@ -154,6 +154,14 @@ class TestSensors(unittest.TestCase):
                     self.assertTrue(
                         np.allclose(data[ih, iw, :], image.at(iw, ih)))
 
+            # A `data` array keeps the pixels at the time of the access, even
+            # after the image is modified or resized.
+            data = image.data
+            expected = np.array(data)
+            image.mutable_data[:] = 5
+            image.resize(w // 2, h // 2)
+            self.assertTrue(np.array_equal(data, expected))
+
     def test_constants(self):
         # Simply ensure we can access the constants.
         values = [
@@ -277,6 +285,8 @@ class TestSensors(unittest.TestCase):
         self.assertIsInstance(sensor.X_BD(),
                               RigidTransform)
         self.assertEqual(sensor.parent_frame_id(), parent_id)
+        self.assertEqual(sensor.render_mode(),
+                         mut.RgbdSensor.RenderMode.kSeparate)
         check_ports(sensor)
 
         # Test discrete camera, reconstructing using single-properties
@@ -285,7 +295,10 @@ class TestSensors(unittest.TestCase):
         sensor = mut.RgbdSensor(parent_id=parent_id, X_PB=X_WB,
                                 properties=color_and_depth_properties,
                                 camera_poses=camera_poses,
-                                show_window=False)
+                                show_window=False,
+                                render_mode=mut.RgbdSensor.RenderMode.kFused)
+        self.assertEqual(sensor.render_mode(),
+                         mut.RgbdSensor.RenderMode.kFused)
         period = mut.RgbdSensorDiscrete.kDefaultPeriod
         discrete = mut.RgbdSensorDiscrete(
             sensor=sensor, period=period, render_label_image=True)
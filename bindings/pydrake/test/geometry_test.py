@@ -369,6 +369,14 @@ class TestGeometry(unittest.TestCase):
         self.assertEqual(params.default_label, label)
         self.assertTrue((params.default_diffuse == diffuse).all())
 
+        params = mut.render.RenderEngineVtkParams()
+        self.assertTrue(params.frustum_culling)
+        self.assertEqual(params.lod_min_triangles, None)
+        params = mut.render.RenderEngineVtkParams(
+            frustum_culling=False, lod_min_triangles=10000)
+        self.assertFalse(params.frustum_culling)
+        self.assertEqual(params.lod_min_triangles, 10000)
+
     def test_render_depth_camera_properties(self):
         obj = mut.render.DepthCameraProperties(width=320, height=240,
                                                fov_y=pi/6,
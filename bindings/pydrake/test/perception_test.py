@@ -5,6 +5,7 @@ import unittest
 import numpy as np
 
 from pydrake.common.value import AbstractValue, Value
+from pydrake.math import RigidTransform
 from pydrake.systems.sensors import CameraInfo, PixelType
 from pydrake.systems.framework import InputPort, OutputPort
 
@@ -76,6 +77,23 @@ class TestPerception(unittest.TestCase):
         # Test Systems' value registration.
         self.assertIsInstance(AbstractValue.Make(pc), Value[mut.PointCloud])
 
+    def test_point_cloud_spatial_operations(self):
+        fields = mut.Fields(mut.BaseField.kXYZs | mut.BaseField.kNormals)
+        pc = mut.PointCloud(new_size=4, fields=fields)
+        pc.mutable_xyzs()[:] = [[0, 1, 0, 0.1], [0, 0, 1, 0.1], [1, 1, 1, 1]]
+        cropped = pc.Crop(lower_xyz=[-0.5, -0.5, 0], upper_xyz=[0.5, 0.5, 2],
+                          num_threads=2)
+        self.assertEqual(cropped.size(), 2)
+        cropped = pc.Crop(X_CB=RigidTransform([0, 0, 1]),
+                          lower_B=[-0.5, -0.5, -0.5],
+                          upper_B=[0.5, 0.5, 0.5])
+        self.assertEqual(cropped.size(), 2)
+        down = pc.VoxelizedDownSample(voxel_size=0.5, num_threads=2)
+        self.assertEqual(down.size(), 3)
+        self.assertTrue(pc.EstimateNormals(
+            radius=2, num_closest=3, num_threads=2))
+        np.testing.assert_allclose(pc.normal(i=0), [0, 0, -1], atol=1e-6)
+
     def test_depth_image_to_point_cloud_api(self):
         camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
         dut = mut.DepthImageToPointCloud(camera_info=camera_info)
@@ -86,4 +104,26 @@ class TestPerception(unittest.TestCase):
             camera_info=camera_info,
             pixel_type=PixelType.kDepth16U,
             scale=0.001,
-            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs)
+            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs,
+            num_threads=2)
+
+    def test_point_cloud_fusion_api(self):
+        camera_infos = [
+            CameraInfo(width=640, height=480, fov_y=np.pi / 4),
+            CameraInfo(width=320, height=240, fov_y=np.pi / 3)]
+        dut = mut.PointCloudFusion(camera_infos=camera_infos)
+        self.assertEqual(dut.num_cameras(), 2)
+        self.assertEqual(dut.point_offset(i=1), 640 * 480)
+        self.assertEqual(dut.point_offset(i=2), 640 * 480 + 320 * 240)
+        for i in range(2):
+            self.assertIsInstance(dut.depth_image_input_port(i=i), InputPort)
+            self.assertIsInstance(dut.color_image_input_port(i=i), InputPort)
+            self.assertIsInstance(dut.camera_pose_input_port(i=i), InputPort)
+        self.assertIsInstance(dut.point_cloud_output_port(), OutputPort)
+        dut = mut.PointCloudFusion(
+            camera_infos=camera_infos,
+            depth_pixel_type=PixelType.kDepth16U,
+            scale=0.001,
+            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs,
+            voxel_size=0.01,
+            num_threads=2)
@@ -18,6 +18,7 @@
 
 #include <cmath>
 #include <ostream>
+#include <utility>
 
 #include <Eigen/Dense>
 
@@ -44,6 +45,12 @@ namespace Eigen {
 // See https://github.com/RobotLocomotion/drake/issues/6944 for more
 // information. See also drake/common/autodiff_overloads.h.
 //
+// The specialization also tries hard to avoid heap allocations of derivative
+// vectors: it provides move construction and assignment, compound assignment
+// operators that update the derivatives in place, and rvalue-qualified
+// overloads of the arithmetic operators that reuse the storage of a temporary
+// left-hand operand (e.g., in `a * b + c * d` the product `a * b` is reused).
+//
 // TODO(soonho-tri): Next time when we upgrade Eigen, please check if we still
 // need these specializations.
 template <>
@@ -73,6 +80,9 @@ class AutoDiffScalar<VectorXd>
   AutoDiffScalar(const Scalar& value, const DerType& der)
       : m_value(value), m_derivatives(der) {}
 
+  AutoDiffScalar(const Scalar& value, DerType&& der)
+      : m_value(value), m_derivatives(std::move(der)) {}
+
   template <typename OtherDerType>
   AutoDiffScalar(
       const AutoDiffScalar<OtherDerType>& other
@@ -95,6 +105,11 @@ class AutoDiffScalar<VectorXd>
   AutoDiffScalar(const AutoDiffScalar& other)
       : m_value(other.value()), m_derivatives(other.derivatives()) {}
 
+  // The moved-from object is left with empty derivatives (i.e., a constant).
+  AutoDiffScalar(AutoDiffScalar&& other) noexcept
+      : m_value(other.m_value),
+        m_derivatives(std::move(other.m_derivatives)) {}
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator=(const AutoDiffScalar<OtherDerType>& other) {
     m_value = other.value();
@@ -108,6 +123,12 @@ class AutoDiffScalar<VectorXd>
     return *this;
   }
 
+  inline AutoDiffScalar& operator=(AutoDiffScalar&& other) noexcept {
+    m_value = other.m_value;
+    m_derivatives = std::move(other.m_derivatives);
+    return *this;
+  }
+
   inline AutoDiffScalar& operator=(const Scalar& other) {
     m_value = other;
     if (m_derivatives.size() > 0) m_derivatives.setZero();
@@ -171,119 +192,201 @@ class AutoDiffScalar<VectorXd>
     return m_value != b.value();
   }
 
-  inline const AutoDiffScalar<DerType> operator+(const Scalar& other) const {
+  inline AutoDiffScalar<DerType> operator+(const Scalar& other) const& {
     return AutoDiffScalar<DerType>(m_value + other, m_derivatives);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator+(
-      const Scalar& a, const AutoDiffScalar& b) {
+  inline AutoDiffScalar<DerType> operator+(const Scalar& other) && {
+    *this += other;
+    return std::move(*this);
+  }
+
+  friend inline AutoDiffScalar<DerType> operator+(const Scalar& a,
+                                                  const AutoDiffScalar& b) {
     return AutoDiffScalar<DerType>(a + b.value(), b.derivatives());
   }
 
+  friend inline AutoDiffScalar<DerType> operator+(const Scalar& a,
+                                                  AutoDiffScalar&& b) {
+    b += a;
+    return std::move(b);
+  }
+
   inline AutoDiffScalar& operator+=(const Scalar& other) {
     value() += other;
     return *this;
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator+(
-      const AutoDiffScalar<OtherDerType>& other) const {
-    const bool has_this_der = m_derivatives.size() > 0;
-    const bool has_both_der = has_this_der && (other.derivatives().size() > 0);
-    return MakeAutoDiffScalar(
-        m_value + other.value(),
-        has_both_der
-            ? VectorXd(m_derivatives + other.derivatives())
-            : has_this_der ? m_derivatives : VectorXd(other.derivatives()));
+  inline AutoDiffScalar<DerType> operator+(
+      const AutoDiffScalar<OtherDerType>& other) const& {
+    AutoDiffScalar<DerType> result(*this);
+    result += other;
+    return result;
+  }
+
+  template <typename OtherDerType>
+  inline AutoDiffScalar<DerType> operator+(
+      const AutoDiffScalar<OtherDerType>& other) && {
+    *this += other;
+    return std::move(*this);
   }
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator+=(const AutoDiffScalar<OtherDerType>& other) {
-    (*this) = (*this) + other;
+    const bool has_this_der = m_derivatives.size() > 0;
+    const bool has_other_der = other.derivatives().size() > 0;
+    if (has_this_der && has_other_der) {
+      m_derivatives += other.derivatives();
+    } else if (has_other_der) {
+      m_derivatives = other.derivatives();
+    }
+    m_value += other.value();
     return *this;
   }
 
-  inline const AutoDiffScalar<DerType> operator-(const Scalar& b) const {
+  inline AutoDiffScalar<DerType> operator-(const Scalar& b) const& {
     return AutoDiffScalar<DerType>(m_value - b, m_derivatives);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator-(
-      const Scalar& a, const AutoDiffScalar& b) {
+  inline AutoDiffScalar<DerType> operator-(const Scalar& b) && {
+    *this -= b;
+    return std::move(*this);
+  }
+
+  friend inline AutoDiffScalar<DerType> operator-(const Scalar& a,
+                                                  const AutoDiffScalar& b) {
     return AutoDiffScalar<DerType>(a - b.value(), -b.derivatives());
   }
 
+  friend inline AutoDiffScalar<DerType> operator-(const Scalar& a,
+                                                  AutoDiffScalar&& b) {
+    b.m_derivatives = -b.m_derivatives;
+    b.m_value = a - b.m_value;
+    return std::move(b);
+  }
+
   inline AutoDiffScalar& operator-=(const Scalar& other) {
     value() -= other;
     return *this;
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator-(
-      const AutoDiffScalar<OtherDerType>& other) const {
-    const bool has_this_der = m_derivatives.size() > 0;
-    const bool has_both_der = has_this_der && (other.derivatives().size() > 0);
-    return MakeAutoDiffScalar(
-        m_value - other.value(),
-        has_both_der
-            ? VectorXd(m_derivatives - other.derivatives())
-            : has_this_der ? m_derivatives : VectorXd(-other.derivatives()));
+  inline AutoDiffScalar<DerType> operator-(
+      const AutoDiffScalar<OtherDerType>& other) const& {
+    AutoDiffScalar<DerType> result(*this);
+    result -= other;
+    return result;
+  }
+
+  template <typename OtherDerType>
+  inline AutoDiffScalar<DerType> operator-(
+      const AutoDiffScalar<OtherDerType>& other) && {
+    *this -= other;
+    return std::move(*this);
   }
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator-=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this - other;
+    const bool has_this_der = m_derivatives.size() > 0;
+    const bool has_other_der = other.derivatives().size() > 0;
+    if (has_this_der && has_other_der) {
+      m_derivatives -= other.derivatives();
+    } else if (has_other_der) {
+      m_derivatives = -other.derivatives();
+    }
+    m_value -= other.value();
     return *this;
   }
 
-  inline const AutoDiffScalar<DerType> operator-() const {
+  inline AutoDiffScalar<DerType> operator-() const& {
     return AutoDiffScalar<DerType>(-m_value, -m_derivatives);
   }
 
-  inline const AutoDiffScalar<DerType> operator*(const Scalar& other) const {
-    return MakeAutoDiffScalar(m_value * other, m_derivatives * other);
+  inline AutoDiffScalar<DerType> operator-() && {
+    m_value = -m_value;
+    m_derivatives = -m_derivatives;
+    return std::move(*this);
+  }
+
+  inline AutoDiffScalar<DerType> operator*(const Scalar& other) const& {
+    return AutoDiffScalar<DerType>(m_value * other,
+                                   VectorXd(m_derivatives * other));
+  }
+
+  inline AutoDiffScalar<DerType> operator*(const Scalar& other) && {
+    *this *= other;
+    return std::move(*this);
+  }
+
+  friend inline AutoDiffScalar<DerType> operator*(const Scalar& other,
+                                                  const AutoDiffScalar& a) {
+    return AutoDiffScalar<DerType>(a.value() * other,
+                                   VectorXd(a.derivatives() * other));
+  }
+
+  friend inline AutoDiffScalar<DerType> operator*(const Scalar& other,
+                                                  AutoDiffScalar&& a) {
+    a *= other;
+    return std::move(a);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator*(
-      const Scalar& other, const AutoDiffScalar& a) {
-    return MakeAutoDiffScalar(a.value() * other, a.derivatives() * other);
+  inline AutoDiffScalar<DerType> operator/(const Scalar& other) const& {
+    return AutoDiffScalar<DerType>(
+        m_value / other, VectorXd(m_derivatives * (Scalar(1) / other)));
   }
 
-  inline const AutoDiffScalar<DerType> operator/(const Scalar& other) const {
-    return MakeAutoDiffScalar(m_value / other,
-                              (m_derivatives * (Scalar(1) / other)));
+  inline AutoDiffScalar<DerType> operator/(const Scalar& other) && {
+    *this /= other;
+    return std::move(*this);
   }
 
-  friend inline const AutoDiffScalar<DerType> operator/(
-      const Scalar& other, const AutoDiffScalar& a) {
-    return MakeAutoDiffScalar(
+  friend inline AutoDiffScalar<DerType> operator/(const Scalar& other,
+                                                  const AutoDiffScalar& a) {
+    return AutoDiffScalar<DerType>(
         other / a.value(),
-        a.derivatives() * (Scalar(-other) / (a.value() * a.value())));
+        VectorXd(a.derivatives() *
+                 (Scalar(-other) / (a.value() * a.value()))));
+  }
+
+  friend inline AutoDiffScalar<DerType> operator/(const Scalar& other,
+                                                  AutoDiffScalar&& a) {
+    a.m_derivatives *= Scalar(-other) / (a.m_value * a.m_value);
+    a.m_value = other / a.m_value;
+    return std::move(a);
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator/(
-      const AutoDiffScalar<OtherDerType>& other) const {
+  inline AutoDiffScalar<DerType> operator/(
+      const AutoDiffScalar<OtherDerType>& other) const& {
     const auto& this_der = m_derivatives;
     const auto& other_der = other.derivatives();
     const bool has_this_der = m_derivatives.size() > 0;
     const bool has_both_der = has_this_der && (other.derivatives().size() > 0);
     const double scale = 1. / (other.value() * other.value());
-    return MakeAutoDiffScalar(
+    return AutoDiffScalar<DerType>(
         m_value / other.value(),
         has_both_der ?
-            VectorXd(this_der * other.value() - other_der * m_value) * scale :
+            VectorXd((this_der * other.value() - other_der * m_value) * scale) :
         has_this_der ?
-            VectorXd(this_der * other.value()) * scale :
+            VectorXd((this_der * other.value()) * scale) :
         // has_other_der || has_neither
-            VectorXd(other_der * -m_value) * scale);
+            VectorXd((other_der * -m_value) * scale));
+  }
+
+  template <typename OtherDerType>
+  inline AutoDiffScalar<DerType> operator/(
+      const AutoDiffScalar<OtherDerType>& other) && {
+    *this /= other;
+    return std::move(*this);
   }
 
   template <typename OtherDerType>
-  inline const AutoDiffScalar<DerType> operator*(
-      const AutoDiffScalar<OtherDerType>& other) const {
+  inline AutoDiffScalar<DerType> operator*(
+      const AutoDiffScalar<OtherDerType>& other) const& {
     const bool has_this_der = m_derivatives.size() > 0;
     const bool has_both_der = has_this_der && (other.derivatives().size() > 0);
-    return MakeAutoDiffScalar(
+    return AutoDiffScalar<DerType>(
         m_value * other.value(),
         has_both_der ? VectorXd(m_derivatives * other.value() +
                                 other.derivatives() * m_value)
@@ -291,25 +394,60 @@ class AutoDiffScalar<VectorXd>
                                     : VectorXd(other.derivatives() * m_value));
   }
 
+  template <typename OtherDerType>
+  inline AutoDiffScalar<DerType> operator*(
+      const AutoDiffScalar<OtherDerType>& other) && {
+    *this *= other;
+    return std::move(*this);
+  }
+
   inline AutoDiffScalar& operator*=(const Scalar& other) {
-    *this = *this * other;
+    m_value *= other;
+    m_derivatives *= other;
     return *this;
   }
 
+  // The compound assignments below copy the operand values before touching
+  // the derivatives, and only use coefficient-wise Eigen expressions, so that
+  // they remain correct when `other` aliases `*this` (e.g., `x *= x`).
   template <typename OtherDerType>
   inline AutoDiffScalar& operator*=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this * other;
+    const Scalar a = m_value;
+    const Scalar b = other.value();
+    const bool has_this_der = m_derivatives.size() > 0;
+    const bool has_other_der = other.derivatives().size() > 0;
+    if (has_this_der && has_other_der) {
+      m_derivatives = m_derivatives * b + other.derivatives() * a;
+    } else if (has_this_der) {
+      m_derivatives *= b;
+    } else if (has_other_der) {
+      m_derivatives = other.derivatives() * a;
+    }
+    m_value = a * b;
     return *this;
   }
 
   inline AutoDiffScalar& operator/=(const Scalar& other) {
-    *this = *this / other;
+    m_value /= other;
+    m_derivatives *= Scalar(1) / other;
     return *this;
   }
 
   template <typename OtherDerType>
   inline AutoDiffScalar& operator/=(const AutoDiffScalar<OtherDerType>& other) {
-    *this = *this / other;
+    const Scalar a = m_value;
+    const Scalar b = other.value();
+    const Scalar scale = 1. / (b * b);
+    const bool has_this_der = m_derivatives.size() > 0;
+    const bool has_other_der = other.derivatives().size() > 0;
+    if (has_this_der && has_other_der) {
+      m_derivatives = (m_derivatives * b - other.derivatives() * a) * scale;
+    } else if (has_this_der) {
+      m_derivatives = (m_derivatives * b) * scale;
+    } else if (has_other_der) {
+      m_derivatives = (other.derivatives() * -a) * scale;
+    }
+    m_value = a / b;
     return *this;
   }
 
@@ -318,104 +456,115 @@ class AutoDiffScalar<VectorXd>
   DerType m_derivatives;
 };
 
+// The functions below take their argument by value so that a temporary
+// argument (e.g., `sin(2 * x)`) donates its derivatives storage to the result.
+// The CODE must update the derivatives of `x` (using the original value of
+// `x`) before it overwrites the value of `x`.
 #define DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(FUNC, CODE) \
-  inline const AutoDiffScalar<VectorXd> FUNC(                   \
-      const AutoDiffScalar<VectorXd>& x) {                      \
+  inline AutoDiffScalar<VectorXd> FUNC(AutoDiffScalar<VectorXd> x) { \
     EIGEN_UNUSED typedef double Scalar;                         \
     CODE;                                                       \
+    return x;                                                   \
   }
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    abs, using std::abs; return Eigen::MakeAutoDiffScalar(
-        abs(x.value()), x.derivatives() * (x.value() < 0 ? -1 : 1));)
+    abs, using std::abs;
+    x.derivatives() *= (x.value() < 0 ? Scalar(-1) : Scalar(1));
+    x.value() = abs(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    abs2, using numext::abs2; return Eigen::MakeAutoDiffScalar(
-        abs2(x.value()), x.derivatives() * (Scalar(2) * x.value()));)
+    abs2, using numext::abs2;
+    x.derivatives() *= (Scalar(2) * x.value());
+    x.value() = abs2(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     sqrt, using std::sqrt; Scalar sqrtx = sqrt(x.value());
-    return Eigen::MakeAutoDiffScalar(sqrtx,
-                                     x.derivatives() * (Scalar(0.5) / sqrtx));)
+    x.derivatives() *= (Scalar(0.5) / sqrtx);
+    x.value() = sqrtx;)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     cos, using std::cos; using std::sin;
-    return Eigen::MakeAutoDiffScalar(cos(x.value()),
-                                     x.derivatives() * (-sin(x.value())));)
+    x.derivatives() *= (-sin(x.value()));
+    x.value() = cos(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     sin, using std::sin; using std::cos;
-    return Eigen::MakeAutoDiffScalar(sin(x.value()),
-                                     x.derivatives() * cos(x.value()));)
+    x.derivatives() *= cos(x.value());
+    x.value() = sin(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     exp, using std::exp; Scalar expx = exp(x.value());
-    return Eigen::MakeAutoDiffScalar(expx, x.derivatives() * expx);)
+    x.derivatives() *= expx;
+    x.value() = expx;)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    log, using std::log; return Eigen::MakeAutoDiffScalar(
-        log(x.value()), x.derivatives() * (Scalar(1) / x.value()));)
+    log, using std::log;
+    x.derivatives() *= (Scalar(1) / x.value());
+    x.value() = log(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    tan, using std::tan; using std::cos; return Eigen::MakeAutoDiffScalar(
-        tan(x.value()),
-        x.derivatives() * (Scalar(1) / numext::abs2(cos(x.value()))));)
+    tan, using std::tan; using std::cos;
+    x.derivatives() *= (Scalar(1) / numext::abs2(cos(x.value())));
+    x.value() = tan(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    asin, using std::sqrt; using std::asin; return Eigen::MakeAutoDiffScalar(
-        asin(x.value()),
-        x.derivatives() * (Scalar(1) / sqrt(1 - numext::abs2(x.value()))));)
+    asin, using std::sqrt; using std::asin;
+    x.derivatives() *= (Scalar(1) / sqrt(1 - numext::abs2(x.value())));
+    x.value() = asin(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    acos, using std::sqrt; using std::acos; return Eigen::MakeAutoDiffScalar(
-        acos(x.value()),
-        x.derivatives() * (Scalar(-1) / sqrt(1 - numext::abs2(x.value()))));)
+    acos, using std::sqrt; using std::acos;
+    x.derivatives() *= (Scalar(-1) / sqrt(1 - numext::abs2(x.value())));
+    x.value() = acos(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    atan, using std::atan; return Eigen::MakeAutoDiffScalar(
-        atan(x.value()),
-        x.derivatives() * (Scalar(1) / (1 + x.value() * x.value())));)
+    atan, using std::atan;
+    x.derivatives() *= (Scalar(1) / (1 + x.value() * x.value()));
+    x.value() = atan(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
-    tanh, using std::cosh; using std::tanh; return Eigen::MakeAutoDiffScalar(
-        tanh(x.value()),
-        x.derivatives() * (Scalar(1) / numext::abs2(cosh(x.value()))));)
+    tanh, using std::cosh; using std::tanh;
+    x.derivatives() *= (Scalar(1) / numext::abs2(cosh(x.value())));
+    x.value() = tanh(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     sinh, using std::sinh; using std::cosh;
-    return Eigen::MakeAutoDiffScalar(sinh(x.value()),
-                                     x.derivatives() * cosh(x.value()));)
+    x.derivatives() *= cosh(x.value());
+    x.value() = sinh(x.value());)
 
 DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY(
     cosh, using std::sinh; using std::cosh;
-    return Eigen::MakeAutoDiffScalar(cosh(x.value()),
-                                     x.derivatives() * sinh(x.value()));)
+    x.derivatives() *= sinh(x.value());
+    x.value() = cosh(x.value());)
 
 #undef DRAKE_EIGEN_AUTODIFFXD_DECLARE_GLOBAL_UNARY
 
 // We have this specialization here because the Eigen-3.3.3's atan2
 // implementation for AutoDiffScalar does not make a return with properly sized
 // derivatives.
-inline const AutoDiffScalar<VectorXd> atan2(const AutoDiffScalar<VectorXd>& a,
-                                            const AutoDiffScalar<VectorXd>& b) {
+inline AutoDiffScalar<VectorXd> atan2(AutoDiffScalar<VectorXd> a,
+                                      const AutoDiffScalar<VectorXd>& b) {
   const bool has_a_der = a.derivatives().size() > 0;
   const bool has_both_der = has_a_der && (b.derivatives().size() > 0);
   const double squared_hypot = a.value() * a.value() + b.value() * b.value();
-  return MakeAutoDiffScalar(
-      std::atan2(a.value(), b.value()),
-      VectorXd((has_both_der
-                    ? VectorXd(a.derivatives() * b.value() -
-                               a.value() * b.derivatives())
-                    : has_a_der ? VectorXd(a.derivatives() * b.value())
-                                : VectorXd(-a.value() * b.derivatives())) /
-               squared_hypot));
+  if (has_both_der) {
+    a.derivatives() =
+        (a.derivatives() * b.value() - a.value() * b.derivatives()) /
+        squared_hypot;
+  } else if (has_a_der) {
+    a.derivatives() = (a.derivatives() * b.value()) / squared_hypot;
+  } else {
+    a.derivatives() = (-a.value() * b.derivatives()) / squared_hypot;
+  }
+  a.value() = std::atan2(a.value(), b.value());
+  return a;
 }
 
-inline const AutoDiffScalar<VectorXd> pow(const AutoDiffScalar<VectorXd>& a,
-                                          double b) {
+inline AutoDiffScalar<VectorXd> pow(AutoDiffScalar<VectorXd> a, double b) {
   using std::pow;
-  return MakeAutoDiffScalar(pow(a.value(), b),
-                            a.derivatives() * (b * pow(a.value(), b - 1)));
+  a.derivatives() *= (b * pow(a.value(), b - 1));
+  a.value() = pow(a.value(), b);
+  return a;
 }
 
 // We have these implementations here because Eigen's implementations do not
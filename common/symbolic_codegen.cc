@@ -1,7 +1,9 @@
 #include "drake/common/symbolic_codegen.h"
 
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -22,7 +24,86 @@ CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
 }
 
 string CodeGenVisitor::CodeGen(const Expression& e) const {
-  return VisitExpression<string>(this, e);
+  if (temporaries_os_ == nullptr || shared_subexpressions_.count(e) == 0) {
+    return VisitExpression<string>(this, e);
+  }
+  const auto it = temporaries_.find(e);
+  if (it != temporaries_.end()) {
+    return it->second;
+  }
+  // The subexpressions of e are visited (and their temporaries are written)
+  // before the temporary for e itself.
+  const string value = VisitExpression<string>(this, e);
+  string name = "t" + to_string(temporaries_.size());
+  (*temporaries_os_) << "    const double " << name << " = " << value
+                     << ";\n";
+  return temporaries_.emplace(e, std::move(name)).first->second;
+}
+
+namespace {
+// Counts the occurrences of each compound subexpression in @p e, including @p
+// e itself, into @p counts. The subexpressions of a repeated subexpression are
+// only counted once, so that they are not turned into temporaries which are
+// used only in the definition of another temporary.
+void CountSubexpressions(const Expression& e,
+                         std::unordered_map<Expression, int>* counts) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+    case ExpressionKind::NaN:
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::UninterpretedFunction:
+      // Leaves, or expressions which CodeGenVisitor rejects.
+      return;
+    default:
+      break;
+  }
+  if (++(*counts)[e] > 1) {
+    return;
+  }
+  switch (e.get_kind()) {
+    case ExpressionKind::Add:
+      for (const auto& item : get_expr_to_coeff_map_in_addition(e)) {
+        CountSubexpressions(item.first, counts);
+      }
+      return;
+    case ExpressionKind::Mul:
+      for (const auto& item : get_base_to_exponent_map_in_multiplication(e)) {
+        CountSubexpressions(item.first, counts);
+        CountSubexpressions(item.second, counts);
+      }
+      return;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      CountSubexpressions(get_first_argument(e), counts);
+      CountSubexpressions(get_second_argument(e), counts);
+      return;
+    default:
+      CountSubexpressions(get_argument(e), counts);
+      return;
+  }
+}
+}  // namespace
+
+void CodeGenVisitor::EnableCommonSubexpressionElimination(
+    const Expression* const data, const int size,
+    std::ostream* const temporaries) {
+  DRAKE_DEMAND(temporaries != nullptr);
+  std::unordered_map<Expression, int> counts;
+  for (int i = 0; i < size; ++i) {
+    CountSubexpressions(data[i], &counts);
+  }
+  shared_subexpressions_.clear();
+  for (const auto& item : counts) {
+    if (item.second > 1) {
+      shared_subexpressions_.insert(item.first);
+    }
+  }
+  temporaries_.clear();
+  temporaries_os_ = temporaries;
 }
 
 string CodeGenVisitor::VisitVariable(const Expression& e) const {
@@ -34,15 +115,50 @@ string CodeGenVisitor::VisitVariable(const Expression& e) const {
   return "p[" + to_string(it->second) + "]";
 }
 
+namespace {
+// Returns the C expression for the non-finite double @p value, using the
+// INFINITY and NAN macros of <math.h>, since C has no literals for them.
+string CodeGenNonFinite(const double value) {
+  if (std::isnan(value)) {
+    return "NAN";
+  }
+  return value > 0 ? "INFINITY" : "(-INFINITY)";
+}
+
+// Returns the shortest C literal that round-trips to the double @p value.
+// Integral values keep a trailing ".0" so that they remain double literals,
+// e.g., 2.0 is printed as "2.0" (and not as "2") to avoid integer division.
+string CodeGenConstant(const double value) {
+  if (!std::isfinite(value)) {
+    return CodeGenNonFinite(value);
+  }
+  string result = fmt::format("{}", value);
+  if (result.find_first_of(".eE") == string::npos) {
+    result += ".0";
+  }
+  return result;
+}
+
+// Returns the shortest string that round-trips to the double @p value, for use
+// as a coefficient in a sum or product which always includes a
+// floating-point term. For integral values, it omits the trailing ".0".
+string CodeGenCoefficient(const double value) {
+  if (!std::isfinite(value)) {
+    return CodeGenNonFinite(value);
+  }
+  return fmt::format("{}", value);
+}
+}  // namespace
+
 string CodeGenVisitor::VisitConstant(const Expression& e) const {
-  return to_string(get_constant_value(e));
+  return CodeGenConstant(get_constant_value(e));
 }
 
 string CodeGenVisitor::VisitAddition(const Expression& e) const {
   const double c{get_constant_in_addition(e)};
   const auto& expr_to_coeff_map{get_expr_to_coeff_map_in_addition(e)};
   ostringstream oss;
-  oss << "(" << c;
+  oss << "(" << CodeGenCoefficient(c);
   for (const auto& item : expr_to_coeff_map) {
     const Expression& e_i{item.first};
     const double c_i{item.second};
@@ -50,7 +166,7 @@ string CodeGenVisitor::VisitAddition(const Expression& e) const {
     if (c_i == 1.0) {
       oss << CodeGen(e_i);
     } else {
-      oss << "(" << c_i << " * " << CodeGen(e_i) << ")";
+      oss << "(" << CodeGenCoefficient(c_i) << " * " << CodeGen(e_i) << ")";
     }
   }
   oss << ")";
@@ -62,7 +178,7 @@ string CodeGenVisitor::VisitMultiplication(const Expression& e) const {
   const auto& base_to_exponent_map{
       get_base_to_exponent_map_in_multiplication(e)};
   ostringstream oss;
-  oss << "(" << c;
+  oss << "(" << CodeGenCoefficient(c);
   for (const auto& item : base_to_exponent_map) {
     const Expression& e_1{item.first};
     const Expression& e_2{item.second};
@@ -178,12 +294,17 @@ string CodeGenVisitor::VisitUninterpretedFunction(const Expression&) const {
 }
 
 string CodeGen(const string& function_name, const vector<Variable>& parameters,
-               const Expression& e) {
+               const Expression& e, const CodeGenOptions& options) {
   ostringstream oss;
   // Add header for the main function.
   oss << "double " << function_name << "(const double* p) {\n";
   // Codegen the expression.
-  oss << "    return " << CodeGenVisitor{parameters}.CodeGen(e) << ";\n";
+  CodeGenVisitor visitor{parameters};
+  if (options.eliminate_common_subexpressions) {
+    visitor.EnableCommonSubexpressionElimination(&e, 1, &oss);
+  }
+  const string result = visitor.CodeGen(e);
+  oss << "    return " << result << ";\n";
   // Add footer for the main function.
   oss << "}\n";
   // <function_name>_meta_t type.
@@ -195,6 +316,10 @@ string CodeGen(const string& function_name, const vector<Variable>& parameters,
   // <function_name>_meta().
   oss << function_name << "_meta_t " << function_name << "_meta() { return {{"
       << parameters.size() << "}}; }\n";
+  if (options.generate_batch_function) {
+    internal::CodeGenBatch(function_name, parameters.size(), 1,
+                           true /* scalar */, &oss);
+  }
   return oss.str();
 }
 
@@ -202,13 +327,18 @@ namespace internal {
 void CodeGenDenseData(const string& function_name,
                       const vector<Variable>& parameters,
                       const Expression* const data, const int size,
-                      ostream* const os) {
+                      const CodeGenOptions& options, ostream* const os) {
   // Add header for the main function.
   (*os) << "void " << function_name << "(const double* p, double* m) {\n";
-  const CodeGenVisitor visitor{parameters};
+  CodeGenVisitor visitor{parameters};
+  if (options.eliminate_common_subexpressions) {
+    visitor.EnableCommonSubexpressionElimination(data, size, os);
+  }
   for (int i = 0; i < size; ++i) {
+    // Temporaries, if any, are written to os while generating the entry.
+    const string entry = visitor.CodeGen(data[i]);
     (*os) << "    "
-          << "m[" << i << "] = " << visitor.CodeGen(data[i]) << ";\n";
+          << "m[" << i << "] = " << entry << ";\n";
   }
   // Add footer for the main function.
   (*os) << "}\n";
@@ -229,12 +359,29 @@ void CodeGenDenseMeta(const string& function_name, const int parameter_size,
         << parameter_size << "}, {" << rows << ", " << cols << "}}; }\n";
 }
 
+void CodeGenBatch(const string& function_name, const int parameter_size,
+                  const int output_size, const bool scalar, ostream* const os) {
+  (*os) << "void " << function_name
+        << "_batch(int n, const double* p, double* m) {\n"
+        << "    for (int i = 0; i < n; ++i) {\n";
+  if (scalar) {
+    (*os) << fmt::format("        m[i] = {}(p + i * {});\n", function_name,
+                         parameter_size);
+  } else {
+    (*os) << fmt::format("        {}(p + i * {}, m + i * {});\n",
+                         function_name, parameter_size, output_size);
+  }
+  (*os) << "    }\n"
+        << "}\n";
+}
+
 void CodeGenSparseData(const string& function_name,
                        const vector<Variable>& parameters,
                        const int outer_index_size, const int non_zeros,
                        const int* const outer_index_ptr,
                        const int* const inner_index_ptr,
-                       const Expression* const value_ptr, ostream* const os) {
+                       const Expression* const value_ptr,
+                       const CodeGenOptions& options, ostream* const os) {
   // Print header.
   (*os) << fmt::format(
       "void {}(const double* p, int* outer_indices, int* "
@@ -249,10 +396,14 @@ void CodeGenSparseData(const string& function_name,
     (*os) << fmt::format("    inner_indices[{0}] = {1};\n", i,
                          inner_index_ptr[i]);
   }
-  const CodeGenVisitor visitor{parameters};
+  CodeGenVisitor visitor{parameters};
+  if (options.eliminate_common_subexpressions) {
+    visitor.EnableCommonSubexpressionElimination(value_ptr, non_zeros, os);
+  }
   for (int i = 0; i < non_zeros; ++i) {
-    (*os) << fmt::format("    values[{0}] = {1};\n", i,
-                         visitor.CodeGen(value_ptr[i]));
+    // Temporaries, if any, are written to os while generating the value.
+    const string value = visitor.CodeGen(value_ptr[i]);
+    (*os) << fmt::format("    values[{0}] = {1};\n", i, value);
   }
   // Print footer.
   (*os) << "}\n";
@@ -288,12 +439,17 @@ void CodeGenSparseMeta(const string& function_name, const int parameter_size,
 
 std::string CodeGen(
     const std::string& function_name, const std::vector<Variable>& parameters,
-    const Eigen::Ref<const Eigen::SparseMatrix<Expression>>& M) {
+    const Eigen::Ref<const Eigen::SparseMatrix<Expression>>& M,
+    const CodeGenOptions& options) {
   DRAKE_ASSERT(M.isCompressed());
+  if (options.generate_batch_function) {
+    throw runtime_error(
+        "CodeGen does not support batch functions for sparse matrices.");
+  }
   ostringstream oss;
   internal::CodeGenSparseData(function_name, parameters, M.cols() + 1,
                               M.nonZeros(), M.outerIndexPtr(),
-                              M.innerIndexPtr(), M.valuePtr(), &oss);
+                              M.innerIndexPtr(), M.valuePtr(), options, &oss);
   internal::CodeGenSparseMeta(function_name, parameters.size(), M.rows(),
                               M.cols(), M.nonZeros(), M.cols() + 1,
                               M.nonZeros(), &oss);
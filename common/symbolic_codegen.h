@@ -1,8 +1,10 @@
 #pragma once
 
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <Eigen/Core>
@@ -31,6 +33,15 @@ class CodeGenVisitor {
   /// Generates C expression for the expression @p e.
   std::string CodeGen(const Expression& e) const;
 
+  /// Enables common-subexpression elimination for the subsequent calls to
+  /// CodeGen(). Each compound subexpression which occurs more than once in
+  /// the @p size expressions starting at @p data is evaluated only once: the
+  /// first call to CodeGen() which needs it writes `const double t<i> =
+  /// ...;` to @p temporaries, and every use of it is generated as `t<i>`. The
+  /// stream @p temporaries must outlive this visitor.
+  void EnableCommonSubexpressionElimination(const Expression* data, int size,
+                                            std::ostream* temporaries);
+
  private:
   std::string VisitVariable(const Expression& e) const;
   std::string VisitConstant(const Expression& e) const;
@@ -68,6 +79,12 @@ class CodeGenVisitor {
                                                   const Expression&);
 
   IdToIndexMap id_to_idx_map_;
+
+  // The state for common-subexpression elimination. When temporaries_os_ is
+  // nullptr, common-subexpression elimination is disabled.
+  std::unordered_set<Expression> shared_subexpressions_;
+  mutable std::unordered_map<Expression, std::string> temporaries_;
+  std::ostream* temporaries_os_{nullptr};
 };
 
 /// @defgroup codegen Code Generation
@@ -77,9 +94,27 @@ class CodeGenVisitor {
 /// expressions and matrices.
 ///
 /// @note Generated code does not contain `#include` directives while it may use
-/// math functions defined in `<math.h>` such as `sin`, `cos`, `exp`, and `log`.
-/// A user of generated code is responsible to include `<math.h>` if needed to
-/// compile generated code.
+/// math functions defined in `<math.h>` such as `sin`, `cos`, `exp`, and `log`,
+/// and the `INFINITY` and `NAN` macros for non-finite constants. A user of
+/// generated code is responsible to include `<math.h>` if needed to compile
+/// generated code.
+
+/// Options for the `CodeGen` functions.
+struct CodeGenOptions {
+  /// When true, each compound subexpression which occurs more than once in a
+  /// generated function is evaluated only once into a local temporary, `const
+  /// double t<i>`, instead of being generated again at every use. This reduces
+  /// the size of the code generated for matrices whose entries share terms,
+  /// e.g., the Jacobians obtained from a MultibodyPlant<Expression>.
+  bool eliminate_common_subexpressions{false};
+
+  /// When true, also generates `void <function_name>_batch(int n, const
+  /// double* p, double* m)`, which evaluates `<function_name>` for `n`
+  /// parameter vectors stored contiguously in `p` and stores the `n` results
+  /// contiguously in `m`. This is only supported for expressions and dense
+  /// matrices.
+  bool generate_batch_function{false};
+};
 
 /// For a given symbolic expression @p e, generates two C functions,
 /// `<function_name>` and `<function_name>_meta`. The generated
@@ -109,9 +144,12 @@ class CodeGenVisitor {
 ///
 /// Note that in this example `x` and `y` are mapped to `p[0]` and `p[1]`
 /// respectively because we passed `{x, y}` to `Codegen`.
+///
+/// See CodeGenOptions for common-subexpression elimination and batch
+/// evaluation.
 std::string CodeGen(const std::string& function_name,
                     const std::vector<Variable>& parameters,
-                    const Expression& e);
+                    const Expression& e, const CodeGenOptions& options = {});
 
 namespace internal {
 // Generates code for the internal representation of a matrix, @p data, using
@@ -123,7 +161,8 @@ namespace internal {
 // const Eigen::PlainObjectBase<Derived>&).
 void CodeGenDenseData(const std::string& function_name,
                       const std::vector<Variable>& parameters,
-                      const Expression* data, int size, std::ostream* os);
+                      const Expression* data, int size,
+                      const CodeGenOptions& options, std::ostream* os);
 
 // Generates code for the meta information and outputs to the output stream @p
 // os.
@@ -133,6 +172,13 @@ void CodeGenDenseData(const std::string& function_name,
 // const Eigen::PlainObjectBase<Derived>&).
 void CodeGenDenseMeta(const std::string& function_name, int parameter_size,
                       int rows, int cols, std::ostream* os);
+
+// Generates `<function_name>_batch`, which calls `<function_name>` for each of
+// `n` parameter vectors of size @p parameter_size and outputs of size @p
+// output_size, and outputs to the output stream @p os. When @p scalar is true,
+// `<function_name>` returns a double rather than taking an output pointer.
+void CodeGenBatch(const std::string& function_name, int parameter_size,
+                  int output_size, bool scalar, std::ostream* os);
 }  // namespace internal
 
 /// For a given symbolic dense matrix @p M, generates two C functions,
@@ -164,7 +210,7 @@ void CodeGenDenseMeta(const std::string& function_name, int parameter_size,
 ///
 /// @code
 /// void f(const double* p, double* m) {
-///   m[0] = 1.000000;
+///   m[0] = 1.0;
 ///   m[1] = (3 + p[0] + p[1]);
 ///   m[2] = (4 * p[1]);
 ///   m[3] = sin(p[0]);
@@ -189,23 +235,31 @@ void CodeGenDenseMeta(const std::string& function_name, int parameter_size,
 ///
 /// @code
 /// void f(const double* p, double* m) {
-///     m[0] = 1.000000;
+///     m[0] = 1.0;
 ///     m[1] = (4 * p[1]);
 ///     m[2] = (3 + p[0] + p[1]);
 ///     m[3] = sin(p[0]);
 /// }
 /// @endcode
+///
+/// See CodeGenOptions for common-subexpression elimination and batch
+/// evaluation.
 template <typename Derived>
 std::string CodeGen(const std::string& function_name,
                     const std::vector<Variable>& parameters,
-                    const Eigen::PlainObjectBase<Derived>& M) {
+                    const Eigen::PlainObjectBase<Derived>& M,
+                    const CodeGenOptions& options = {}) {
   static_assert(std::is_same<typename Derived::Scalar, Expression>::value,
                 "CodeGen should take a symbolic matrix.");
   std::ostringstream oss;
   internal::CodeGenDenseData(function_name, parameters, M.data(),
-                             M.cols() * M.rows(), &oss);
+                             M.cols() * M.rows(), options, &oss);
   internal::CodeGenDenseMeta(function_name, parameters.size(), M.rows(),
                              M.cols(), &oss);
+  if (options.generate_batch_function) {
+    internal::CodeGenBatch(function_name, parameters.size(),
+                           M.cols() * M.rows(), false /* scalar */, &oss);
+  }
   return oss.str();
 }
 
@@ -239,7 +293,11 @@ std::string CodeGen(const std::string& function_name,
 ///  - `.m.outer_indices`: the length of the outer_indices.
 ///  - `.m.inner_indices`: the length of the inner_indices.
 ///
+/// Common-subexpression elimination is supported via @p options, which apply to
+/// the generated `values`; batch evaluation is not.
+///
 /// @throw std::runtime_error if @p M is not compressed.
+/// @throw std::runtime_error if `options.generate_batch_function` is true.
 // TODO(soonho-tri): Support row-major sparse matrices.
 ///
 /// Please consider the following example which generates code for a 3x6
@@ -326,7 +384,8 @@ std::string CodeGen(const std::string& function_name,
 std::string CodeGen(
     const std::string& function_name, const std::vector<Variable>& parameters,
     const Eigen::Ref<const Eigen::SparseMatrix<Expression, Eigen::ColMajor>>&
-        M);
+        M,
+    const CodeGenOptions& options = {});
 /// @} End of codegen group.
 
 }  // namespace symbolic
@@ -1,5 +1,6 @@
 // NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <ios>
@@ -8,6 +9,7 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include <Eigen/Core>
@@ -72,20 +74,82 @@ shared_ptr<ExpressionCell> Expression::make_cell(const double d) {
 }
 
 Expression::Expression(const Variable& var)
-    : ptr_{make_shared<ExpressionVar>(var)} {}
-Expression::Expression(const double d) : ptr_{make_cell(d)} {}
+    : ptr_{ExpressionInterningScope::Intern(make_shared<ExpressionVar>(var))} {}
+Expression::Expression(const double d)
+    : ptr_{ExpressionInterningScope::Intern(make_cell(d))} {}
 Expression::Expression(std::shared_ptr<ExpressionCell> ptr)
-    : ptr_{std::move(ptr)} {}
+    : ptr_{ExpressionInterningScope::Intern(std::move(ptr))} {}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
   return ptr_->get_kind();
 }
 
-void Expression::HashAppend(DelegatingHasher* hasher) const {
-  using drake::hash_append;
-  hash_append(*hasher, get_kind());
-  ptr_->HashAppendDetail(hasher);
+size_t Expression::GetHash() const {
+  DRAKE_ASSERT(ptr_ != nullptr);
+  return ptr_->GetHash();
+}
+
+namespace {
+// The active ExpressionInterningScope of the current thread, if any.
+thread_local ExpressionInterningScope* g_interning_scope{nullptr};
+
+int64_t NextInterningScopeId() {
+  static std::atomic<int64_t> next_id{1};
+  return next_id++;
+}
+}  // namespace
+
+class ExpressionInterningScope::Impl {
+ public:
+  struct CellHash {
+    size_t operator()(const shared_ptr<ExpressionCell>& cell) const {
+      return cell->GetHash();
+    }
+  };
+  struct CellEqualTo {
+    bool operator()(const shared_ptr<ExpressionCell>& c1,
+                    const shared_ptr<ExpressionCell>& c2) const {
+      return c1->get_kind() == c2->get_kind() && c1->EqualTo(*c2);
+    }
+  };
+  std::unordered_set<shared_ptr<ExpressionCell>, CellHash, CellEqualTo> cells;
+};
+
+ExpressionInterningScope::ExpressionInterningScope()
+    : id_{NextInterningScopeId()},
+      previous_{g_interning_scope},
+      impl_{std::make_unique<Impl>()} {
+  g_interning_scope = this;
+}
+
+ExpressionInterningScope::~ExpressionInterningScope() {
+  DRAKE_DEMAND(g_interning_scope == this);
+  g_interning_scope = previous_;
+}
+
+int ExpressionInterningScope::size() const {
+  return static_cast<int>(impl_->cells.size());
+}
+
+shared_ptr<ExpressionCell> ExpressionInterningScope::Intern(
+    shared_ptr<ExpressionCell> cell) {
+  ExpressionInterningScope* const scope = g_interning_scope;
+  if (scope == nullptr || cell->interning_scope_id_ == scope->id_) {
+    return cell;
+  }
+  auto& cells = scope->impl_->cells;
+  const auto iter = cells.find(cell);
+  if (iter != cells.end()) {
+    return *iter;
+  }
+  // A cell which is already shared (e.g., Expression::Zero()) could be read
+  // concurrently by another thread, so we only tag cells owned by the caller.
+  if (cell.use_count() == 1) {
+    cell->interning_scope_id_ = scope->id_;
+    cells.insert(cell);
+  }
+  return cell;
 }
 
 Expression Expression::Zero() {
@@ -132,6 +196,15 @@ bool Expression::EqualTo(const Expression& e) const {
   if (get_kind() != e.get_kind()) {
     return false;
   }
+  // Two distinct cells interned in the same scope are never structurally
+  // equal.
+  const int64_t scope_id{ptr_->get_interning_scope_id()};
+  if (scope_id != 0 && scope_id == e.ptr_->get_interning_scope_id()) {
+    return false;
+  }
+  if (ptr_->GetHash() != e.ptr_->GetHash()) {
+    return false;
+  }
   // Check structural equality.
   return ptr_->EqualTo(*(e.ptr_));
 }
@@ -543,7 +616,7 @@ Expression& operator/=(Expression& lhs, const Expression& rhs) {
     lhs = Expression::One();
     return lhs;
   }
-  lhs.ptr_ = make_shared<ExpressionDiv>(lhs, rhs);
+  lhs = Expression{make_shared<ExpressionDiv>(lhs, rhs)};
   return lhs;
 }
 
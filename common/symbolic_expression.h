@@ -7,6 +7,7 @@
 
 #include <algorithm>  // for cpplint only
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <map>
@@ -354,11 +355,8 @@ class Expression {
   template <class HashAlgorithm>
   friend void hash_append(HashAlgorithm& hasher,
                           const Expression& item) noexcept {
-    DelegatingHasher delegating_hasher(
-        [&hasher](const void* data, const size_t length) {
-          return hasher(data, length);
-        });
-    item.HashAppend(&delegating_hasher);
+    using drake::hash_append;
+    hash_append(hasher, item.GetHash());
   }
 
   friend Expression operator+(Expression lhs, const Expression& rhs);
@@ -570,7 +568,8 @@ class Expression {
 
   explicit Expression(std::shared_ptr<ExpressionCell> ptr);
 
-  void HashAppend(DelegatingHasher* hasher) const;
+  // Returns the hash of this expression, which is cached in its cell.
+  size_t GetHash() const;
 
   // Note: We use "non-const" ExpressionCell type. This allows us to perform
   // destructive updates on the pointed cell if the cell is not shared with
@@ -581,6 +580,57 @@ class Expression {
   Expression& set_expanded();
 };
 
+/** Enables hash-consing of symbolic expressions on the current thread for the
+lifetime of this object.
+
+While a scope is alive, every expression cell constructed on this thread is
+interned: structurally equal expressions share a single cell. Comparing two
+expressions whose cells are interned in the same scope with Expression::EqualTo
+is a pointer comparison, and hashing any expression is O(1) because the hash is
+cached in its cell. Building large programs that repeatedly construct, compare,
+and hash the same subterms, e.g., SOS programs over symbolic::Polynomial, is
+faster as a result.
+
+The interned cells are kept alive until the scope is destroyed. Scopes can be
+nested, in which case the innermost one is used. A scope must be destroyed on
+the thread which created it, in the reverse order of creation.
+
+@code
+{
+  ExpressionInterningScope interning;
+  MathematicalProgram prog;
+  // Add SOS constraints to prog.
+}
+@endcode
+*/
+class ExpressionInterningScope {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionInterningScope)
+
+  /** Makes this scope the active scope of the current thread. */
+  ExpressionInterningScope();
+
+  /** Restores the previously active scope of the current thread. */
+  ~ExpressionInterningScope();
+
+  /** Returns the number of distinct cells interned in this scope. */
+  int size() const;
+
+ private:
+  friend class Expression;
+  class Impl;
+
+  // Returns the cell which is structurally equal to @p cell in the active
+  // scope of the current thread, if any. Otherwise, interns @p cell (unless it
+  // is already shared) and returns it.
+  static std::shared_ptr<ExpressionCell> Intern(
+      std::shared_ptr<ExpressionCell> cell);
+
+  const int64_t id_;
+  ExpressionInterningScope* const previous_;
+  std::unique_ptr<Impl> impl_;
+};
+
 Expression operator+(Expression lhs, const Expression& rhs);
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
 Expression& operator+=(Expression& lhs, const Expression& rhs);
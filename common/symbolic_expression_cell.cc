@@ -229,6 +229,35 @@ ExpressionCell::ExpressionCell(const ExpressionKind k, const bool is_poly,
                                const bool is_expanded)
     : kind_{k}, is_polynomial_{is_poly}, is_expanded_{is_expanded} {}
 
+ExpressionCell::ExpressionCell(const ExpressionCell& e)
+    : kind_{e.kind_},
+      is_polynomial_{e.is_polynomial_},
+      is_expanded_{e.is_expanded_} {}
+
+ExpressionCell::ExpressionCell(ExpressionCell&& e) : ExpressionCell{e} {}
+
+size_t ExpressionCell::GetHash() const {
+  size_t result = hash_.load(std::memory_order_relaxed);
+  if (result == 0) {
+    using drake::hash_append;
+    DefaultHasher hasher;
+    hash_append(hasher, kind_);
+    DelegatingHasher delegating_hasher(
+        [&hasher](const void* data, const size_t length) {
+          return hasher(data, length);
+        });
+    HashAppendDetail(&delegating_hasher);
+    result = static_cast<size_t>(hasher);
+    // Zero is reserved for "not computed yet".
+    if (result == 0) {
+      result = 1;
+    }
+    // Concurrent callers compute the same value, so a relaxed store suffices.
+    hash_.store(result, std::memory_order_relaxed);
+  }
+  return result;
+}
+
 UnaryExpressionCell::UnaryExpressionCell(const ExpressionKind k,
                                          const Expression& e,
                                          const bool is_poly,
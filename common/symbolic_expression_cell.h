@@ -12,7 +12,9 @@
 #endif
 
 #include <algorithm>  // for cpplint only
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -54,6 +56,17 @@ class ExpressionCell {
    */
   virtual void HashAppendDetail(DelegatingHasher*) const = 0;
 
+  /** Returns the hash of this cell, including get_kind(). It is computed on
+   * the first call and cached afterwards. Because the hash of a subexpression
+   * is also cached in its own cell, computing it only visits the direct
+   * children of this cell.
+   */
+  size_t GetHash() const;
+
+  /** Returns the id of the ExpressionInterningScope which holds this cell as
+   * the unique representative of its structure, or zero if there is none. */
+  int64_t get_interning_scope_id() const { return interning_scope_id_; }
+
   /** Collects variables in expression. */
   virtual Variables GetVariables() const = 0;
 
@@ -70,7 +83,12 @@ class ExpressionCell {
   bool is_expanded() const { return is_expanded_; }
 
   /** Sets this symbolic expression as already expanded. */
-  void set_expanded() { is_expanded_ = true; }
+  void set_expanded() {
+    // Cells can be shared (e.g., interned), so we avoid a redundant write.
+    if (!is_expanded_) {
+      is_expanded_ = true;
+    }
+  }
 
   /** Evaluates under a given environment (by default, an empty environment).
    *  @throws std::runtime_error if NaN is detected during evaluation.
@@ -102,9 +120,10 @@ class ExpressionCell {
   /** Default constructor. */
   ExpressionCell() = default;
   /** Move-constructs an ExpressionCell from an rvalue. */
-  ExpressionCell(ExpressionCell&& e) = default;
-  /** Copy-constructs an ExpressionCell from an lvalue. */
-  ExpressionCell(const ExpressionCell& e) = default;
+  ExpressionCell(ExpressionCell&& e);
+  /** Copy-constructs an ExpressionCell from an lvalue. The cached hash and the
+   * interning scope id are not copied. */
+  ExpressionCell(const ExpressionCell& e);
   /** Move-assigns (DELETED). */
   ExpressionCell& operator=(ExpressionCell&& e) = delete;
   /** Copy-assigns (DELETED). */
@@ -116,9 +135,15 @@ class ExpressionCell {
   virtual ~ExpressionCell() = default;
 
  private:
+  friend class ExpressionInterningScope;
+
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
   bool is_expanded_{false};
+  // The cached result of GetHash(), or zero if it is not computed yet.
+  mutable std::atomic<size_t> hash_{0};
+  // See get_interning_scope_id().
+  int64_t interning_scope_id_{0};
 };
 
 /** Represents the base class for unary expressions.  */
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace test {
+namespace {
+
+using Eigen::VectorXd;
+
+// Provide some autodiff variables that don't expire at scope end for test
+// cases.
+class AutoDiffXdHeapTest : public ::testing::Test {
+ protected:
+  AutoDiffXd x_{0.4, Eigen::VectorXd::Ones(3)};
+  AutoDiffXd y_{0.3, Eigen::VectorXd::Ones(3)};
+};
+
+// @note The test cases use a sum in argument passing to ensure that a
+// temporary is created, so that the tests exercise the rvalue overloads.
+
+TEST_F(AutoDiffXdHeapTest, Move) {
+  AutoDiffXd z{x_};
+  {
+    LimitMalloc guard;
+    AutoDiffXd w{std::move(z)};
+    EXPECT_EQ(w.derivatives().size(), 3);
+    EXPECT_EQ(z.derivatives().size(), 0);
+    z = std::move(w);
+    EXPECT_EQ(z.derivatives().size(), 3);
+  }
+}
+
+TEST_F(AutoDiffXdHeapTest, CompoundAssignment) {
+  AutoDiffXd z{x_};
+  {
+    LimitMalloc guard;
+    z += y_;
+    z -= y_;
+    z *= y_;
+    z /= y_;
+    z += 1.0;
+    z -= 1.0;
+    z *= 2.0;
+    z /= 2.0;
+    // Aliased operands must also work in place.
+    z *= z;
+    z /= z;
+  }
+  EXPECT_DOUBLE_EQ(z.value(), 1.0);
+  EXPECT_TRUE(CompareMatrices(z.derivatives(), VectorXd::Zero(3), 1e-14));
+}
+
+TEST_F(AutoDiffXdHeapTest, Arithmetic) {
+  // Each expression below is allowed exactly one allocation, for the first
+  // temporary; all subsequent operations reuse its storage.
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = (x_ * y_ + x_) * 3.0 / 2.0 - y_;
+    unused(z);
+  }
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = 1.0 - (2.0 / (x_ + y_)) * 3.0 + 4.0;
+    unused(z);
+  }
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = -(x_ / y_) / x_ - x_;
+    unused(z);
+  }
+}
+
+TEST_F(AutoDiffXdHeapTest, Functions) {
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = cos(sin(exp(log(sqrt(abs2(abs(tan(x_ + y_))))))));
+    unused(z);
+  }
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = cosh(sinh(tanh(atan(acos(asin(pow(x_ + y_, 2.0) - 0.5))))));
+    unused(z);
+  }
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    auto z = atan2(x_ + y_, y_);
+    unused(z);
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace drake
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <vector>
 
@@ -81,6 +82,86 @@ TEST_F(SymbolicCodeGenTest, Constant) {
             MakeScalarFunctionCode("f", 0, "3.141592"));
 }
 
+TEST_F(SymbolicCodeGenTest, ConstantPrecision) {
+  // Constants are printed with enough digits to round-trip.
+  EXPECT_EQ(CodeGen("f", {}, 0.100000000001),
+            MakeScalarFunctionCode("f", 0, "0.100000000001"));
+  EXPECT_EQ(CodeGen("f", {}, 1e-9), MakeScalarFunctionCode("f", 0, "1e-09"));
+  EXPECT_EQ(CodeGen("f", {x_}, 0.1234567891 * x_),
+            MakeScalarFunctionCode("f", 1, "(0.1234567891 * p[0])"));
+  EXPECT_EQ(CodeGen("f", {x_}, 0.1234567891 + x_),
+            MakeScalarFunctionCode("f", 1, "(0.1234567891 + p[0])"));
+}
+
+TEST_F(SymbolicCodeGenTest, NonFiniteConstant) {
+  // C has no literals for infinity, so the <math.h> macros are used.
+  const double inf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(CodeGen("f", {}, inf), MakeScalarFunctionCode("f", 0, "INFINITY"));
+  EXPECT_EQ(CodeGen("f", {}, -inf),
+            MakeScalarFunctionCode("f", 0, "(-INFINITY)"));
+  EXPECT_EQ(CodeGen("f", {x_}, inf * x_),
+            MakeScalarFunctionCode("f", 1, "(INFINITY * p[0])"));
+  EXPECT_EQ(CodeGen("f", {x_}, x_ - inf),
+            MakeScalarFunctionCode("f", 1, "((-INFINITY) + p[0])"));
+}
+
+TEST_F(SymbolicCodeGenTest, CommonSubexpressionElimination) {
+  CodeGenOptions options;
+  options.eliminate_common_subexpressions = true;
+  const Expression e{(x_ + y_) * sin(x_ + y_)};
+  EXPECT_EQ(CodeGen("f", {x_, y_}, e, options),
+            "double f(const double* p) {\n"
+            "    const double t0 = (0 + p[0] + p[1]);\n"
+            "    return (1 * t0 * sin(t0));\n"
+            "}\n"
+            "typedef struct {\n"
+            "    /* p: input, vector */\n"
+            "    struct { int size; } p;\n"
+            "} f_meta_t;\n"
+            "f_meta_t f_meta() { return {{2}}; }\n");
+
+  // Subexpressions shared across the entries of a matrix are evaluated once,
+  // before the first entry which uses them.
+  Eigen::Matrix<Expression, 3, 1> M;
+  M << x_, sin(x_ + y_), cos(x_ + y_) * z_;
+  const string code = CodeGen("f", {x_, y_, z_}, M, options);
+  EXPECT_EQ(code.substr(0, code.find("typedef")),
+            "void f(const double* p, double* m) {\n"
+            "    m[0] = p[0];\n"
+            "    const double t0 = (0 + p[0] + p[1]);\n"
+            "    m[1] = sin(t0);\n"
+            "    m[2] = (1 * p[2] * cos(t0));\n"
+            "}\n");
+}
+
+TEST_F(SymbolicCodeGenTest, BatchFunction) {
+  CodeGenOptions options;
+  options.generate_batch_function = true;
+  EXPECT_EQ(CodeGen("f", {x_, y_}, x_ + y_, options),
+            MakeScalarFunctionCode("f", 2, "(0 + p[0] + p[1])") +
+                "void f_batch(int n, const double* p, double* m) {\n"
+                "    for (int i = 0; i < n; ++i) {\n"
+                "        m[i] = f(p + i * 2);\n"
+                "    }\n"
+                "}\n");
+
+  Eigen::Matrix<Expression, 2, 2> M;
+  M << x_, y_, y_, x_;
+  const string code = CodeGen("f", {x_, y_}, M, options);
+  EXPECT_NE(code.find("void f_batch(int n, const double* p, double* m) {\n"
+                      "    for (int i = 0; i < n; ++i) {\n"
+                      "        f(p + i * 2, m + i * 4);\n"
+                      "    }\n"
+                      "}\n"),
+            string::npos);
+
+  // Batch functions are not supported for sparse matrices.
+  Eigen::SparseMatrix<Expression> S(2, 2);
+  S.insert(0, 0) = x_;
+  S.makeCompressed();
+  EXPECT_THROW(CodeGen("f", {x_, y_}, S, options), std::runtime_error);
+}
+
 TEST_F(SymbolicCodeGenTest, Addition) {
   EXPECT_EQ(CodeGen("f", {x_, y_}, 2.0 + 3.0 * x_ - 7.0 * y_),
             MakeScalarFunctionCode("f", 2, "(2 + (3 * p[0]) + (-7 * p[1]))"));
@@ -89,7 +170,7 @@ TEST_F(SymbolicCodeGenTest, Addition) {
 TEST_F(SymbolicCodeGenTest, Multiplication) {
   EXPECT_EQ(CodeGen("f", {x_, y_}, 2.0 * 3.0 * x_ * x_ * -7.0 * y_ * y_ * y_),
             MakeScalarFunctionCode(
-                "f", 2, "(-42 * pow(p[0], 2.000000) * pow(p[1], 3.000000))"));
+                "f", 2, "(-42 * pow(p[0], 2.0) * pow(p[1], 3.0))"));
 }
 
 TEST_F(SymbolicCodeGenTest, Pow) {
@@ -215,7 +296,7 @@ TEST_F(SymbolicCodeGenTest, DenseMatrixRowMajor) {
   expected.push_back("(3 + (2 * p[0]) + p[1])");
 
   M(0, 1) = 2 * pow(x_, 2) * pow(y_, 3);
-  expected.push_back("(2 * pow(p[0], 2.000000) * pow(p[1], 3.000000))");
+  expected.push_back("(2 * pow(p[0], 2.0) * pow(p[1], 3.0))");
 
   M(1, 0) = 5 + sin(x_) + cos(z_);
   expected.push_back("(5 + sin(p[0]) + cos(p[2]))");
@@ -249,7 +330,7 @@ TEST_F(SymbolicCodeGenTest, DenseMatrixColMajor) {
   expected.push_back("((2 + p[0]) / (-2 + p[1]))");
 
   M(0, 1) = 2 * pow(x_, 2) * pow(y_, 3);
-  expected.push_back("(2 * pow(p[0], 2.000000) * pow(p[1], 3.000000))");
+  expected.push_back("(2 * pow(p[0], 2.0) * pow(p[1], 3.0))");
 
   M(1, 1) = 3 * min(x_, w_);
   expected.push_back("(3 * fmin(p[0], p[3]))");
@@ -268,7 +349,7 @@ TEST_F(SymbolicCodeGenTest, DenseMatrixExampleInDocumentation) {
   vector<string> expected;
 
   M(0, 0) = 1.0;
-  expected.push_back("1.000000");
+  expected.push_back("1.0");
 
   M(1, 0) = 3 + x_ + y_;
   expected.push_back("(3 + p[0] + p[1])");
@@ -912,6 +912,54 @@ TEST_F(SymbolicExpressionTest, HashUnary) {
   EXPECT_EQ(hash_set.size(), exprs.size());
 }
 
+TEST_F(SymbolicExpressionTest, InterningScope) {
+  // Without an active scope, structurally equal expressions built separately
+  // have distinct cells (and hence distinct arguments).
+  const Expression e1{sin(x_ + y_)};
+  const Expression e2{sin(x_ + y_)};
+  EXPECT_PRED2(ExprEqual, e1, e2);
+  EXPECT_NE(&get_argument(e1), &get_argument(e2));
+
+  {
+    ExpressionInterningScope scope;
+    const Expression e3{sin(x_ + y_)};
+    const Expression e4{sin(x_ + y_)};
+    const Expression e5{cos(x_ + y_)};
+    // e3 and e4 share a cell.
+    EXPECT_EQ(&get_argument(e3), &get_argument(e4));
+    // So do divisions, which are built in place by operator/=.
+    const Expression d1{x_ / y_};
+    const Expression d2{x_ / y_};
+    EXPECT_EQ(&get_first_argument(d1), &get_first_argument(d2));
+    EXPECT_PRED2(ExprEqual, e3, e4);
+    EXPECT_PRED2(ExprNotEqual, e3, e5);
+    EXPECT_EQ(get_std_hash(e3), get_std_hash(e4));
+    // Interned expressions are still equal to the ones built outside of the
+    // scope.
+    EXPECT_PRED2(ExprEqual, e1, e3);
+    EXPECT_EQ(get_std_hash(e1), get_std_hash(e3));
+    const int size = scope.size();
+    EXPECT_GT(size, 0);
+
+    {
+      // Nested scopes intern independently.
+      ExpressionInterningScope nested;
+      const Expression e6{sin(x_ + y_)};
+      EXPECT_NE(&get_argument(e3), &get_argument(e6));
+      EXPECT_PRED2(ExprEqual, e3, e6);
+      EXPECT_GT(nested.size(), 0);
+    }
+
+    // Building an existing expression again does not intern new cells.
+    const Expression e7{cos(x_ + y_)};
+    EXPECT_EQ(&get_argument(e5), &get_argument(e7));
+    EXPECT_EQ(scope.size(), size);
+  }
+
+  const Expression e8{sin(x_ + y_)};
+  EXPECT_NE(&get_argument(e1), &get_argument(e8));
+}
+
 // Confirm that numeric_limits is appropriately specialized for Expression.
 // We'll just spot-test a few values, since our implementation is trivially
 // forwarding to numeric_limits<double>.
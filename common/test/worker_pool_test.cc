@@ -0,0 +1,73 @@
+#include "drake/common/worker_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(WorkerPoolTest, ParallelFor) {
+  for (int num_threads : {1, 2, 4}) {
+    WorkerPool pool(num_threads);
+    EXPECT_EQ(pool.num_threads(), num_threads);
+    // The same pool runs several loops, of any size.
+    for (int num_tasks : {0, 1, 3, 100}) {
+      std::vector<int> counts(num_tasks, 0);
+      pool.ParallelFor(num_tasks, [&counts](int i) { ++counts[i]; });
+      EXPECT_EQ(counts, std::vector<int>(num_tasks, 1));
+    }
+  }
+}
+
+GTEST_TEST(WorkerPoolTest, CallingThreadTask) {
+  WorkerPool pool(3);
+  const std::thread::id calling_thread = std::this_thread::get_id();
+  std::thread::id task_thread;
+  std::atomic<int> num_tasks_run{0};
+  pool.ParallelFor(
+      50, [&num_tasks_run](int) { ++num_tasks_run; },
+      [&task_thread]() { task_thread = std::this_thread::get_id(); });
+  EXPECT_EQ(task_thread, calling_thread);
+  EXPECT_EQ(num_tasks_run, 50);
+}
+
+GTEST_TEST(WorkerPoolTest, Exceptions) {
+  for (int num_threads : {1, 3}) {
+    WorkerPool pool(num_threads);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        pool.ParallelFor(20,
+                         [](int i) {
+                           if (i == 7) {
+                             throw std::runtime_error("task 7");
+                           }
+                         }),
+        std::runtime_error, "task 7");
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        pool.ParallelFor(
+            20, [](int) {},
+            []() { throw std::runtime_error("calling thread"); }),
+        std::runtime_error, "calling thread");
+    // The pool remains usable after an exception.
+    std::atomic<int> num_tasks_run{0};
+    pool.ParallelFor(20, [&num_tasks_run](int) { ++num_tasks_run; });
+    EXPECT_EQ(num_tasks_run, 20);
+  }
+}
+
+GTEST_TEST(WorkerPoolTest, FreeParallelFor) {
+  std::vector<int> counts(100, 0);
+  ParallelFor(4, 100, [&counts](int i) { ++counts[i]; });
+  EXPECT_EQ(counts, std::vector<int>(100, 1));
+  ParallelFor(4, 0, [](int) { FAIL(); });
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
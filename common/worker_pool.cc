@@ -0,0 +1,128 @@
+#include "drake/common/worker_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace internal {
+
+WorkerPool::WorkerPool(int num_threads) {
+  DRAKE_DEMAND(num_threads >= 1);
+  workers_.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void WorkerPool::ParallelFor(
+    int num_tasks, const std::function<void(int)>& task,
+    const std::function<void()>& calling_thread_task) {
+  if (workers_.empty() || num_tasks == 0) {
+    if (calling_thread_task) {
+      calling_thread_task();
+    }
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_tasks_ = num_tasks;
+    next_task_ = 0;
+    failed_ = false;
+    first_exception_ = nullptr;
+    num_busy_workers_ = static_cast<int>(workers_.size());
+    ++generation_;
+  }
+  start_.notify_all();
+  if (calling_thread_task) {
+    try {
+      calling_thread_task();
+    } catch (...) {
+      SaveCurrentException();
+    }
+  }
+  RunTasks();
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return num_busy_workers_ == 0; });
+    task_ = nullptr;
+    exception = std::move(first_exception_);
+    first_exception_ = nullptr;
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void WorkerPool::WorkerLoop() {
+  int generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [this, generation]() {
+        return stop_ || generation_ != generation;
+      });
+      if (stop_) {
+        return;
+      }
+      generation = generation_;
+    }
+    RunTasks();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--num_busy_workers_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+}
+
+void WorkerPool::RunTasks() {
+  while (!failed_) {
+    const int i = next_task_++;
+    if (i >= num_tasks_) {
+      break;
+    }
+    try {
+      (*task_)(i);
+    } catch (...) {
+      SaveCurrentException();
+    }
+  }
+}
+
+void WorkerPool::SaveCurrentException() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!failed_) {
+    first_exception_ = std::current_exception();
+    failed_ = true;
+  }
+}
+
+void ParallelFor(int num_threads, int num_tasks,
+                 const std::function<void(int)>& task) {
+  DRAKE_DEMAND(num_threads >= 1);
+  WorkerPool pool(std::max(std::min(num_threads, num_tasks), 1));
+  pool.ParallelFor(num_tasks, task);
+}
+
+}  // namespace internal
+}  // namespace drake
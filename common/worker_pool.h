@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+/* A fixed set of worker threads which, together with the calling thread, run
+the iterations of parallel loops. The workers sleep between the loops, so a
+pool owned by a long-lived object (e.g., a solve or a renderer) saves creating
+and joining threads on every loop.
+
+A pool runs one loop at a time: ParallelFor() must not be called concurrently,
+nor from within one of its own tasks. */
+class WorkerPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(WorkerPool)
+
+  /* Creates a pool which runs loops on up to `num_threads` threads, including
+  the calling thread, i.e., with num_threads - 1 workers.
+  @pre num_threads >= 1. */
+  explicit WorkerPool(int num_threads);
+
+  ~WorkerPool();
+
+  /* The maximal number of threads running a loop, including the calling
+  thread. */
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  /* Calls task(i) for each i in [0, num_tasks). The workers and the calling
+  thread claim the tasks one at a time, which balances tasks of uneven cost.
+  If `calling_thread_task` is given, the calling thread first runs it while the
+  workers already run the tasks. Returns once all the tasks are done. If any
+  task throws, the unclaimed tasks are skipped, and the first exception is
+  rethrown on the calling thread. */
+  void ParallelFor(int num_tasks, const std::function<void(int)>& task,
+                   const std::function<void()>& calling_thread_task = nullptr);
+
+ private:
+  void WorkerLoop();
+  void RunTasks();
+  void SaveCurrentException();
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  // The members below are guarded by mutex_, except for next_task_ and
+  // failed_, and for task_ and num_tasks_ which are only written while no
+  // worker is running a loop.
+  bool stop_{false};
+  int generation_{0};
+  int num_busy_workers_{0};
+  const std::function<void(int)>* task_{nullptr};
+  int num_tasks_{0};
+  std::atomic<int> next_task_{0};
+  std::atomic<bool> failed_{false};
+  std::exception_ptr first_exception_;
+};
+
+/* Calls task(i) for each i in [0, num_tasks) like WorkerPool::ParallelFor(),
+on up to `num_threads` threads (including the calling thread) which are
+created for this call only; loops which run repeatedly should share a
+WorkerPool instead.
+@pre num_threads >= 1. */
+void ParallelFor(int num_threads, int num_tasks,
+                 const std::function<void(int)>& task);
+
+}  // namespace internal
+}  // namespace drake
@@ -5,6 +5,7 @@
 #include <gflags/gflags.h>
 
 #include "drake/common/filesystem.h"
+#include "drake/geometry/render/render_engine_cpu_factory.h"
 #include "drake/geometry/render/render_engine_ospray_factory.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/systems/sensors/image_writer.h"
@@ -23,7 +24,9 @@ namespace render {
  If there are multiple spheres, they are positioned in a regular grid positioned
  at a uniform height above the ground plane. Increasing the number of spheres
  provides an approximate measure of how the renderer performs with increased
- scene complexity.
+ scene complexity. The grid has four columns, so with hundreds of spheres most
+ of them lie outside of the cameras' view, as in a large environment observed
+ by a camera looking at a small workspace.
 
  If there are multiple cameras, they are all at the same position, looking in
  the same direction, with the same intrinsic properties. In other words, each
@@ -88,6 +91,8 @@ RenderEngineBenchmark/OsprayPathColor/1/10/640/480                 351 ms
  - __samples_per_pixel__: The number of illumination samples per pixel when path
    tracing with RenderEngineOspray. Higher numbers introduce higher quality at
    increased cost. Defaults to 1.
+ - __cpu_threads__: The number of threads RenderEngineCpu renders with. Defaults
+   to 0, which uses all of the hardware threads.
 
  For example:
  ```
@@ -107,6 +112,9 @@ RenderEngineBenchmark/OsprayPathColor/1/10/640/480                 351 ms
      - __VtkColor__: Renders the color image from RenderEngineVtk.
      - __VtkDepth__: Renders the depth image from RenderEngineVtk.
      - __VtkLabel__: Renders the label image from RenderEngineVtk.
+     - __VtkColorNoCulling__, __VtkDepthNoCulling__: Render the color and depth
+       images from RenderEngineVtk without frustum culling (see
+       RenderEngineVtkParams::frustum_culling).
      - __OsprayRayColor__: Renders the color image from RenderEngineOspray with
        ray-traced shadows.
      - __OsprayRayColorShadowsOff__: Renders the color image from
@@ -115,6 +123,8 @@ RenderEngineBenchmark/OsprayPathColor/1/10/640/480                 351 ms
      - __OsprayPathColor__: Renders the color image from RenderEngineOspray with
        path-traced global illumination (with only a single sample per pixel by
        default, unless configured using --samples_per_pixel).
+     - __CpuDepth__: Renders the depth image from RenderEngineCpu.
+     - __CpuLabel__: Renders the label image from RenderEngineCpu.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
      they each render the same image.
@@ -137,8 +147,15 @@ RenderEngineBenchmark/OsprayPathColor/1/10/640/480                 351 ms
        for label.
      - RenderEngineVtk also increased a factor of 10X when path-tracing the
        scene when we increased the number of cameras by a factor of 10X.
+   - The CpuDepth and CpuLabel cases render the same images as VtkDepth and
+     VtkLabel, so they compare the CPU rasterizer against the OpenGL pipeline
+     on the same machine. Unlike RenderEngineVtk, the cost of RenderEngineCpu
+     grows with the number of triangles in view.
    - The number of objects in the scene has an apparently negligible impact on
      RenderEngineVtk, but a noticeable impact on RenderEngineOspray.
+   - Comparing the VtkColor and VtkColorNoCulling cases with hundreds of
+     spheres measures what RenderEngineVtk saves by culling the geometries
+     outside of the view frustum.
  */
 
 // Friend class for accessing RenderEngine's protected/private functionality.
@@ -171,6 +188,9 @@ DEFINE_string(save_image_path, "",
 DEFINE_bool(show_window, false, "Whether to display the rendered images");
 DEFINE_int32(samples_per_pixel, 1,
              "Number of illumination samples per pixel when path tracing");
+DEFINE_int32(cpu_threads, 0,
+             "Number of threads used by RenderEngineCpu; 0 uses all of the "
+             "hardware threads");
 
 // Default sphere array sizes.
 const int kCols = 4;
@@ -197,10 +217,14 @@ class RenderEngineBenchmark : public benchmark::Fixture {
    @param camera_count Number of cameras to include in the render.
    @param width Width of the render image.
    @param height Height of the render image.
+   @param frustum_culling Whether the engine culls the geometries outside of
+                          the view frustum.
    */
   void SetupVtkRender(const int sphere_count, const int camera_count,
-                      const int width, const int height) {
+                      const int width, const int height,
+                      bool frustum_culling = true) {
     RenderEngineVtkParams params{{}, {}, bg_rgb_};
+    params.frustum_culling = frustum_culling;
     renderer_ = MakeRenderEngineVtk(params);
     SetupScene(sphere_count, camera_count, width, height);
   }
@@ -223,6 +247,22 @@ class RenderEngineBenchmark : public benchmark::Fixture {
     SetupScene(sphere_count, camera_count, width, height);
   }
 
+  /** Set up the scene using the CPU render engine.
+   @param sphere_count Number of spheres to include in the render.
+   @param camera_count Number of cameras to include in the render.
+   @param width Width of the render image.
+   @param height Height of the render image.
+   */
+  void SetupCpuRender(const int sphere_count, const int camera_count,
+                      const int width, const int height) {
+    RenderEngineCpuParams params;
+    if (FLAGS_cpu_threads > 0) {
+      params.num_threads = FLAGS_cpu_threads;
+    }
+    renderer_ = MakeRenderEngineCpu(params);
+    SetupScene(sphere_count, camera_count, width, height);
+  }
+
   /** Parse arguments from the benchmark state.
    @return A tuple representing the sphere count, camera count, width, and
            height.  */
@@ -347,11 +387,38 @@ BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkColor)
     ->Args({1, 1, 640, 480})     // 1 sphere, 1 camera, 640 width, 480 height.
     ->Args({4, 1, 640, 480})     // 4 spheres, 1 camera, 640 width, 480 height.
     ->Args({8, 1, 640, 480})     // 8 spheres, 1 camera, 640 width, 480 height.
+    ->Args({100, 1, 640, 480})   // 100 spheres, 1 camera, 640 width, 480 height
+    ->Args({500, 1, 640, 480})   // 500 spheres, 1 camera, 640 width, 480 height
     ->Args({1, 10, 640, 480})    // 1 sphere, 10 cameras, 640 width, 480 height.
     ->Args({1, 1, 320, 240})     // 1 sphere, 1 camera, 320 width, 240 height.
     ->Args({1, 1, 1280, 960})    // 1 sphere, 1 camera, 1280 width, 960 height.
     ->Args({1, 1, 2560, 1920});  // 1 sphere, 1 camera, 2560 width, 1920 height.
 
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkColorNoCulling)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupVtkRender(sphere_count, camera_count, width, height,
+                 false /* frustum_culling */);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      renderer_->RenderColorImage(cameras_[i], FLAGS_show_window,
+                                  &color_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name =
+        image_path_name("VtkColorNoCulling", state, "png");
+    SaveToPng(color_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkColorNoCulling)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({8, 1, 640, 480})     // 8 spheres, 1 camera, 640 width, 480 height.
+    ->Args({100, 1, 640, 480})   // 100 spheres, 1 camera, 640 width, 480 height
+    ->Args({500, 1, 640, 480});  // 500 spheres, 1 camera, 640 width, 480 height
+
 BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkDepth)
 // NOLINTNEXTLINE(runtime/references)
 (benchmark::State& state) {
@@ -370,8 +437,31 @@ BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkDepth)
 }
 BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkDepth)
     ->Unit(benchmark::kMillisecond)
-    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
-    ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
+    ->Args({1, 1, 640, 480})     // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({500, 1, 640, 480})   // 500 spheres, 1 camera, 640 width, 480 height
+    ->Args({1, 10, 640, 480});   // 1 sphere, 10 cameras, 640 width, 480 height.
+
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkDepthNoCulling)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupVtkRender(sphere_count, camera_count, width, height,
+                 false /* frustum_culling */);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      renderer_->RenderDepthImage(cameras_[i], &depth_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name =
+        image_path_name("VtkDepthNoCulling", state, "tiff");
+    SaveToTiff(depth_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkDepthNoCulling)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({500, 1, 640, 480});  // 500 spheres, 1 camera, 640 width, 480 height
 
 BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkLabel)
 // NOLINTNEXTLINE(runtime/references)
@@ -392,8 +482,9 @@ BENCHMARK_DEFINE_F(RenderEngineBenchmark, VtkLabel)
 }
 BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkLabel)
     ->Unit(benchmark::kMillisecond)
-    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
-    ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
+    ->Args({1, 1, 640, 480})     // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({500, 1, 640, 480})   // 500 spheres, 1 camera, 640 width, 480 height
+    ->Args({1, 10, 640, 480});   // 1 sphere, 10 cameras, 640 width, 480 height.
 
 BENCHMARK_DEFINE_F(RenderEngineBenchmark, OsprayRayColor)
 // NOLINTNEXTLINE(runtime/references)
@@ -479,6 +570,52 @@ BENCHMARK_REGISTER_F(RenderEngineBenchmark, OsprayPathColor)
     ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
     ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
 
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, CpuDepth)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupCpuRender(sphere_count, camera_count, width, height);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      renderer_->RenderDepthImage(cameras_[i], &depth_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name = image_path_name("CpuDepth", state, "tiff");
+    SaveToTiff(depth_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, CpuDepth)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({8, 1, 640, 480})    // 8 spheres, 1 camera, 640 width, 480 height.
+    ->Args({1, 10, 640, 480})   // 1 sphere, 10 cameras, 640 width, 480 height.
+    ->Args({1, 1, 320, 240})    // 1 sphere, 1 camera, 320 width, 240 height.
+    ->Args({1, 1, 1280, 960});  // 1 sphere, 1 camera, 1280 width, 960 height.
+
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, CpuLabel)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupCpuRender(sphere_count, camera_count, width, height);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      renderer_->RenderLabelImage(cameras_[i], FLAGS_show_window,
+                                  &label_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name = image_path_name("CpuLabel", state, "png");
+    SaveToPng(label_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, CpuLabel)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
+
 void Cleanup() {
   if (!RenderEngineBenchmark::saved_image_paths.empty()) {
     std::cout << "Saved rendered images to:" << std::endl;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -968,6 +969,33 @@ void GeometryState<T>::RenderLabelImage(const render::CameraProperties& camera,
   engine.RenderLabelImage(camera, show_window, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(
+    const render::RenderImageBatch& batch) const {
+  // Each render engine renders the requests that name it as a single batch.
+  std::map<std::string, render::RenderImageBatch> batches;
+  for (const auto& request : batch.color) {
+    batches[request.camera.renderer_name].color.push_back(request);
+  }
+  for (const auto& request : batch.depth) {
+    batches[request.camera.renderer_name].depth.push_back(request);
+  }
+  for (const auto& request : batch.label) {
+    batches[request.camera.renderer_name].label.push_back(request);
+  }
+  // Confirm that all of the engines exist before rendering anything.
+  for (const auto& name_batch_pair : batches) {
+    GetRenderEngineOrThrow(name_batch_pair.first);
+  }
+  for (const auto& name_batch_pair : batches) {
+    const render::RenderEngine& engine =
+        GetRenderEngineOrThrow(name_batch_pair.first);
+    // See note in RenderColorImage() about this const cast.
+    const_cast<render::RenderEngine&>(engine).RenderImages(
+        name_batch_pair.second);
+  }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
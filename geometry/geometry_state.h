@@ -510,6 +510,10 @@ class GeometryState {
                         bool show_window,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(const render::RenderImageBatch& batch) const;
+
   //@}
 
   /** @name Scalar conversion */
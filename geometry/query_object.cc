@@ -197,6 +197,15 @@ void QueryObject<T>::RenderLabelImage(const CameraProperties& camera,
                                 label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(const render::RenderImageBatch& batch) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.RenderImages(batch);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
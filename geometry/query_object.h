@@ -510,6 +510,18 @@ class QueryObject {
                         bool show_window,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Renders all of the images requested in `batch`. Each request names the
+   renderer to use (in its camera properties) and poses its camera in the world
+   frame. The requests for the same renderer are rendered together with
+   render::RenderEngine::RenderImages(), which lets many cameras (e.g., those
+   of several sensors) share the work of a single render pass.
+
+   @param batch  The requested images; the images are written to the pointers
+                 stored in the requests.
+   @throws std::exception if any request names a renderer that doesn't exist
+                          or has a null image.  */
+  void RenderImages(const render::RenderImageBatch& batch) const;
+
 
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
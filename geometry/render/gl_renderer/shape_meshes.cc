@@ -79,9 +79,9 @@ pair<VertexBuffer, IndexBuffer> LoadMeshFromObj(std::istream* input_stream) {
          ++sub_index) {
       const int i = sub_index * 3;
       indices.block<1, 3>(tri_index, 0)
-          << static_cast<GLuint>(raw_mesh.indices[i].vertex_index),
-          static_cast<GLuint>(raw_mesh.indices[i + 1].vertex_index),
-          static_cast<GLuint>(raw_mesh.indices[i + 2].vertex_index);
+          << static_cast<unsigned int>(raw_mesh.indices[i].vertex_index),
+          static_cast<unsigned int>(raw_mesh.indices[i + 1].vertex_index),
+          static_cast<unsigned int>(raw_mesh.indices[i + 2].vertex_index);
       ++tri_index;
     }
   }
@@ -126,10 +126,10 @@ namespace {
  */
 pair<VertexBuffer, IndexBuffer> MakeRevoluteShape(
     int rotate_sample_count, int curve_sample_count,
-    const std::function<GLfloat(int i)>& calc_radius_i,
-    const std::function<GLfloat(int i)>& calc_z_i) {
-  const GLfloat delta_theta =
-      static_cast<GLfloat>(2 * M_PI / rotate_sample_count);
+    const std::function<float(int i)>& calc_radius_i,
+    const std::function<float(int i)>& calc_z_i) {
+  const float delta_theta =
+      static_cast<float>(2 * M_PI / rotate_sample_count);
 
   /* We have R revolute samples and C curve samples.
 
@@ -164,8 +164,8 @@ pair<VertexBuffer, IndexBuffer> MakeRevoluteShape(
   // Index of the ring whose vertices are being added, the ring's position on
   // the z axis, and its radius.
   int ring_i = 1;
-  GLfloat z_i = calc_z_i(ring_i);
-  GLfloat r_i = calc_radius_i(ring_i);
+  float z_i = calc_z_i(ring_i);
+  float r_i = calc_radius_i(ring_i);
 
   // Triangles spanning ring 0 to ring 1 is simply a triangle fan around vertex
   // 0.
@@ -180,9 +180,9 @@ pair<VertexBuffer, IndexBuffer> MakeRevoluteShape(
    pattern gets repeated as we iterate through ring (see below). */
   int p = v_index + rotate_sample_count - 1;
   for (int v_j = 0; v_j < rotate_sample_count; ++v_j) {
-    const GLfloat theta = v_j * delta_theta;
-    const GLfloat v_x = r_i * ::cosf(theta);
-    const GLfloat v_y = r_i * ::sinf(theta);
+    const float theta = v_j * delta_theta;
+    const float v_x = r_i * ::cosf(theta);
+    const float v_y = r_i * ::sinf(theta);
     vertices.block<1, 3>(v_index, 0) << v_x, v_y, z_i;
     indices.block<1, 3>(t_index++, 0) << 0, p, v_index;
     p = v_index++;
@@ -215,9 +215,9 @@ pair<VertexBuffer, IndexBuffer> MakeRevoluteShape(
 
     p = v_index + rotate_sample_count - 1;
     for (int v_j = 0; v_j < rotate_sample_count; ++v_j) {
-      const GLfloat theta = v_j * delta_theta;
-      const GLfloat v_x = r_i * ::cosf(theta);
-      const GLfloat v_y = r_i * ::sinf(theta);
+      const float theta = v_j * delta_theta;
+      const float v_x = r_i * ::cosf(theta);
+      const float v_y = r_i * ::sinf(theta);
       vertices.block<1, 3>(v_index, 0) << v_x, v_y, z_i;
       const int b = v_index - rotate_sample_count;
       const int c = p - rotate_sample_count;
@@ -308,14 +308,14 @@ pair<VertexBuffer, IndexBuffer> MakeLongLatUnitSphere(int longitude_bands,
 
   // Angle separating latitudinal rings measured in the longitudinal direction
   // (defines the height of rings).
-  const GLfloat delta_phi = static_cast<GLfloat>(M_PI / latitude_bands);
+  const float delta_phi = static_cast<float>(M_PI / latitude_bands);
   auto calc_z_i = [delta_phi, latitude_bands](int ring_i) {
     DRAKE_DEMAND(ring_i >= 0 && ring_i <= latitude_bands);
     return ::cosf(ring_i * delta_phi); };
   auto calc_radius_i = [calc_z_i, latitude_bands](int ring_i) {
     DRAKE_DEMAND(ring_i >= 0 && ring_i <= latitude_bands);
     if (ring_i == 0 || ring_i == latitude_bands) return 0.f;
-    const GLfloat z_i = calc_z_i(ring_i);
+    const float z_i = calc_z_i(ring_i);
     return sqrtf(1.0 - z_i * z_i);
   };
   auto buffers = MakeRevoluteShape(longitude_bands, latitude_bands + 1,
@@ -398,7 +398,7 @@ pair<VertexBuffer, IndexBuffer> MakeUnitCylinder(int num_strips,
   const int tri_count = 2 * (num_bands + 1) * num_strips;
 
   // The height of each band along the length of the barrel.
-  const GLfloat band_height = 1.f / num_bands;
+  const float band_height = 1.f / num_bands;
 
   // As illustrated above, circle 0 & 1 have a z-value of 0.5, circles
   // C-2 and C-1 are at -0.5, and all other circles are distributed between.
@@ -427,7 +427,7 @@ pair<VertexBuffer, IndexBuffer> MakeUnitCylinder(int num_strips,
   return buffers;
 }
 
-pair<VertexBuffer, IndexBuffer> MakeSquarePatch(GLfloat measure,
+pair<VertexBuffer, IndexBuffer> MakeSquarePatch(float measure,
                                                 int resolution) {
   DRAKE_DEMAND(measure > 0);
   DRAKE_DEMAND(resolution >= 1);
@@ -439,7 +439,7 @@ pair<VertexBuffer, IndexBuffer> MakeSquarePatch(GLfloat measure,
   IndexBuffer indices{tri_count, 3};
 
   // The size of each square sub-patch.
-  const GLfloat delta = measure / resolution;
+  const float delta = measure / resolution;
 
   /* Build the following grid. Where N = resolution.
 
@@ -468,12 +468,12 @@ pair<VertexBuffer, IndexBuffer> MakeSquarePatch(GLfloat measure,
   // First add the vertices.
   int v_index = 0;
 
-  GLfloat x0 = -measure / 2;
-  GLfloat y0 = -measure / 2;
+  float x0 = -measure / 2;
+  float y0 = -measure / 2;
   for (int i = 0; i <= resolution; ++i) {
-    const GLfloat y = y0 + i * delta;
+    const float y = y0 + i * delta;
     for (int j = 0; j <= resolution; ++j) {
-      const GLfloat x = x0 + j * delta;
+      const float x = x0 + j * delta;
       vertices.block<1, 3>(v_index++, 0) << x, y, 0;
     }
   }
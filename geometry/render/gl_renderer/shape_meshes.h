@@ -6,8 +6,6 @@
 
 #include <Eigen/Dense>
 
-#include "drake/geometry/render/gl_renderer/opengl_includes.h"
-
 namespace drake {
 namespace geometry {
 namespace render {
@@ -17,7 +15,10 @@ namespace internal {
 //  normals and texture coordinates.
 
 // These are pseudo-public aliases -- they are exposed to other classes in the
-// render::internal namespace, but aren't part of the public API.
+// render::internal namespace, but aren't part of the public API. The scalar
+// types are those of GLfloat and GLuint, so the buffers can be handed to OpenGL
+// as is, but this file doesn't depend on OpenGL so that other renderers (e.g.,
+// RenderEngineCpu) can share the tessellations.
 
 /* The representation of all Nv vertex positions in the mesh encoded in a Nvx3
  matrix such that the ith row is the position for the ith vertex in the mesh
@@ -25,7 +26,7 @@ namespace internal {
 
  The representation is, as the name implies, intended to facilitate defining
  OpenGl geometry constructs via vertex buffers.  */
-using VertexBuffer = Eigen::Matrix<GLfloat, Eigen::Dynamic, 3, Eigen::RowMajor>;
+using VertexBuffer = Eigen::Matrix<float, Eigen::Dynamic, 3, Eigen::RowMajor>;
 
 /* The representation of all Nt mesh triangles, encoded in an Ntx3 matrix of
  index values. The ith row represents the ith triangle such that columns 0, 1,
@@ -35,7 +36,8 @@ using VertexBuffer = Eigen::Matrix<GLfloat, Eigen::Dynamic, 3, Eigen::RowMajor>;
 
  The representation is, as the name implies, intended to facilitate defining
  OpenGl geometries via index buffers.  */
-using IndexBuffer = Eigen::Matrix<GLuint, Eigen::Dynamic, 3, Eigen::RowMajor>;
+using IndexBuffer =
+    Eigen::Matrix<unsigned int, Eigen::Dynamic, 3, Eigen::RowMajor>;
 
 // TODO(SeanCurtis-TRI): Also parse normals and texture coordinates.
 
@@ -95,7 +97,7 @@ std::pair<VertexBuffer, IndexBuffer> MakeUnitCylinder(int num_strips = 50,
  two triangles).
  @pre `measure` > 0
  @pre `resolution >= 1`. */
-std::pair<VertexBuffer, IndexBuffer> MakeSquarePatch(GLfloat measure = 200,
+std::pair<VertexBuffer, IndexBuffer> MakeSquarePatch(float measure = 200,
                                                      int resolution = 1);
 
 /* Creates an OpenGL_compatible mesh representation of the unit box - all edges
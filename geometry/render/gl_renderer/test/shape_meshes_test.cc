@@ -16,7 +16,7 @@ namespace render {
 namespace internal {
 namespace {
 
-using Vector3f = Vector3<GLfloat>;
+using Vector3f = Vector3<float>;
 
 GTEST_TEST(LoadMeshFromObjTest, ErrorModes) {
   {
@@ -157,13 +157,13 @@ Vector3f CalcTriNormal(const VertexBuffer& vertices, const IndexBuffer& tris,
 }
 
 // Computes the area of the indicated triangle.
-GLfloat CalcTriArea(const VertexBuffer& vertices, const IndexBuffer& tris,
-                    int tri_index) {
+float CalcTriArea(const VertexBuffer& vertices, const IndexBuffer& tris,
+                  int tri_index) {
   return CalcTriNormal(vertices, tris, tri_index).norm() * 0.5;
 }
 
 // Computes the total area of the given triangles.
-GLfloat CalcTotalArea(const VertexBuffer& vertices, const IndexBuffer& tris) {
+float CalcTotalArea(const VertexBuffer& vertices, const IndexBuffer& tris) {
   float total_area = 0;
   for (int t = 0; t < tris.rows(); ++t) {
     const auto a = CalcTriArea(vertices, tris, t);
@@ -216,10 +216,10 @@ GTEST_TEST(ShapeMeshesTest, ConfirmUtilities) {
  tests until there's a proven bug. */
 
 GTEST_TEST(PrimitiveMeshTests, MakeLongLatUnitSphere) {
-  const GLfloat kEps = std::numeric_limits<GLfloat>::epsilon();
+  const float kEps = std::numeric_limits<float>::epsilon();
 
   // Closed form solution for surface area of unit sphere.
-  const GLfloat kIdealArea = static_cast<GLfloat>(4 * M_PI);  // 4πR², R = 1.
+  const float kIdealArea = static_cast<float>(4 * M_PI);  // 4πR², R = 1.
 
   float prev_area = 0;
   for (int resolution : {3, 10, 20, 40}) {
@@ -250,13 +250,13 @@ GTEST_TEST(PrimitiveMeshTests, MakeLongLatUnitSphere) {
 }
 
 GTEST_TEST(PrimitiveMeshTests, MakeUnitCylinder) {
-  const GLfloat kEps = std::numeric_limits<GLfloat>::epsilon();
+  const float kEps = std::numeric_limits<float>::epsilon();
 
   // Closed form solution for surface area of unit cylinder: H = 1, R = 1.
   //  Total cap area: 2 * πR² = 2π
   //  Barrel area: 2πRH = 2π
   //  Total area = 2π + 2π = 4π
-  const GLfloat kIdealArea = static_cast<GLfloat>(4 * M_PI);
+  const float kIdealArea = static_cast<float>(4 * M_PI);
 
   float prev_area = 0;
   for (int resolution : {3, 10, 20, 40}) {
@@ -305,10 +305,10 @@ GTEST_TEST(PrimitiveMeshTests, MakeUnitCylinder) {
 }
 
 GTEST_TEST(PrimitiveMeshTests, MakeSquarePatch) {
-  const GLfloat kEps = std::numeric_limits<GLfloat>::epsilon();
-  const GLfloat kMax = std::numeric_limits<GLfloat>::max();
-  const GLfloat kMeasure = 25;
-  const GLfloat kArea = kMeasure * kMeasure;
+  const float kEps = std::numeric_limits<float>::epsilon();
+  const float kMax = std::numeric_limits<float>::max();
+  const float kMeasure = 25;
+  const float kArea = kMeasure * kMeasure;
 
   for (int resolution : {1, 4, 15}) {
     auto [vertices, indices] = MakeSquarePatch(kMeasure, resolution);
@@ -319,7 +319,7 @@ GTEST_TEST(PrimitiveMeshTests, MakeSquarePatch) {
     // the sum of many small real values each contribute round-off error. The
     // more we sum, the more round off error we introduce. We scale by the
     // number of triangles (representative of the number of small additions).
-    const GLfloat area_epsilon = kEps * kArea * resolution * resolution;
+    const float area_epsilon = kEps * kArea * resolution * resolution;
     EXPECT_NEAR(CalcTotalArea(vertices, indices), kArea, area_epsilon);
     EXPECT_EQ(vertices.rows(), (resolution + 1) * (resolution + 1));
     EXPECT_EQ(indices.rows(), 2 * resolution * resolution);
@@ -343,8 +343,8 @@ GTEST_TEST(PrimitiveMeshTests, MakeSquarePatch) {
 }
 
 GTEST_TEST(PrimitiveMeshTests, MakeUnitBox) {
-  const GLfloat kEps = std::numeric_limits<GLfloat>::epsilon();
-  const GLfloat kMax = std::numeric_limits<GLfloat>::max();
+  const float kEps = std::numeric_limits<float>::epsilon();
+  const float kMax = std::numeric_limits<float>::max();
 
   auto [vertices, indices] = MakeUnitBox();
 
@@ -13,10 +13,11 @@ namespace render {
  three types of images: color, depth, and label. (For more details about the
  API, refer to the RenderEngine documentation.)
 
- Drake includes *two* implementations of that API:
+ Drake includes *three* implementations of that API:
 
    - RenderEngineVtk - A GPU-based rasterization renderer
    - RenderEngineOspray - A CPU-based ray-tracing renderer
+   - RenderEngineCpu - A CPU-based rasterization renderer
 
  These implementations differ in many ways:
 
@@ -35,6 +36,7 @@ namespace render {
  |:------------------:|:-----------------:|:------------------------------------------------------------:|:-----------:|
  | RenderEngineVtk    | Full              | No shadows, limited anti-aliasing                            | Fast        |
  | RenderEngineOspray | Color images only | Shadow-less, ray-traced shadows, or full global illumination | Slow        |
+ | RenderEngineCpu    | No color images   | Same geometry as RenderEngineVtk                             | Fast        |
 
  <h2>API Support</h2>
 
@@ -43,6 +45,7 @@ namespace render {
    - RenderEngineVtk: Full support, i.e. color, depth and label images.
    - RenderEngineOspray: *Currently* only supports color images, but the missing
      images are planned for the future.
+   - RenderEngineCpu: Only supports depth and label images.
 
  <h2>Fidelity</h2>
 
@@ -77,6 +80,10 @@ namespace render {
  its driver. A more powerful graphics card with an up-to-date driver will likely
  produce images more quickly.
 
+ The performance of RenderEngineCpu depends on the number of triangles in the
+ scene and the number of CPUs; the image is rasterized tile by tile in
+ parallel. It is most useful on machines without a GPU.
+
  It should be clear that the relative performance between the two RenderEngine
  implementation depends on a particular system's configuration. As such, it is
  impossible to state what the two engine's relative performance is in absolute
@@ -2,6 +2,7 @@
 
 #include <typeinfo>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/nice_type_name.h"
 
 namespace drake {
@@ -60,6 +61,34 @@ bool RenderEngine::has_geometry(GeometryId id) const {
   return update_ids_.count(id) > 0 || anchored_ids_.count(id) > 0;
 }
 
+void RenderEngine::RenderImages(const RenderImageBatch& batch) {
+  for (const auto& request : batch.color) {
+    DRAKE_THROW_UNLESS(request.image != nullptr);
+  }
+  for (const auto& request : batch.depth) {
+    DRAKE_THROW_UNLESS(request.image != nullptr);
+  }
+  for (const auto& request : batch.label) {
+    DRAKE_THROW_UNLESS(request.image != nullptr);
+  }
+  DoRenderImages(batch);
+}
+
+void RenderEngine::DoRenderImages(const RenderImageBatch& batch) {
+  for (const auto& request : batch.color) {
+    UpdateViewpoint(request.X_WC);
+    RenderColorImage(request.camera, request.show_window, request.image);
+  }
+  for (const auto& request : batch.depth) {
+    UpdateViewpoint(request.X_WC);
+    RenderDepthImage(request.camera, request.image);
+  }
+  for (const auto& request : batch.label) {
+    UpdateViewpoint(request.X_WC);
+    RenderLabelImage(request.camera, request.show_window, request.image);
+  }
+}
+
 RenderLabel RenderEngine::GetRenderLabelOrThrow(
     const PerceptionProperties& properties) const {
   RenderLabel label =
@@ -24,6 +24,53 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** A request for a color image of the camera posed at `X_WC`. See
+ RenderImageBatch.  */
+struct ColorRenderRequest {
+  /** The intrinsic properties of the camera.  */
+  CameraProperties camera;
+  /** The pose of the camera frame C in the world frame W.  */
+  math::RigidTransformd X_WC;
+  /** If true, the render window will be displayed.  */
+  bool show_window{false};
+  /** The image to render into; it must not be null.  */
+  systems::sensors::ImageRgba8U* image{};
+};
+
+/** A request for a depth image of the camera posed at `X_WC`. See
+ RenderImageBatch.  */
+struct DepthRenderRequest {
+  /** The intrinsic properties of the camera.  */
+  DepthCameraProperties camera;
+  /** The pose of the camera frame C in the world frame W.  */
+  math::RigidTransformd X_WC;
+  /** The image to render into; it must not be null.  */
+  systems::sensors::ImageDepth32F* image{};
+};
+
+/** A request for a label image of the camera posed at `X_WC`. See
+ RenderImageBatch.  */
+struct LabelRenderRequest {
+  /** The intrinsic properties of the camera.  */
+  CameraProperties camera;
+  /** The pose of the camera frame C in the world frame W.  */
+  math::RigidTransformd X_WC;
+  /** If true, the render window will be displayed.  */
+  bool show_window{false};
+  /** The image to render into; it must not be null.  */
+  systems::sensors::ImageLabel16I* image{};
+};
+
+/** A set of images, from any number of cameras, to be rendered together by
+ RenderEngine::RenderImages(). Rendering the images of many cameras as a
+ single batch allows the render engine to share the work that doesn't depend
+ on the camera (e.g., preparing the geometry) among the cameras.  */
+struct RenderImageBatch {
+  std::vector<ColorRenderRequest> color;
+  std::vector<DepthRenderRequest> depth;
+  std::vector<LabelRenderRequest> label;
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -197,6 +244,16 @@ class RenderEngine : public ShapeReifier {
       bool show_window,
       systems::sensors::ImageLabel16I* label_image_out) const = 0;
 
+  /** Renders all of the images requested in the given `batch`, each from the
+   viewpoint of its own camera. This is equivalent to calling UpdateViewpoint()
+   and then RenderColorImage(), RenderDepthImage(), or RenderLabelImage() for
+   each request, but derived classes may render the batch more efficiently
+   than that. After this call, the renderer's viewpoint is undefined; it must be
+   set with UpdateViewpoint() before rendering a single image again.
+
+   @throws std::exception if any of the requested images is null.  */
+  void RenderImages(const RenderImageBatch& batch);
+
   /** Reports the render label value this render engine has been configured to
    use.  */
   RenderLabel default_render_label() const { return default_render_label_; }
@@ -242,6 +299,11 @@ class RenderEngine : public ShapeReifier {
   /** The NVI-function for cloning this render engine.  */
   virtual std::unique_ptr<RenderEngine> DoClone() const = 0;
 
+  /** The NVI-function for rendering a batch of images; see RenderImages(). The
+   images in `batch` are guaranteed to be non-null. The default implementation
+   renders the requests one at a time.  */
+  virtual void DoRenderImages(const RenderImageBatch& batch);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
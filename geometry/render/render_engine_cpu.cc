@@ -0,0 +1,713 @@
+#include "drake/geometry/render/render_engine_cpu.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/worker_pool.h"
+#include "drake/geometry/render/gl_renderer/shape_meshes.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+namespace internal {
+
+struct CpuMesh {
+  VertexBuffer vertices;
+  IndexBuffer triangles;
+  // The radius of the smallest sphere centered on the origin of the mesh's
+  // canonical frame which contains all of the vertices.
+  double bounding_radius{};
+};
+
+}  // namespace internal
+
+using Eigen::Vector3d;
+using internal::CpuMesh;
+using internal::IndexBuffer;
+using internal::VertexBuffer;
+using math::RigidTransformd;
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+using LabelType = RenderLabel::ValueType;
+
+namespace {
+
+// The distance from the camera to the near clipping plane. Like
+// RenderEngineVtk, the geometry is clipped at this plane rather than at the
+// camera's z_near so that geometry closer than z_near is reported as
+// InvalidDepth::kTooClose instead of revealing the geometry behind it.
+const double kClippingPlaneNear = 0.01;
+
+// The edge length of the square patch standing in for a half space; it
+// matches the size of the terrain of RenderEngineVtk.
+const float kTerrainSize = 100.f;
+
+// The edge length, in pixels, of the square tiles the image is divided into.
+// Each tile is rasterized by one thread at a time, with a z-buffer that fits in
+// the L1/L2 cache.
+const int kTileSize = 64;
+
+// The projected vertices are snapped to a fixed-point grid with this many
+// subdivisions per pixel, such that the coverage test is exact and two
+// triangles sharing an edge never both (or neither) cover a pixel on it.
+const int64_t kSubpixels = 256;
+
+// The triangles are clipped to the image extended by this many pixels on each
+// side. Vertices within this guard band are simply rasterized outside of the
+// image bounds, while the clipping bounds the fixed-point coordinates.
+const double kGuardBand = 64;
+
+constexpr int kNumClipPlanes = 5;
+
+// Clipping a triangle against each plane adds at most one vertex.
+constexpr int kMaxClippedVertices = 3 + kNumClipPlanes;
+
+// The bit set in an outcode for a vertex beyond the camera's z_far. Unlike the
+// clip planes, this is only used to discard triangles.
+constexpr uint8_t kBeyondFar = 1 << kNumClipPlanes;
+
+constexpr uint8_t kClipMask = kBeyondFar - 1;
+
+std::shared_ptr<const CpuMesh> MakeCpuMesh(
+    std::pair<VertexBuffer, IndexBuffer> mesh_data) {
+  auto mesh = make_shared<CpuMesh>();
+  mesh->vertices = std::move(mesh_data.first);
+  mesh->triangles = std::move(mesh_data.second);
+  mesh->bounding_radius =
+      mesh->vertices.rows() > 0
+          ? mesh->vertices.cast<double>().rowwise().norm().maxCoeff()
+          : 0.0;
+  return mesh;
+}
+
+// Data to pass through the reification process.
+struct RegistrationData {
+  const GeometryId id;
+  const RigidTransformd& X_WG;
+  const RenderLabel label;
+};
+
+// Invokes func(i) for each i in [0, num_tasks) on the threads of `pool`, or
+// on the calling thread only if `pool` is null.
+void ParallelFor(drake::internal::WorkerPool* pool, int num_tasks,
+                 const std::function<void(int)>& func) {
+  if (pool == nullptr) {
+    for (int i = 0; i < num_tasks; ++i) {
+      func(i);
+    }
+    return;
+  }
+  pool->ParallelFor(num_tasks, func);
+}
+
+// The pinhole model of the camera. A point p_CP = (x, y, z) expressed in the
+// camera frame C (X right, Y down, Z forward) projects to the pixel coordinates
+// (u, v) = (fx x / z + cx, fy y / z + cy), where pixel (i, j) covers the
+// square [i, i + 1) x [j, j + 1).
+struct Intrinsics {
+  explicit Intrinsics(const CameraProperties& camera)
+      : width(camera.width),
+        height(camera.height),
+        fx(camera.height / (2 * std::tan(camera.fov_y / 2))),
+        fy(fx),
+        cx(camera.width / 2.0),
+        cy(camera.height / 2.0) {}
+
+  int width{};
+  int height{};
+  double fx{};
+  double fy{};
+  double cx{};
+  double cy{};
+};
+
+// The planes bounding the clip volume: the near clipping plane and the four
+// sides of the camera frustum pushed out by the guard band. A point p_CP is
+// on the inner side of plane k iff normal[k]⋅p_CP + offset[k] ≥ 0.
+class ClipPlanes {
+ public:
+  explicit ClipPlanes(const Intrinsics& K)
+      : normals_{{Vector3d(0, 0, 1),
+                  Vector3d(K.fx, 0, K.cx + kGuardBand),
+                  Vector3d(-K.fx, 0, K.width + kGuardBand - K.cx),
+                  Vector3d(0, K.fy, K.cy + kGuardBand),
+                  Vector3d(0, -K.fy, K.height + kGuardBand - K.cy)}},
+        offsets_{{-kClippingPlaneNear, 0, 0, 0, 0}} {}
+
+  double Distance(int k, const Vector3d& p_CP) const {
+    return normals_[k].dot(p_CP) + offsets_[k];
+  }
+
+  // Returns the bitmask of the planes for which p_CP is on the outer side.
+  uint8_t Outcode(const Vector3d& p_CP) const {
+    uint8_t outcode = 0;
+    for (int k = 0; k < kNumClipPlanes; ++k) {
+      if (Distance(k, p_CP) < 0) outcode |= 1 << k;
+    }
+    return outcode;
+  }
+
+  // Reports if the sphere of the given center and radius lies entirely on the
+  // outer side of one of the planes.
+  bool IsSphereOutside(const Vector3d& p_CS, double radius) const {
+    for (int k = 0; k < kNumClipPlanes; ++k) {
+      if (Distance(k, p_CS) < -radius * normals_[k].norm()) return true;
+    }
+    return false;
+  }
+
+ private:
+  std::array<Vector3d, kNumClipPlanes> normals_;
+  std::array<double, kNumClipPlanes> offsets_;
+};
+
+// A triangle projected to the image, set up for rasterization.
+struct ScreenTriangle {
+  // The edge functions Eₖ(i, j) = a[k] i + b[k] j + c[k], k = 0, 1, 2, of the
+  // pixel (i, j). The pixel's center lies inside the triangle iff Eₖ(i, j) ≥ 0
+  // for all k. They are evaluated exactly on the fixed-point grid, and a
+  // center lying on an edge belongs to exactly one of the two triangles
+  // sharing that edge.
+  std::array<int64_t, 3> a;
+  std::array<int64_t, 3> b;
+  std::array<int64_t, 3> c;
+  // The inverse depth 1 / z at the center of pixel (i, j), which is an affine
+  // function of (i, j), is inv_z_i i + inv_z_j j + inv_z_0.
+  double inv_z_i{};
+  double inv_z_j{};
+  double inv_z_0{};
+  // The inclusive range of the pixels whose centers may lie in the triangle,
+  // clamped to the image.
+  int i_min{};
+  int i_max{};
+  int j_min{};
+  int j_max{};
+  LabelType label{};
+};
+
+// Projects the triangle with the vertices p_CV, which must lie in the clip
+// volume, and appends it to `triangles` unless it covers no pixel center.
+// Triangles are two-sided.
+void SetupTriangle(const std::array<Vector3d, 3>& p_CV, const Intrinsics& K,
+                   LabelType label, vector<ScreenTriangle>* triangles) {
+  std::array<int64_t, 3> x;
+  std::array<int64_t, 3> y;
+  std::array<double, 3> inv_z;
+  for (int k = 0; k < 3; ++k) {
+    inv_z[k] = 1 / p_CV[k].z();
+    x[k] = std::llround(kSubpixels * (K.fx * p_CV[k].x() * inv_z[k] + K.cx));
+    y[k] = std::llround(kSubpixels * (K.fy * p_CV[k].y() * inv_z[k] + K.cy));
+  }
+  int64_t twice_area = (x[1] - x[0]) * (y[2] - y[0]) -
+                       (y[1] - y[0]) * (x[2] - x[0]);
+  if (twice_area == 0) return;
+  if (twice_area < 0) {
+    std::swap(x[1], x[2]);
+    std::swap(y[1], y[2]);
+    std::swap(inv_z[1], inv_z[2]);
+    twice_area = -twice_area;
+  }
+
+  // The center of pixel (i, j) is at (i + ½, j + ½) pixels.
+  const int64_t half = kSubpixels / 2;
+  auto first_center = [half](int64_t coordinate) {
+    return static_cast<int>(
+        std::ceil(static_cast<double>(coordinate - half) / kSubpixels));
+  };
+  auto last_center = [half](int64_t coordinate) {
+    return static_cast<int>(
+        std::floor(static_cast<double>(coordinate - half) / kSubpixels));
+  };
+  ScreenTriangle t;
+  t.i_min = std::max(first_center(*std::min_element(x.begin(), x.end())), 0);
+  t.i_max = std::min(last_center(*std::max_element(x.begin(), x.end())),
+                     K.width - 1);
+  t.j_min = std::max(first_center(*std::min_element(y.begin(), y.end())), 0);
+  t.j_max = std::min(last_center(*std::max_element(y.begin(), y.end())),
+                     K.height - 1);
+  if (t.i_min > t.i_max || t.j_min > t.j_max) return;
+
+  for (int k = 0; k < 3; ++k) {
+    const int next = (k + 1) % 3;
+    const int64_t dx = x[next] - x[k];
+    const int64_t dy = y[next] - y[k];
+    // E(p) = dx (p_y - y[k]) - dy (p_x - x[k]), with p the center of (i, j).
+    t.a[k] = -dy * kSubpixels;
+    t.b[k] = dx * kSubpixels;
+    t.c[k] = dx * (half - y[k]) - dy * (half - x[k]);
+    // Of the two (opposite) directions an edge can be traversed in, exactly
+    // one owns the centers lying on the edge; the other excludes them.
+    const bool owns_edge = dy < 0 || (dy == 0 && dx > 0);
+    if (!owns_edge) t.c[k] -= 1;
+  }
+
+  // Solve for the plane through (u, v, 1 / z) at the three vertices.
+  const double u0 = static_cast<double>(x[0]) / kSubpixels;
+  const double v0 = static_cast<double>(y[0]) / kSubpixels;
+  const double du1 = static_cast<double>(x[1] - x[0]) / kSubpixels;
+  const double dv1 = static_cast<double>(y[1] - y[0]) / kSubpixels;
+  const double du2 = static_cast<double>(x[2] - x[0]) / kSubpixels;
+  const double dv2 = static_cast<double>(y[2] - y[0]) / kSubpixels;
+  const double det =
+      static_cast<double>(twice_area) / (kSubpixels * kSubpixels);
+  const double d_inv_z1 = inv_z[1] - inv_z[0];
+  const double d_inv_z2 = inv_z[2] - inv_z[0];
+  t.inv_z_i = (d_inv_z1 * dv2 - d_inv_z2 * dv1) / det;
+  t.inv_z_j = (d_inv_z2 * du1 - d_inv_z1 * du2) / det;
+  t.inv_z_0 = inv_z[0] - t.inv_z_i * u0 - t.inv_z_j * v0 +
+              0.5 * (t.inv_z_i + t.inv_z_j);
+  t.label = label;
+  triangles->push_back(t);
+}
+
+// Clips the triangle with the vertices p_CV against the clip planes in the
+// bitmask `outcode` and sets up the triangles fanning the clipped polygon.
+void ClipAndSetupTriangle(const std::array<Vector3d, 3>& p_CV,
+                          uint8_t outcode, const ClipPlanes& planes,
+                          const Intrinsics& K, LabelType label,
+                          vector<ScreenTriangle>* triangles) {
+  std::array<Vector3d, kMaxClippedVertices> polygon;
+  std::array<Vector3d, kMaxClippedVertices> clipped;
+  std::copy(p_CV.begin(), p_CV.end(), polygon.begin());
+  int num_vertices = 3;
+  for (int k = 0; k < kNumClipPlanes; ++k) {
+    if ((outcode & (1 << k)) == 0) continue;
+    int num_clipped = 0;
+    for (int v = 0; v < num_vertices; ++v) {
+      const Vector3d& p = polygon[v];
+      const Vector3d& q = polygon[(v + 1) % num_vertices];
+      const double d_p = planes.Distance(k, p);
+      const double d_q = planes.Distance(k, q);
+      if (d_p >= 0) clipped[num_clipped++] = p;
+      if ((d_p >= 0) != (d_q >= 0)) {
+        clipped[num_clipped++] = p + (d_p / (d_p - d_q)) * (q - p);
+      }
+    }
+    std::swap(polygon, clipped);
+    num_vertices = num_clipped;
+    if (num_vertices < 3) return;
+  }
+  for (int v = 1; v + 1 < num_vertices; ++v) {
+    SetupTriangle({polygon[0], polygon[v], polygon[v + 1]}, K, label,
+                  triangles);
+  }
+}
+
+// Transforms, clips, and projects all the triangles of `mesh`, scaled by
+// `scale` and posed at X_CG, and appends them to `triangles` in the order of
+// the mesh.
+void SetupMeshTriangles(const CpuMesh& mesh, const RigidTransformd& X_CG,
+                        const Vector3d& scale, LabelType label,
+                        const Intrinsics& K, const ClipPlanes& planes,
+                        double z_far, vector<ScreenTriangle>* triangles) {
+  const Eigen::Matrix3d S_CG = X_CG.rotation().matrix() * scale.asDiagonal();
+  const Eigen::Matrix<double, Eigen::Dynamic, 3> p_CV =
+      (mesh.vertices.cast<double>() * S_CG.transpose()).rowwise() +
+      X_CG.translation().transpose();
+  vector<uint8_t> outcodes(p_CV.rows());
+  for (int v = 0; v < p_CV.rows(); ++v) {
+    outcodes[v] = planes.Outcode(p_CV.row(v).transpose());
+    if (p_CV(v, 2) > z_far) outcodes[v] |= kBeyondFar;
+  }
+  for (int t = 0; t < mesh.triangles.rows(); ++t) {
+    const std::array<int, 3> v{static_cast<int>(mesh.triangles(t, 0)),
+                               static_cast<int>(mesh.triangles(t, 1)),
+                               static_cast<int>(mesh.triangles(t, 2))};
+    if (outcodes[v[0]] & outcodes[v[1]] & outcodes[v[2]]) continue;
+    const std::array<Vector3d, 3> p{p_CV.row(v[0]).transpose(),
+                                    p_CV.row(v[1]).transpose(),
+                                    p_CV.row(v[2]).transpose()};
+    const uint8_t outcode =
+        (outcodes[v[0]] | outcodes[v[1]] | outcodes[v[2]]) & kClipMask;
+    if (outcode == 0) {
+      SetupTriangle(p, K, label, triangles);
+    } else {
+      ClipAndSetupTriangle(p, outcode, planes, K, label, triangles);
+    }
+  }
+}
+
+// Rasterizes the triangles in [first, last) into the pixels [i_begin, i_end) x
+// [j_begin, j_end) of the row-major buffers of the given width.
+void RasterizeTile(const ScreenTriangle* const* first,
+                   const ScreenTriangle* const* last, int width, int i_begin,
+                   int i_end, int j_begin, int j_end, float* inverse_depth,
+                   LabelType* labels) {
+  for (int j = j_begin; j < j_end; ++j) {
+    std::fill(inverse_depth + j * width + i_begin,
+              inverse_depth + j * width + i_end, 0.0f);
+    std::fill(labels + j * width + i_begin, labels + j * width + i_end,
+              static_cast<LabelType>(RenderLabel::kEmpty));
+  }
+  for (; first != last; ++first) {
+    const ScreenTriangle* t = *first;
+    const int i_first = std::max(t->i_min, i_begin);
+    const int i_last = std::min(t->i_max, i_end - 1);
+    const int j_first = std::max(t->j_min, j_begin);
+    const int j_last = std::min(t->j_max, j_end - 1);
+    const float inv_z_i = static_cast<float>(t->inv_z_i);
+    for (int j = j_first; j <= j_last; ++j) {
+      int64_t e0 = t->a[0] * i_first + t->b[0] * j + t->c[0];
+      int64_t e1 = t->a[1] * i_first + t->b[1] * j + t->c[1];
+      int64_t e2 = t->a[2] * i_first + t->b[2] * j + t->c[2];
+      const float inv_z_first = static_cast<float>(
+          t->inv_z_i * i_first + t->inv_z_j * j + t->inv_z_0);
+      float* depth_row = inverse_depth + j * width;
+      LabelType* label_row = labels + j * width;
+      // The loop body is branch-free so the compiler can vectorize it.
+      for (int i = i_first; i <= i_last; ++i) {
+        const bool inside = (e0 | e1 | e2) >= 0;
+        const float inv_z = inv_z_first + inv_z_i * (i - i_first);
+        const bool closer = inside && inv_z > depth_row[i];
+        depth_row[i] = closer ? inv_z : depth_row[i];
+        label_row[i] = closer ? t->label : label_row[i];
+        e0 += t->a[0];
+        e1 += t->a[1];
+        e2 += t->a[2];
+      }
+    }
+  }
+}
+
+// Writes the depth image of the given inverse depth buffer, as produced by
+// RenderEngineCpu::Rasterize().
+void WriteDepthImage(const DepthCameraProperties& camera,
+                     const vector<float>& inverse_depth,
+                     ImageDepth32F* depth_image_out) {
+  float* depth = depth_image_out->mutable_data();
+  const int width = depth_image_out->width();
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const float inv_z = inverse_depth[v * camera.width + u];
+      float z = InvalidDepth::kTooFar;
+      if (inv_z > 0) {
+        z = 1.0f / inv_z;
+        if (z > camera.z_far) {
+          z = InvalidDepth::kTooFar;
+        } else if (z < camera.z_near) {
+          z = InvalidDepth::kTooClose;
+        }
+      }
+      depth[v * width + u] = z;
+    }
+  }
+}
+
+// Writes the label image of the given label buffer, as produced by
+// RenderEngineCpu::Rasterize().
+void WriteLabelImage(const CameraProperties& camera,
+                     const vector<LabelType>& labels,
+                     ImageLabel16I* label_image_out) {
+  int16_t* label = label_image_out->mutable_data();
+  const int width = label_image_out->width();
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      label[v * width + u] = labels[v * camera.width + u];
+    }
+  }
+}
+
+}  // namespace
+
+RenderEngineCpu::RenderEngineCpu(const RenderEngineCpuParams& parameters)
+    : RenderEngine(parameters.default_label ? *parameters.default_label
+                                            : RenderLabel::kUnspecified),
+      num_threads_(parameters.num_threads
+                       ? *parameters.num_threads
+                       : std::max<int>(std::thread::hardware_concurrency(), 1)),
+      sphere_(MakeCpuMesh(internal::MakeLongLatUnitSphere(50, 50))),
+      cylinder_(MakeCpuMesh(internal::MakeUnitCylinder(50, 1))),
+      half_space_(MakeCpuMesh(internal::MakeSquarePatch(kTerrainSize, 1))),
+      box_(MakeCpuMesh(internal::MakeUnitBox())) {
+  DRAKE_THROW_UNLESS(num_threads_ > 0);
+}
+
+// The clone shares the meshes, but not the threads of `other`, so that the
+// two engines can render concurrently.
+RenderEngineCpu::RenderEngineCpu(const RenderEngineCpu& other)
+    : RenderEngine(other),
+      num_threads_(other.num_threads_),
+      X_CW_(other.X_CW_),
+      sphere_(other.sphere_),
+      cylinder_(other.cylinder_),
+      half_space_(other.half_space_),
+      box_(other.box_),
+      meshes_(other.meshes_),
+      visuals_(other.visuals_) {}
+
+RenderEngineCpu::~RenderEngineCpu() = default;
+
+drake::internal::WorkerPool* RenderEngineCpu::GetPool() const {
+  if (num_threads_ == 1) {
+    return nullptr;
+  }
+  if (pool_ == nullptr) {
+    pool_ = std::make_unique<drake::internal::WorkerPool>(num_threads_);
+  }
+  return pool_.get();
+}
+
+void RenderEngineCpu::UpdateViewpoint(const RigidTransformd& X_WR) {
+  X_CW_ = X_WR.inverse();
+}
+
+void RenderEngineCpu::RenderColorImage(const CameraProperties&, bool,
+                                       ImageRgba8U*) const {
+  throw std::runtime_error("RenderEngineCpu cannot render color images");
+}
+
+void RenderEngineCpu::RenderDepthImage(const DepthCameraProperties& camera,
+                                       ImageDepth32F* depth_image_out) const {
+  DRAKE_DEMAND(depth_image_out != nullptr);
+  vector<float> inverse_depth;
+  vector<LabelType> labels;
+  Rasterize(camera, X_CW_, camera.z_far, GetPool(), &inverse_depth, &labels);
+  WriteDepthImage(camera, inverse_depth, depth_image_out);
+}
+
+void RenderEngineCpu::RenderLabelImage(const CameraProperties& camera, bool,
+                                       ImageLabel16I* label_image_out) const {
+  DRAKE_DEMAND(label_image_out != nullptr);
+  vector<float> inverse_depth;
+  vector<LabelType> labels;
+  Rasterize(camera, X_CW_, std::numeric_limits<double>::infinity(),
+            GetPool(), &inverse_depth, &labels);
+  WriteLabelImage(camera, labels, label_image_out);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Sphere& sphere,
+                                        void* user_data) {
+  const double r = sphere.radius();
+  AddInstance(sphere_, Vector3d{r, r, r}, user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Cylinder& cylinder,
+                                        void* user_data) {
+  const double r = cylinder.radius();
+  AddInstance(cylinder_, Vector3d{r, r, cylinder.length()}, user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const HalfSpace&, void* user_data) {
+  AddInstance(half_space_, Vector3d{1, 1, 1}, user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Box& box, void* user_data) {
+  AddInstance(box_, Vector3d{box.width(), box.depth(), box.height()},
+              user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Ellipsoid& ellipsoid,
+                                        void* user_data) {
+  AddInstance(sphere_, Vector3d{ellipsoid.a(), ellipsoid.b(), ellipsoid.c()},
+              user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Mesh& mesh, void* user_data) {
+  ImplementObj(mesh.filename(), mesh.scale(), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Convex& convex,
+                                        void* user_data) {
+  ImplementObj(convex.filename(), convex.scale(), user_data);
+}
+
+bool RenderEngineCpu::DoRegisterVisual(GeometryId id, const Shape& shape,
+                                       const PerceptionProperties& properties,
+                                       const RigidTransformd& X_WG) {
+  // Note: the user_data interface on reification requires a non-const pointer.
+  RegistrationData data{id, X_WG, GetRenderLabelOrThrow(properties)};
+  shape.Reify(this, &data);
+  return true;
+}
+
+void RenderEngineCpu::DoUpdateVisualPose(GeometryId id,
+                                         const RigidTransformd& X_WG) {
+  visuals_.at(id).X_WG = X_WG;
+}
+
+bool RenderEngineCpu::DoRemoveGeometry(GeometryId id) {
+  return visuals_.erase(id) > 0;
+}
+
+unique_ptr<RenderEngine> RenderEngineCpu::DoClone() const {
+  return unique_ptr<RenderEngineCpu>(new RenderEngineCpu(*this));
+}
+
+void RenderEngineCpu::DoRenderImages(const RenderImageBatch& batch) {
+  if (!batch.color.empty()) {
+    const ColorRenderRequest& request = batch.color.front();
+    RenderColorImage(request.camera, request.show_window, request.image);
+  }
+
+  // The depth and label images of cameras with the same pose and intrinsics
+  // are all written from a single rasterization of that view.
+  struct View {
+    const CameraProperties* camera{};
+    RigidTransformd X_WC;
+    double z_far{};
+    vector<const DepthRenderRequest*> depth;
+    vector<const LabelRenderRequest*> label;
+  };
+  vector<View> views;
+  auto find_view = [&views](const CameraProperties& camera,
+                            const RigidTransformd& X_WC) -> View& {
+    for (View& view : views) {
+      if (view.camera->width == camera.width &&
+          view.camera->height == camera.height &&
+          view.camera->fov_y == camera.fov_y &&
+          view.X_WC.IsExactlyEqualTo(X_WC)) {
+        return view;
+      }
+    }
+    views.push_back(View{&camera, X_WC, 0.0, {}, {}});
+    return views.back();
+  };
+  for (const DepthRenderRequest& request : batch.depth) {
+    View& view = find_view(request.camera, request.X_WC);
+    view.z_far = std::max(view.z_far, request.camera.z_far);
+    view.depth.push_back(&request);
+  }
+  for (const LabelRenderRequest& request : batch.label) {
+    View& view = find_view(request.camera, request.X_WC);
+    view.z_far = std::numeric_limits<double>::infinity();
+    view.label.push_back(&request);
+  }
+
+  // With enough views to keep every thread busy, each thread rasterizes whole
+  // views; otherwise, the views are rasterized one at a time with all threads.
+  const int num_views = static_cast<int>(views.size());
+  const bool parallel_views = num_views >= num_threads_;
+  drake::internal::WorkerPool* const pool = GetPool();
+  ParallelFor(parallel_views ? pool : nullptr, num_views, [&](int k) {
+    const View& view = views[k];
+    vector<float> inverse_depth;
+    vector<LabelType> labels;
+    Rasterize(*view.camera, view.X_WC.inverse(), view.z_far,
+              parallel_views ? nullptr : pool, &inverse_depth, &labels);
+    for (const DepthRenderRequest* request : view.depth) {
+      WriteDepthImage(request->camera, inverse_depth, request->image);
+    }
+    for (const LabelRenderRequest* request : view.label) {
+      WriteLabelImage(request->camera, labels, request->image);
+    }
+  });
+}
+
+void RenderEngineCpu::ImplementObj(const string& file_name, double scale,
+                                   void* user_data) {
+  auto iter = meshes_.find(file_name);
+  if (iter == meshes_.end()) {
+    iter = meshes_
+               .emplace(file_name,
+                        MakeCpuMesh(internal::LoadMeshFromObj(file_name)))
+               .first;
+  }
+  AddInstance(iter->second, Vector3d{scale, scale, scale}, user_data);
+}
+
+void RenderEngineCpu::AddInstance(shared_ptr<const CpuMesh> mesh,
+                                  const Vector3d& scale, void* user_data) {
+  const RegistrationData& data = *static_cast<RegistrationData*>(user_data);
+  visuals_.emplace(data.id,
+                   Instance{std::move(mesh), data.X_WG, scale, data.label});
+}
+
+void RenderEngineCpu::Rasterize(const CameraProperties& camera,
+                                const RigidTransformd& X_CW, double z_far,
+                                drake::internal::WorkerPool* pool,
+                                vector<float>* inverse_depth,
+                                vector<LabelType>* labels) const {
+  const Intrinsics K(camera);
+  const ClipPlanes planes(K);
+
+  // Cull the instances whose bounding spheres lie outside the clip volume.
+  vector<const Instance*> instances;
+  instances.reserve(visuals_.size());
+  for (const auto& id_instance : visuals_) {
+    const Instance& instance = id_instance.second;
+    const Vector3d p_CGo = X_CW * instance.X_WG.translation();
+    const double radius = instance.mesh->bounding_radius *
+                          instance.scale.cwiseAbs().maxCoeff();
+    if (p_CGo.z() - radius > z_far || planes.IsSphereOutside(p_CGo, radius)) {
+      continue;
+    }
+    instances.push_back(&instance);
+  }
+
+  // Transform, clip, and project the triangles of each instance in parallel.
+  const int num_instances = static_cast<int>(instances.size());
+  vector<vector<ScreenTriangle>> triangles(num_instances);
+  ParallelFor(pool, num_instances, [&](int k) {
+    const Instance& instance = *instances[k];
+    SetupMeshTriangles(*instance.mesh, X_CW * instance.X_WG, instance.scale,
+                       instance.label, K, planes, z_far, &triangles[k]);
+  });
+
+  // Bin the triangles to the tiles overlapped by their bounding boxes with a
+  // counting sort, which keeps the triangles of each tile in the same order
+  // regardless of the number of threads.
+  const int num_tiles_i = (camera.width + kTileSize - 1) / kTileSize;
+  const int num_tiles_j = (camera.height + kTileSize - 1) / kTileSize;
+  const int num_tiles = num_tiles_i * num_tiles_j;
+  auto for_each_tile = [num_tiles_i](const ScreenTriangle& t,
+                                     const auto& func) {
+    for (int tile_j = t.j_min / kTileSize; tile_j <= t.j_max / kTileSize;
+         ++tile_j) {
+      for (int tile_i = t.i_min / kTileSize; tile_i <= t.i_max / kTileSize;
+           ++tile_i) {
+        func(tile_j * num_tiles_i + tile_i);
+      }
+    }
+  };
+  vector<int> bin_begin(num_tiles + 1, 0);
+  for (const auto& instance_triangles : triangles) {
+    for (const ScreenTriangle& t : instance_triangles) {
+      for_each_tile(t, [&bin_begin](int tile) { ++bin_begin[tile + 1]; });
+    }
+  }
+  std::partial_sum(bin_begin.begin(), bin_begin.end(), bin_begin.begin());
+  vector<const ScreenTriangle*> binned(bin_begin.back());
+  vector<int> bin_end(bin_begin.begin(), bin_begin.end() - 1);
+  for (const auto& instance_triangles : triangles) {
+    for (const ScreenTriangle& t : instance_triangles) {
+      for_each_tile(t, [&](int tile) { binned[bin_end[tile]++] = &t; });
+    }
+  }
+
+  // Rasterize the tiles in parallel; each tile writes to its own pixels.
+  inverse_depth->resize(camera.width * camera.height);
+  labels->resize(camera.width * camera.height);
+  ParallelFor(pool, num_tiles, [&](int tile) {
+    const int tile_i = tile % num_tiles_i;
+    const int tile_j = tile / num_tiles_i;
+    RasterizeTile(binned.data() + bin_begin[tile],
+                  binned.data() + bin_end[tile], camera.width,
+                  tile_i * kTileSize,
+                  std::min((tile_i + 1) * kTileSize, camera.width),
+                  tile_j * kTileSize,
+                  std::min((tile_j + 1) * kTileSize, camera.height),
+                  inverse_depth->data(), labels->data());
+  });
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_engine_cpu_factory.h"
+#include "drake/geometry/render/render_label.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+class WorkerPool;
+}  // namespace internal
+#endif  // !DRAKE_DOXYGEN_CXX
+
+namespace geometry {
+namespace render {
+
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+// The triangle mesh of a canonical shape, shared by all the instances of that
+// shape. Defined in render_engine_cpu.cc.
+struct CpuMesh;
+}  // namespace internal
+#endif  // !DRAKE_DOXYGEN_CXX
+
+/** See documentation of MakeRenderEngineCpu().  */
+class RenderEngineCpu final : public RenderEngine {
+ public:
+  /** \name Does not allow copy, move, or assignment  */
+  //@{
+#ifdef DRAKE_DOXYGEN_CXX
+  // Note: the copy constructor operator is actually private to serve as the
+  // basis for implementing the DoClone() method.
+  RenderEngineCpu(const RenderEngineCpu&) = delete;
+#endif
+  RenderEngineCpu& operator=(const RenderEngineCpu&) = delete;
+  RenderEngineCpu(RenderEngineCpu&&) = delete;
+  RenderEngineCpu& operator=(RenderEngineCpu&&) = delete;
+  //@}}
+
+  /** Constructs the render engine from the given `parameters`.
+   @throws std::exception if `parameters.num_threads` is not positive.  */
+  explicit RenderEngineCpu(
+      const RenderEngineCpuParams& parameters = RenderEngineCpuParams());
+
+  ~RenderEngineCpu() final;
+
+  /** The maximal number of threads used to render an image, including the
+   calling thread. The engine starts its worker threads on the first render
+   and keeps them until it is destroyed; a clone has its own threads. As the
+   threads are shared by the engine's render calls, an engine must not render
+   from several threads at once.  */
+  int num_threads() const { return num_threads_; }
+
+  /** @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
+
+  /** Throws; %RenderEngineCpu cannot render color images.  */
+  void RenderColorImage(
+      const CameraProperties& camera, bool show_window,
+      systems::sensors::ImageRgba8U* color_image_out) const final;
+
+  /** @see RenderEngine::RenderDepthImage().  */
+  void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+  /** @see RenderEngine::RenderLabelImage(). `show_window` is ignored.  */
+  void RenderLabelImage(
+      const CameraProperties& camera, bool show_window,
+      systems::sensors::ImageLabel16I* label_image_out) const final;
+
+  /** @name    Shape reification  */
+  //@{
+  using RenderEngine::ImplementGeometry;
+  void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+  void ImplementGeometry(const Box& box, void* user_data) final;
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) final;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+  void ImplementGeometry(const Convex& convex, void* user_data) final;
+  //@}
+
+  /** @name    Access the default properties  */
+  //@{
+  using RenderEngine::default_render_label;
+  //@}
+
+ private:
+  // A registered geometry: a canonical mesh, scaled along the axes of the
+  // geometry frame G, and posed in the world.
+  struct Instance {
+    std::shared_ptr<const internal::CpuMesh> mesh;
+    math::RigidTransformd X_WG;
+    Vector3<double> scale;
+    RenderLabel label;
+  };
+
+  // @see RenderEngine::DoRegisterVisual().
+  bool DoRegisterVisual(GeometryId id, const Shape& shape,
+                        const PerceptionProperties& properties,
+                        const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoUpdateVisualPose().
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoRemoveGeometry().
+  bool DoRemoveGeometry(GeometryId id) final;
+
+  // @see RenderEngine::DoClone().
+  std::unique_ptr<RenderEngine> DoClone() const final;
+
+  // @see RenderEngine::DoRenderImages(). Depth and label images of cameras
+  // that share pose and intrinsics are rasterized once, and distinct cameras
+  // are rasterized concurrently when there are at least as many of them as
+  // threads.
+  void DoRenderImages(const RenderImageBatch& batch) final;
+
+  // Copy constructor used for cloning. The clone shares the canonical meshes.
+  RenderEngineCpu(const RenderEngineCpu& other);
+
+  // Common interface for loading an obj file -- used for both mesh and convex
+  // shapes.
+  void ImplementObj(const std::string& file_name, double scale,
+                    void* user_data);
+
+  // Adds the instance of the given mesh described by the RegistrationData in
+  // `user_data`.
+  void AddInstance(std::shared_ptr<const internal::CpuMesh> mesh,
+                   const Vector3<double>& scale, void* user_data);
+
+  // Returns the engine's worker threads, started on the first call, or nullptr
+  // if num_threads_ is 1.
+  drake::internal::WorkerPool* GetPool() const;
+
+  // Rasterizes all the instances seen by the camera posed at X_WC = X_CW⁻¹,
+  // using the threads of `pool` (on the calling thread only if null). On
+  // return, both buffers have camera.width * camera.height entries in
+  // row-major order; the inverse depth buffer holds 1 / z of the nearest
+  // surface (0 where nothing was drawn), and the label buffer holds its label
+  // (RenderLabel::kEmpty where nothing was drawn). Triangles whose vertices all
+  // lie beyond `z_far` are discarded.
+  void Rasterize(const CameraProperties& camera,
+                 const math::RigidTransformd& X_CW, double z_far,
+                 drake::internal::WorkerPool* pool,
+                 std::vector<float>* inverse_depth,
+                 std::vector<RenderLabel::ValueType>* labels) const;
+
+  int num_threads_{};
+
+  // The threads which rasterize the images, see GetPool().
+  mutable std::unique_ptr<drake::internal::WorkerPool> pool_;
+
+  // The pose of the world frame in the camera frame.
+  math::RigidTransformd X_CW_;
+
+  // The canonical meshes of the primitive shapes.
+  std::shared_ptr<const internal::CpuMesh> sphere_;
+  std::shared_ptr<const internal::CpuMesh> cylinder_;
+  std::shared_ptr<const internal::CpuMesh> half_space_;
+  std::shared_ptr<const internal::CpuMesh> box_;
+
+  // Mapping from obj filename to the loaded mesh.
+  std::unordered_map<std::string, std::shared_ptr<const internal::CpuMesh>>
+      meshes_;
+
+  // Mapping from GeometryId to the registered instance of that geometry.
+  std::unordered_map<GeometryId, Instance> visuals_;
+};
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
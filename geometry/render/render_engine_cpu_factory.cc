@@ -0,0 +1,16 @@
+#include "drake/geometry/render/render_engine_cpu_factory.h"
+
+#include "drake/geometry/render/render_engine_cpu.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+std::unique_ptr<RenderEngine> MakeRenderEngineCpu(
+    const RenderEngineCpuParams& params) {
+  return std::make_unique<RenderEngineCpu>(params);
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
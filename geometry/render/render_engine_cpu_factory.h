@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "drake/geometry/render/render_engine.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Construction parameters for the RenderEngineCpu.  */
+struct RenderEngineCpuParams {
+  /** The (optional) label to apply when none is otherwise specified.  */
+  std::optional<RenderLabel> default_label{};
+
+  /** The (optional) number of threads used to render an image, including the
+   calling thread. If omitted, the number of concurrent threads supported by
+   the hardware is used.  */
+  std::optional<int> num_threads{};
+};
+
+/** Constructs a RenderEngine implementation which rasterizes depth and label
+ images on the CPU, without any dependency on OpenGL or a display. It is meant
+ for headless machines (e.g., cloud instances without GPU) where the OpenGL
+ based engines are either unavailable or slow, and for simulations with many
+ cameras rendering low-resolution depth or label images.
+
+ The geometries are tessellated into triangles and the image is divided into
+ square tiles. The triangles are binned to the tiles they overlap, and the
+ tiles are rasterized in parallel, each with its own z-buffer, so the rendered
+ images don't depend on the number of threads.
+
+ %RenderEngineCpu does not render color images; RenderColorImage() throws.
+
+ @anchor render_engine_cpu_properties
+ <h2>Geometry perception properties</h2>
+
+ This RenderEngine implementation looks for the following properties when
+ registering visual geometry, categorized by rendered image type.
+
+ <h3>Depth images</h3>
+
+ No specific properties required.
+
+ <h3>Label images</h3>
+
+ | Group name | Property Name |   Required    |  Property Type  | Property Description |
+ | :--------: | :-----------: | :-----------: | :-------------: | :------------------- |
+ |   label    | id            | configurable¹ |  RenderLabel    | The label to render into the image. |
+
+ ¹ %RenderEngineCpu has a default render label value that is applied to any
+ geometry that doesn't have a (label, id) property at registration. If a value
+ is not explicitly specified, %RenderEngineCpu uses RenderLabel::kUnspecified
+ as this default value. It can be explicitly set upon construction. The possible
+ values for this default label and the ramifications of that choice are
+ documented @ref render_engine_default_label "here".
+
+ <h3>Geometries accepted by %RenderEngineCpu</h3>
+
+ %RenderEngineCpu accepts all geometries except Capsule, for which
+ registration throws.
+ */
+std::unique_ptr<RenderEngine> MakeRenderEngineCpu(
+    const RenderEngineCpuParams& params);
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
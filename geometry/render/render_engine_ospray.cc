@@ -72,6 +72,8 @@ struct RegistrationData {
   const PerceptionProperties& properties;
   const RigidTransformd& X_FG;
   const GeometryId id;
+  // The key of the shape being registered; see GetVtkShapeKey().
+  const std::string shape_key;
   // The file name if the shape being registered is a mesh.
   std::optional<std::string> mesh_filename;
 };
@@ -235,8 +237,18 @@ bool RenderEngineOspray::DoRegisterVisual(
     GeometryId id, const Shape& shape, const PerceptionProperties& properties,
     const RigidTransformd& X_FG) {
   // Note: the user_data interface on reification requires a non-const pointer.
-  RegistrationData data{properties, X_FG, id};
-  shape.Reify(this, &data);
+  RegistrationData data{properties, X_FG, id,
+                        GetVtkShapeKey(shape, properties)};
+  // Only the first geometry with a given shape creates its polygonal data; the
+  // others share it.
+  std::shared_ptr<const ShapeData> shape_data;
+  auto iter = shapes_.find(data.shape_key);
+  if (iter != shapes_.end()) shape_data = iter->second.lock();
+  if (shape_data != nullptr) {
+    ImplementInstance(std::move(shape_data), &data);
+  } else {
+    shape.Reify(this, &data);
+  }
   return true;
 }
 
@@ -253,13 +265,15 @@ RenderEngineOsprayParams RenderEngineOspray::get_params() const {
 
 void RenderEngineOspray::DoUpdateVisualPose(GeometryId id,
                                             const RigidTransformd& X_WG) {
-  vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(X_WG);
+  // All of the actors of the geometry share its transform, so updating it in
+  // place moves them all.
   // TODO(SeanCurtis-TRI): Perhaps provide the ability to specify actors for
   //  specific pipelines; i.e. only update the color actor or only the label
   //  actor, etc.
-  for (const auto& actor : actors_.at(id)) {
-    actor->SetUserTransform(vtk_X_WG);
-  }
+  vtkTransform* vtk_X_WG = vtkTransform::SafeDownCast(
+      actors_.at(id)[ImageType::kColor]->GetUserTransform());
+  DRAKE_DEMAND(vtk_X_WG != nullptr);
+  SetVtkTransform(X_WG, vtk_X_WG);
 }
 
 bool RenderEngineOspray::DoRemoveGeometry(GeometryId id) {
@@ -274,6 +288,14 @@ bool RenderEngineOspray::DoRemoveGeometry(GeometryId id) {
     pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
   }
   actors_.erase(iter);
+  auto shape_iter = geometry_shapes_.find(id);
+  const std::string key = shape_iter->second->key;
+  geometry_shapes_.erase(shape_iter);
+  // Forget the shape once no geometry uses it anymore.
+  auto key_iter = shapes_.find(key);
+  if (key_iter != shapes_.end() && key_iter->second.expired()) {
+    shapes_.erase(key_iter);
+  }
   return true;
 }
 
@@ -288,6 +310,8 @@ std::unique_ptr<RenderEngine> RenderEngineOspray::DoClone() const {
 RenderEngineOspray::RenderEngineOspray(const RenderEngineOspray& other)
     : RenderEngine(other),
       pipelines_{{make_unique<RenderingPipeline>()}},
+      shapes_{other.shapes_},
+      geometry_shapes_{other.geometry_shapes_},
       default_diffuse_{other.default_diffuse_},
       background_color_{other.background_color_},
       render_mode_(other.render_mode_) {
@@ -304,6 +328,11 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOspray& other)
         DRAKE_DEMAND(clone_actors_ptr != nullptr);
         std::array<vtkSmartPointer<vtkActor>, kNumPipelines>& clone_actors =
             *clone_actors_ptr;
+        // The transforms are updated in place, so the clone needs its own
+        // copy.
+        vtkNew<vtkTransform> transform;
+        transform->SetMatrix(
+            source_actors[ImageType::kColor]->GetUserTransform()->GetMatrix());
         for (int i = 0; i < kNumPipelines; ++i) {
           // NOTE: source *should* be const; but none of the getters on the
           // source are const-compatible.
@@ -327,7 +356,7 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOspray& other)
           // valid, VTK's reference counting preserves the underlying geometry
           // in the copy that still references it.
           clone.SetMapper(source.GetMapper());
-          clone.SetUserTransform(source.GetUserTransform());
+          clone.SetUserTransform(transform.Get());
 
           pipelines_.at(i)->renderer.Get()->AddActor(&clone);
         }
@@ -441,16 +470,33 @@ void RenderEngineOspray::ImplementGeometry(vtkPolyDataAlgorithm* source,
                                            void* user_data) {
   DRAKE_DEMAND(user_data != nullptr);
 
-  std::array<vtkSmartPointer<vtkActor>, kNumPipelines> actors{
-      vtkSmartPointer<vtkActor>::New()};
-  // Note: the mappers ultimately get referenced by the actors, so they do _not_
-  // get destroyed when this array goes out of scope.
-  std::array<vtkNew<vtkOpenGLPolyDataMapper>, kNumPipelines> mappers;
+  const RegistrationData& data =
+      *reinterpret_cast<RegistrationData*>(user_data);
 
-  for (auto& mapper : mappers) {
-    mapper->SetInputConnection(source->GetOutputPort());
+  auto shape = std::make_shared<ShapeData>();
+  shape->key = data.shape_key;
+  shape->mesh_filename = data.mesh_filename;
+  for (auto& mapper : shape->mappers) {
+    vtkNew<vtkOpenGLPolyDataMapper> opengl_mapper;
+    opengl_mapper->SetInputConnection(source->GetOutputPort());
+    mapper = opengl_mapper.Get();
   }
 
+  shapes_[shape->key] = shape;
+  ImplementInstance(std::move(shape), user_data);
+}
+
+void RenderEngineOspray::ImplementInstance(
+    std::shared_ptr<const ShapeData> shape, void* user_data) {
+  DRAKE_DEMAND(user_data != nullptr);
+
+  // The actors are the only per-geometry VTK objects; they all reference the
+  // mappers (and so the polygonal data) of the shape.
+  std::array<vtkSmartPointer<vtkActor>, kNumPipelines> actors{
+      vtkSmartPointer<vtkActor>::New()};
+  const std::array<vtkSmartPointer<vtkMapper>, kNumPipelines>& mappers =
+      shape->mappers;
+
   const RegistrationData& data =
       *reinterpret_cast<RegistrationData*>(user_data);
 
@@ -488,10 +534,10 @@ void RenderEngineOspray::ImplementGeometry(vtkPolyDataAlgorithm* source,
       log()->warn("Requested diffuse map could not be found: {}",
                   diffuse_map_name);
     }
-    if (diffuse_map_name.empty() && data.mesh_filename) {
+    if (diffuse_map_name.empty() && shape->mesh_filename) {
       // This is the hack to search for mesh.png as a possible texture.
       const std::string alt_texture_name(
-          RemoveFileExtension(*data.mesh_filename) + ".png");
+          RemoveFileExtension(*shape->mesh_filename) + ".png");
       std::ifstream alt_file_exist(alt_texture_name);
       if (alt_file_exist) texture_name = alt_texture_name;
     }
@@ -516,6 +562,7 @@ void RenderEngineOspray::ImplementGeometry(vtkPolyDataAlgorithm* source,
 
   // Take ownership of the actors.
   actors_.insert({data.id, std::move(actors)});
+  geometry_shapes_.insert({data.id, std::move(shape)});
 }
 
 void RenderEngineOspray::PerformVtkUpdate(const RenderingPipeline& p) {
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -9,6 +10,7 @@
 #include <vtkAutoInit.h>
 #include <vtkImageExport.h>
 #include <vtkLight.h>
+#include <vtkMapper.h>
 #include <vtkNew.h>
 #include <vtkOSPRayPass.h>
 #include <vtkPolyDataAlgorithm.h>
@@ -148,7 +150,9 @@ class RenderEngineOspray final
   void ImplementObj(const std::string& file_name, double scale,
                     void* user_data);
 
-  // Performs the common setup for all shape types.
+  // Performs the common setup for all shape types: creates the data shared by
+  // all of the geometries with the shape of `source` and then the geometry's
+  // actors.
   void ImplementGeometry(vtkPolyDataAlgorithm* source, void* user_data);
 
   vtkNew<vtkLight> light_;
@@ -156,6 +160,21 @@ class RenderEngineOspray final
   // A single pipeline (for now): rgb.
   static constexpr int kNumPipelines = 1;
 
+  // The data shared by all of the geometries with the same shape (see
+  // GetVtkShapeKey()): the polygonal data, through its mappers.
+  struct ShapeData {
+    // The key of the shape in shapes_.
+    std::string key;
+    // The file name if the shape is a mesh.
+    std::optional<std::string> mesh_filename;
+    std::array<vtkSmartPointer<vtkMapper>, kNumPipelines> mappers;
+  };
+
+  // Creates the actors of the geometry being registered, which use the shared
+  // data of its `shape`.
+  void ImplementInstance(std::shared_ptr<const ShapeData> shape,
+                         void* user_data);
+
   // The rendering pipeline for a single image type.
   struct RenderingPipeline {
     vtkNew<vtkRenderer> renderer;
@@ -186,6 +205,15 @@ class RenderEngineOspray final
                      std::array<vtkSmartPointer<vtkActor>, kNumPipelines>>
       actors_;
 
+  // The shared data of the shapes of the registered geometries, keyed by
+  // GetVtkShapeKey(). An entry expires when the last geometry with its shape
+  // is removed from this engine and its clones.
+  std::unordered_map<std::string, std::weak_ptr<const ShapeData>> shapes_;
+
+  // The shape data of each geometry, keyed like actors_.
+  std::unordered_map<GeometryId, std::shared_ptr<const ShapeData>>
+      geometry_shapes_;
+
   // Color to assign to objects that define no color.
   Eigen::Vector4d default_diffuse_{0.9, 0.45, 0.1, 1.0};
 
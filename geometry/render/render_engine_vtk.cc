@@ -1,10 +1,12 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <cmath>
 #include <fstream>
 #include <limits>
 #include <optional>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <vtkCamera.h>
 #include <vtkCylinderSource.h>
@@ -13,11 +15,15 @@
 #include <vtkOpenGLTexture.h>
 #include <vtkPNGReader.h>
 #include <vtkPlaneSource.h>
+#include <vtkPolyData.h>
 #include <vtkProperty.h>
+#include <vtkQuadricDecimation.h>
 #include <vtkTexturedSphereSource.h>
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
+#include <vtkTriangleFilter.h>
 
+#include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/render/render_engine_vtk_base.h"
 #include "drake/geometry/render/shaders/depth_shaders.h"
@@ -29,6 +35,7 @@ namespace geometry {
 namespace render {
 
 using Eigen::Vector2d;
+using Eigen::Vector3d;
 using Eigen::Vector4d;
 using std::make_unique;
 using math::RigidTransformd;
@@ -56,8 +63,20 @@ namespace {
 // range and mark them as too close. Clipping all geometry beyond z_far is not
 // a problem because they can unambiguously be marked as too far.
 const double kClippingPlaneNear = 0.01;
+// The far clipping plane of the color and label images.
+// TODO(SeanCurtis-TRI): Provide mechanism where user can set this value.
+//  It's important to expose this as it will affect the efficacy of the
+//  z-buffer.
+const double kClippingPlaneFar = 100.;
 const double kTerrainSize = 100.;
 
+// The levels of detail of a mesh keep 1/4^i of its triangles, and a mesh uses
+// the full resolution when its bounding sphere spans at least kLodPixels on the
+// image, and level i when it spans at least kLodPixels / 4^i (or when there is
+// no coarser level). See MakeRenderEngineVtk().
+const double kLodPixels = 256.;
+const double kLodReductions[] = {0.75, 0.9375};
+
 void SetModelTransformMatrixToVtkCamera(
     vtkCamera* camera, const vtkSmartPointer<vtkTransform>& X_WC) {
   // vtkCamera contains a transformation as the internal state and
@@ -104,6 +123,8 @@ struct RegistrationData {
   const PerceptionProperties& properties;
   const RigidTransformd& X_FG;
   const GeometryId id;
+  // The key of the shape being registered; see GetVtkShapeKey().
+  const std::string shape_key;
   // The file name if the shape being registered is a mesh.
   std::optional<std::string> mesh_filename;
 };
@@ -134,7 +155,9 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
                                             : RenderLabel::kUnspecified),
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
-                  make_unique<RenderingPipeline>()}} {
+                  make_unique<RenderingPipeline>()}},
+      frustum_culling_(parameters.frustum_culling),
+      lod_min_triangles_(parameters.lod_min_triangles) {
   if (parameters.default_diffuse) {
     default_diffuse_ = *parameters.default_diffuse;
   }
@@ -146,6 +169,8 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
 }
 
 void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
+  X_WC_ = X_WC;
+  batch_p_CSo_all_ = nullptr;
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
   for (const auto& pipeline : pipelines_) {
@@ -157,8 +182,84 @@ void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
 void RenderEngineVtk::RenderColorImage(const CameraProperties& camera,
                                        bool show_window,
                                        ImageRgba8U* color_image_out) const {
+  std::vector<Vector3d> p_CSo_storage;
+  RenderColorImage(camera, show_window,
+                   GetBoundingCentersInCamera(&p_CSo_storage),
+                   color_image_out);
+}
+
+void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
+                                       ImageDepth32F* depth_image_out) const {
+  std::vector<Vector3d> p_CSo_storage;
+  RenderDepthImage(camera, GetBoundingCentersInCamera(&p_CSo_storage),
+                   depth_image_out);
+}
+
+void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
+                                       bool show_window,
+                                       ImageLabel16I* label_image_out) const {
+  std::vector<Vector3d> p_CSo_storage;
+  RenderLabelImage(camera, show_window,
+                   GetBoundingCentersInCamera(&p_CSo_storage),
+                   label_image_out);
+}
+
+void RenderEngineVtk::DoRenderImages(const RenderImageBatch& batch) {
+  // The distinct camera poses of the batch; e.g., the color, depth, and label
+  // cameras of a sensor usually share their pose.
+  std::vector<RigidTransformd> poses;
+  auto pose_index = [&poses](const RigidTransformd& X_WC) {
+    for (int i = 0; i < static_cast<int>(poses.size()); ++i) {
+      if (poses[i].IsExactlyEqualTo(X_WC)) return i;
+    }
+    poses.push_back(X_WC);
+    return static_cast<int>(poses.size()) - 1;
+  };
+  std::vector<int> color_poses, depth_poses, label_poses;
+  for (const auto& request : batch.color) {
+    color_poses.push_back(pose_index(request.X_WC));
+  }
+  for (const auto& request : batch.depth) {
+    depth_poses.push_back(pose_index(request.X_WC));
+  }
+  for (const auto& request : batch.label) {
+    label_poses.push_back(pose_index(request.X_WC));
+  }
+
+  // The images are rendered by the (possibly overridden) virtual methods,
+  // which find the centers of the current pose in batch_p_CSo_all_.
+  ScopeExit guard([this]() {
+    batch_p_CSo_all_ = nullptr;
+  });
+  for (int p = 0; p < static_cast<int>(poses.size()); ++p) {
+    UpdateViewpoint(poses[p]);
+    const std::vector<Vector3d> p_CSo_all = CalcBoundingCentersInCamera();
+    batch_p_CSo_all_ = &p_CSo_all;
+    for (int i = 0; i < static_cast<int>(batch.color.size()); ++i) {
+      if (color_poses[i] != p) continue;
+      const ColorRenderRequest& request = batch.color[i];
+      RenderColorImage(request.camera, request.show_window, request.image);
+    }
+    for (int i = 0; i < static_cast<int>(batch.depth.size()); ++i) {
+      if (depth_poses[i] != p) continue;
+      const DepthRenderRequest& request = batch.depth[i];
+      RenderDepthImage(request.camera, request.image);
+    }
+    for (int i = 0; i < static_cast<int>(batch.label.size()); ++i) {
+      if (label_poses[i] != p) continue;
+      const LabelRenderRequest& request = batch.label[i];
+      RenderLabelImage(request.camera, request.show_window, request.image);
+    }
+  }
+}
+
+void RenderEngineVtk::RenderColorImage(const CameraProperties& camera,
+                                       bool show_window,
+                                       const std::vector<Vector3d>& p_CSo_all,
+                                       ImageRgba8U* color_image_out) const {
   UpdateWindow(camera, show_window, pipelines_[ImageType::kColor].get(),
                "Color Image");
+  PrepareActors(camera, kClippingPlaneFar, ImageType::kColor, p_CSo_all);
   PerformVtkUpdate(*pipelines_[ImageType::kColor]);
 
   // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
@@ -167,8 +268,10 @@ void RenderEngineVtk::RenderColorImage(const CameraProperties& camera,
 }
 
 void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
+                                       const std::vector<Vector3d>& p_CSo_all,
                                        ImageDepth32F* depth_image_out) const {
   UpdateWindow(camera, pipelines_[ImageType::kDepth].get());
+  PrepareActors(camera, camera.z_far, ImageType::kDepth, p_CSo_all);
   PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
 
   // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
@@ -178,22 +281,22 @@ void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
   ImageRgba8U image(camera.width, camera.height);
   pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
 
+  float* depth = depth_image_out->mutable_data();
+  const int width = depth_image_out->width();
   for (int v = 0; v < camera.height; ++v) {
     for (int u = 0; u < camera.width; ++u) {
-      if (image.at(u, v)[0] == 255u &&
-          image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] = InvalidDepth::kTooFar;
+      const uint8_t* rgba = std::as_const(image).at(u, v);
+      if (rgba[0] == 255u && rgba[1] == 255u && rgba[2] == 255u) {
+        depth[u + v * width] = InvalidDepth::kTooFar;
       } else {
         // Decoding three channel color values to a float value. For the detail,
         // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
+        float shader_value = rgba[0] + rgba[1] / 255. + rgba[2] / (255. * 255.);
 
         // Dividing by 255 so that the range gets to be [0, 1].
         shader_value /= 255.f;
         // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] =
+        depth[u + v * width] =
             CheckRangeAndConvertToMeters(shader_value, camera.z_near,
                                          camera.z_far);
       }
@@ -203,9 +306,11 @@ void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
 
 void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
                                        bool show_window,
+                                       const std::vector<Vector3d>& p_CSo_all,
                                        ImageLabel16I* label_image_out) const {
   UpdateWindow(camera, show_window, pipelines_[ImageType::kLabel].get(),
                "Label Image");
+  PrepareActors(camera, kClippingPlaneFar, ImageType::kLabel, p_CSo_all);
   PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
 
   // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
@@ -215,13 +320,16 @@ void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
   ImageRgba8U image(camera.width, camera.height);
   pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
 
+  int16_t* label = label_image_out->mutable_data();
+  const int width = label_image_out->width();
   ColorI color;
   for (int v = 0; v < camera.height; ++v) {
     for (int u = 0; u < camera.width; ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
+      const uint8_t* rgba = std::as_const(image).at(u, v);
+      color.r = rgba[0];
+      color.g = rgba[1];
+      color.b = rgba[2];
+      label[u + v * width] = RenderEngine::LabelFromColor(color);
     }
   }
 }
@@ -281,20 +389,34 @@ bool RenderEngineVtk::DoRegisterVisual(
     GeometryId id, const Shape& shape, const PerceptionProperties& properties,
     const RigidTransformd& X_FG) {
   // Note: the user_data interface on reification requires a non-const pointer.
-  RegistrationData data{properties, X_FG, id};
-  shape.Reify(this, &data);
+  RegistrationData data{properties, X_FG, id,
+                        GetVtkShapeKey(shape, properties)};
+  // Only the first geometry with a given shape creates its polygonal data; the
+  // others share it.
+  std::shared_ptr<const ShapeData> shape_data;
+  auto iter = shapes_.find(data.shape_key);
+  if (iter != shapes_.end()) shape_data = iter->second.lock();
+  if (shape_data != nullptr) {
+    ImplementInstance(std::move(shape_data), &data);
+  } else {
+    shape.Reify(this, &data);
+  }
   return true;
 }
 
 void RenderEngineVtk::DoUpdateVisualPose(GeometryId id,
                                          const RigidTransformd& X_WG) {
-  vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(X_WG);
+  // All of the actors of the geometry share its transform (the color actor is
+  // always connected), so updating it in place moves them all.
   // TODO(SeanCurtis-TRI): Perhaps provide the ability to specify actors for
   //  specific pipelines; i.e. only update the color actor or only the label
   //  actor, etc.
-  for (const auto& actor : actors_.at(id)) {
-    actor->SetUserTransform(vtk_X_WG);
-  }
+  vtkTransform* vtk_X_WG = vtkTransform::SafeDownCast(
+      actors_.at(id)[ImageType::kColor]->GetUserTransform());
+  DRAKE_DEMAND(vtk_X_WG != nullptr);
+  SetVtkTransform(X_WG, vtk_X_WG);
+  InstanceData& instance = instances_.at(id);
+  instance.p_WSo = X_WG * instance.shape->p_GSo;
 }
 
 bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
@@ -307,6 +429,14 @@ bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
       pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
     }
     actors_.erase(iter);
+    auto instance_iter = instances_.find(id);
+    const std::string key = instance_iter->second.shape->key;
+    instances_.erase(instance_iter);
+    // Forget the shape once no geometry uses it anymore.
+    auto shape_iter = shapes_.find(key);
+    if (shape_iter != shapes_.end() && shape_iter->second.expired()) {
+      shapes_.erase(shape_iter);
+    }
     return true;
   }
 
@@ -323,7 +453,12 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
                   make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>()}},
       default_diffuse_{other.default_diffuse_},
-      default_clear_color_{other.default_clear_color_} {
+      default_clear_color_{other.default_clear_color_},
+      frustum_culling_{other.frustum_culling_},
+      lod_min_triangles_{other.lod_min_triangles_},
+      X_WC_{other.X_WC_},
+      shapes_{other.shapes_},
+      instances_{other.instances_} {
   InitializePipelines();
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -334,6 +469,10 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
     DRAKE_DEMAND(clone_actors_ptr != nullptr);
     std::array<vtkSmartPointer<vtkActor>, kNumPipelines>& clone_actors =
         *clone_actors_ptr;
+    // The transforms are updated in place, so the clone needs its own copy.
+    vtkNew<vtkTransform> transform;
+    transform->SetMatrix(
+        source_actors[ImageType::kColor]->GetUserTransform()->GetMatrix());
     for (int i = 0; i < kNumPipelines; ++i) {
       // NOTE: source *should* be const; but none of the getters on the source
       // are const-compatible.
@@ -359,7 +498,9 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       }
 
       clone.SetMapper(source.GetMapper());
-      clone.SetUserTransform(source.GetUserTransform());
+      if (source.GetUserTransform() != nullptr) {
+        clone.SetUserTransform(transform.Get());
+      }
       // This is necessary because *terrain* has its lighting turned off. To
       // blindly handle arbitrary actors being flagged as terrain, we need
       // to treat all actors this way.
@@ -418,10 +559,7 @@ void RenderEngineVtk::InitializePipelines() {
     camera->SetViewAngle(90.0);  // Default to an arbitrary 90° field of view.
     // Initialize far plane to arbitrary value. In the case of depth it will be
     // overwritten by the depth camera's z-far value.
-    // TODO(SeanCurtis-TRI): Provide mechanism where user can set this value.
-    //  It's important to expose this as it will affect the efficacy of the
-    //  z-buffer.
-    camera->SetClippingRange(kClippingPlaneNear, 100.0);
+    camera->SetClippingRange(kClippingPlaneNear, kClippingPlaneFar);
     SetModelTransformMatrixToVtkCamera(camera, vtk_identity);
 
     pipeline->window->AddRenderer(pipeline->renderer.GetPointer());
@@ -475,22 +613,79 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
                                         void* user_data) {
   DRAKE_DEMAND(user_data != nullptr);
 
+  const RegistrationData& data =
+      *reinterpret_cast<RegistrationData*>(user_data);
+
+  auto shape = std::make_shared<ShapeData>();
+  shape->key = data.shape_key;
+  shape->mesh_filename = data.mesh_filename;
+
+  // Creates the mappers of the pipelines for the polygonal data at `port`.
+  auto make_mappers = [](vtkAlgorithmOutput* port) {
+    std::array<vtkSmartPointer<vtkMapper>, kNumPipelines> mappers;
+    for (int i = 0; i < kNumPipelines; ++i) {
+      vtkNew<vtkOpenGLPolyDataMapper> mapper;
+      if (i == ImageType::kDepth) {
+        // Sets vertex and fragment shaders only to the depth mapper.
+        mapper->SetVertexShaderCode(shaders::kDepthVS);
+        mapper->SetFragmentShaderCode(shaders::kDepthFS);
+        mapper->AddObserver(vtkCommand::UpdateShaderEvent,
+                            uniform_setting_callback_.Get());
+      }
+      mapper->SetInputConnection(port);
+      mappers[i] = mapper.Get();
+    }
+    return mappers;
+  };
+  shape->lods.push_back(make_mappers(source->GetOutputPort()));
+
+  // The bounding sphere of the shape's axis-aligned bounding box.
+  source->Update();
+  double bounds[6];
+  source->GetOutput()->GetBounds(bounds);
+  if (bounds[0] <= bounds[1]) {
+    const Vector3d lower(bounds[0], bounds[2], bounds[4]);
+    const Vector3d upper(bounds[1], bounds[3], bounds[5]);
+    shape->p_GSo = (lower + upper) / 2;
+    shape->radius = (upper - lower).norm() / 2;
+  } else {
+    // VTK reports inverted bounds for empty data; never cull such geometry.
+    shape->p_GSo.setZero();
+    shape->radius = std::numeric_limits<double>::infinity();
+  }
+
+  // Levels of detail for large meshes.
+  if (lod_min_triangles_ && data.mesh_filename) {
+    vtkNew<vtkTriangleFilter> triangle_filter;
+    triangle_filter->SetInputConnection(source->GetOutputPort());
+    triangle_filter->Update();
+    if (triangle_filter->GetOutput()->GetNumberOfPolys() >
+        *lod_min_triangles_) {
+      for (double reduction : kLodReductions) {
+        vtkNew<vtkQuadricDecimation> decimation;
+        decimation->SetInputConnection(triangle_filter->GetOutputPort());
+        decimation->SetTargetReduction(reduction);
+        decimation->Update();
+        shape->lods.push_back(make_mappers(decimation->GetOutputPort()));
+      }
+    }
+  }
+
+  shapes_[shape->key] = shape;
+  ImplementInstance(std::move(shape), user_data);
+}
+
+void RenderEngineVtk::ImplementInstance(std::shared_ptr<const ShapeData> shape,
+                                        void* user_data) {
+  DRAKE_DEMAND(user_data != nullptr);
+
+  // The actors are the only per-geometry VTK objects; they all reference the
+  // mappers (and so the polygonal data and its buffers) of the shape.
   std::array<vtkSmartPointer<vtkActor>, kNumPipelines> actors{
       vtkSmartPointer<vtkActor>::New(), vtkSmartPointer<vtkActor>::New(),
       vtkSmartPointer<vtkActor>::New()};
-  // Note: the mappers ultimately get referenced by the actors, so they do _not_
-  // get destroyed when this array goes out of scope.
-  std::array<vtkNew<vtkOpenGLPolyDataMapper>, kNumPipelines> mappers;
-
-  // Sets vertex and fragment shaders only to the depth mapper.
-  mappers[ImageType::kDepth]->SetVertexShaderCode(shaders::kDepthVS);
-  mappers[ImageType::kDepth]->SetFragmentShaderCode(shaders::kDepthFS);
-  mappers[ImageType::kDepth]->AddObserver(
-      vtkCommand::UpdateShaderEvent, uniform_setting_callback_.Get());
-
-  for (auto& mapper : mappers) {
-    mapper->SetInputConnection(source->GetOutputPort());
-  }
+  const std::array<vtkSmartPointer<vtkMapper>, kNumPipelines>& mappers =
+      shape->lods[0];
 
   const RegistrationData& data =
       *reinterpret_cast<RegistrationData*>(user_data);
@@ -499,6 +694,8 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
   // anchored geometry -- for all other values of F, it is dynamic and will be
   // re-written in the first pose update.
   vtkSmartPointer<vtkTransform> vtk_X_PG = ConvertToVtkTransform(data.X_FG);
+  InstanceData instance;
+  instance.p_WSo = data.X_FG * shape->p_GSo;
 
   // Adds the actor into the specified pipeline.
   auto connect_actor = [this, &actors, &mappers,
@@ -541,10 +738,10 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
       log()->warn("Requested diffuse map could not be found: {}",
                   diffuse_map_name);
     }
-    if (diffuse_map_name.empty() && data.mesh_filename) {
+    if (diffuse_map_name.empty() && shape->mesh_filename) {
       // This is the hack to search for mesh.png as a possible texture.
       const std::string alt_texture_name(
-          RemoveFileExtension(*data.mesh_filename) + ".png");
+          RemoveFileExtension(*shape->mesh_filename) + ".png");
       std::ifstream alt_file_exist(alt_texture_name);
       if (alt_file_exist) texture_name = alt_texture_name;
     }
@@ -578,8 +775,82 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
   // Depth actor; always gets wired in with no additional work.
   connect_actor(ImageType::kDepth);
 
+  // The decimation doesn't preserve texture coordinates, so textured meshes
+  // always use the full resolution.
+  instance.use_lods = shape->lods.size() > 1 && texture_name.empty();
+  instance.shape = std::move(shape);
+
   // Take ownership of the actors.
   actors_.insert({data.id, std::move(actors)});
+  instances_.insert({data.id, std::move(instance)});
+}
+
+std::vector<Vector3d> RenderEngineVtk::CalcBoundingCentersInCamera() const {
+  std::vector<Vector3d> p_CSo_all;
+  if (!frustum_culling_ && !lod_min_triangles_) return p_CSo_all;
+  const RigidTransformd X_CW = X_WC_.inverse();
+  p_CSo_all.reserve(instances_.size());
+  for (const auto& id_instance : instances_) {
+    p_CSo_all.push_back(X_CW * id_instance.second.p_WSo);
+  }
+  return p_CSo_all;
+}
+
+const std::vector<Vector3d>& RenderEngineVtk::GetBoundingCentersInCamera(
+    std::vector<Vector3d>* storage) const {
+  if (batch_p_CSo_all_ != nullptr) return *batch_p_CSo_all_;
+  *storage = CalcBoundingCentersInCamera();
+  return *storage;
+}
+
+void RenderEngineVtk::PrepareActors(
+    const CameraProperties& camera, double z_far, int pipeline,
+    const std::vector<Vector3d>& p_CSo_all) const {
+  if (!frustum_culling_ && !lod_min_triangles_) return;
+  DRAKE_DEMAND(p_CSo_all.size() == instances_.size());
+
+  // In the camera frame C, the camera looks along +Cz with +Cx to the right
+  // and +Cy down. The side planes of the frustum pass through Co; e.g., the
+  // signed distance from the point p_CQ to the right plane is
+  // x cos(θx) - z sin(θx), where θx is half of the horizontal field of view.
+  const double tan_y = std::tan(camera.fov_y / 2);
+  const double tan_x = tan_y * camera.width / camera.height;
+  const double cos_x = 1 / std::sqrt(1 + tan_x * tan_x);
+  const double sin_x = tan_x * cos_x;
+  const double cos_y = 1 / std::sqrt(1 + tan_y * tan_y);
+  const double sin_y = tan_y * cos_y;
+  // The focal length in pixels, which measures the spheres on the image.
+  const double focal_y = camera.height / (2 * tan_y);
+
+  int index = 0;
+  for (const auto& [id, instance] : instances_) {
+    vtkActor* actor = actors_.at(id)[pipeline];
+    const ShapeData& shape = *instance.shape;
+    const Vector3d& p_CSo = p_CSo_all[index++];
+    const double r = shape.radius;
+    if (frustum_culling_) {
+      const bool visible =
+          p_CSo.z() + r >= kClippingPlaneNear && p_CSo.z() - r <= z_far &&
+          std::abs(p_CSo.x()) * cos_x - p_CSo.z() * sin_x <= r &&
+          std::abs(p_CSo.y()) * cos_y - p_CSo.z() * sin_y <= r;
+      actor->SetVisibility(visible);
+      if (!visible) continue;
+    }
+    if (instance.use_lods) {
+      // Use the full resolution when Co is inside the sphere.
+      const int coarsest = static_cast<int>(shape.lods.size()) - 1;
+      int level = 0;
+      if (p_CSo.z() > r) {
+        const double pixels = 2 * r * focal_y / p_CSo.z();
+        for (double min_pixels = kLodPixels;
+             level < coarsest && pixels < min_pixels; min_pixels /= 4) {
+          ++level;
+        }
+      }
+      // SetMapper() is a no-op when the mapper doesn't change.
+      actor->SetMapper(shape.lods[level][pipeline]);
+    }
+  }
 }
 
 void RenderEngineVtk::SetDefaultLightPosition(const Vector3<double>& X_DL) {
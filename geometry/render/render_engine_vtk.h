@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -11,6 +12,7 @@
 #include <vtkCommand.h>
 #include <vtkImageExport.h>
 #include <vtkLight.h>
+#include <vtkMapper.h>
 #include <vtkNew.h>
 #include <vtkPolyDataAlgorithm.h>
 #include <vtkRenderWindow.h>
@@ -20,9 +22,11 @@
 #include <vtkWindowToImageFilter.h>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/geometry/render/render_label.h"
+#include "drake/math/rigid_transform.h"
 
 #ifndef DRAKE_DOXYGEN_CXX
 // This, and the ModuleInitVtkRenderingOpenGL2, provide the basis for enabling
@@ -175,6 +179,13 @@ class RenderEngineVtk : public RenderEngine,
   // @see RenderEngine::DoClone().
   std::unique_ptr<RenderEngine> DoClone() const override;
 
+  // @see RenderEngine::DoRenderImages(). The requests are grouped by camera
+  // pose, so that the viewpoint is set, and the geometry is measured in the
+  // camera frame for the culling, once per distinct pose. Each image is then
+  // rendered by the virtual RenderColorImage(), RenderDepthImage() or
+  // RenderLabelImage(), so that subclasses' overrides apply to batches too.
+  void DoRenderImages(const RenderImageBatch& batch) override;
+
   // Initializes the VTK pipelines.
   void InitializePipelines();
 
@@ -183,9 +194,19 @@ class RenderEngineVtk : public RenderEngine,
   void ImplementObj(const std::string& file_name, double scale,
                     void* user_data);
 
-  // Performs the common setup for all shape types.
+  // Performs the common setup for all shape types: creates the data shared by
+  // all of the geometries with the shape of `source` and then the geometry's
+  // actors.
   void ImplementGeometry(vtkPolyDataAlgorithm* source, void* user_data);
 
+  // Forward declaration; see below.
+  struct ShapeData;
+
+  // Creates the actors of the geometry being registered, which use the shared
+  // data of its `shape`.
+  void ImplementInstance(std::shared_ptr<const ShapeData> shape,
+                         void* user_data);
+
   // The rendering pipeline for a single image type (color, depth, or label).
   struct RenderingPipeline {
     vtkNew<vtkRenderer> renderer;
@@ -208,11 +229,72 @@ class RenderEngineVtk : public RenderEngine,
   void UpdateWindow(const DepthCameraProperties& camera,
                     const RenderingPipeline* p) const;
 
+  // Computes the center of the bounding sphere of each registered geometry,
+  // in the iteration order of instances_, measured and expressed in the camera
+  // frame of the current viewpoint. It is empty if neither the frustum culling
+  // nor the levels of detail are enabled, as only PrepareActors() uses it.
+  std::vector<Vector3<double>> CalcBoundingCentersInCamera() const;
+
+  // Returns the centers that DoRenderImages() computed for the current
+  // viewpoint, if it is rendering a batch, or else computes them into
+  // `storage`.
+  const std::vector<Vector3<double>>& GetBoundingCentersInCamera(
+      std::vector<Vector3<double>>* storage) const;
+
+  // Hides the actors of the given `pipeline` whose geometries lie outside of
+  // the view frustum of `camera` (ending at the far clipping plane `z_far`) and
+  // selects the levels of detail of the others. See MakeRenderEngineVtk().
+  // `p_CSo_all` holds the centers computed by CalcBoundingCentersInCamera().
+  void PrepareActors(const CameraProperties& camera, double z_far, int pipeline,
+                     const std::vector<Vector3<double>>& p_CSo_all) const;
+
+  // The implementations of RenderColorImage(), RenderDepthImage(), and
+  // RenderLabelImage() for the current viewpoint, whose geometry centers
+  // `p_CSo_all` have already been computed.
+  void RenderColorImage(const CameraProperties& camera, bool show_window,
+                        const std::vector<Vector3<double>>& p_CSo_all,
+                        systems::sensors::ImageRgba8U* color_image_out) const;
+  void RenderDepthImage(const DepthCameraProperties& camera,
+                        const std::vector<Vector3<double>>& p_CSo_all,
+                        systems::sensors::ImageDepth32F* depth_image_out) const;
+  void RenderLabelImage(const CameraProperties& camera, bool show_window,
+                        const std::vector<Vector3<double>>& p_CSo_all,
+                        systems::sensors::ImageLabel16I* label_image_out) const;
+
   void SetDefaultLightPosition(const Vector3<double>& X_DL) override;
 
   // Three pipelines: rgb, depth, and label.
   static constexpr int kNumPipelines = 3;
 
+  // The data shared by all of the geometries with the same shape (see
+  // GetVtkShapeKey()): the polygonal data, through its mappers, and its
+  // bounding sphere.
+  struct ShapeData {
+    // The key of the shape in shapes_.
+    std::string key;
+    // The file name if the shape is a mesh.
+    std::optional<std::string> mesh_filename;
+    // The mappers of each pipeline for the levels of detail, from the full
+    // resolution to the coarsest one; only meshes have more than one.
+    std::vector<std::array<vtkSmartPointer<vtkMapper>, kNumPipelines>> lods;
+    // The center So of the bounding sphere, measured and expressed in the
+    // geometry frame.
+    Vector3<double> p_GSo;
+    // The radius of the sphere; infinite for shapes that are never culled.
+    double radius{};
+  };
+
+  // The per-geometry data used to cull a registered geometry and to select
+  // its level of detail.
+  struct InstanceData {
+    std::shared_ptr<const ShapeData> shape;
+    // The center of the bounding sphere, measured and expressed in the world
+    // frame.
+    Vector3<double> p_WSo;
+    // True if the geometry uses the coarser levels of detail of its shape.
+    bool use_lods{};
+  };
+
   std::array<std::unique_ptr<RenderingPipeline>, kNumPipelines> pipelines_;
 
   vtkNew<vtkLight> light_;
@@ -243,6 +325,27 @@ class RenderEngineVtk : public RenderEngine,
   // depth, and label) keyed by the geometry's GeometryId.
   std::unordered_map<GeometryId, std::array<vtkSmartPointer<vtkActor>, 3>>
       actors_;
+
+  // See RenderEngineVtkParams.
+  bool frustum_culling_{true};
+  std::optional<int> lod_min_triangles_;
+
+  // The pose of the camera set by UpdateViewpoint().
+  math::RigidTransformd X_WC_;
+
+  // While DoRenderImages() renders the images of one camera pose, the
+  // bounding centers it computed for that pose; nullptr otherwise (and after
+  // any other call to UpdateViewpoint()).
+  const std::vector<Vector3<double>>* batch_p_CSo_all_{};
+
+  // The shared data of the shapes of the registered geometries, keyed by
+  // GetVtkShapeKey(). An entry expires when the last geometry with its shape
+  // is removed from this engine and its clones.
+  std::unordered_map<std::string, std::weak_ptr<const ShapeData>> shapes_;
+
+  // The instance data of each geometry, keyed like actors_. Like the mappers,
+  // the shape data is shared across clones.
+  std::unordered_map<GeometryId, InstanceData> instances_;
 };
 
 }  // namespace render
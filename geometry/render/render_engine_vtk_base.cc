@@ -1,9 +1,11 @@
 #include "drake/geometry/render/render_engine_vtk_base.h"
 
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
 #include "third_party/com_github_finetjul_bender/vtkCapsuleSource.h"
 #include <vtkCellArray.h>
 #include <vtkFloatArray.h>
@@ -226,6 +228,65 @@ class DrakeCubeSource : public vtkPolyDataAlgorithm {
   void operator=(const DrakeCubeSource&) = delete;
 };
 
+// Computes the keys of GetVtkShapeKey(). The key of a shape holds all of the
+// parameters its polygonal data depends on; fmt prints each double in its
+// shortest exact representation, so different values give different keys.
+class ShapeKeyReifier final : public ShapeReifier {
+ public:
+  explicit ShapeKeyReifier(const PerceptionProperties& properties)
+      : properties_(properties) {}
+
+  std::string GetKey(const Shape& shape) {
+    shape.Reify(this);
+    return key_;
+  }
+
+  using ShapeReifier::ImplementGeometry;
+
+  void ImplementGeometry(const Sphere& sphere, void*) final {
+    key_ = fmt::format("Sphere({})", sphere.radius());
+  }
+
+  void ImplementGeometry(const Cylinder& cylinder, void*) final {
+    key_ = fmt::format("Cylinder({}, {})", cylinder.radius(),
+                       cylinder.length());
+  }
+
+  void ImplementGeometry(const HalfSpace&, void*) final {
+    key_ = "HalfSpace";
+  }
+
+  // The texture coordinates of a box depend on its texture scale.
+  void ImplementGeometry(const Box& box, void*) final {
+    const Vector2d& uv_scale = properties_.GetPropertyOrDefault(
+        "phong", "diffuse_scale", Vector2d{1, 1});
+    key_ = fmt::format("Box({}, {}, {}, {}, {})", box.width(), box.depth(),
+                       box.height(), uv_scale[0], uv_scale[1]);
+  }
+
+  void ImplementGeometry(const Capsule& capsule, void*) final {
+    key_ = fmt::format("Capsule({}, {})", capsule.radius(), capsule.length());
+  }
+
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void*) final {
+    key_ = fmt::format("Ellipsoid({}, {}, {})", ellipsoid.a(), ellipsoid.b(),
+                       ellipsoid.c());
+  }
+
+  // Meshes and convex shapes are both loaded from their obj files.
+  void ImplementGeometry(const Mesh& mesh, void*) final {
+    key_ = fmt::format("Obj({}, {})", mesh.scale(), mesh.filename());
+  }
+
+  void ImplementGeometry(const Convex& convex, void*) final {
+    key_ = fmt::format("Obj({}, {})", convex.scale(), convex.filename());
+  }
+
+ private:
+  const PerceptionProperties& properties_;
+  std::string key_;
+};
+
 }  // namespace
 
 vtkSmartPointer<vtkPolyDataAlgorithm> CreateVtkCapsule(const Capsule& capsule) {
@@ -303,6 +364,30 @@ void TransformToDrakeCylinder(vtkTransform* transform,
   transform_filter->Update();
 }
 
+std::string GetVtkShapeKey(const Shape& shape,
+                           const PerceptionProperties& properties) {
+  return ShapeKeyReifier(properties).GetKey(shape);
+}
+
+void SetVtkTransform(const math::RigidTransformd& X_AB,
+                     vtkTransform* transform) {
+  // The row-major elements of the homogeneous matrix.
+  double elements[16];
+  for (int i = 0; i < 3; ++i) {
+    const auto& row = X_AB.rotation().row(i);
+    for (int j = 0; j < 3; ++j) {
+      elements[4 * i + j] = row(j);
+    }
+    elements[4 * i + 3] = X_AB.translation()(i);
+  }
+  elements[12] = elements[13] = elements[14] = 0;
+  elements[15] = 1;
+  transform->SetMatrix(elements);
+  // The actors read the transform's matrix, which is only recomputed when the
+  // transform is updated.
+  transform->Update();
+}
+
 }  // namespace render
 }  // namespace geometry
 }  // namespace drake
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include <vtkCylinderSource.h>
 #include <vtkSmartPointer.h>
 #include <vtkTexturedSphereSource.h>
@@ -8,6 +10,7 @@
 
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
 
 namespace drake {
 namespace geometry {
@@ -39,6 +42,20 @@ void TransformToDrakeCylinder(vtkTransform* transform,
                               vtkTransformPolyDataFilter* transform_filter,
                               vtkCylinderSource* vtk_cylinder);
 
+// Returns a key that identifies the polygonal data the VTK-based render
+// engines create for `shape` registered with `properties`. Shapes with equal
+// keys produce identical polygonal data (e.g., two boxes with the same size and
+// texture scale, or a Mesh and a Convex of the same file and scale), so the
+// engines create it once and share it among them.
+std::string GetVtkShapeKey(const Shape& shape,
+                           const PerceptionProperties& properties);
+
+// Sets the matrix of `transform` to the given pose, in place. Unlike
+// replacing the transform, this allocates nothing, and everything that
+// references `transform` sees the new pose.
+void SetVtkTransform(const math::RigidTransformd& X_AB,
+                     vtkTransform* transform);
+
 }  // namespace render
 }  // namespace geometry
 }  // namespace drake
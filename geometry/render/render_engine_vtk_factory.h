@@ -23,6 +23,16 @@ struct RenderEngineVtkParams  {
    channel in the range [0, 1]). The default value (in byte values) would be
    [204, 229, 255].  */
   Eigen::Vector3d default_clear_color{204 / 255., 229 / 255., 255 / 255.};
+
+  /** If true, geometries that lie entirely outside of a camera's view frustum
+   are hidden from VTK while that camera's image is rendered. See
+   @ref render_engine_vtk_culling "here" for details.  */
+  bool frustum_culling{true};
+
+  /** The (optional) number of triangles above which a Mesh or Convex shape
+   gets coarser levels of detail. If omitted, all shapes are always rendered at
+   full resolution. See @ref render_engine_vtk_culling "here" for details.  */
+  std::optional<int> lod_min_triangles{};
 };
 
 /** Constructs a RenderEngine implementation which uses a VTK-based OpenGL
@@ -79,6 +89,38 @@ struct RenderEngineVtkParams  {
  e.g., render label validation).
  <!-- TODO(SeanCurtis-TRI): Change this policy to be more selective when other
       renderers with different properties are introduced. -->
+
+ @anchor render_engine_vtk_shared_shapes
+ <h2>Shared polygonal data</h2>
+
+ Geometries with identical shapes share their polygonal data. Only the first
+ geometry registered with a shape (e.g., a Box of a given size and texture
+ scale, or a Mesh of a given file and scale) creates its VTK data and mappers,
+ and with them the vertex buffers on the GPU; every other geometry with the same
+ shape only adds its own actors, which reference them and hold its pose,
+ material and label. Scenes with many identical objects (e.g., a bin full of
+ the same part) thus keep a single copy of the data of each shape. The data of
+ a shape is released once all of the geometries with that shape are removed.
+
+ @anchor render_engine_vtk_culling
+ <h2>Culling and levels of detail</h2>
+
+ When a geometry is registered, %RenderEngineVtk computes a bounding sphere of
+ its polygonal data. Before rendering an image, the spheres are tested against
+ the camera's view frustum (bounded by the near and far clipping planes), and
+ the geometries whose spheres lie entirely outside of it are hidden, so that
+ VTK doesn't spend any per-object work on them. The test is conservative and
+ does not change the rendered images. It can be disabled with
+ RenderEngineVtkParams::frustum_culling.
+
+ If RenderEngineVtkParams::lod_min_triangles is given, each untextured Mesh or
+ Convex with more triangles than that also gets two decimated levels of detail
+ with a quarter and a sixteenth of its triangles. Each image uses the level
+ that matches the size, in pixels, of the geometry's bounding sphere on the
+ image: full resolution at 256 pixels and above, the first level down to 64
+ pixels, and the coarsest level below that. Since the coarser levels only
+ approximate the mesh, they do change the rendered images (slightly, for
+ small, distant meshes).
  */
 std::unique_ptr<RenderEngine> MakeRenderEngineVtk(
     const RenderEngineVtkParams& params);
@@ -0,0 +1,539 @@
+#include "drake/geometry/render/render_engine_cpu.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/render/camera_properties.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using std::make_unique;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+
+// Default camera properties; they match those of render_engine_vtk_test.cc.
+const int kWidth = 640;
+const int kHeight = 480;
+const double kZNear = 0.5;
+const double kZFar = 5.;
+const double kFovY = M_PI_4;
+const bool kShowWindow = false;
+
+// See render_engine_vtk_test.cc for the reasons for this tolerance: the pixel
+// centers around the center of the image don't exactly sample the peak of the
+// shapes. The tessellation of the curved shapes adds to it.
+const double kDepthTolerance = 1e-3;
+
+const float kDefaultDistance{3.f};
+
+// The amount inset from the edge of the images to *still* expect ground plane
+// values.
+static constexpr int kInset{10};
+
+// Holds `(x, y)` indices of the screen coordinate system where the ranges of
+// `x` and `y` are [0, image_width) and [0, image_height) respectively.
+struct ScreenCoord {
+  int x{};
+  int y{};
+};
+
+std::ostream& operator<<(std::ostream& out, const ScreenCoord& c) {
+  out << "(" << c.x << ", " << c.y << ")";
+  return out;
+}
+
+// This test suite facilitates a test with a ground plane and floating shape.
+// The camera is positioned above the shape looking straight down. The shape
+// is centered in the image and the ground plane fills the rest of it; the
+// tests examine the center pixel and pixels inset from each corner.
+class RenderEngineCpuTest : public ::testing::Test {
+ public:
+  RenderEngineCpuTest()
+      : depth_(kWidth, kHeight),
+        label_(kWidth, kHeight),
+        // Looking straight down from kDefaultDistance meters above the ground.
+        X_WC_(RotationMatrixd{AngleAxisd(M_PI, Vector3d::UnitY()) *
+                              AngleAxisd(-M_PI_2, Vector3d::UnitZ())},
+              {0, 0, kDefaultDistance}),
+        geometry_id_(GeometryId::get_new_id()) {}
+
+ protected:
+  // Renders the depth and label images with the given renderer (defaults to
+  // renderer_) into the member images.
+  void Render(const RenderEngineCpu* renderer = nullptr) {
+    if (!renderer) renderer = renderer_.get();
+    renderer->RenderDepthImage(camera_, &depth_);
+    renderer->RenderLabelImage(camera_, kShowWindow, &label_);
+  }
+
+  // Confirms that all pixels in the member label image have the same value.
+  void VerifyUniformLabel(int16_t label) {
+    for (int y = 0; y < kHeight; ++y) {
+      for (int x = 0; x < kWidth; ++x) {
+        ASSERT_EQ(label_.at(x, y)[0], label)
+            << "At pixel (" << x << ", " << y << ")";
+      }
+    }
+  }
+
+  // Confirms that all pixels in the member depth image have the same value.
+  void VerifyUniformDepth(float depth) {
+    for (int y = 0; y < kHeight; ++y) {
+      for (int x = 0; x < kWidth; ++x) {
+        if (depth == std::numeric_limits<float>::infinity() || depth == 0) {
+          ASSERT_EQ(depth_.at(x, y)[0], depth);
+        } else {
+          ASSERT_NEAR(depth_.at(x, y)[0], depth, kDepthTolerance);
+        }
+      }
+    }
+  }
+
+  // Tests that don't instantiate their own renderers should invoke this.
+  void Init(const RigidTransformd& X_WR, bool add_terrain = false,
+            int num_threads = 1) {
+    RenderEngineCpuParams params;
+    params.num_threads = num_threads;
+    renderer_ = make_unique<RenderEngineCpu>(params);
+    renderer_->UpdateViewpoint(X_WR);
+    if (add_terrain) {
+      PerceptionProperties material;
+      material.AddProperty("label", "id", RenderLabel::kDontCare);
+      renderer_->RegisterVisual(GeometryId::get_new_id(), HalfSpace(),
+                                material, RigidTransformd::Identity(),
+                                false /** needs update */);
+    }
+  }
+
+  PerceptionProperties simple_material() const {
+    PerceptionProperties material;
+    material.AddProperty("label", "id", expected_label_);
+    return material;
+  }
+
+  // Populates the given renderer with a sphere of radius 0.5 whose top is
+  // 2 meters from the camera.
+  void PopulateSphereTest(RenderEngineCpu* renderer) {
+    Sphere sphere{0.5};
+    expected_label_ = RenderLabel(12345);  // an arbitrary value.
+    renderer->RegisterVisual(geometry_id_, sphere, simple_material(),
+                             RigidTransformd::Identity(),
+                             true /* needs update */);
+    renderer->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+        {geometry_id_, RigidTransformd{Vector3d{0, 0, 0.5}}}});
+  }
+
+  // Performs the work to test the rendering with a shape centered in the
+  // image. To pass, the renderer will have to have been populated with a
+  // compatible shape and camera configuration (e.g., PopulateSphereTest()).
+  void PerformCenterShapeTest(const RenderEngineCpu* renderer,
+                              const char* name) {
+    Render(renderer);
+    const vector<ScreenCoord> outliers{
+        {kInset, kInset},
+        {kInset, kHeight - kInset - 1},
+        {kWidth - kInset - 1, kHeight - kInset - 1},
+        {kWidth - kInset - 1, kInset}};
+    for (const ScreenCoord& p : outliers) {
+      EXPECT_NEAR(depth_.at(p.x, p.y)[0], kDefaultDistance, kDepthTolerance)
+          << "Depth at: " << p << " for test: " << name;
+      EXPECT_EQ(label_.at(p.x, p.y)[0], RenderLabel::kDontCare)
+          << "Label at: " << p << " for test: " << name;
+    }
+    const ScreenCoord inlier{kWidth / 2, kHeight / 2};
+    EXPECT_NEAR(depth_.at(inlier.x, inlier.y)[0], expected_object_depth_,
+                kDepthTolerance)
+        << "Depth at: " << inlier << " for test: " << name;
+    EXPECT_EQ(label_.at(inlier.x, inlier.y)[0],
+              static_cast<int>(expected_label_))
+        << "Label at: " << inlier << " for test: " << name;
+  }
+
+  float expected_object_depth_{2.f};
+  RenderLabel expected_label_;
+
+  const DepthCameraProperties camera_ = {kWidth, kHeight, kFovY, "unused",
+                                         kZNear, kZFar};
+
+  ImageDepth32F depth_;
+  ImageLabel16I label_;
+  RigidTransformd X_WC_;
+  GeometryId geometry_id_;
+
+  unique_ptr<RenderEngineCpu> renderer_;
+};
+
+// Tests an empty image -- confirms that it clears to the "empty" values.
+TEST_F(RenderEngineCpuTest, NoBodyTest) {
+  Init(RigidTransformd::Identity());
+  Render();
+
+  VerifyUniformLabel(RenderLabel::kEmpty);
+  VerifyUniformDepth(std::numeric_limits<float>::infinity());
+}
+
+TEST_F(RenderEngineCpuTest, ColorImageThrows) {
+  Init(X_WC_, true);
+  ImageRgba8U color(kWidth, kHeight);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer_->RenderColorImage(camera_, kShowWindow, &color),
+      std::runtime_error, "RenderEngineCpu cannot render color images");
+}
+
+TEST_F(RenderEngineCpuTest, InvalidParameters) {
+  RenderEngineCpuParams params;
+  params.num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineCpu{params}, std::exception,
+                              ".*num_threads_ > 0.*");
+  EXPECT_GT(RenderEngineCpu().num_threads(), 0);
+}
+
+// Tests an image with *only* terrain (perpendicular to the camera's forward
+// direction), at distances inside and outside the depth range.
+TEST_F(RenderEngineCpuTest, TerrainTest) {
+  Init(X_WC_, true);
+  const Vector3d p_WR = X_WC_.translation();
+
+  for (auto depth : std::array<float, 2>({{2.f, 4.9999f}})) {
+    X_WC_.set_translation({p_WR(0), p_WR(1), depth});
+    renderer_->UpdateViewpoint(X_WC_);
+    Render();
+    VerifyUniformLabel(RenderLabel::kDontCare);
+    VerifyUniformDepth(depth);
+  }
+
+  // Closer than kZNear.
+  X_WC_.set_translation({p_WR(0), p_WR(1), kZNear - 1e-5});
+  renderer_->UpdateViewpoint(X_WC_);
+  Render();
+  VerifyUniformLabel(RenderLabel::kDontCare);
+  VerifyUniformDepth(InvalidDepth::kTooClose);
+
+  // Farther than kZFar; the label image doesn't have a depth range.
+  X_WC_.set_translation({p_WR(0), p_WR(1), kZFar + 1e-3});
+  renderer_->UpdateViewpoint(X_WC_);
+  Render();
+  VerifyUniformLabel(RenderLabel::kDontCare);
+  VerifyUniformDepth(InvalidDepth::kTooFar);
+}
+
+// Positions the camera such that a horizon between terrain and sky appears.
+TEST_F(RenderEngineCpuTest, HorizonTest) {
+  // Camera at the origin, pointing in a direction parallel to the ground.
+  RigidTransformd X_WR{RotationMatrixd{AngleAxisd(-M_PI_2, Vector3d::UnitX()) *
+                                       AngleAxisd(M_PI_2, Vector3d::UnitY())}};
+  Init(X_WR, true);
+
+  // Returns the row of the horizon in the image, for the terrain patch whose
+  // far edge is 50 m away.
+  auto CalcHorizon = [](double z) {
+    const double kTerrainHalfSize = 50.;
+    const double kFocalLength = kHeight * 0.5 / std::tan(0.5 * kFovY);
+    return 0.5 * kHeight + z / kTerrainHalfSize * kFocalLength;
+  };
+
+  const Vector3d p_WR = X_WR.translation();
+  for (const double z : {2., 1., 0.5}) {
+    X_WR.set_translation({p_WR(0), p_WR(1), z});
+    renderer_->UpdateViewpoint(X_WR);
+    Render();
+
+    int actual_horizon{0};
+    for (int y = 0; y < kHeight; ++y) {
+      if (label_.at(0, y)[0] != RenderLabel::kEmpty) {
+        actual_horizon = y;
+        break;
+      }
+    }
+    ASSERT_NEAR(CalcHorizon(z), actual_horizon, 1.001);
+  }
+}
+
+TEST_F(RenderEngineCpuTest, BoxTest) {
+  Init(X_WC_, true);
+  Box box(1.999, 0.55, 0.75);
+  expected_label_ = RenderLabel(1);
+  const GeometryId id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id, box, simple_material(),
+                            RigidTransformd::Identity(),
+                            true /* needs update */);
+  // Position the box so that one corner is just beyond the center of the
+  // image, such that the center pixel is fully covered by the near face.
+  const RigidTransformd X_WV{
+      RotationMatrixd{AngleAxisd(M_PI, Vector3d::UnitX())},
+      Vector3d{-box.width() * 0.49, -box.depth() * 0.49, 0.625}};
+  renderer_->UpdatePoses(
+      unordered_map<GeometryId, RigidTransformd>{{id, X_WV}});
+  PerformCenterShapeTest(renderer_.get(), "Box test");
+}
+
+TEST_F(RenderEngineCpuTest, SphereTest) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+  PerformCenterShapeTest(renderer_.get(), "Sphere test");
+}
+
+TEST_F(RenderEngineCpuTest, CapsuleUnsupported) {
+  Init(X_WC_, true);
+  expected_label_ = RenderLabel(1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer_->RegisterVisual(GeometryId::get_new_id(), Capsule(0.1, 0.2),
+                                simple_material(), RigidTransformd::Identity(),
+                                true /* needs update */),
+      std::runtime_error, ".*does not support Capsule.*");
+}
+
+TEST_F(RenderEngineCpuTest, CylinderTest) {
+  Init(X_WC_, true);
+  Cylinder cylinder(0.2, 1.2);
+  expected_label_ = RenderLabel(2);
+  const GeometryId id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id, cylinder, simple_material(),
+                            RigidTransformd::Identity(),
+                            true /* needs update */);
+  // Position the top of the cylinder to be 1 m above the terrain.
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {id, RigidTransformd{Vector3d{0, 0, 0.4}}}});
+  PerformCenterShapeTest(renderer_.get(), "Cylinder test");
+}
+
+// Performs the shape-centered-in-the-image test with an ellipsoid rotated
+// three different ways for confirming each extent axis.
+TEST_F(RenderEngineCpuTest, EllipsoidTest) {
+  Init(X_WC_, true);
+  const double a = 0.25;
+  const double b = 0.4;
+  const double c = 0.5;
+  expected_label_ = RenderLabel(2);
+  const GeometryId id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id, Ellipsoid(a, b, c), simple_material(),
+                            RigidTransformd::Identity(),
+                            true /* needs update */);
+
+  const double target_z = 1.0;
+  const std::vector<std::pair<RotationMatrixd, double>> poses{
+      {RotationMatrixd(), c},
+      {RotationMatrixd{AngleAxisd(-M_PI / 2, Vector3d::UnitX())}, b},
+      {RotationMatrixd{AngleAxisd(M_PI / 2, Vector3d::UnitY())}, a}};
+  for (const auto& [R_WV, extent] : poses) {
+    renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+        {id, RigidTransformd{R_WV, Vector3d{0, 0, target_z - extent}}}});
+    PerformCenterShapeTest(renderer_.get(), "Ellipsoid test");
+  }
+}
+
+// Performs the shape-centered-in-the-image test with a mesh (which happens to
+// be a box).
+TEST_F(RenderEngineCpuTest, MeshTest) {
+  Init(X_WC_, true);
+  const std::string filename =
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.obj");
+  expected_label_ = RenderLabel(3);
+  const GeometryId id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id, Mesh(filename), simple_material(),
+                            RigidTransformd::Identity(),
+                            true /* needs update */);
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {id, RigidTransformd::Identity()}});
+  PerformCenterShapeTest(renderer_.get(), "Mesh test");
+
+  // The same file as a convex shape shares the loaded mesh.
+  const GeometryId convex_id = GeometryId::get_new_id();
+  expected_label_ = RenderLabel(4);
+  renderer_->RegisterVisual(convex_id, Convex(filename, 1.0), simple_material(),
+                            RigidTransformd::Identity(),
+                            true /* needs update */);
+  renderer_->RemoveGeometry(id);
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {convex_id, RigidTransformd::Identity()}});
+  PerformCenterShapeTest(renderer_.get(), "Convex test");
+}
+
+// Confirms that the images don't depend on the number of threads; the tiles
+// rasterize the triangles in the same order regardless.
+TEST_F(RenderEngineCpuTest, ThreadCountIndependence) {
+  vector<ImageDepth32F> depths;
+  vector<ImageLabel16I> labels;
+  for (const int num_threads : {1, 4}) {
+    Init(X_WC_, true, num_threads);
+    EXPECT_EQ(renderer_->num_threads(), num_threads);
+    PopulateSphereTest(renderer_.get());
+    renderer_->RegisterVisual(
+        GeometryId::get_new_id(), Box(0.4, 2.5, 0.3), simple_material(),
+        RigidTransformd{RotationMatrixd::MakeZRotation(0.3),
+                        Vector3d{0.2, -0.1, 0.6}},
+        false /* needs update */);
+    Render();
+    depths.push_back(depth_);
+    labels.push_back(label_);
+  }
+  EXPECT_TRUE(std::equal(depths[0].at(0, 0),
+                         depths[0].at(0, 0) + depths[0].size(),
+                         depths[1].at(0, 0)));
+  EXPECT_TRUE(std::equal(labels[0].at(0, 0),
+                         labels[0].at(0, 0) + labels[0].size(),
+                         labels[1].at(0, 0)));
+}
+
+// Confirms that rendering a batch of images produces the same images as
+// rendering them one at a time, both when the views share the threads and when
+// each view uses them all.
+TEST_F(RenderEngineCpuTest, RenderImages) {
+  auto same_pixels = [](const auto& image1, const auto& image2) {
+    return std::equal(image1.at(0, 0), image1.at(0, 0) + image1.size(),
+                      image2.at(0, 0));
+  };
+  const RigidTransformd X_WC2(X_WC_.rotation(),
+                              X_WC_.translation() + Vector3d(0.3, 0, 0));
+  for (const int num_threads : {1, 4}) {
+    Init(X_WC_, true, num_threads);
+    PopulateSphereTest(renderer_.get());
+    renderer_->RegisterVisual(
+        GeometryId::get_new_id(), Box(0.4, 2.5, 0.3), simple_material(),
+        RigidTransformd{RotationMatrixd::MakeZRotation(0.3),
+                        Vector3d{0.2, -0.1, 0.6}},
+        false /* needs update */);
+
+    vector<ImageDepth32F> expected_depths;
+    vector<ImageLabel16I> expected_labels;
+    for (const RigidTransformd& X_WC : {X_WC_, X_WC2}) {
+      renderer_->UpdateViewpoint(X_WC);
+      Render();
+      expected_depths.push_back(depth_);
+      expected_labels.push_back(label_);
+    }
+
+    // The depth and label images of X_WC_ come from a single rasterization.
+    vector<ImageDepth32F> depths(2, ImageDepth32F(kWidth, kHeight));
+    vector<ImageLabel16I> labels(2, ImageLabel16I(kWidth, kHeight));
+    RenderImageBatch batch;
+    batch.depth.push_back({camera_, X_WC_, &depths[0]});
+    batch.depth.push_back({camera_, X_WC2, &depths[1]});
+    batch.label.push_back({camera_, X_WC_, kShowWindow, &labels[0]});
+    batch.label.push_back({camera_, X_WC2, kShowWindow, &labels[1]});
+    renderer_->RenderImages(batch);
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_TRUE(same_pixels(depths[i], expected_depths[i]));
+      EXPECT_TRUE(same_pixels(labels[i], expected_labels[i]));
+    }
+
+    ImageRgba8U color(kWidth, kHeight);
+    batch.color.push_back({camera_, X_WC_, kShowWindow, &color});
+    DRAKE_EXPECT_THROWS_MESSAGE(renderer_->RenderImages(batch),
+                                std::runtime_error,
+                                "RenderEngineCpu cannot render color images");
+  }
+}
+
+TEST_F(RenderEngineCpuTest, RemoveVisual) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+  const RenderLabel default_label = expected_label_;
+
+  // Add another sphere in front of the default sphere.
+  const GeometryId id = GeometryId::get_new_id();
+  expected_label_ = RenderLabel(5);
+  renderer_->RegisterVisual(id, Sphere(0.5), simple_material(),
+                            RigidTransformd{Vector3d{0, 0, 0.75}},
+                            false /* needs update */);
+  expected_object_depth_ = kDefaultDistance - 0.5 - 0.75;
+  PerformCenterShapeTest(renderer_.get(), "Second sphere added");
+
+  EXPECT_TRUE(renderer_->RemoveGeometry(id));
+  EXPECT_FALSE(renderer_->RemoveGeometry(id));
+  expected_label_ = default_label;
+  expected_object_depth_ = 2.f;
+  PerformCenterShapeTest(renderer_.get(), "Second sphere removed");
+}
+
+// Tests that the clone renders the same images, even when the original is
+// changed or deleted.
+TEST_F(RenderEngineCpuTest, CloneIndependence) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  ASSERT_NE(dynamic_cast<RenderEngineCpu*>(clone.get()), nullptr);
+  // Move the sphere *up* 10 units in the z.
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {geometry_id_, RigidTransformd{Vector3d{0, 0, 10}}}});
+  renderer_.reset();
+  PerformCenterShapeTest(static_cast<RenderEngineCpu*>(clone.get()),
+                         "Clone independence");
+}
+
+// Tests that a clone has its own threads: the original and the clone, whose
+// threads are already started, can render concurrently.
+TEST_F(RenderEngineCpuTest, CloneRendersConcurrently) {
+  Init(X_WC_, true, 4);
+  PopulateSphereTest(renderer_.get());
+  Render();
+  const ImageDepth32F expected_depth = depth_;
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  ImageDepth32F clone_depth(kWidth, kHeight);
+  clone->RenderDepthImage(camera_, &clone_depth);
+
+  const vector<const RenderEngine*> engines{renderer_.get(), clone.get()};
+  vector<ImageDepth32F> depths;
+  vector<std::thread> threads;
+  for (int i = 0; i < 2; ++i) {
+    depths.emplace_back(kWidth, kHeight);
+  }
+  for (int i = 0; i < 2; ++i) {
+    threads.emplace_back([this, &engines, &depths, i]() {
+      for (int repeat = 0; repeat < 3; ++repeat) {
+        engines[i]->RenderDepthImage(camera_, &depths[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const ImageDepth32F& depth : depths) {
+    EXPECT_TRUE(std::equal(depth.at(0, 0), depth.at(0, 0) + depth.size(),
+                           expected_depth.at(0, 0)));
+  }
+}
+
+TEST_F(RenderEngineCpuTest, DefaultProperties_RenderLabel) {
+  RenderEngineCpuParams params;
+  params.default_label = RenderLabel::kDontCare;
+  RenderEngineCpu renderer(params);
+  EXPECT_EQ(renderer.default_render_label(), RenderLabel::kDontCare);
+  renderer.UpdateViewpoint(X_WC_);
+  renderer.RegisterVisual(GeometryId::get_new_id(), HalfSpace(),
+                          PerceptionProperties(), RigidTransformd::Identity(),
+                          false /* needs update */);
+  Render(&renderer);
+  VerifyUniformLabel(RenderLabel::kDontCare);
+}
+
+}  // namespace
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
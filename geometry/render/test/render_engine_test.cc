@@ -2,7 +2,10 @@
 
 #include <optional>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -299,6 +302,67 @@ GTEST_TEST(RenderEngine, DetectDoCloneFailure) {
       "probably not implemented");
 }
 
+// A CloneableEngine that records the camera poses used to render each image.
+class RecordingEngine : public CloneableEngine {
+ public:
+  RecordingEngine() = default;
+
+  void UpdateViewpoint(const math::RigidTransformd& X_WC) override {
+    X_WC_ = X_WC;
+  }
+  void RenderColorImage(const render::CameraProperties&, bool,
+                        systems::sensors::ImageRgba8U*) const override {
+    rendered_.emplace_back("color", X_WC_.translation().x());
+  }
+  void RenderDepthImage(const render::DepthCameraProperties&,
+                        systems::sensors::ImageDepth32F*) const override {
+    rendered_.emplace_back("depth", X_WC_.translation().x());
+  }
+  void RenderLabelImage(const render::CameraProperties&, bool,
+                        systems::sensors::ImageLabel16I*) const override {
+    rendered_.emplace_back("label", X_WC_.translation().x());
+  }
+
+  // The type of each rendered image and the x-coordinate of its camera.
+  const std::vector<std::pair<std::string, double>>& rendered() const {
+    return rendered_;
+  }
+
+ private:
+  math::RigidTransformd X_WC_;
+  mutable std::vector<std::pair<std::string, double>> rendered_;
+};
+
+// Confirms that the default implementation of RenderImages() renders each
+// request from the viewpoint of its own camera, and that null images are
+// rejected.
+GTEST_TEST(RenderEngine, RenderImages) {
+  const DepthCameraProperties camera(2, 2, M_PI_2, "recording", 0.1, 5.0);
+  auto X_WC = [](double x) {
+    return math::RigidTransformd(Vector3<double>(x, 0, 0));
+  };
+  systems::sensors::ImageRgba8U color;
+  systems::sensors::ImageDepth32F depth;
+  systems::sensors::ImageLabel16I label;
+
+  RecordingEngine engine;
+  RenderImageBatch batch;
+  batch.color.push_back({camera, X_WC(1), false, &color});
+  batch.depth.push_back({camera, X_WC(2), &depth});
+  batch.depth.push_back({camera, X_WC(3), &depth});
+  batch.label.push_back({camera, X_WC(4), false, &label});
+  engine.RenderImages(batch);
+  const std::vector<std::pair<std::string, double>> expected{
+      {"color", 1}, {"depth", 2}, {"depth", 3}, {"label", 4}};
+  EXPECT_EQ(engine.rendered(), expected);
+
+  batch.depth[1].image = nullptr;
+  DRAKE_EXPECT_THROWS_MESSAGE(engine.RenderImages(batch), std::exception,
+                              ".*image != nullptr.*");
+  // Nothing was rendered.
+  EXPECT_EQ(engine.rendered().size(), expected.size());
+}
+
 }  // namespace
 }  // namespace render
 }  // namespace geometry
@@ -1,14 +1,18 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <algorithm>
+#include <cmath>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
 #include <fmt/format.h>
 #include <gtest/gtest.h>
+#include <vtkMapper.h>
 #include <vtkOpenGLTexture.h>
 #include <vtkProperty.h>
 
@@ -1234,6 +1238,278 @@ TEST_F(RenderEngineVtkTest, PreservePropertyTexturesOverClone) {
   ASSERT_TRUE(clone->GeometryHasColorTexture(id, texture_name));
 }
 
+// Exposes the actors of the geometries to the culling tests.
+class CullingTesterEngine : public RenderEngineVtk {
+ public:
+  explicit CullingTesterEngine(const RenderEngineVtkParams& params)
+      : RenderEngineVtk(params) {}
+
+  // The pipeline indices of the actors().
+  static constexpr int kColor = 0;
+  static constexpr int kLabel = 1;
+  static constexpr int kDepth = 2;
+
+  bool IsVisible(GeometryId id, int pipeline) const {
+    return actors().at(id)[pipeline]->GetVisibility() != 0;
+  }
+
+  const vtkMapper* mapper(GeometryId id, int pipeline) const {
+    return actors().at(id)[pipeline]->GetMapper();
+  }
+};
+
+// Confirms that the geometries outside of the view frustum are hidden, that
+// the culling follows the pose updates, and that it doesn't change the images.
+TEST_F(RenderEngineVtkTest, FrustumCulling) {
+  const Vector3d bg_rgb{
+      kBgColor.r / 255., kBgColor.g / 255., kBgColor.b / 255.};
+  CullingTesterEngine engine(RenderEngineVtkParams{{}, {}, bg_rgb});
+  InitializeRenderer(X_WC_, true /* add terrain */, &engine);
+  PopulateSphereTest(&engine);
+
+  // A second sphere, far outside of the camera's view.
+  const GeometryId outside_id = GeometryId::get_new_id();
+  engine.RegisterVisual(outside_id, Sphere(0.5), simple_material(),
+                        RigidTransformd::Identity(), true /* needs update */);
+  X_WV_[outside_id] = RigidTransformd{Vector3d{0, 20, 0.5}};
+  engine.UpdatePoses(X_WV_);
+
+  PerformCenterShapeTest(&engine, "Frustum culling");
+  for (int pipeline : {CullingTesterEngine::kColor, CullingTesterEngine::kLabel,
+                       CullingTesterEngine::kDepth}) {
+    EXPECT_TRUE(engine.IsVisible(geometry_id_, pipeline));
+    EXPECT_FALSE(engine.IsVisible(outside_id, pipeline));
+  }
+
+  // Moving the sphere so that it straddles the edge of the image makes it
+  // visible again.
+  X_WV_[outside_id] = RigidTransformd{Vector3d{0, 1.5, 0.5}};
+  engine.UpdatePoses(X_WV_);
+  Render(&engine);
+  for (int pipeline : {CullingTesterEngine::kColor, CullingTesterEngine::kLabel,
+                       CullingTesterEngine::kDepth}) {
+    EXPECT_TRUE(engine.IsVisible(outside_id, pipeline));
+  }
+
+  // The same scene without culling renders the same images.
+  RenderEngineVtkParams params{{}, {}, bg_rgb};
+  params.frustum_culling = false;
+  CullingTesterEngine unculled(params);
+  InitializeRenderer(X_WC_, true /* add terrain */, &unculled);
+  PopulateSphereTest(&unculled);
+  unculled.RegisterVisual(outside_id, Sphere(0.5), simple_material(),
+                          RigidTransformd::Identity(), true /* needs update */);
+  X_WV_[outside_id] = RigidTransformd{Vector3d{0, 1.5, 0.5}};
+  unculled.UpdatePoses(X_WV_);
+  ImageRgba8U color(kWidth, kHeight);
+  ImageDepth32F depth(kWidth, kHeight);
+  ImageLabel16I label(kWidth, kHeight);
+  Render(&unculled, &camera_, &color, &depth, &label);
+  auto same_pixels = [](const auto& a, const auto& b) {
+    const int count = a.size() * a.kNumChannels;
+    return std::equal(a.at(0, 0), a.at(0, 0) + count, b.at(0, 0),
+                      [](auto x, auto y) {
+                        return x == y || (std::isnan(x) && std::isnan(y));
+                      });
+  };
+  EXPECT_TRUE(same_pixels(color, color_));
+  EXPECT_TRUE(same_pixels(depth, depth_));
+  EXPECT_TRUE(same_pixels(label, label_));
+}
+
+// Confirms that rendering a batch, whose requests are regrouped by camera pose,
+// produces the same images as rendering each request on its own.
+TEST_F(RenderEngineVtkTest, RenderImagesBatch) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+  const RigidTransformd X_WC2(X_WC_.rotation(),
+                              X_WC_.translation() + Vector3d(0.25, 0, 0));
+
+  ImageRgba8U color1(kWidth, kHeight), color2(kWidth, kHeight);
+  ImageDepth32F depth1(kWidth, kHeight), depth2(kWidth, kHeight);
+  ImageLabel16I label1(kWidth, kHeight), label2(kWidth, kHeight);
+  RenderImageBatch batch;
+  batch.color.push_back({camera_, X_WC2, false, &color2});
+  batch.color.push_back({camera_, X_WC_, false, &color1});
+  batch.depth.push_back({camera_, X_WC_, &depth1});
+  batch.depth.push_back({camera_, X_WC2, &depth2});
+  batch.label.push_back({camera_, X_WC2, false, &label2});
+  batch.label.push_back({camera_, X_WC_, false, &label1});
+  renderer_->RenderImages(batch);
+
+  auto same_pixels = [](const auto& a, const auto& b) {
+    const int count = a.size() * a.kNumChannels;
+    return std::equal(a.at(0, 0), a.at(0, 0) + count, b.at(0, 0),
+                      [](auto x, auto y) {
+                        return x == y || (std::isnan(x) && std::isnan(y));
+                      });
+  };
+  auto expect_same_images = [&](const RigidTransformd& X_WC,
+                                const ImageRgba8U& color,
+                                const ImageDepth32F& depth,
+                                const ImageLabel16I& label) {
+    ImageRgba8U expected_color(kWidth, kHeight);
+    ImageDepth32F expected_depth(kWidth, kHeight);
+    ImageLabel16I expected_label(kWidth, kHeight);
+    renderer_->UpdateViewpoint(X_WC);
+    renderer_->RenderColorImage(camera_, false, &expected_color);
+    renderer_->RenderDepthImage(camera_, &expected_depth);
+    renderer_->RenderLabelImage(camera_, false, &expected_label);
+    EXPECT_TRUE(same_pixels(color, expected_color));
+    EXPECT_TRUE(same_pixels(depth, expected_depth));
+    EXPECT_TRUE(same_pixels(label, expected_label));
+  };
+  expect_same_images(X_WC_, color1, depth1, label1);
+  expect_same_images(X_WC2, color2, depth2, label2);
+}
+
+// Counts the depth images it renders, through the override of a subclass.
+class DepthCountingEngine : public RenderEngineVtk {
+ public:
+  DepthCountingEngine() = default;
+
+  void RenderDepthImage(const DepthCameraProperties& camera,
+                        ImageDepth32F* depth_image_out) const override {
+    ++num_depth_images_;
+    RenderEngineVtk::RenderDepthImage(camera, depth_image_out);
+  }
+
+  int num_depth_images() const { return num_depth_images_; }
+
+ private:
+  mutable int num_depth_images_{};
+};
+
+// Confirms that the batches are rendered through the virtual methods, so that
+// subclasses' overrides apply to them.
+TEST_F(RenderEngineVtkTest, RenderImagesBatchUsesOverrides) {
+  DepthCountingEngine engine;
+  PopulateSphereTest(&engine);
+  ImageDepth32F depth1(kWidth, kHeight), depth2(kWidth, kHeight);
+  RenderImageBatch batch;
+  batch.depth.push_back({camera_, X_WC_, &depth1});
+  batch.depth.push_back({camera_, X_WC_, &depth2});
+  engine.RenderImages(batch);
+  EXPECT_EQ(engine.num_depth_images(), 2);
+
+  ImageDepth32F expected_depth(kWidth, kHeight);
+  engine.UpdateViewpoint(X_WC_);
+  engine.RenderDepthImage(camera_, &expected_depth);
+  EXPECT_EQ(engine.num_depth_images(), 3);
+  EXPECT_TRUE(std::equal(depth1.at(0, 0), depth1.at(0, 0) + depth1.size(),
+                         expected_depth.at(0, 0), [](float x, float y) {
+                           return x == y || (std::isnan(x) && std::isnan(y));
+                         }));
+}
+
+// Confirms that large untextured meshes switch between their levels of detail
+// with their distance to the camera, and that other meshes don't.
+TEST_F(RenderEngineVtkTest, LevelsOfDetail) {
+  RenderEngineVtkParams params;
+  params.default_label = RenderLabel::kDontCare;
+  // The 2x2x2 cube has 12 triangles.
+  params.lod_min_triangles = 10;
+  CullingTesterEngine engine(params);
+  InitializeRenderer(X_WC_, false /* add terrain */, &engine);
+
+  const GeometryId cube_id = GeometryId::get_new_id();
+  engine.RegisterVisual(
+      cube_id, Mesh(FindResourceOrThrow("drake/geometry/test/quad_cube.obj")),
+      PerceptionProperties(), RigidTransformd::Identity(),
+      true /* needs update */);
+  // The textured box has the same size.
+  const GeometryId textured_id = GeometryId::get_new_id();
+  engine.RegisterVisual(
+      textured_id,
+      Mesh(FindResourceOrThrow(
+          "drake/systems/sensors/test/models/meshes/box.obj")),
+      PerceptionProperties(), RigidTransformd::Identity(),
+      true /* needs update */);
+
+  // Renders with both meshes at the given depth below the camera, and returns
+  // the color mappers of the cube and of the textured box.
+  auto render_at = [&](double depth) {
+    const RigidTransformd X_WG{Vector3d{0, 0, kDefaultDistance - depth}};
+    engine.UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+        {cube_id, X_WG}, {textured_id, X_WG}});
+    ImageRgba8U color(kWidth, kHeight);
+    engine.RenderColorImage(camera_, kShowWindow, &color);
+    return std::make_pair(engine.mapper(cube_id, CullingTesterEngine::kColor),
+                          engine.mapper(textured_id,
+                                        CullingTesterEngine::kColor));
+  };
+
+  // The bounding sphere (of radius √3) spans about 670 pixels at a depth of 3,
+  // 200 pixels at 10, and 32 pixels at 63.
+  const auto [full, textured_full] = render_at(3);
+  const auto [coarse, textured_coarse] = render_at(10);
+  const auto [coarsest, textured_coarsest] = render_at(63);
+  EXPECT_NE(full, coarse);
+  EXPECT_NE(full, coarsest);
+  EXPECT_NE(coarse, coarsest);
+  EXPECT_EQ(render_at(3).first, full);
+  EXPECT_EQ(textured_coarse, textured_full);
+  EXPECT_EQ(textured_coarsest, textured_full);
+}
+
+// Confirms that geometries with identical shapes share their mappers (and so
+// their polygonal data), while each keeps its own pose, and that the shared
+// data outlives the removal of one of them.
+TEST_F(RenderEngineVtkTest, SharedShapes) {
+  const Vector3d bg_rgb{
+      kBgColor.r / 255., kBgColor.g / 255., kBgColor.b / 255.};
+  CullingTesterEngine engine(RenderEngineVtkParams{{}, {}, bg_rgb});
+  InitializeRenderer(X_WC_, true /* add terrain */, &engine);
+  PopulateSphereTest(&engine);
+
+  // A second, identical sphere, out of the camera's view.
+  const GeometryId other_id = GeometryId::get_new_id();
+  engine.RegisterVisual(other_id, Sphere(0.5), simple_material(),
+                        RigidTransformd::Identity(), true /* needs update */);
+  X_WV_[other_id] = RigidTransformd{Vector3d{0, 20, 0.5}};
+  engine.UpdatePoses(X_WV_);
+  PerformCenterShapeTest(&engine, "First shared sphere");
+  for (int pipeline : {CullingTesterEngine::kColor, CullingTesterEngine::kLabel,
+                       CullingTesterEngine::kDepth}) {
+    EXPECT_EQ(engine.mapper(other_id, pipeline),
+              engine.mapper(geometry_id_, pipeline));
+  }
+
+  // Swapping the poses of the spheres renders the same images.
+  std::swap(X_WV_[other_id], X_WV_[geometry_id_]);
+  engine.UpdatePoses(X_WV_);
+  PerformCenterShapeTest(&engine, "Second shared sphere");
+
+  // The remaining sphere still renders once the other one is removed.
+  EXPECT_TRUE(engine.RemoveGeometry(geometry_id_));
+  X_WV_.erase(geometry_id_);
+  PerformCenterShapeTest(&engine, "Remaining shared sphere");
+
+  // Shapes with other dimensions, or boxes with other texture scales (and so
+  // other texture coordinates), don't share their mappers.
+  const GeometryId larger_id = GeometryId::get_new_id();
+  engine.RegisterVisual(larger_id, Sphere(0.6), simple_material(),
+                        RigidTransformd::Identity(), true /* needs update */);
+  EXPECT_NE(engine.mapper(larger_id, CullingTesterEngine::kColor),
+            engine.mapper(other_id, CullingTesterEngine::kColor));
+  const Box box(1, 2, 3);
+  const GeometryId box_id = GeometryId::get_new_id();
+  engine.RegisterVisual(box_id, box, simple_material(),
+                        RigidTransformd::Identity(), true /* needs update */);
+  const GeometryId same_box_id = GeometryId::get_new_id();
+  engine.RegisterVisual(same_box_id, box, simple_material(),
+                        RigidTransformd::Identity(), true /* needs update */);
+  PerceptionProperties scaled_material = simple_material();
+  scaled_material.AddProperty("phong", "diffuse_scale", Vector2d{2, 2});
+  const GeometryId scaled_box_id = GeometryId::get_new_id();
+  engine.RegisterVisual(scaled_box_id, box, scaled_material,
+                        RigidTransformd::Identity(), true /* needs update */);
+  EXPECT_EQ(engine.mapper(same_box_id, CullingTesterEngine::kColor),
+            engine.mapper(box_id, CullingTesterEngine::kColor));
+  EXPECT_NE(engine.mapper(scaled_box_id, CullingTesterEngine::kColor),
+            engine.mapper(box_id, CullingTesterEngine::kColor));
+}
+
 }  // namespace
 }  // namespace render
 }  // namespace geometry
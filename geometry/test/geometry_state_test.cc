@@ -3210,6 +3210,45 @@ TEST_F(GeometryStateTest, GetRenderEngine) {
                               "No renderer exists with name.*");
 }
 
+// Confirms that RenderImages() dispatches each request to the renderer named
+// in its camera properties, and that unknown renderers are detected before
+// anything is rendered.
+TEST_F(GeometryStateTest, RenderImages) {
+  auto render_engine = make_unique<DummyRenderEngine>();
+  DummyRenderEngine* second_engine = render_engine.get();
+  const std::string second_engine_name = "second_engine";
+  geometry_state_.AddRenderer(second_engine_name, move(render_engine));
+
+  const RigidTransformd X_WC1(Vector3d(1, 2, 3));
+  const RigidTransformd X_WC2(Vector3d(4, 5, 6));
+  systems::sensors::ImageDepth32F depth;
+  systems::sensors::ImageLabel16I label;
+  render::RenderImageBatch batch;
+  batch.depth.push_back(
+      {render::DepthCameraProperties(2, 2, M_PI_2, kDummyRenderName, 0.1, 5),
+       X_WC1, &depth});
+  batch.label.push_back(
+      {render::CameraProperties(2, 2, M_PI_2, second_engine_name), X_WC2,
+       false, &label});
+  geometry_state_.RenderImages(batch);
+  auto expect_X_WC = [](const DummyRenderEngine& engine,
+                        const RigidTransformd& X_WC) {
+    EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                                X_WC.GetAsMatrix34()));
+  };
+  expect_X_WC(*render_engine_, X_WC1);
+  expect_X_WC(*second_engine, X_WC2);
+
+  batch.label.push_back(
+      {render::CameraProperties(2, 2, M_PI_2, "bad name"),
+       RigidTransformd::Identity(), false, &label});
+  batch.depth[0].X_WC = X_WC2;
+  DRAKE_EXPECT_THROWS_MESSAGE(geometry_state_.RenderImages(batch),
+                              std::logic_error,
+                              "No renderer exists with name: 'bad name'");
+  expect_X_WC(*render_engine_, X_WC1);
+}
+
 // Confirms that the renderer(s) have poses updated properly when
 // FinalizePoseUpdate() is called.
 TEST_F(GeometryStateTest, RendererPoseUpdate) {
@@ -30,7 +30,9 @@ namespace internal {
  4. Records which poses have been updated via UpdatePoses() to validate which
     ids values are updated and which aren't (and with what pose).
  5. Records the camera pose provided to UpdateViewpoint() and report it with
-    last_updated_X_WC().  */
+    last_updated_X_WC().
+ 6. Counts the rendered images of each type and the rendered batches (see
+    RenderImages()).  */
 class DummyRenderEngine final : public render::RenderEngine {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DummyRenderEngine);
@@ -48,11 +50,17 @@ class DummyRenderEngine final : public render::RenderEngine {
     X_WC_ = X_WC;
   }
   void RenderColorImage(const render::CameraProperties&, bool,
-                        systems::sensors::ImageRgba8U*) const final {}
+                        systems::sensors::ImageRgba8U*) const final {
+    ++num_color_renders_;
+  }
   void RenderDepthImage(const render::DepthCameraProperties&,
-                        systems::sensors::ImageDepth32F*) const final {}
+                        systems::sensors::ImageDepth32F*) const final {
+    ++num_depth_renders_;
+  }
   void RenderLabelImage(const render::CameraProperties&, bool,
-                        systems::sensors::ImageLabel16I*) const final {}
+                        systems::sensors::ImageLabel16I*) const final {
+    ++num_label_renders_;
+  }
 
   using RenderEngine::ImplementGeometry;
   void ImplementGeometry(const Sphere& sphere, void* user_data) final {}
@@ -111,6 +119,16 @@ class DummyRenderEngine final : public render::RenderEngine {
 
   const math::RigidTransformd& last_updated_X_WC() const { return X_WC_; }
 
+  /** Reports the number of images of each type rendered over the lifespan of
+   `this` instance, whether individually or as part of a batch.  */
+  int num_color_renders() const { return num_color_renders_; }
+  int num_depth_renders() const { return num_depth_renders_; }
+  int num_label_renders() const { return num_label_renders_; }
+
+  /** Reports the number of batches rendered with RenderImages() over the
+   lifespan of `this` instance.  */
+  int num_batch_renders() const { return num_batch_renders_; }
+
   // Promote these to be public to facilitate testing.
   using RenderEngine::LabelFromColor;
   using RenderEngine::GetColorDFromLabel;
@@ -145,6 +163,12 @@ class DummyRenderEngine final : public render::RenderEngine {
     return registered_geometries_.erase(id) > 0;
   }
 
+  /** Counts the batch and renders it with the default implementation.  */
+  void DoRenderImages(const render::RenderImageBatch& batch) final {
+    ++num_batch_renders_;
+    RenderEngine::DoRenderImages(batch);
+  }
+
   /** Implementation of RenderEngine::DoClone().  */
   std::unique_ptr<render::RenderEngine> DoClone() const final {
     return std::make_unique<DummyRenderEngine>(*this);
@@ -165,6 +189,12 @@ class DummyRenderEngine final : public render::RenderEngine {
 
   // The last updated camera pose (defaults to identity).
   math::RigidTransformd X_WC_;
+
+  // The number of rendered images of each type, and of rendered batches.
+  mutable int num_color_renders_{};
+  mutable int num_depth_renders_{};
+  mutable int num_label_renders_{};
+  int num_batch_renders_{};
 };
 
 }  // namespace internal
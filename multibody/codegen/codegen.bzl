@@ -0,0 +1,61 @@
+# -*- python -*-
+
+load("@drake//tools/skylark:drake_cc.bzl", "drake_cc_library")
+
+def drake_multibody_dynamics_cc_library(
+        name,
+        model,
+        namespace_name = "generated",
+        bodies = [],
+        mass_matrix = True,
+        bias_term = True,
+        gravity_generalized_forces = True,
+        weld_to_world = None,
+        deps = [],
+        **kwargs):
+    """Declares a C++ library named `name` with code-generated kinematics and
+    dynamics for the fixed model in `model` (the label of a URDF or SDF file).
+
+    The library provides the header `drake/<package>/<name>.h`; refer to
+    GenerateDynamicsCode() in drake/multibody/codegen/dynamics_codegen.h for
+    the functions it declares. The quantities that are generated are selected
+    by `mass_matrix`, `bias_term`, `gravity_generalized_forces` and `bodies`
+    (the names of the bodies whose pose in world is generated). When given,
+    the body named `weld_to_world` is welded to the world before generation.
+    """
+    hdr = name + ".h"
+    src = name + ".cc"
+    tool = "//multibody/codegen:dynamics_codegen_main"
+    args = [
+        "--model=$(location {})".format(model),
+        "--namespace_name=" + namespace_name,
+        "--header_include_path=drake/{}/{}".format(native.package_name(), hdr),
+        "--header_output=$(location {})".format(hdr),
+        "--source_output=$(location {})".format(src),
+        "--bodies=" + ",".join(bodies),
+        "--mass_matrix=" + ("true" if mass_matrix else "false"),
+        "--bias_term=" + ("true" if bias_term else "false"),
+        "--gravity_generalized_forces=" + (
+            "true" if gravity_generalized_forces else "false"
+        ),
+    ]
+    if weld_to_world:
+        args.append("--weld_to_world=" + weld_to_world)
+    native.genrule(
+        name = name + "_genrule",
+        srcs = [model],
+        outs = [hdr, src],
+        cmd = "$(location {}) {}".format(tool, " ".join(args)),
+        tools = [tool],
+    )
+    drake_cc_library(
+        name = name,
+        srcs = [src],
+        hdrs = [hdr],
+        tags = ["nolint"],
+        deps = deps + [
+            "//common:essential",
+            "//math:geometric_transform",
+        ],
+        **kwargs
+    )
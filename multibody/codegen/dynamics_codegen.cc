@@ -0,0 +1,189 @@
+#include "drake/multibody/codegen/dynamics_codegen.h"
+
+#include <memory>
+#include <sstream>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/symbolic.h"
+#include "drake/common/symbolic_codegen.h"
+
+namespace drake {
+namespace multibody {
+
+using symbolic::Expression;
+using symbolic::Variable;
+
+namespace {
+
+// Appends to @p os the C function `void <name>(const double* p, double* m)`
+// that evaluates the column-major matrix @p M as a function of @p parameters.
+// The entries of M share many terms (e.g., the sines and cosines of q), which
+// are evaluated only once.
+void AppendMatrixFunction(const std::string& name,
+                          const std::vector<Variable>& parameters,
+                          const MatrixX<Expression>& M, std::ostream* os) {
+  symbolic::CodeGenOptions options;
+  options.eliminate_common_subexpressions = true;
+  symbolic::internal::CodeGenDenseData(name, parameters, M.data(), M.size(),
+                                       options, os);
+}
+
+std::vector<Variable> ToStdVector(const VectorX<Variable>& x) {
+  return std::vector<Variable>(x.data(), x.data() + x.size());
+}
+
+}  // namespace
+
+DynamicsCode GenerateDynamicsCode(const MultibodyPlant<double>& plant,
+                                  const DynamicsCodeGenOptions& options) {
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+  DRAKE_THROW_UNLESS(!options.namespace_name.empty());
+  DRAKE_THROW_UNLESS(!options.header_include_path.empty());
+
+  std::unique_ptr<MultibodyPlant<Expression>> symbolic_plant =
+      systems::System<double>::ToSymbolic(plant);
+  std::unique_ptr<systems::Context<Expression>> context =
+      symbolic_plant->CreateDefaultContext();
+
+  const int nq = symbolic_plant->num_positions();
+  const int nv = symbolic_plant->num_velocities();
+  const VectorX<Variable> q = symbolic::MakeVectorContinuousVariable(nq, "q");
+  const VectorX<Variable> v = symbolic::MakeVectorContinuousVariable(nv, "v");
+  symbolic_plant->SetPositions(context.get(), q.cast<Expression>());
+  symbolic_plant->SetVelocities(context.get(), v.cast<Expression>());
+
+  const std::vector<Variable> q_parameters = ToStdVector(q);
+  VectorX<Variable> qv(nq + nv);
+  qv << q, v;
+  const std::vector<Variable> qv_parameters = ToStdVector(qv);
+
+  const std::string& ns = options.namespace_name;
+  std::ostringstream header;
+  std::ostringstream internal;
+  std::ostringstream wrappers;
+
+  header << "#pragma once\n\n"
+         << "// Generated by //multibody/codegen:dynamics_codegen_main. "
+         << "Do not edit.\n\n"
+         << "#include <string>\n\n"
+         << "#include <Eigen/Dense>\n\n"
+         << "#include \"drake/common/eigen_types.h\"\n"
+         << "#include \"drake/math/rigid_transform.h\"\n\n"
+         << "namespace " << ns << " {\n\n"
+         << fmt::format("constexpr int kNumPositions = {};\n", nq)
+         << fmt::format("constexpr int kNumVelocities = {};\n", nv);
+
+  if (options.mass_matrix) {
+    MatrixX<Expression> M(nv, nv);
+    symbolic_plant->CalcMassMatrix(*context, &M);
+    AppendMatrixFunction("mass_matrix", q_parameters, M, &internal);
+    header << "\n"
+           << "void CalcMassMatrix(const Eigen::Ref<const Eigen::VectorXd>& q,"
+           << "\n                    drake::EigenPtr<Eigen::MatrixXd> M);\n";
+    wrappers
+        << "void CalcMassMatrix(const Eigen::Ref<const Eigen::VectorXd>& q,\n"
+        << "                    drake::EigenPtr<Eigen::MatrixXd> M) {\n"
+        << "  DRAKE_THROW_UNLESS(q.size() == kNumPositions);\n"
+        << "  DRAKE_THROW_UNLESS(M != nullptr);\n"
+        << "  DRAKE_THROW_UNLESS(M->rows() == kNumVelocities);\n"
+        << "  DRAKE_THROW_UNLESS(M->cols() == kNumVelocities);\n"
+        << "  internal::mass_matrix(q.data(), M->data());\n"
+        << "}\n\n";
+  }
+
+  if (options.bias_term) {
+    VectorX<Expression> Cv(nv);
+    symbolic_plant->CalcBiasTerm(*context, &Cv);
+    AppendMatrixFunction("bias_term", qv_parameters, Cv, &internal);
+    header << "\n"
+           << "void CalcBiasTerm(const Eigen::Ref<const Eigen::VectorXd>& q,\n"
+           << "                  const Eigen::Ref<const Eigen::VectorXd>& v,\n"
+           << "                  drake::EigenPtr<Eigen::VectorXd> Cv);\n";
+    wrappers
+        << "void CalcBiasTerm(const Eigen::Ref<const Eigen::VectorXd>& q,\n"
+        << "                  const Eigen::Ref<const Eigen::VectorXd>& v,\n"
+        << "                  drake::EigenPtr<Eigen::VectorXd> Cv) {\n"
+        << "  DRAKE_THROW_UNLESS(q.size() == kNumPositions);\n"
+        << "  DRAKE_THROW_UNLESS(v.size() == kNumVelocities);\n"
+        << "  DRAKE_THROW_UNLESS(Cv != nullptr);\n"
+        << "  DRAKE_THROW_UNLESS(Cv->size() == kNumVelocities);\n"
+        << "  Eigen::Matrix<double, kNumPositions + kNumVelocities, 1> qv;\n"
+        << "  qv << q, v;\n"
+        << "  internal::bias_term(qv.data(), Cv->data());\n"
+        << "}\n\n";
+  }
+
+  if (options.gravity_generalized_forces) {
+    const VectorX<Expression> tau_g =
+        symbolic_plant->CalcGravityGeneralizedForces(*context);
+    AppendMatrixFunction("gravity_generalized_forces", q_parameters, tau_g,
+                         &internal);
+    header << "\n"
+           << "Eigen::VectorXd CalcGravityGeneralizedForces(\n"
+           << "    const Eigen::Ref<const Eigen::VectorXd>& q);\n";
+    wrappers
+        << "Eigen::VectorXd CalcGravityGeneralizedForces(\n"
+        << "    const Eigen::Ref<const Eigen::VectorXd>& q) {\n"
+        << "  DRAKE_THROW_UNLESS(q.size() == kNumPositions);\n"
+        << "  Eigen::VectorXd tau_g(kNumVelocities);\n"
+        << "  internal::gravity_generalized_forces(q.data(), tau_g.data());\n"
+        << "  return tau_g;\n"
+        << "}\n\n";
+  }
+
+  if (!options.body_names.empty()) {
+    header << "\n"
+           << "drake::math::RigidTransformd CalcBodyPoseInWorld(\n"
+           << "    const Eigen::Ref<const Eigen::VectorXd>& q,\n"
+           << "    const std::string& body_name);\n";
+    wrappers << "drake::math::RigidTransformd CalcBodyPoseInWorld(\n"
+             << "    const Eigen::Ref<const Eigen::VectorXd>& q,\n"
+             << "    const std::string& body_name) {\n"
+             << "  DRAKE_THROW_UNLESS(q.size() == kNumPositions);\n"
+             << "  Eigen::Matrix<double, 3, 4> X_WB;\n";
+    for (size_t i = 0; i < options.body_names.size(); ++i) {
+      const std::string& body_name = options.body_names[i];
+      const Body<Expression>& body = symbolic_plant->GetBodyByName(body_name);
+      const MatrixX<Expression> X_WB =
+          symbolic_plant->EvalBodyPoseInWorld(*context, body).GetAsMatrix34();
+      const std::string function_name = fmt::format("X_WB_{}", i);
+      AppendMatrixFunction(function_name, q_parameters, X_WB, &internal);
+      wrappers << fmt::format("  {}if (body_name == \"{}\") {{\n",
+                              i == 0 ? "" : "} else ", body_name)
+               << fmt::format("    internal::{}(q.data(), X_WB.data());\n",
+                              function_name);
+    }
+    wrappers << "  } else {\n"
+             << "    throw std::logic_error(\n"
+             << "        \"CalcBodyPoseInWorld(): No code was generated for "
+             << "body '\" + body_name + \"'.\");\n"
+             << "  }\n"
+             << "  return drake::math::RigidTransformd(\n"
+             << "      drake::math::RotationMatrixd(X_WB.leftCols<3>()),\n"
+             << "      X_WB.col(3));\n"
+             << "}\n\n";
+  }
+
+  header << "\n}  // namespace " << ns << "\n";
+
+  std::ostringstream source;
+  source << "#include \"" << options.header_include_path << "\"\n\n"
+         << "// Generated by //multibody/codegen:dynamics_codegen_main. "
+         << "Do not edit.\n\n"
+         << "#include <cmath>\n"
+         << "#include <stdexcept>\n\n"
+         << "#include \"drake/common/drake_throw.h\"\n\n"
+         << "namespace " << ns << " {\n"
+         << "namespace internal {\n\n"
+         << internal.str() << "\n"
+         << "}  // namespace internal\n\n"
+         << wrappers.str()
+         << "}  // namespace " << ns << "\n";
+
+  return DynamicsCode{header.str(), source.str()};
+}
+
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/multibody/plant/multibody_plant.h"
+
+namespace drake {
+namespace multibody {
+
+/// Options for GenerateDynamicsCode(), selecting which quantities are
+/// generated and how the generated code is named.
+struct DynamicsCodeGenOptions {
+  /// The C++ namespace that encloses the generated functions. Nested
+  /// namespaces may be given as, e.g., "my_robot::generated".
+  std::string namespace_name{"generated"};
+
+  /// The path used by the generated source file to `#include` the generated
+  /// header, e.g., "my_package/iiwa_dynamics.h".
+  std::string header_include_path;
+
+  /// Generates `CalcMassMatrix(q, M)` when true.
+  bool mass_matrix{true};
+
+  /// Generates `CalcBiasTerm(q, v, Cv)` when true.
+  bool bias_term{true};
+
+  /// Generates `CalcGravityGeneralizedForces(q)` when true.
+  bool gravity_generalized_forces{true};
+
+  /// The names of the bodies for which `CalcBodyPoseInWorld(q, name)` is able
+  /// to compute the pose X_WB. When empty, forward kinematics is not
+  /// generated.
+  std::vector<std::string> body_names;
+};
+
+/// The C++ code generated by GenerateDynamicsCode().
+struct DynamicsCode {
+  /// The contents of the generated header file.
+  std::string header;
+  /// The contents of the generated source file.
+  std::string source;
+};
+
+/// Generates flattened, straight-line C++ code that evaluates the kinematics
+/// and dynamics of the fixed model in @p plant. The model is converted to
+/// MultibodyPlant<symbolic::Expression>, the requested quantities are evaluated
+/// symbolically as functions of the generalized positions q and velocities v,
+/// and the resulting expressions are emitted with symbolic::CodeGen().
+///
+/// The generated header declares, inside `options.namespace_name`, the
+/// constants `kNumPositions` and `kNumVelocities` together with the functions
+/// below, whose signatures mirror those of MultibodyPlant minus the Context:
+///
+/// @code
+/// void CalcMassMatrix(const Eigen::Ref<const Eigen::VectorXd>& q,
+///                     EigenPtr<Eigen::MatrixXd> M);
+/// void CalcBiasTerm(const Eigen::Ref<const Eigen::VectorXd>& q,
+///                   const Eigen::Ref<const Eigen::VectorXd>& v,
+///                   EigenPtr<Eigen::VectorXd> Cv);
+/// Eigen::VectorXd CalcGravityGeneralizedForces(
+///     const Eigen::Ref<const Eigen::VectorXd>& q);
+/// math::RigidTransformd CalcBodyPoseInWorld(
+///     const Eigen::Ref<const Eigen::VectorXd>& q,
+///     const std::string& body_name);
+/// @endcode
+///
+/// Only the functions selected in @p options are generated. All parameters of
+/// @p plant, such as masses, inertias and gravity, are baked into the
+/// generated code as constants.
+///
+/// @note The generated code is not simplified beyond what symbolic::Expression
+/// does on construction. The size of the generated code, and the time to
+/// generate it, grows quickly with the number of degrees of freedom; this is
+/// intended for fixed-base arms with a handful of joints.
+///
+/// @throws std::exception if @p plant is not finalized, if @p plant does not
+/// support scalar conversion to symbolic::Expression, or if any of the
+/// requested body names does not name a body in @p plant.
+DynamicsCode GenerateDynamicsCode(const MultibodyPlant<double>& plant,
+                                  const DynamicsCodeGenOptions& options);
+
+}  // namespace multibody
+}  // namespace drake
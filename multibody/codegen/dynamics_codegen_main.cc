@@ -0,0 +1,98 @@
+/// @file
+/// Generates C++ code for the kinematics and dynamics of a fixed model. See
+/// GenerateDynamicsCode() for details. This is typically invoked through the
+/// drake_multibody_dynamics_cc_library() Bazel macro.
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/multibody/codegen/dynamics_codegen.h"
+#include "drake/multibody/parsing/parser.h"
+
+DEFINE_string(model, "", "The URDF or SDF file of the model.");
+DEFINE_string(namespace_name, "generated",
+              "The C++ namespace of the generated code.");
+DEFINE_string(header_include_path, "",
+              "The path used by the generated source to include the generated "
+              "header.");
+DEFINE_string(header_output, "", "Where to write the generated header.");
+DEFINE_string(source_output, "", "Where to write the generated source.");
+DEFINE_string(bodies, "",
+              "Comma-separated names of the bodies whose pose in world is "
+              "generated.");
+DEFINE_bool(mass_matrix, true, "Generate CalcMassMatrix().");
+DEFINE_bool(bias_term, true, "Generate CalcBiasTerm().");
+DEFINE_bool(gravity_generalized_forces, true,
+            "Generate CalcGravityGeneralizedForces().");
+DEFINE_string(weld_to_world, "",
+              "The name of a body to weld to the world, for fixed-base arms "
+              "whose model files omit that joint, e.g., iiwa_link_0.");
+
+namespace drake {
+namespace multibody {
+namespace {
+
+std::vector<std::string> SplitCommaSeparated(const std::string& text) {
+  std::vector<std::string> result;
+  std::istringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    if (!item.empty()) {
+      result.push_back(item);
+    }
+  }
+  return result;
+}
+
+bool WriteFile(const std::string& filename, const std::string& contents) {
+  std::ofstream out(filename);
+  out << contents;
+  return out.good();
+}
+
+int DoMain() {
+  MultibodyPlant<double> plant(0.0);
+  Parser(&plant).AddModelFromFile(FLAGS_model);
+  if (!FLAGS_weld_to_world.empty()) {
+    plant.WeldFrames(plant.world_frame(),
+                     plant.GetFrameByName(FLAGS_weld_to_world));
+  }
+  plant.Finalize();
+
+  DynamicsCodeGenOptions options;
+  options.namespace_name = FLAGS_namespace_name;
+  options.header_include_path = FLAGS_header_include_path;
+  options.mass_matrix = FLAGS_mass_matrix;
+  options.bias_term = FLAGS_bias_term;
+  options.gravity_generalized_forces = FLAGS_gravity_generalized_forces;
+  options.body_names = SplitCommaSeparated(FLAGS_bodies);
+
+  const DynamicsCode code = GenerateDynamicsCode(plant, options);
+  if (!WriteFile(FLAGS_header_output, code.header) ||
+      !WriteFile(FLAGS_source_output, code.source)) {
+    std::cerr << "dynamics_codegen: Failed to write the generated code\n";
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Generate C++ code for the dynamics of a fixed MultibodyPlant model");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_model.empty() || FLAGS_header_include_path.empty() ||
+      FLAGS_header_output.empty() || FLAGS_source_output.empty()) {
+    gflags::ShowUsageWithFlags(argv[0]);
+    return 1;
+  }
+  return drake::multibody::DoMain();
+}
@@ -0,0 +1,116 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/multibody/codegen/test/iiwa_dynamics.h"
+#include "drake/multibody/parsing/parser.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+/* Compares MultibodyPlant against the code generated for the same iiwa model
+ by drake_multibody_dynamics_cc_library(). Run it as:
+
+ ```
+ bazel run -c opt //multibody/codegen:dynamics_codegen_benchmark
+ ```
+*/
+class IiwaDynamicsBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State&) override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser(plant_.get()).AddModelFromFile(FindResourceOrThrow(
+        "drake/multibody/benchmarks/kuka_iiwa_robot/kuka_iiwa_robot.urdf"));
+    plant_->WeldFrames(plant_->world_frame(), plant_->GetFrameByName("base"));
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+
+    q_ = Eigen::VectorXd::LinSpaced(7, -0.6, 0.6);
+    v_ = Eigen::VectorXd::LinSpaced(7, 1.0, -1.0);
+    x_.resize(14);
+    x_ << q_, v_;
+    M_.resize(7, 7);
+    Cv_.resize(7);
+  }
+
+ protected:
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  Eigen::VectorXd q_;
+  Eigen::VectorXd v_;
+  Eigen::VectorXd x_;
+  Eigen::MatrixXd M_;
+  Eigen::VectorXd Cv_;
+};
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, PlantMassMatrix)(benchmark::State& state) {
+  for (auto _ : state) {
+    // Setting the positions invalidates the kinematics cache, as would happen
+    // on every tick of a controller.
+    plant_->SetPositions(context_.get(), q_);
+    plant_->CalcMassMatrix(*context_, &M_);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, CodeGenMassMatrix)(benchmark::State& state) {
+  for (auto _ : state) {
+    test::iiwa::CalcMassMatrix(q_, &M_);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, PlantBiasTerm)(benchmark::State& state) {
+  for (auto _ : state) {
+    plant_->SetPositionsAndVelocities(context_.get(), x_);
+    plant_->CalcBiasTerm(*context_, &Cv_);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, CodeGenBiasTerm)(benchmark::State& state) {
+  for (auto _ : state) {
+    test::iiwa::CalcBiasTerm(q_, v_, &Cv_);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, PlantGravity)(benchmark::State& state) {
+  for (auto _ : state) {
+    plant_->SetPositions(context_.get(), q_);
+    benchmark::DoNotOptimize(plant_->CalcGravityGeneralizedForces(*context_));
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, CodeGenGravity)(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(test::iiwa::CalcGravityGeneralizedForces(q_));
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, PlantPose)(benchmark::State& state) {
+  const Body<double>& body = plant_->GetBodyByName("iiwa_link_7");
+  for (auto _ : state) {
+    plant_->SetPositions(context_.get(), q_);
+    benchmark::DoNotOptimize(plant_->EvalBodyPoseInWorld(*context_, body));
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_F(IiwaDynamicsBenchmark, CodeGenPose)(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        test::iiwa::CalcBodyPoseInWorld(q_, "iiwa_link_7"));
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+#include "drake/multibody/codegen/dynamics_codegen.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/codegen/test/acrobot_dynamics.h"
+#include "drake/multibody/codegen/test/iiwa_dynamics.h"
+#include "drake/multibody/parsing/parser.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kTolerance = 1.0e-12;
+
+std::unique_ptr<MultibodyPlant<double>> MakePlant(
+    const std::string& model, const std::string& weld_to_world = "") {
+  auto plant = std::make_unique<MultibodyPlant<double>>(0.0);
+  Parser(plant.get()).AddModelFromFile(FindResourceOrThrow(model));
+  if (!weld_to_world.empty()) {
+    plant->WeldFrames(plant->world_frame(),
+                      plant->GetFrameByName(weld_to_world));
+  }
+  plant->Finalize();
+  return plant;
+}
+
+// Verifies that the code generated for the acrobot, at build time through
+// drake_multibody_dynamics_cc_library(), matches MultibodyPlant.
+GTEST_TEST(DynamicsCodeGenTest, Acrobot) {
+  const auto plant =
+      MakePlant("drake/multibody/benchmarks/acrobot/acrobot.urdf");
+  auto context = plant->CreateDefaultContext();
+  ASSERT_EQ(test::acrobot::kNumPositions, plant->num_positions());
+  ASSERT_EQ(test::acrobot::kNumVelocities, plant->num_velocities());
+
+  const VectorXd q = Eigen::Vector2d(0.3, -1.1);
+  const VectorXd v = Eigen::Vector2d(2.0, 0.5);
+  plant->SetPositions(context.get(), q);
+  plant->SetVelocities(context.get(), v);
+
+  MatrixXd M_expected(2, 2);
+  plant->CalcMassMatrix(*context, &M_expected);
+  MatrixXd M(2, 2);
+  test::acrobot::CalcMassMatrix(q, &M);
+  EXPECT_TRUE(CompareMatrices(M, M_expected, kTolerance));
+
+  VectorXd Cv_expected(2);
+  plant->CalcBiasTerm(*context, &Cv_expected);
+  VectorXd Cv(2);
+  test::acrobot::CalcBiasTerm(q, v, &Cv);
+  EXPECT_TRUE(CompareMatrices(Cv, Cv_expected, kTolerance));
+
+  EXPECT_TRUE(CompareMatrices(
+      test::acrobot::CalcGravityGeneralizedForces(q),
+      plant->CalcGravityGeneralizedForces(*context), kTolerance));
+
+  for (const char* name : {"Link1", "Link2"}) {
+    const math::RigidTransformd X_WB_expected =
+        plant->EvalBodyPoseInWorld(*context, plant->GetBodyByName(name));
+    const math::RigidTransformd X_WB =
+        test::acrobot::CalcBodyPoseInWorld(q, name);
+    EXPECT_TRUE(X_WB.IsNearlyEqualTo(X_WB_expected, kTolerance)) << name;
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      test::acrobot::CalcBodyPoseInWorld(q, "world"), std::logic_error,
+      "CalcBodyPoseInWorld\\(\\): No code was generated for body 'world'.");
+
+  // Incorrectly sized arguments are rejected.
+  MatrixXd M_wrong(3, 3);
+  EXPECT_THROW(test::acrobot::CalcMassMatrix(q, &M_wrong), std::exception);
+  EXPECT_THROW(test::acrobot::CalcGravityGeneralizedForces(v.head(1)),
+               std::exception);
+}
+
+GTEST_TEST(DynamicsCodeGenTest, Iiwa) {
+  const auto plant = MakePlant(
+      "drake/multibody/benchmarks/kuka_iiwa_robot/kuka_iiwa_robot.urdf",
+      "base");
+  auto context = plant->CreateDefaultContext();
+  const int nv = plant->num_velocities();
+  ASSERT_EQ(test::iiwa::kNumPositions, plant->num_positions());
+  ASSERT_EQ(test::iiwa::kNumVelocities, nv);
+
+  VectorXd q(7), v(7);
+  q << 0.1, -0.2, 0.3, -0.4, 0.5, -0.6, 0.7;
+  v << 1.0, 2.0, -3.0, 0.5, -1.5, 0.25, 1.25;
+  plant->SetPositions(context.get(), q);
+  plant->SetVelocities(context.get(), v);
+
+  MatrixXd M_expected(nv, nv);
+  plant->CalcMassMatrix(*context, &M_expected);
+  MatrixXd M(nv, nv);
+  test::iiwa::CalcMassMatrix(q, &M);
+  EXPECT_TRUE(CompareMatrices(M, M_expected, kTolerance));
+
+  VectorXd Cv_expected(nv);
+  plant->CalcBiasTerm(*context, &Cv_expected);
+  VectorXd Cv(nv);
+  test::iiwa::CalcBiasTerm(q, v, &Cv);
+  EXPECT_TRUE(CompareMatrices(Cv, Cv_expected, kTolerance));
+
+  EXPECT_TRUE(CompareMatrices(test::iiwa::CalcGravityGeneralizedForces(q),
+                              plant->CalcGravityGeneralizedForces(*context),
+                              kTolerance));
+
+  const math::RigidTransformd X_WB_expected = plant->EvalBodyPoseInWorld(
+      *context, plant->GetBodyByName("iiwa_link_7"));
+  EXPECT_TRUE(test::iiwa::CalcBodyPoseInWorld(q, "iiwa_link_7")
+                  .IsNearlyEqualTo(X_WB_expected, kTolerance));
+}
+
+// Checks the structure of the generated code for selected quantities.
+GTEST_TEST(DynamicsCodeGenTest, Options) {
+  const auto plant =
+      MakePlant("drake/multibody/benchmarks/acrobot/acrobot.urdf");
+
+  DynamicsCodeGenOptions options;
+  options.namespace_name = "my::robot";
+  options.header_include_path = "my/robot.h";
+  options.mass_matrix = true;
+  options.bias_term = false;
+  options.gravity_generalized_forces = false;
+  const DynamicsCode code = GenerateDynamicsCode(*plant, options);
+
+  const auto contains = [](const std::string& text, const std::string& str) {
+    return text.find(str) != std::string::npos;
+  };
+  EXPECT_TRUE(contains(code.header, "namespace my::robot {"));
+  EXPECT_TRUE(contains(code.header, "constexpr int kNumPositions = 2;"));
+  EXPECT_TRUE(contains(code.header, "constexpr int kNumVelocities = 2;"));
+  EXPECT_TRUE(contains(code.header, "void CalcMassMatrix("));
+  EXPECT_FALSE(contains(code.header, "CalcBiasTerm"));
+  EXPECT_FALSE(contains(code.header, "CalcGravityGeneralizedForces"));
+  EXPECT_FALSE(contains(code.header, "CalcBodyPoseInWorld"));
+  EXPECT_TRUE(contains(code.source, "#include \"my/robot.h\""));
+  EXPECT_TRUE(contains(code.source,
+                       "void mass_matrix(const double* p, double* m) {"));
+
+  options.body_names = {"NotABody"};
+  EXPECT_THROW(GenerateDynamicsCode(*plant, options), std::exception);
+
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(GenerateDynamicsCode(unfinalized, options), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
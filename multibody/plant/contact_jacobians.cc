@@ -1,6 +1,56 @@
 #include "drake/multibody/plant/contact_jacobians.h"
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <class T>
+void ContactJacobians<T>::CalcContactVelocities(
+    const Eigen::Ref<const VectorX<T>>& v, EigenPtr<VectorX<T>> vn,
+    EigenPtr<VectorX<T>> vt) const {
+  DRAKE_DEMAND(vn != nullptr);
+  DRAKE_DEMAND(vt != nullptr);
+  const int nc = num_contacts();
+  DRAKE_DEMAND(vn->size() == nc);
+  DRAKE_DEMAND(vt->size() == 2 * nc);
+  for (int ic = 0; ic < nc; ++ic) {
+    const ContactPairJacobian<T>& pair_jacobian = pair_jacobians[ic];
+    Vector3<T> v_AcBc_C = Vector3<T>::Zero();
+    for (size_t k = 0; k < pair_jacobian.velocity_indices.size(); ++k) {
+      v_AcBc_C +=
+          pair_jacobian.J_AcBc_C.col(k) * v(pair_jacobian.velocity_indices[k]);
+    }
+    (*vn)(ic) = -v_AcBc_C(2);
+    vt->template segment<2>(2 * ic) = v_AcBc_C.template head<2>();
+  }
+}
+
+template <class T>
+void ContactJacobians<T>::CalcGeneralizedContactForces(
+    const Eigen::Ref<const VectorX<T>>& fn,
+    const Eigen::Ref<const VectorX<T>>& ft, EigenPtr<VectorX<T>> tau) const {
+  DRAKE_DEMAND(tau != nullptr);
+  const int nc = num_contacts();
+  DRAKE_DEMAND(fn.size() == nc);
+  DRAKE_DEMAND(ft.size() == 2 * nc);
+  tau->setZero();
+  for (int ic = 0; ic < nc; ++ic) {
+    const ContactPairJacobian<T>& pair_jacobian = pair_jacobians[ic];
+    // The force on Bc expressed in C, with the sign convention of Jn.
+    const Vector3<T> f_Bc_C(ft(2 * ic), ft(2 * ic + 1), -fn(ic));
+    for (size_t k = 0; k < pair_jacobian.velocity_indices.size(); ++k) {
+      (*tau)(pair_jacobian.velocity_indices[k]) +=
+          pair_jacobian.J_AcBc_C.col(k).dot(f_Bc_C);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     struct ::drake::multibody::internal::ContactJacobians)
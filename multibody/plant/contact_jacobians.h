@@ -10,6 +10,26 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+/// Stores the "tree-path" sparse representation of the contact Jacobian for a
+/// single contact pair between bodies A and B, with contact frame C.
+/// Only the generalized velocities of the mobilizers along the kinematic paths
+/// from the world to bodies A and B can contribute to the relative velocity
+/// `v_AcBc` of contact point Bc in Ac. Therefore only those (possibly)
+/// non-zero columns of the full `3 x nv` Jacobian are stored.
+template <class T>
+struct ContactPairJacobian {
+  /// Indices into the vector of generalized velocities v of the columns
+  /// stored in `J_AcBc_C`, sorted in increasing order and with no repetitions.
+  std::vector<int> velocity_indices;
+
+  /// Matrix of size `3 x velocity_indices.size()` such that
+  /// `v_AcBc_C = J_AcBc_C⋅v(velocity_indices)` is the velocity of Bc relative
+  /// to Ac, expressed in the contact frame C. That is, rows 0 and 1 store the
+  /// tangential components along `Cx` and `Cy` and row 2 stores the component
+  /// along `Cz = nhat_BA_W`, which is the negative of the separation speed.
+  Matrix3X<T> J_AcBc_C;
+};
+
 /// Stores the computed contact Jacobians when a point contact model is used.
 /// At a given state of the multibody system, there will be `nc` contact pairs.
 /// For each penetration pair involving bodies A and B a contact frame C is
@@ -19,26 +39,46 @@ namespace internal {
 /// details on the definition of each contact pair. Versors `Cx_W` and `Cy_W`
 /// constitute a basis of the plane normal to `Cz_W` and are arbitrarily chosen.
 /// Below, v denotes the vector of generalized velocities, of size `nv`.
+///
+/// The Jacobians are stored in the sparse tree-path representation described
+/// in ContactPairJacobian. Together, the pairs define:
+///   - the normal contact Jacobian `Jn`, of size `nc x nv`, such that
+///     `vn = Jn⋅v` is the separation speed for each contact point, defined to
+///     be positive when bodies are moving away from each other.
+///   - the tangential contact Jacobian `Jt`, of size `2⋅nc x nv`, such that
+///     `vt = Jt⋅v` concatenates the tangential components of the relative
+///     velocity vector `v_AcBc` in the frame C of contact, for each pair. That
+///     is, for the k-th contact pair, `vt.segment<2>(2 * ik)` stores the
+///     components of `v_AcBc` in the `Cx` and `Cy` directions.
+///
+/// `Jn` and `Jt` are never formed. Instead, the operators below apply them at
+/// a cost that scales with the number of non-zeros rather than with
+/// `nc x nv`.
 /// @see MultibodyPlant::EvalContactJacobians().
 template <class T>
 struct ContactJacobians {
-  /// Normal contact Jacobian.
-  /// `Jn` is a matrix of size `nc x nv` such that `vn = Jn⋅v` is the separation
-  /// speed for each contact point, defined to be positive when bodies are
-  /// moving away from each other.
-  MatrixX<T> Jn;
-
-  /// Tangential contact forces Jacobian.
-  /// `Jt` is a matrix of size `2⋅nc x nv` such that `vt = Jt⋅v` concatenates
-  /// the tangential components of the relative velocity vector `v_AcBc`
-  /// in the frame C of contact, for each pair. That is, for the k-th contact
-  /// pair, `vt.segment<2>(2 * ik)` stores the components of `v_AcBc` in the
-  /// `Cx` and `Cy` directions.
-  MatrixX<T> Jt;
-
   /// List of contact frames orientation R_WC in the world frame W for each
   /// contact pair.
   std::vector<drake::math::RotationMatrix<T>> R_WC_list;
+
+  /// The contact Jacobian of each contact pair.
+  std::vector<ContactPairJacobian<T>> pair_jacobians;
+
+  /// Returns the number of contact pairs `nc`.
+  int num_contacts() const { return pair_jacobians.size(); }
+
+  /// Computes `vn = Jn⋅v` and `vt = Jt⋅v`.
+  /// @pre `vn` and `vt` are non-null and have sizes `nc` and `2⋅nc`.
+  void CalcContactVelocities(const Eigen::Ref<const VectorX<T>>& v,
+                             EigenPtr<VectorX<T>> vn,
+                             EigenPtr<VectorX<T>> vt) const;
+
+  /// Computes the generalized forces `tau = Jnᵀ⋅fn + Jtᵀ⋅ft`, where `fn` and
+  /// `ft` are of size `nc` and `2⋅nc`.
+  /// @pre `tau` is non-null and has size `nv`.
+  void CalcGeneralizedContactForces(const Eigen::Ref<const VectorX<T>>& fn,
+                                    const Eigen::Ref<const VectorX<T>>& ft,
+                                    EigenPtr<VectorX<T>> tau) const;
 };
 
 }  // namespace internal
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <set>
@@ -900,23 +901,66 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
   DRAKE_DEMAND(Jn_ptr != nullptr);
   DRAKE_DEMAND(Jt_ptr != nullptr);
 
-  const int num_contacts = point_pairs_set.size();
+  std::vector<internal::ContactPairJacobian<T>> pair_jacobians;
+  CalcContactPairJacobians(context, point_pairs_set, &pair_jacobians,
+                           R_WC_set);
 
-  // Jn is defined such that vn = Jn * v, with vn of size nc.
-  auto& Jn = *Jn_ptr;
-  Jn.resize(num_contacts, num_velocities());
+  // Scatter the non-zero columns of each pair into the dense Jacobians.
+  const int num_contacts = pair_jacobians.size();
+  MatrixX<T>& Jn = *Jn_ptr;
+  MatrixX<T>& Jt = *Jt_ptr;
+  Jn.setZero(num_contacts, num_velocities());
+  Jt.setZero(2 * num_contacts, num_velocities());
+  for (int icontact = 0; icontact < num_contacts; ++icontact) {
+    const internal::ContactPairJacobian<T>& pair_jacobian =
+        pair_jacobians[icontact];
+    for (size_t k = 0; k < pair_jacobian.velocity_indices.size(); ++k) {
+      const int iv = pair_jacobian.velocity_indices[k];
+      Jn(icontact, iv) = -pair_jacobian.J_AcBc_C(2, k);
+      Jt(2 * icontact, iv) = pair_jacobian.J_AcBc_C(0, k);
+      Jt(2 * icontact + 1, iv) = pair_jacobian.J_AcBc_C(1, k);
+    }
+  }
+}
 
-  // Jt is defined such that vt = Jt * v, with vt of size 2nc.
-  auto& Jt = *Jt_ptr;
-  Jt.resize(2 * num_contacts, num_velocities());
+template<typename T>
+void MultibodyPlant<T>::CalcContactPairJacobians(
+    const systems::Context<T>& context,
+    const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs_set,
+    std::vector<internal::ContactPairJacobian<T>>* pair_jacobians,
+    std::vector<RotationMatrix<T>>* R_WC_set) const {
+  DRAKE_DEMAND(pair_jacobians != nullptr);
 
+  const int num_contacts = point_pairs_set.size();
+  pair_jacobians->resize(num_contacts);
   if (R_WC_set != nullptr) R_WC_set->clear();
 
-  // Quick no-op exit. Notice we did resize Jn, Jt and R_WC_set to be zero
-  // sized.
+  // Quick no-op exit. Notice we did resize pair_jacobians and R_WC_set to be
+  // zero sized.
   if (num_contacts == 0) return;
 
-  const Frame<T>& frame_W = world_frame();
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+
+  // Scratch space, reused for all contact pairs.
+  Matrix3X<T> Jv_WAc;
+  Matrix3X<T> Jv_WBc;
+
+  // The kinematic path from the world to each body in contact, and the
+  // velocities on it, indexed by BodyIndex. They are computed on the first
+  // contact of each body (a path always contains the world, so an empty path
+  // is not computed yet), since a body is often in several contacts.
+  std::vector<std::vector<internal::BodyNodeIndex>> paths_to_world(
+      num_bodies());
+  std::vector<std::vector<int>> velocities_on_paths(num_bodies());
+  auto compute_path = [&](const Body<T>& body) {
+    std::vector<internal::BodyNodeIndex>& path = paths_to_world[body.index()];
+    if (!path.empty()) return;
+    topology.GetKinematicPathToWorld(body.node_index(), &path);
+    topology.GetVelocitiesOnKinematicPathToWorld(
+        path, &velocities_on_paths[body.index()]);
+  };
+
   for (int icontact = 0; icontact < num_contacts; ++icontact) {
     const auto& point_pair = point_pairs_set[icontact];
 
@@ -938,45 +982,39 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     // midpoint (or any other point between Ac and Bc for that matter) since,
     // in the limit to rigid contact, Ac = Bc.
 
-    // For contact point Ac of (fixed to) body A, calculate `Jv_v_WAc` (Ac's
+    // Only the velocities on the kinematic paths from the world to A and B
+    // can contribute to the relative velocity at the contact. All other
+    // columns of the contact Jacobian are zero and we neither compute nor
+    // store them.
+    compute_path(bodyA);
+    compute_path(bodyB);
+    const std::vector<int>& velocities_on_path_A =
+        velocities_on_paths[bodyA_index];
+    const std::vector<int>& velocities_on_path_B =
+        velocities_on_paths[bodyB_index];
+
+    // For contact point Ac of (fixed to) body A, calculate `Jv_WAc` (Ac's
     // translational velocity Jacobian in the world frame W with respect to
-    // generalized velocities v).  Note: Ac's translational velocity in W can
-    // be written in terms of this Jacobian as `v_WAc = Jv_v_WAc * v`.
-    Matrix3X<T> Jv_WAc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyA.body_frame(),
-                                                      frame_W,
-                                                      p_WCa,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WAc);
-
-    // Similarly, for contact point Bc of body B, calculate `Jv_v_WBc
-    // (Bc's translational velocity Jacobian in W with respect to v)
-    Matrix3X<T> Jv_WBc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyB.body_frame(),
-                                                      frame_W,
-                                                      p_WCb,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WBc);
-
-    // Computation of the normal separation velocities Jacobian Jn:
-    //
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // From where the separation velocity is computed as
-    //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
-    // where the negative sign stems from the sign convention for vn and xdot.
-    // This can be written in terms of the Jacobians as
-    //   vn = -nhat_BA_Wᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jn.row(icontact) = nhat_BA_W.transpose() * (Jv_WAc - Jv_WBc);
-
-    // Computation of the tangential velocities Jacobian Jt:
-    //
+    // the generalized velocities on the path from the world to A). Note: Ac's
+    // translational velocity in W can be written in terms of this Jacobian as
+    // `v_WAc = Jv_WAc * v(velocities_on_path_A)`.
+    Jv_WAc.resize(3, velocities_on_path_A.size());
+    internal_tree().CalcJacobianTranslationalVelocityOnPathToWorld(
+        context, paths_to_world[bodyA_index], p_WCa, &Jv_WAc);
+
+    // Similarly, for contact point Bc of body B, calculate `Jv_WBc`.
+    Jv_WBc.resize(3, velocities_on_path_B.size());
+    internal_tree().CalcJacobianTranslationalVelocityOnPathToWorld(
+        context, paths_to_world[bodyB_index], p_WCb, &Jv_WBc);
+
+    internal::ContactPairJacobian<T>& pair_jacobian =
+        (*pair_jacobians)[icontact];
+    std::vector<int>& velocity_indices = pair_jacobian.velocity_indices;
+    velocity_indices.clear();
+    std::set_union(velocities_on_path_A.begin(), velocities_on_path_A.end(),
+                   velocities_on_path_B.begin(), velocities_on_path_B.end(),
+                   std::back_inserter(velocity_indices));
+
     // Compute the orientation of a contact frame C at the contact point such
     // that the z-axis Cz equals to nhat_BA_W. The tangent vectors are
     // arbitrary, with the only requirement being that they form a valid right
@@ -990,13 +1028,34 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const Vector3<T> that2_W = R_WC.matrix().col(1);  // that2 = Cy.
 
     // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // The first two components of this velocity in C corresponds to the
-    // tangential velocities in a plane normal to nhat_BA.
-    //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jt.row(2 * icontact)     = that1_W.transpose() * (Jv_WBc - Jv_WAc);
-    Jt.row(2 * icontact + 1) = that2_W.transpose() * (Jv_WBc - Jv_WAc);
+    //   v_AcBc_W = v_WBc - v_WAc = (Jv_WBc - Jv_WAc)⋅v.
+    // Its components in C are:
+    //   vx_AcBc_C = that1⋅v_AcBc, vy_AcBc_C = that2⋅v_AcBc
+    // which correspond to the tangential velocities in a plane normal to
+    // nhat_BA, and
+    //   vz_AcBc_C = nhat_BA⋅v_AcBc = -vn
+    // where the negative sign stems from the sign convention for the
+    // separation velocity vn (positive when bodies move apart).
+    // Since velocity_indices is the sorted union of the (sorted) velocities on
+    // the paths to A and B, we walk the three lists together.
+    const int num_path_velocities = velocity_indices.size();
+    Matrix3X<T>& J_AcBc_C = pair_jacobian.J_AcBc_C;
+    J_AcBc_C.resize(3, num_path_velocities);
+    int column_A = 0;
+    int column_B = 0;
+    for (int k = 0; k < num_path_velocities; ++k) {
+      const int iv = velocity_indices[k];
+      Vector3<T> Jv_AcBc_W = Vector3<T>::Zero();
+      if (column_B < Jv_WBc.cols() && velocities_on_path_B[column_B] == iv) {
+        Jv_AcBc_W = Jv_WBc.col(column_B++);
+      }
+      if (column_A < Jv_WAc.cols() && velocities_on_path_A[column_A] == iv) {
+        Jv_AcBc_W -= Jv_WAc.col(column_A++);
+      }
+      J_AcBc_C(0, k) = that1_W.dot(Jv_AcBc_W);
+      J_AcBc_C(1, k) = that2_W.dot(Jv_AcBc_W);
+      J_AcBc_C(2, k) = nhat_BA_W.dot(Jv_AcBc_W);
+    }
   }
 }
 
@@ -1726,7 +1785,8 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
 template<typename T>
 TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     int num_substeps,
-    const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
+    const MatrixX<T>& M0,
+    const internal::ContactJacobians<T>& contact_jacobians,
     const VectorX<T>& minus_tau,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
     const VectorX<T>& mu,
@@ -1749,7 +1809,7 @@ TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
 
     // Update the data.
     tamsi_solver_->SetTwoWayCoupledProblemData(
-        &M0, &Jn, &Jt,
+        &M0, &contact_jacobians,
         &p_star_substep, &phi0_substep,
         &stiffness, &damping, &mu);
 
@@ -1963,9 +2023,8 @@ void MultibodyPlant<T>::CalcTamsiResults(
   int num_substeps = 0;
   do {
     ++num_substeps;
-    info = SolveUsingSubStepping(num_substeps, M0, contact_jacobians.Jn,
-                                 contact_jacobians.Jt, minus_tau, stiffness,
-                                 damping, mu, v0, phi0);
+    info = SolveUsingSubStepping(num_substeps, M0, contact_jacobians,
+                                 minus_tau, stiffness, damping, mu, v0, phi0);
   } while (info != TamsiSolverResult::kSuccess &&
            num_substeps < kNumMaxSubTimeSteps);
 
@@ -2487,9 +2546,9 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
         auto& context = dynamic_cast<const Context<T>&>(context_base);
         auto& contact_jacobians_cache =
             cache_value->get_mutable_value<internal::ContactJacobians<T>>();
-        this->CalcNormalAndTangentContactJacobians(
+        this->CalcContactPairJacobians(
             context, EvalPointPairPenetrations(context),
-            &contact_jacobians_cache.Jn, &contact_jacobians_cache.Jt,
+            &contact_jacobians_cache.pair_jacobians,
             &contact_jacobians_cache.R_WC_list);
       },
       // We explicitly declare the configuration dependence even though the
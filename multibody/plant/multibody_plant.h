@@ -3826,10 +3826,12 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // This helper uses num_substeps within a time interval of duration dt
   // to perform the update using a step size dt_substep = dt/num_substeps.
   // During the time span dt the problem data M, Jn, Jt and minus_tau, are
-  // approximated to be constant, a first order approximation.
+  // approximated to be constant, a first order approximation. Jn and Jt are
+  // given in the sparse representation of `contact_jacobians`.
   TamsiSolverResult SolveUsingSubStepping(
       int num_substeps,
-      const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
+      const MatrixX<T>& M0,
+      const internal::ContactJacobians<T>& contact_jacobians,
       const VectorX<T>& minus_tau,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
       const VectorX<T>& mu,
@@ -4143,12 +4145,32 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // R_WC_set will contain the orientation R_WC (with columns Cx, Cy, Cz) in the
   // world using the mean of the pair of witnesses for point_pairs_set[i] as the
   // contact point.
+  //
+  // This method forms the dense Jn and Jt from CalcContactPairJacobians() and
+  // is only used for testing. The plant itself only uses the sparse
+  // representation, see EvalContactJacobians().
   void CalcNormalAndTangentContactJacobians(
       const systems::Context<T>& context,
       const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs_set,
       MatrixX<T>* Jn, MatrixX<T>* Jt,
       std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr) const;
 
+  // Computes the same contact Jacobian information as
+  // CalcNormalAndTangentContactJacobians(), though in the sparse "tree-path"
+  // representation described in internal::ContactPairJacobian. Only the
+  // non-zero columns are computed, see
+  // MultibodyTree::CalcJacobianTranslationalVelocityOnPathToWorld(). Therefore
+  // the cost of this method is proportional to the number of velocities along
+  // the kinematic paths of the contacting bodies rather than to `nv`.
+  // On output, the i-th entry of pair_jacobians corresponds to
+  // point_pairs_set[i]. R_WC_set is set as in
+  // CalcNormalAndTangentContactJacobians().
+  void CalcContactPairJacobians(
+      const systems::Context<T>& context,
+      const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs_set,
+      std::vector<internal::ContactPairJacobian<T>>* pair_jacobians,
+      std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr) const;
+
   // Evaluates the contact Jacobians for the given state of the plant stored in
   // `context`.
   // This method first evaluates the point pair penetrations in the system for
@@ -4161,7 +4183,8 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // basis of the plane normal to `Cz_W` and are arbitrarily chosen. The
   // contact frame basis can be accessed in the results, see
   // ContactJacobians::R_WC_list. Further, for each contact pair evaluated,
-  // this method computes the Jacobians `Jn` and `Jt`. With the vector of
+  // this method computes the Jacobians `Jn` and `Jt`, in the sparse
+  // representation of ContactJacobians::pair_jacobians. With the vector of
   // generalized velocities v of size `nv` and `nc` the number of contact
   // pairs;
   //   - `Jn` is a matrix of size `nc x nv` such that `vn = Jn⋅v` is the
@@ -252,7 +252,7 @@ TamsiSolver<T>::TamsiSolver(int nv) :
     // Provide an initial (arbitrarily large enough for most applications)
     // workspace size so that we avoid re-allocations afterwards as much as we
     // can.
-    variable_size_workspace_(128, nv) {
+    variable_size_workspace_(128) {
   // We allow empty worlds, with a trivial solution.
   DRAKE_THROW_UNLESS(nv >= 0);
 }
@@ -271,7 +271,7 @@ void TamsiSolver<T>::SetOneWayCoupledProblemData(
   DRAKE_THROW_UNLESS(mu->size() == nc_);
   // Keep references to the problem data.
   problem_data_aliases_.SetOneWayCoupledData(M, Jn, Jt, p_star, fn, mu);
-  variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  variable_size_workspace_.ResizeIfNeeded(nc_);
 }
 
 template <typename T>
@@ -291,7 +291,63 @@ void TamsiSolver<T>::SetTwoWayCoupledProblemData(
   // Keep references to the problem data.
   problem_data_aliases_.SetTwoWayCoupledData(M, Jn, Jt, p_star, x0, stiffness,
                                              dissipation, mu);
-  variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  variable_size_workspace_.ResizeIfNeeded(nc_);
+}
+
+template <typename T>
+void TamsiSolver<T>::SetTwoWayCoupledProblemData(
+    EigenPtr<const MatrixX<T>> M,
+    const internal::ContactJacobians<T>* contact_jacobians,
+    EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> x0,
+    EigenPtr<const VectorX<T>> stiffness,
+    EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
+  DRAKE_THROW_UNLESS(contact_jacobians != nullptr);
+  nc_ = contact_jacobians->num_contacts();
+  DRAKE_THROW_UNLESS(p_star->size() == nv_);
+  DRAKE_THROW_UNLESS(M->rows() == nv_ && M->cols() == nv_);
+  for (const auto& pair_jacobian : contact_jacobians->pair_jacobians) {
+    const std::vector<int>& velocity_indices = pair_jacobian.velocity_indices;
+    DRAKE_THROW_UNLESS(pair_jacobian.J_AcBc_C.cols() ==
+                       static_cast<int>(velocity_indices.size()));
+    DRAKE_THROW_UNLESS(velocity_indices.empty() ||
+                       (velocity_indices.front() >= 0 &&
+                        velocity_indices.back() < nv_));
+  }
+  DRAKE_THROW_UNLESS(x0->size() == nc_);
+  DRAKE_THROW_UNLESS(mu->size() == nc_);
+  DRAKE_THROW_UNLESS(stiffness->size() == nc_);
+  DRAKE_THROW_UNLESS(dissipation->size() == nc_);
+  // Keep references to the problem data.
+  problem_data_aliases_.SetTwoWayCoupledData(M, contact_jacobians, p_star, x0,
+                                             stiffness, dissipation, mu);
+  variable_size_workspace_.ResizeIfNeeded(nc_);
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcContactVelocities(
+    const Eigen::Ref<const VectorX<T>>& v,
+    EigenPtr<VectorX<T>> vn,
+    EigenPtr<VectorX<T>> vt) const {
+  if (problem_data_aliases_.has_contact_jacobians_data()) {
+    problem_data_aliases_.contact_jacobians().CalcContactVelocities(v, vn, vt);
+  } else {
+    *vn = problem_data_aliases_.Jn() * v;
+    *vt = problem_data_aliases_.Jt() * v;
+  }
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcGeneralizedContactForces(
+    const Eigen::Ref<const VectorX<T>>& fn,
+    const Eigen::Ref<const VectorX<T>>& ft,
+    EigenPtr<VectorX<T>> tau) const {
+  if (problem_data_aliases_.has_contact_jacobians_data()) {
+    problem_data_aliases_.contact_jacobians().CalcGeneralizedContactForces(
+        fn, ft, tau);
+  } else {
+    *tau = problem_data_aliases_.Jn().transpose() * fn +
+        problem_data_aliases_.Jt().transpose() * ft;
+  }
 }
 
 template <typename T>
@@ -456,12 +512,11 @@ template <typename T>
 void TamsiSolver<T>::CalcNormalForces(
     const Eigen::Ref<const VectorX<T>>& x,
     const Eigen::Ref<const VectorX<T>>& vn,
-    const Eigen::Ref<const MatrixX<T>>& Jn,
     double dt,
-    // We change from fn/Gn in the header to fn_ptr, Gn_ptr here to avoid name
-    // clashes with local variables.
+    // We change from fn/dfn_dvn in the header to fn_ptr, dfn_dvn_ptr here to
+    // avoid name clashes with local variables.
     EigenPtr<VectorX<T>> fn_ptr,
-    EigenPtr<MatrixX<T>> Gn_ptr) const {
+    EigenPtr<VectorX<T>> dfn_dvn_ptr) const {
   using std::max;
   const int nc = nc_;  // Number of contact points.
 
@@ -475,52 +530,36 @@ void TamsiSolver<T>::CalcNormalForces(
   const auto& stiffness = problem_data_aliases_.stiffness();
   const auto& dissipation = problem_data_aliases_.dissipation();
 
-  VectorX<T> x_capped(nc);  // = x₊
-  VectorX<T> H_x(nc);  // = H(x), with H the Heaviside function.
-  VectorX<T> k_vn_capped(nc);  // = k(vₙ)₊ = k (1 − d vₙ)₊
-  VectorX<T> H_k_vn(nc);  // = H(k(vₙ)).
-
   auto& fn = *fn_ptr;
+  auto& dfn_dvn = *dfn_dvn_ptr;
   for (int ic = 0; ic < nc; ++ic) {
     // Stiffness as a function of vn, k(vₙ) = k (1 − d vₙ)₊
     // where x₊ = max(x, 0).
-    T k_vn = stiffness(ic) * (1.0 - dissipation(ic) * vn(ic));
+    const T k_vn = stiffness(ic) * (1.0 - dissipation(ic) * vn(ic));
 
-    k_vn_capped(ic) = max(0.0, k_vn);
-    x_capped(ic) = max(0.0, x(ic));
+    const T k_vn_capped = max(0.0, k_vn);  // = k(vₙ)₊
+    const T x_capped = max(0.0, x(ic));  // = x₊
     // fₙ = k(vₙ)₊ x₊
-    fn(ic) = k_vn_capped(ic) * x_capped(ic);
-    // Factors in the derivatives of x₊ and k(vₙ)₊
-    H_x(ic) = x(ic) > 0 ? 1.0 : 0.0;
-    H_k_vn(ic) = k_vn > 0 ? 1.0 : 0.0;
+    fn(ic) = k_vn_capped * x_capped;
+    // Factors in the derivatives of x₊ and k(vₙ)₊, with H the Heaviside
+    // function.
+    const double H_x = x(ic) > 0 ? 1.0 : 0.0;
+    const double H_k_vn = k_vn > 0 ? 1.0 : 0.0;
+
+    // ∂xˢ⁺¹₊/∂vₙ = −δt H(xˢ⁺¹), with xˢ⁺¹ = xˢ − δt vₙˢ⁺¹.
+    const T dx_capped_dvn = -dt * H_x;
+    // ∂k(vₙˢ⁺¹)₊/∂vₙ = −H(k(vₙˢ⁺¹)) k d.
+    const T dk_vn_capped_dvn = -H_k_vn * stiffness(ic) * dissipation(ic);
+
+    // ∂fₙ/∂vₙ = x₊ ∂k(vₙ)₊/∂vₙ + k(vₙ)₊ ∂x₊/∂vₙ.
+    dfn_dvn(ic) = x_capped * dk_vn_capped_dvn + k_vn_capped * dx_capped_dvn;
   }
-
-  // ∇ᵥxˢ⁺¹₊ = −δt diag(H(xˢ⁺¹)) Jₙ, with xˢ⁺¹ = xˢ − δt vₙˢ⁺¹.
-  // of size nc x nv.
-  MatrixX<T> nabla_x_capped = -dt * H_x.asDiagonal() * Jn;
-
-  // ∇ᵥk(vₙˢ⁺¹)₊ = −diag(H(k(vₙˢ⁺¹))) diag(k) diag(d) Jₙ
-  // of size nc x nv.
-  MatrixX<T> nabla_k_vn_capped = -(
-      (H_k_vn.array() *
-          stiffness.array() * dissipation.array()).matrix().asDiagonal() * Jn);
-
-  auto& Gn = *Gn_ptr;
-
-  // fₙ = k(vₙ)₊ x₊
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) =
-  //        diag(x₊) ∇ᵥk(vₙˢ⁺¹)₊ + diag(k(vₙ)₊) ∇ᵥxˢ⁺¹₊
-  // Gn is of size nc x nv.
-  Gn = x_capped.asDiagonal() * nabla_k_vn_capped +
-      k_vn_capped.asDiagonal() * nabla_x_capped;
 }
 
 template <typename T>
 void TamsiSolver<T>::CalcJacobian(
     const Eigen::Ref<const MatrixX<T>>& M,
-    const Eigen::Ref<const MatrixX<T>>& Jn,
-    const Eigen::Ref<const MatrixX<T>>& Jt,
-    const Eigen::Ref<const MatrixX<T>>& Gn,
+    const Eigen::Ref<const VectorX<T>>& dfn_dvn,
     const std::vector<Matrix2<T>>& dft_dvt,
     const Eigen::Ref<const VectorX<T>>& t_hat,
     const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
@@ -537,11 +576,10 @@ void TamsiSolver<T>::CalcJacobian(
   // brevity here.
   // Analytical differentiation of the residual with respect to v leads to:
   //   J = ∇ᵥR = M − δt Jₙᵀ Gn − δt Jₜᵀ Gt
-  // where Gn = Gn = ∇ᵥfₙ(∇ᵥfₙ(x(v), vₙ(v))) (of size nc x nv) and
+  // where Gn = ∇ᵥfₙ(x(v), vₙ(v)) = diag(dfn_dvn) Jₙ (of size nc x nv) and
   // Gt = ∇ᵥfₜ(vₜ(v)) (of size 2nc x nv) are the gradients with respect to v
-  // of the normal and friction forces, respectively. The gradient of the normal
-  // forces is an input to this method while the gradient of the tangential
-  // forces can be computed in terms of dft_dvt and Gn as:
+  // of the normal and friction forces, respectively. The gradient of the
+  // tangential forces can be computed in terms of dft_dvt and Gn as:
   //   Gt = ∇ᵥfₜ = −diag(dft_dvt) Jₜ - Gfn(ft) Jₙ
   // recall that dft_dvt = −∇ᵥₜfₜ so that dft_dvt is defined PSD.
   // For each contact point dft_dvt is a 2x2 PSD matrix. diag(dft_dvt) is the
@@ -552,10 +590,58 @@ void TamsiSolver<T>::CalcJacobian(
   // the functional dependence of the normal forces with v.
   // Notice that Gfn(ft) is zero for the one-way coupled scheme.
 
+  if (problem_data_aliases_.has_contact_jacobians_data()) {
+    // With the sparse Jacobians, the rows of Jₙ and Jₜ for the ic-th contact
+    // point are only non-zero for the velocities along the kinematic paths of
+    // the contacting bodies. Therefore each contact point only contributes to
+    // J with a dense block in those rows and columns.
+    const internal::ContactJacobians<T>& contact_jacobians =
+        problem_data_aliases_.contact_jacobians();
+    *J = M;
+    for (int ic = 0; ic < nc; ++ic) {  // Index ic scans contact points.
+      const internal::ContactPairJacobian<T>& pair_jacobian =
+          contact_jacobians.pair_jacobians[ic];
+      const std::vector<int>& velocity_indices =
+          pair_jacobian.velocity_indices;
+      const int num_path_velocities = velocity_indices.size();
+
+      // Non-zero columns of the rows of Jₜ and Jₙ for this contact point.
+      const auto Jt_ic = pair_jacobian.J_AcBc_C.template topRows<2>();
+      const RowVectorX<T> Jn_ic = -pair_jacobian.J_AcBc_C.row(2);
+
+      // Non-zero columns of the rows of Gt = −∇ᵥfₜ for this contact point.
+      Matrix2X<T> Gt_ic = -dft_dvt[ic] * Jt_ic;
+      // Contribution to J from this contact point, i.e. δt Jₜᵀ Gt (+ δt Jₙᵀ Gn
+      // for the two-way coupled scheme).
+      MatrixX<T> J_ic(num_path_velocities, num_path_velocities);
+      if (has_two_way_coupling()) {
+        // Add contribution from Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹).
+        const RowVectorX<T> Gn_ic = dfn_dvn(ic) * Jn_ic;
+        Gt_ic -= mu_vt(ic) * t_hat.template segment<2>(2 * ic) * Gn_ic;
+        J_ic = dt * (Jt_ic.transpose() * Gt_ic + Jn_ic.transpose() * Gn_ic);
+      } else {
+        J_ic = dt * Jt_ic.transpose() * Gt_ic;
+      }
+
+      for (int j = 0; j < num_path_velocities; ++j) {
+        for (int i = 0; i < num_path_velocities; ++i) {
+          (*J)(velocity_indices[i], velocity_indices[j]) -= J_ic(i, j);
+        }
+      }
+    }
+    return;
+  }
+
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+
   // Compute Gt = −∇ᵥfₜ (gradient of the friction forces with respect to the
   // generalized velocities) as Gt = −diag(dft_dvt) Jt and use the fact that
   // diag(dft_dvt) is block diagonal.
   MatrixX<T> Gt(nf, nv);  // −∇ᵥfₜ
+  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), only for the two-way coupled scheme.
+  MatrixX<T> Gn;
+  if (has_two_way_coupling()) Gn = dfn_dvn.asDiagonal() * Jn;
   for (int ic = 0; ic < nc; ++ic) {  // Index ic scans contact points.
     const int ik = 2 * ic;  // Index ik scans contact vector quantities.
     Gt.block(ik, 0, 2, nv) =
@@ -636,8 +722,6 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
 
   // Convenient aliases to problem data.
   const auto M = problem_data_aliases_.M();
-  const auto Jn = problem_data_aliases_.Jn();
-  const auto Jt = problem_data_aliases_.Jt();
   const auto p_star = problem_data_aliases_.p_star();
 
   // Convenient aliases to fixed size workspace variables.
@@ -656,7 +740,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   auto Delta_vn = variable_size_workspace_.mutable_Delta_vn();
   auto Delta_vt = variable_size_workspace_.mutable_Delta_vt();
   auto& dft_dvt = variable_size_workspace_.mutable_dft_dvt();
-  auto Gn = variable_size_workspace_.mutable_Gn();
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
   auto fn = variable_size_workspace_.mutable_fn();
@@ -673,8 +757,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
 
   for (int iter = 0; iter < max_iterations; ++iter) {
     // Update normal and tangential velocities.
-    vn = Jn * v;
-    vt = Jt * v;
+    CalcContactVelocities(v, &vn, &vt);
 
     if (has_two_way_coupling()) {
       // Update the penetration for the two-way coupling scheme.
@@ -682,7 +765,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
       x = x0 - dt * vn;
     }
 
-    CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
+    CalcNormalForces(x, vn, dt, &fn, &dfn_dvn);
 
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
@@ -693,21 +776,22 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // Convergence is monitored in both tangential and normal directions.
     if (std::max(vt_error, vn_error) < v_contact_tolerance) {
       // Update generalized forces and return.
-      tau_f = Jt.transpose() * ft;
-      tau = tau_f + Jn.transpose() * fn;
+      CalcGeneralizedContactForces(variable_size_workspace_.zero_fn(), ft,
+                                   &tau_f);
+      CalcGeneralizedContactForces(fn, ft, &tau);
       return TamsiSolverResult::kSuccess;
     }
 
-    // Newton-Raphson residual.
-    residual =
-        M * v - p_star - dt * Jn.transpose() * fn - dt * Jt.transpose() * ft;
+    // Newton-Raphson residual, with tau = Jₙᵀ fₙ + Jₜᵀ fₜ.
+    CalcGeneralizedContactForces(fn, ft, &tau);
+    residual = M * v - p_star - dt * tau;
 
     // Compute gradient dft_dvt = ∇ᵥₜfₜ(vₜ) as a function of fn, mus,
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
     // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+    CalcJacobian(M, dfn_dvn, dft_dvt, t_hat, mu_vt, dt, &J);
 
     // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
     // Since we are in a non-linear iteration, an approximate cheap solution
@@ -735,11 +819,9 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // determine by limiting the maximum angle change between vₜᵏ and vₜᵏ⁺¹.
     // For multiple contact points, we choose the minimum α among all contact
     // points.
-    Delta_vt = Jt * Delta_v;
-
-    // Similarly to Δvₜᵏ above, we define the update in the normal velocities
-    // as Δvₙᵏ = Jₙ Δvᵏ.
-    Delta_vn = Jn * Delta_v;
+    // Similarly, we define the update in the normal velocities as
+    // Δvₙᵏ = Jₙ Δvᵏ.
+    CalcContactVelocities(Delta_v, &Delta_vn, &Delta_vt);
 
     // We monitor convergence in both normal and tangential velocities.
     vn_error = ExtractDoubleOrThrow(Delta_vn.norm());
@@ -8,6 +8,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/plant/contact_jacobians.h"
 
 namespace drake {
 namespace multibody {
@@ -609,6 +610,23 @@ class TamsiSolver {
       EigenPtr<const VectorX<T>> x0, EigenPtr<const VectorX<T>> stiffness,
       EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
 
+  /// Alternative signature for SetTwoWayCoupledProblemData() for which the
+  /// normal and tangential velocities Jacobians `Jn` and `Jt` are given in the
+  /// sparse tree-path representation of internal::ContactJacobians rather
+  /// than as dense matrices. The number of contact points is
+  /// `nc = contact_jacobians->num_contacts()`. With this representation, the
+  /// cost of applying the Jacobians and of forming the Newton-Raphson Jacobian
+  /// scales with the number of velocities along the kinematic paths of the
+  /// contacting bodies rather than with `nc x nv`.
+  /// All other parameters, the warning on stored references and the
+  /// exceptions are as documented for the dense version.
+  void SetTwoWayCoupledProblemData(
+      EigenPtr<const MatrixX<T>> M,
+      const internal::ContactJacobians<T>* contact_jacobians,
+      EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> x0,
+      EigenPtr<const VectorX<T>> stiffness,
+      EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
+
   /// Given an initial guess `v_guess`, this method uses a Newton-Raphson
   /// iteration to find a solution for the generalized velocities satisfying
   /// either Eq. (3) when one-way coupling is used or Eq. (10) when two-way
@@ -736,6 +754,7 @@ class TamsiSolver {
       M_ptr_ = M;
       Jn_ptr_ = Jn;
       Jt_ptr_ = Jt;
+      contact_jacobians_ptr_ = nullptr;
       p_star_ptr_ = p_star;
       fn_ptr_ = fn;
       mu_ptr_ = mu;
@@ -765,6 +784,37 @@ class TamsiSolver {
       M_ptr_ = M;
       Jn_ptr_ = Jn;
       Jt_ptr_ = Jt;
+      contact_jacobians_ptr_ = nullptr;
+      p_star_ptr_ = p_star;
+      x0_ptr_ = x0;
+      stiffness_ptr_ = stiffness;
+      dissipation_ptr_ = dissipation;
+      mu_ptr_ = mu;
+    }
+
+    // Same as the previous overload, but with the Jacobians given in the
+    // sparse representation of `contact_jacobians`.
+    void SetTwoWayCoupledData(
+        EigenPtr<const MatrixX<T>> M,
+        const internal::ContactJacobians<T>* contact_jacobians,
+        EigenPtr<const VectorX<T>> p_star,
+        EigenPtr<const VectorX<T>> x0,
+        EigenPtr<const VectorX<T>> stiffness,
+        EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
+      DRAKE_DEMAND(M != nullptr);
+      DRAKE_DEMAND(contact_jacobians != nullptr);
+      DRAKE_DEMAND(p_star != nullptr);
+      DRAKE_DEMAND(x0 != nullptr);
+      DRAKE_DEMAND(stiffness != nullptr);
+      DRAKE_DEMAND(dissipation != nullptr);
+      DRAKE_DEMAND(mu != nullptr);
+      DRAKE_THROW_UNLESS(coupling_scheme_ == kInvalidScheme ||
+          coupling_scheme_ == kTwoWayCoupled);
+      coupling_scheme_ = kTwoWayCoupled;
+      M_ptr_ = M;
+      Jn_ptr_ = nullptr;
+      Jt_ptr_ = nullptr;
+      contact_jacobians_ptr_ = contact_jacobians;
       p_star_ptr_ = p_star;
       x0_ptr_ = x0;
       stiffness_ptr_ = stiffness;
@@ -779,8 +829,36 @@ class TamsiSolver {
     }
 
     Eigen::Ref<const MatrixX<T>> M() const { return *M_ptr_; }
-    Eigen::Ref<const MatrixX<T>> Jn() const { return *Jn_ptr_; }
-    Eigen::Ref<const MatrixX<T>> Jt() const { return *Jt_ptr_; }
+
+    // Returns true if the Jacobians are given in the sparse representation of
+    // contact_jacobians() rather than as the dense Jn() and Jt().
+    bool has_contact_jacobians_data() const {
+      return contact_jacobians_ptr_ != nullptr;
+    }
+
+    // For dense problem data, it returns a constant reference to the normal
+    // separation velocities Jacobian. It aborts otherwise, see
+    // has_contact_jacobians_data().
+    Eigen::Ref<const MatrixX<T>> Jn() const {
+      DRAKE_DEMAND(Jn_ptr_ != nullptr);
+      return *Jn_ptr_;
+    }
+
+    // For dense problem data, it returns a constant reference to the
+    // tangential velocities Jacobian. It aborts otherwise, see
+    // has_contact_jacobians_data().
+    Eigen::Ref<const MatrixX<T>> Jt() const {
+      DRAKE_DEMAND(Jt_ptr_ != nullptr);
+      return *Jt_ptr_;
+    }
+
+    // For sparse problem data, it returns a constant reference to the contact
+    // Jacobians. It aborts otherwise, see has_contact_jacobians_data().
+    const internal::ContactJacobians<T>& contact_jacobians() const {
+      DRAKE_DEMAND(contact_jacobians_ptr_ != nullptr);
+      return *contact_jacobians_ptr_;
+    }
+
     Eigen::Ref<const VectorX<T>> p_star() const { return *p_star_ptr_; }
 
     // For the one-way coupled scheme, it returns a constant reference to the
@@ -832,6 +910,9 @@ class TamsiSolver {
     EigenPtr<const MatrixX<T>> Jn_ptr_{nullptr};
     // The tangential velocities Jacobian.
     EigenPtr<const MatrixX<T>> Jt_ptr_{nullptr};
+    // Both Jacobians, in their sparse representation. When non-null, Jn_ptr_
+    // and Jt_ptr_ are nullptr and vice versa.
+    const internal::ContactJacobians<T>* contact_jacobians_ptr_{nullptr};
     // The generalized momentum vector **before** contact is applied.
     EigenPtr<const VectorX<T>> p_star_ptr_{nullptr};
     // Normal force at each contact point. fn_ptr_ is nullptr for two-way
@@ -905,15 +986,14 @@ class TamsiSolver {
   // than the data size.
   class VariableSizeWorkspace {
    public:
-    explicit VariableSizeWorkspace(int initial_nc, int nv) {
-      ResizeIfNeeded(initial_nc, nv);
+    explicit VariableSizeWorkspace(int initial_nc) {
+      ResizeIfNeeded(initial_nc);
     }
 
     // Performs a resize of this workspace's variables only if the new size `nc`
     // is larger than capacity() in order to reuse previously allocated space.
-    void ResizeIfNeeded(int nc, int nv) {
+    void ResizeIfNeeded(int nc) {
       nc_ = nc;
-      nv_ = nv;
       if (capacity() >= nc) return;  // no-op if not needed.
       const int nf = 2 * nc;
       // Only reallocate if sizes from previous allocations are not sufficient.
@@ -928,7 +1008,8 @@ class TamsiSolver {
       v_slip_.resize(nc);
       mus_.resize(nc);
       dft_dv_.resize(nc);
-      Gn_.resize(nc, nv);
+      dfn_dvn_.resize(nc);
+      zero_fn_.setZero(nc);
     }
 
     // Returns the current (maximum) capacity of the workspace.
@@ -1022,10 +1103,11 @@ class TamsiSolver {
       return mus_.segment(0, nc_);
     }
 
-    // Returns a mutable reference to the gradient Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹)
-    // with respect to the generalized velocites v.
-    Eigen::Block<MatrixX<T>> mutable_Gn() {
-      return Gn_.block(0, 0, nc_, nv_);
+    // Returns a mutable reference to the vector containing the derivative
+    // ∂fₙ/∂vₙ of the normal force with respect to the normal velocity, at
+    // each contact point, of size nc.
+    Eigen::VectorBlock<VectorX<T>> mutable_dfn_dvn() {
+      return dfn_dvn_.segment(0, nc_);
     }
 
     // Returns a mutable reference to the vector storing ∂fₜ/∂vₜ (in ℝ²ˣ²)
@@ -1034,9 +1116,16 @@ class TamsiSolver {
       return dft_dv_;
     }
 
+    // Returns a constant reference to a vector of zero normal forces, of size
+    // nc, with which the generalized forces of the friction forces alone are
+    // computed.
+    Eigen::VectorBlock<const VectorX<T>> zero_fn() const {
+      return zero_fn_.segment(0, nc_);
+    }
+
    private:
     // The number of contact points. This determines sizes in this workspace.
-    int nc_, nv_;
+    int nc_;
     VectorX<T> Delta_vn_;  // Δvₙᵏ = Jₙ Δvᵏ, in ℝⁿᶜ, for the k-th iteration.
     VectorX<T> Delta_vt_;  // Δvₜᵏ = Jₜ Δvᵏ, in ℝ²ⁿᶜ, for the k-th iteration.
     VectorX<T> vn_;        // vₙᵏ, in ℝⁿᶜ.
@@ -1049,7 +1138,8 @@ class TamsiSolver {
     VectorX<T> mus_;       // (modified) regularized friction, in ℝⁿᶜ.
     // Vector of size nc storing ∂fₜ/∂vₜ (in ℝ²ˣ²) for each contact point.
     std::vector<Matrix2<T>> dft_dv_;
-    MatrixX<T> Gn_;        // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
+    VectorX<T> dfn_dvn_;   // ∂fₙ/∂vₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜ.
+    VectorX<T> zero_fn_;   // Zeros, in ℝⁿᶜ. Never written after a resize.
   };
 
   // Returns true if the solver is solving the two-way coupled problem.
@@ -1057,21 +1147,35 @@ class TamsiSolver {
     return problem_data_aliases_.has_two_way_coupling_data();
   }
 
+  // Computes vn = Jn v and vt = Jt v, from either the dense or the sparse
+  // Jacobians in the problem data.
+  void CalcContactVelocities(
+      const Eigen::Ref<const VectorX<T>>& v,
+      EigenPtr<VectorX<T>> vn,
+      EigenPtr<VectorX<T>> vt) const;
+
+  // Computes the generalized contact forces tau = Jnᵀ fn + Jtᵀ ft, from either
+  // the dense or the sparse Jacobians in the problem data.
+  void CalcGeneralizedContactForces(
+      const Eigen::Ref<const VectorX<T>>& fn,
+      const Eigen::Ref<const VectorX<T>>& ft,
+      EigenPtr<VectorX<T>> tau) const;
+
   // Helper method to compute, into fn, the normal force at each contact
   // point pair according to the law:
   //   fₙ(x, vₙ) = k(vₙ)₊ x₊
   //       k(vₙ) = k (1 − d vₙ)₊
   // where `x₊` is max(x, 0) and k and d are the stiffness and
   // dissipation coefficients for a given contact point, respectively.
-  // In addition, this method also computes the gradient
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹).
+  // In addition, this method also computes the derivative
+  // dfn_dvn = ∂fₙ/∂vₙ(xˢ⁺¹, vₙˢ⁺¹) at each contact point, so that the gradient
+  // of the normal forces is Gn = ∇ᵥfₙ = diag(dfn_dvn) Jₙ.
   void CalcNormalForces(
       const Eigen::Ref<const VectorX<T>>& x,
       const Eigen::Ref<const VectorX<T>>& vn,
-      const Eigen::Ref<const MatrixX<T>>& Jn,
       double dt,
       EigenPtr<VectorX<T>> fn,
-      EigenPtr<MatrixX<T>> Gn) const;
+      EigenPtr<VectorX<T>> dfn_dvn) const;
 
   // Helper to compute fₜ(vₜ) = −vₜ/‖vₜ‖ₛ μ(‖vₜ‖ₛ) fₙ, where ‖vₜ‖ₛ
   // is the "soft norm" of vₜ. In addition this method computes
@@ -1098,12 +1202,11 @@ class TamsiSolver {
       std::vector<Matrix2<T>>* dft_dvt) const;
 
   // Helper method to compute the Newton-Raphson Jacobian, J = ∇ᵥR, as a
-  // function of M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt and dt.
+  // function of M, dfn_dvn, dft_dvt, t_hat, mu_vt and dt, and of the contact
+  // Jacobians in the problem data.
   void CalcJacobian(
       const Eigen::Ref<const MatrixX<T>>& M,
-      const Eigen::Ref<const MatrixX<T>>& Jn,
-      const Eigen::Ref<const MatrixX<T>>& Jt,
-      const Eigen::Ref<const MatrixX<T>>& Gn,
+      const Eigen::Ref<const VectorX<T>>& dfn_dvn,
       const std::vector<Matrix2<T>>& dft_dvt,
       const Eigen::Ref<const VectorX<T>>& t_hat,
       const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
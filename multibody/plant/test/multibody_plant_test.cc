@@ -1,5 +1,6 @@
 #include "drake/multibody/plant/multibody_plant.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -105,6 +106,13 @@ class MultibodyPlantTester {
     plant.CalcNormalAndTangentContactJacobians(
         context, point_pairs, Jn, Jt, R_WC_set);
   }
+
+  static void CalcContactPairJacobians(
+      const MultibodyPlant<double>& plant, const Context<double>& context,
+      const std::vector<PenetrationAsPointPair<double>>& point_pairs,
+      std::vector<internal::ContactPairJacobian<double>>* pair_jacobians) {
+    plant.CalcContactPairJacobians(context, point_pairs, pair_jacobians);
+  }
 };
 
 namespace {
@@ -2235,6 +2243,54 @@ TEST_F(MultibodyPlantContactJacobianTests, NormalAndTangentJacobian) {
       D, vt_derivs, kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the sparse tree-path representation of the contact Jacobians
+// only stores velocities on the kinematic paths of the contacting bodies, and
+// that its operators are consistent with the dense Jacobians Jn and Jt. The
+// dense Jacobians are verified against automatic differentiation in the tests
+// above.
+TEST_F(MultibodyPlantContactJacobianTests, PairJacobians) {
+  const double kTolerance = 5 * std::numeric_limits<double>::epsilon();
+  const int nv = plant_.num_velocities();
+  const int nc = penetrations_.size();
+
+  MatrixX<double> Jn, Jt;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, penetrations_, &Jn, &Jt, nullptr);
+  internal::ContactJacobians<double> jacobians;
+  MultibodyPlantTester::CalcContactPairJacobians(
+      plant_, *context_, penetrations_, &jacobians.pair_jacobians);
+  ASSERT_EQ(static_cast<int>(jacobians.pair_jacobians.size()), nc);
+
+  for (const auto& pair_jacobian : jacobians.pair_jacobians) {
+    const int num_indices = pair_jacobian.velocity_indices.size();
+    // Each contact in this setup involves at most two free bodies, with six
+    // velocities each.
+    EXPECT_LE(num_indices, 12);
+    EXPECT_EQ(pair_jacobian.J_AcBc_C.cols(), num_indices);
+    EXPECT_TRUE(std::is_sorted(pair_jacobian.velocity_indices.begin(),
+                               pair_jacobian.velocity_indices.end()));
+  }
+
+  // Verify the Jv and Jᵀλ operators.
+  const VectorX<double> v = VectorX<double>::LinSpaced(nv, -1.0, 2.0);
+  VectorX<double> vn(nc);
+  VectorX<double> vt(2 * nc);
+  jacobians.CalcContactVelocities(v, &vn, &vt);
+  EXPECT_TRUE(CompareMatrices(vn, Jn * v, kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(vt, Jt * v, kTolerance,
+                              MatrixCompareType::relative));
+
+  const VectorX<double> fn = VectorX<double>::LinSpaced(nc, 1.0, 3.0);
+  const VectorX<double> ft = VectorX<double>::LinSpaced(2 * nc, -0.5, 0.5);
+  VectorX<double> tau(nv);
+  jacobians.CalcGeneralizedContactForces(fn, ft, &tau);
+  const VectorX<double> tau_expected =
+      Jn.transpose() * fn + Jt.transpose() * ft;
+  EXPECT_TRUE(CompareMatrices(tau, tau_expected, kTolerance,
+                              MatrixCompareType::relative));
+}
+
 // Verifies that we can obtain the indexes into the state vector for each joint
 // in the model of a Kuka arm.
 // For this topologically simple model with only one branch of bodies with root
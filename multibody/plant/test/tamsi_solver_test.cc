@@ -23,8 +23,6 @@ class TamsiSolverTester {
 
     // Problem data.
     const auto& M = solver.problem_data_aliases_.M();
-    const auto& Jn = solver.problem_data_aliases_.Jn();
-    const auto& Jt = solver.problem_data_aliases_.Jt();
 
     // Workspace with size depending on the number of contact points.
     // Note: "auto" below resolves to Eigen::Block.
@@ -32,7 +30,7 @@ class TamsiSolverTester {
     auto vt = solver.variable_size_workspace_.mutable_vt();
     auto fn = solver.variable_size_workspace_.mutable_fn();
     auto ft = solver.variable_size_workspace_.mutable_ft();
-    auto Gn = solver.variable_size_workspace_.mutable_Gn();
+    auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
     auto mus = solver.variable_size_workspace_.mutable_mu();
     auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
     auto v_slip = solver.variable_size_workspace_.mutable_v_slip();
@@ -40,8 +38,8 @@ class TamsiSolverTester {
         solver.variable_size_workspace_.mutable_dft_dvt();
     auto x = solver.variable_size_workspace_.mutable_x();
 
-    // Normal separation velocity.
-    vn = Jn * v;
+    // Normal separation and tangential velocities.
+    solver.CalcContactVelocities(v, &vn, &vt);
 
     if (solver.has_two_way_coupling()) {
       const auto x0 = solver.problem_data_aliases_.x0();
@@ -49,12 +47,9 @@ class TamsiSolverTester {
       x = x0 - dt * vn;
     }
 
-    // Computes friction forces fn and gradients Gn as a function of x, vn,
-    // Jn and dt.
-    solver.CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
-
-    // Tangential velocity.
-    vt = Jt * v;
+    // Computes normal forces fn and derivatives dfn_dvn as a function of x, vn
+    // and dt.
+    solver.CalcNormalForces(x, vn, dt, &fn, &dfn_dvn);
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
     solver.CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mus, &ft);
@@ -65,7 +60,7 @@ class TamsiSolverTester {
 
     // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
     MatrixX<double> J(nv, nv);
-    solver.CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mus, dt, &J);
+    solver.CalcJacobian(M, dfn_dvn, dft_dvt, t_hat, mus, dt, &J);
 
     return J;
   }
@@ -1082,6 +1077,94 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Verifies that the solver computes the same solution when the contact
+// Jacobians are given in the sparse representation of
+// internal::ContactJacobians. We add to the cylinder a fourth generalized
+// velocity that does not participate in contact so that the sparse Jacobian
+// only stores a subset of the columns of the dense one.
+TEST_F(RollingCylinder, ContactJacobiansData) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;  // Friction coefficient.
+  const double h0 = 0.5;  // Initial height.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const Vector3<double> v0(1.0, -sqrt(2.0 * g_ * h0), 0.0);
+  SetImpactProblem(v0, tau, mu, h0, dt);
+
+  const int nv = nv_ + 1;
+  MatrixX<double> M = MatrixX<double>::Zero(nv, nv);
+  M.topLeftCorner(nv_, nv_) = M_;
+  M(nv_, nv_) = m_;
+  MatrixX<double> Jn = MatrixX<double>::Zero(nc_, nv);
+  Jn.leftCols(nv_) = Jn_;
+  MatrixX<double> Jt = MatrixX<double>::Zero(2 * nc_, nv);
+  Jt.leftCols(nv_) = Jt_;
+  VectorX<double> v0_extended(nv);
+  v0_extended << v0, 2.0;
+  const VectorX<double> p_star = M * v0_extended;
+
+  internal::ContactJacobians<double> contact_jacobians;
+  internal::ContactPairJacobian<double> pair_jacobian;
+  pair_jacobian.velocity_indices = {0, 1, 2};
+  pair_jacobian.J_AcBc_C.resize(3, nv_);
+  pair_jacobian.J_AcBc_C << Jt_, -Jn_;
+  contact_jacobians.pair_jacobians.push_back(pair_jacobian);
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+
+  TamsiSolver<double> dense_solver(nv);
+  dense_solver.set_solver_parameters(parameters);
+  dense_solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &x0_,
+                                           &stiffness_, &dissipation_,
+                                           &mu_vector_);
+  ASSERT_EQ(dense_solver.SolveWithGuess(dt, v0_extended),
+            TamsiSolverResult::kSuccess);
+
+  TamsiSolver<double> sparse_solver(nv);
+  sparse_solver.set_solver_parameters(parameters);
+  sparse_solver.SetTwoWayCoupledProblemData(&M, &contact_jacobians, &p_star,
+                                            &x0_, &stiffness_, &dissipation_,
+                                            &mu_vector_);
+  ASSERT_EQ(sparse_solver.SolveWithGuess(dt, v0_extended),
+            TamsiSolverResult::kSuccess);
+
+  EXPECT_EQ(sparse_solver.get_iteration_statistics().num_iterations,
+            dense_solver.get_iteration_statistics().num_iterations);
+
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_velocities(),
+                              dense_solver.get_generalized_velocities(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_normal_velocities(),
+                              dense_solver.get_normal_velocities(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_tangential_velocities(),
+                              dense_solver.get_tangential_velocities(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_normal_forces(),
+                              dense_solver.get_normal_forces(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_friction_forces(),
+                              dense_solver.get_friction_forces(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_friction_forces(),
+                              dense_solver.get_generalized_friction_forces(),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(sparse_solver.get_generalized_contact_forces(),
+                              dense_solver.get_generalized_contact_forces(),
+                              kTolerance, MatrixCompareType::relative));
+
+  // The sparse assembly of the Newton-Raphson Jacobian matches the dense one.
+  const VectorX<double> v = dense_solver.get_generalized_velocities();
+  const MatrixX<double> J_dense =
+      TamsiSolverTester::CalcJacobian(dense_solver, v, dt);
+  const MatrixX<double> J_sparse =
+      TamsiSolverTester::CalcJacobian(sparse_solver, v, dt);
+  EXPECT_TRUE(CompareMatrices(J_sparse, J_dense,
+                              J_dense.norm() * kTolerance,
+                              MatrixCompareType::absolute));
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
@@ -1778,6 +1778,66 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
   }  // body_node_index
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcJacobianTranslationalVelocityOnPathToWorld(
+    const systems::Context<T>& context,
+    const Body<T>& body_B,
+    const Eigen::Ref<const Vector3<T>>& p_WoBp_W,
+    EigenPtr<Matrix3X<T>> Jv_v_WBp_W) const {
+  // Form kinematic path from body_B to the world.
+  std::vector<BodyNodeIndex> path_to_world;
+  topology_.GetKinematicPathToWorld(body_B.node_index(), &path_to_world);
+  CalcJacobianTranslationalVelocityOnPathToWorld(context, path_to_world,
+                                                 p_WoBp_W, Jv_v_WBp_W);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcJacobianTranslationalVelocityOnPathToWorld(
+    const systems::Context<T>& context,
+    const std::vector<BodyNodeIndex>& path_to_world,
+    const Eigen::Ref<const Vector3<T>>& p_WoBp_W,
+    EigenPtr<Matrix3X<T>> Jv_v_WBp_W) const {
+  DRAKE_THROW_UNLESS(Jv_v_WBp_W != nullptr);
+
+  // Skip the world (path index = 0).
+  int num_path_velocities = 0;
+  for (size_t ilevel = 1; ilevel < path_to_world.size(); ++ilevel) {
+    num_path_velocities += topology_.get_body_node(path_to_world[ilevel])
+                               .num_mobilizer_velocities;
+  }
+  DRAKE_THROW_UNLESS(Jv_v_WBp_W->cols() == num_path_velocities);
+  if (num_path_velocities == 0) return;
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+
+  // Since velocities are numbered in the same (base to tip) order as the body
+  // nodes, the columns for each node along the path are contiguous and sorted.
+  int path_column = 0;
+  for (size_t ilevel = 1; ilevel < path_to_world.size(); ++ilevel) {
+    const BodyNode<T>& node = *body_nodes_[path_to_world[ilevel]];
+    const int mobilizer_num_velocities =
+        node.get_topology().num_mobilizer_velocities;
+
+    // "Hinge matrix" H for the across-node Jacobian, with P the inboard
+    // (parent) body frame and B the body of the node at level ilevel.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const auto Hw_PB_W = H_PB_W.template topRows<3>();
+    const auto Hv_PB_W = H_PB_W.template bottomRows<3>();
+
+    // Position from the node's body origin to point Bp, expressed in W.
+    const Vector3<T> p_BoBp_W =
+        p_WoBp_W - pc.get_X_WB(node.index()).translation();
+
+    // "Shift" Hv_PB_W to point Bp, one column at a time.
+    Jv_v_WBp_W->block(0, path_column, 3, mobilizer_num_velocities) =
+        Hv_PB_W + Hw_PB_W.colwise().cross(p_BoBp_W);
+    path_column += mobilizer_num_velocities;
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianCenterOfMassTranslationalVelocity(
     const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
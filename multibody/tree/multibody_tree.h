@@ -1403,6 +1403,39 @@ class MultibodyTree {
       const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Js_v_ABi_E) const;
 
+  /// Computes the columns of point Bp's translational velocity Jacobian in the
+  /// world frame W with respect to the generalized velocities v, expressed in
+  /// W, that correspond to the velocities on the kinematic path from the world
+  /// to body B, see
+  /// MultibodyTreeTopology::GetVelocitiesOnKinematicPathToWorld(). All other
+  /// columns of this Jacobian are zero. Therefore this method's cost is
+  /// proportional to the number of velocities on the path rather than to the
+  /// total number of velocities.
+  ///
+  /// @param[in] context The state of the multibody system.
+  /// @param[in] body_B The body on which point Bp is fixed.
+  /// @param[in] p_WoBp_W Position vector from Wo (the world origin) to point
+  /// Bp, expressed in the world frame W.
+  /// @param[out] Jv_v_WBp_W A `3 x m` matrix, where m is the number of
+  /// velocities on the kinematic path from the world to body B. Its k-th
+  /// column corresponds to the k-th velocity on the path, in increasing order
+  /// of index into v.
+  /// @throws std::exception if `Jv_v_WBp_W` is nullptr or not of size `3 x m`.
+  void CalcJacobianTranslationalVelocityOnPathToWorld(
+      const systems::Context<T>& context,
+      const Body<T>& body_B,
+      const Eigen::Ref<const Vector3<T>>& p_WoBp_W,
+      EigenPtr<Matrix3X<T>> Jv_v_WBp_W) const;
+
+  /// Overload of CalcJacobianTranslationalVelocityOnPathToWorld() for callers
+  /// which already have the kinematic path `path_to_world` from the world to
+  /// body B, as computed by MultibodyTreeTopology::GetKinematicPathToWorld().
+  void CalcJacobianTranslationalVelocityOnPathToWorld(
+      const systems::Context<T>& context,
+      const std::vector<BodyNodeIndex>& path_to_world,
+      const Eigen::Ref<const Vector3<T>>& p_WoBp_W,
+      EigenPtr<Matrix3X<T>> Jv_v_WBp_W) const;
+
   /// See MultibodyPlant method.
   void CalcJacobianCenterOfMassTranslationalVelocity(
       const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
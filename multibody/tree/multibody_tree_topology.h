@@ -930,6 +930,46 @@ class MultibodyTreeTopology {
     DRAKE_DEMAND(get_body_node((*path_to_world)[1]).level == 1);
   }
 
+  /// Given a node in `this` topology, specified by its BodyNodeIndex `from`,
+  /// this method computes the indices into the vector of generalized
+  /// velocities v of all the mobilizer velocities along the kinematic path
+  /// from the world to `from`, see GetKinematicPathToWorld(). These are the
+  /// only generalized velocities that can contribute to the motion of the
+  /// body associated with `from`, and therefore they are the only (possibly)
+  /// non-zero columns of any velocity Jacobian for a point fixed on that body.
+  ///
+  /// @param[in] from
+  ///   A node in the tree topology.
+  /// @param[out] velocities_on_path
+  ///   On output, the indices into v of the velocities on the path, sorted in
+  ///   increasing order. Weld mobilizers contribute no entries. On input,
+  ///   `velocities_on_path` must be a valid pointer.
+  void GetVelocitiesOnKinematicPathToWorld(
+      BodyNodeIndex from, std::vector<int>* velocities_on_path) const {
+    std::vector<BodyNodeIndex> path_to_world;
+    GetKinematicPathToWorld(from, &path_to_world);
+    GetVelocitiesOnKinematicPathToWorld(path_to_world, velocities_on_path);
+  }
+
+  /// Overload of GetVelocitiesOnKinematicPathToWorld() for callers which
+  /// already have the `path_to_world` computed by GetKinematicPathToWorld().
+  void GetVelocitiesOnKinematicPathToWorld(
+      const std::vector<BodyNodeIndex>& path_to_world,
+      std::vector<int>* velocities_on_path) const {
+    DRAKE_THROW_UNLESS(velocities_on_path != nullptr);
+    velocities_on_path->clear();
+    // Skip the world at path_to_world[0]. Since velocities are numbered in
+    // the same (base to tip) order as the body nodes, the output is sorted.
+    for (size_t path_index = 1; path_index < path_to_world.size();
+         ++path_index) {
+      const BodyNodeTopology& node = get_body_node(path_to_world[path_index]);
+      for (int i = 0; i < node.num_mobilizer_velocities; ++i) {
+        velocities_on_path->push_back(
+            node.mobilizer_velocities_start_in_v + i);
+      }
+    }
+  }
+
   /// Returns `true` if the body with index `body_index` is anchored to the
   /// world.
   /// A body is said to be "anchored" if its kinematics path to the world only
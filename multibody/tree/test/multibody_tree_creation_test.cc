@@ -604,6 +604,37 @@ TEST_F(TreeTopologyTests, KinematicPathToWorld) {
   }
 }
 
+// Verifies the correctness of the method
+// MultibodyTreeTopology::GetVelocitiesOnKinematicPathToWorld() on the same
+// known topology used in the KinematicPathToWorld test above.
+TEST_F(TreeTopologyTests, VelocitiesOnKinematicPathToWorld) {
+  FinalizeModel();
+  const MultibodyTreeTopology& topology = model_->get_topology();
+
+  const BodyNodeIndex body6_node_index =
+      topology.get_body(BodyIndex(6)).body_node;
+  std::vector<int> velocities_on_path;
+  topology.GetVelocitiesOnKinematicPathToWorld(
+      body6_node_index, &velocities_on_path);
+
+  // All mobilizers in this model are revolute, with a single velocity each.
+  // Therefore we expect one velocity for each body on the path {4, 1, 6}.
+  std::vector<int> expected_velocities;
+  for (BodyIndex body_index : {BodyIndex(4), BodyIndex(1), BodyIndex(6)}) {
+    const BodyNodeTopology& node =
+        topology.get_body_node(topology.get_body(body_index).body_node);
+    expected_velocities.push_back(node.mobilizer_velocities_start_in_v);
+  }
+  EXPECT_EQ(velocities_on_path, expected_velocities);
+  EXPECT_TRUE(std::is_sorted(
+      velocities_on_path.begin(), velocities_on_path.end()));
+
+  // The world has no velocities on its (empty) path.
+  topology.GetVelocitiesOnKinematicPathToWorld(
+      BodyNodeIndex(0), &velocities_on_path);
+  EXPECT_TRUE(velocities_on_path.empty());
+}
+
 // Unit test to verify the correctness of
 // MultibodyTreeTopology::CreateListOfWeldedBodies().
 // This test creates a tree with a topology as shown below. Single vertical
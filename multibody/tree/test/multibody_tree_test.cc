@@ -1216,6 +1216,71 @@ TEST_F(KukaIiwaModelTests, CalcJacobianTranslationalVelocityD) {
   EXPECT_EQ(Jv_WP, MatrixX<double>::Zero(3 * npoints, nv));
 }
 
+// Verifies that CalcJacobianTranslationalVelocityOnPathToWorld() computes the
+// columns of the full translational velocity Jacobian for the velocities on
+// the kinematic path of a body and that all other columns are zero.
+TEST_F(KukaIiwaModelTests, CalcJacobianTranslationalVelocityOnPathToWorld) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  int angle_index = 0;
+  for (const RevoluteJoint<double>* joint : joints_) {
+    joint->set_angle(context_.get(), q[angle_index]);
+    joint->set_angular_rate(context_.get(), v[angle_index]);
+    angle_index++;
+  }
+
+  // A body in the middle of the chain so that the path does not include all
+  // of the velocities.
+  const Body<double>& link4 = tree().GetBodyByName("iiwa_link_4");
+  const Vector3<double> p_WoBp_W(0.1, -0.2, 0.3);
+  const int nv = tree().num_velocities();
+
+  const Frame<double>& frame_W = tree().world_frame();
+  MatrixX<double> Jv_WBp(3, nv);
+  tree().CalcJacobianTranslationalVelocity(*context_, JacobianWrtVariable::kV,
+                                           link4.body_frame(), frame_W,
+                                           p_WoBp_W, frame_W, frame_W,
+                                           &Jv_WBp);
+
+  std::vector<int> velocities_on_path;
+  tree().get_topology().GetVelocitiesOnKinematicPathToWorld(
+      link4.node_index(), &velocities_on_path);
+  ASSERT_EQ(velocities_on_path, std::vector<int>({0, 1, 2, 3}));
+
+  Matrix3X<double> Jv_WBp_path(3, velocities_on_path.size());
+  tree().CalcJacobianTranslationalVelocityOnPathToWorld(*context_, link4,
+                                                        p_WoBp_W,
+                                                        &Jv_WBp_path);
+  EXPECT_TRUE(CompareMatrices(Jv_WBp_path, Jv_WBp.leftCols(4), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_EQ(Jv_WBp.rightCols(nv - 4), MatrixX<double>::Zero(3, nv - 4));
+
+  // The overloads which take a precomputed kinematic path agree.
+  std::vector<BodyNodeIndex> path_to_world;
+  tree().get_topology().GetKinematicPathToWorld(link4.node_index(),
+                                                &path_to_world);
+  std::vector<int> velocities_on_given_path;
+  tree().get_topology().GetVelocitiesOnKinematicPathToWorld(
+      path_to_world, &velocities_on_given_path);
+  EXPECT_EQ(velocities_on_given_path, velocities_on_path);
+  Matrix3X<double> Jv_WBp_given_path(3, velocities_on_path.size());
+  tree().CalcJacobianTranslationalVelocityOnPathToWorld(
+      *context_, path_to_world, p_WoBp_W, &Jv_WBp_given_path);
+  EXPECT_EQ(Jv_WBp_given_path, Jv_WBp_path);
+
+  // The path from the world to itself has no velocities.
+  Matrix3X<double> Jv_WWp_path(3, 0);
+  DRAKE_EXPECT_NO_THROW(tree().CalcJacobianTranslationalVelocityOnPathToWorld(
+      *context_, tree().world_body(), p_WoBp_W, &Jv_WWp_path));
+
+  // The output must have one column per velocity on the path.
+  Matrix3X<double> Jv_wrong_size(3, nv);
+  EXPECT_THROW(tree().CalcJacobianTranslationalVelocityOnPathToWorld(
+      *context_, link4, p_WoBp_W, &Jv_wrong_size), std::exception);
+}
+
 // Verify that even when the input set of points and/or the Jacobian might
 // contain garbage on input, a query for the world body Jacobian will always
 // return a zero Jacobian since the world does not move.
@@ -0,0 +1,144 @@
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_kd_tree.h"
+
+namespace drake {
+namespace perception {
+
+/** @defgroup point_cloud_benchmarks Point Cloud Benchmarks
+ @ingroup perception_systems
+
+ The benchmark measures the spatial operations of PointCloud, and the
+ PointCloudKdTree they are built on, on a cloud of one million points like
+ those of a depth camera: a 1000 x 1000 grid, in the camera's frame, of a
+ wavy surface about one meter away.
+
+ Each operation is run with 1, 2, 4 and 8 threads (the trailing argument of
+ each benchmark name).
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //perception/benchmarking:point_cloud_benchmark
+ ```
+ */
+
+namespace {
+
+class PointCloudBenchmark : public benchmark::Fixture {
+ public:
+  PointCloudBenchmark()
+      : cloud_(kSide * kSide, pc_flags::kXYZs | pc_flags::kNormals) {
+    for (int i = 0; i < kSide; ++i) {
+      for (int j = 0; j < kSide; ++j) {
+        const float x = (i - kSide / 2) * 0.001f;
+        const float y = (j - kSide / 2) * 0.001f;
+        const float z = 1 + 0.05f * std::sin(10 * x) * std::cos(10 * y);
+        cloud_.mutable_xyz(i * kSide + j) = Eigen::Vector3f(x, y, z);
+      }
+    }
+  }
+
+ protected:
+  static constexpr int kSide = 1000;
+  PointCloud cloud_;
+};
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, BuildKdTree)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    PointCloudKdTree tree(cloud_.xyzs(), state.range(0));
+    benchmark::DoNotOptimize(tree);
+  }
+}
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, FindNearest)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  const PointCloudKdTree tree(cloud_.xyzs(), state.range(0));
+  std::vector<int> indices;
+  int i = 0;
+  for (auto _ : state) {
+    tree.FindNearest(cloud_.xyz(i), 10, &indices);
+    i = (i + 7919) % cloud_.size();
+  }
+}
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, Crop)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud_.Crop(Eigen::Vector3f(-0.25, -0.25, 0),
+                                         Eigen::Vector3f(0.25, 0.25, 2),
+                                         state.range(0)));
+  }
+}
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, OrientedCrop)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  const math::RigidTransformd X_CB(math::RollPitchYawd(0.1, 0.2, 0.3),
+                                   Eigen::Vector3d(0, 0, 1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud_.Crop(X_CB,
+                                         Eigen::Vector3f(-0.25, -0.25, -1),
+                                         Eigen::Vector3f(0.25, 0.25, 1),
+                                         state.range(0)));
+  }
+}
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, VoxelizedDownSample)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud_.VoxelizedDownSample(0.005, state.range(0)));
+  }
+}
+
+BENCHMARK_DEFINE_F(PointCloudBenchmark, EstimateNormals)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud_.EstimateNormals(0.005, 10, state.range(0)));
+  }
+}
+
+BENCHMARK_REGISTER_F(PointCloudBenchmark, BuildKdTree)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_REGISTER_F(PointCloudBenchmark, FindNearest)->Arg(1);
+BENCHMARK_REGISTER_F(PointCloudBenchmark, Crop)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_REGISTER_F(PointCloudBenchmark, OrientedCrop)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_REGISTER_F(PointCloudBenchmark, VoxelizedDownSample)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_REGISTER_F(PointCloudBenchmark, EstimateNormals)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -1,15 +1,21 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/worker_pool.h"
 
-using Eigen::Matrix3Xf;
+using Eigen::Matrix3f;
 using Eigen::Vector3f;
 using drake::AbstractValue;
 using drake::Value;
+using drake::internal::WorkerPool;
 using drake::math::RigidTransformd;
 using drake::systems::sensors::CameraInfo;
 using drake::systems::sensors::Image;
@@ -43,72 +49,204 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
+// Writes the point of each pixel (u, v) of `depth_image`, expressed in a
+// frame P with `X_PC`, to column `first_point + v * width + u` of `output`,
+// along with its color (iff `color_image` is not nullptr) and normal (iff the
+// output has normals). `ray_x` and `ray_y` are the tables of MakePixelRays().
+// The rows of the image are converted in parallel on `pool`, or on the calling
+// thread if `pool` is nullptr; the loop over a row has no branches so that the
+// compiler can vectorize it.
+template <PixelType pixel_type>
+void DeprojectRows(const float* const ray_x, const float* const ray_y,
+                   const math::RigidTransform<float>& X_PC,
+                   const Image<pixel_type>& depth_image,
+                   const ImageRgba8U* color_image, const float scale,
+                   int first_point, WorkerPool* pool, PointCloud* output) {
+  using T = typename ImageTraits<pixel_type>::ChannelType;
+  constexpr T kTooClose = ImageTraits<pixel_type>::kTooClose;
+  constexpr T kTooFar = ImageTraits<pixel_type>::kTooFar;
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  const Matrix3f R_PC = X_PC.rotation().matrix();
+  const Vector3f p_PC = X_PC.translation();
+
+  // The point cloud stores each field as a 3xN column-major matrix.
+  float* const xyzs = output->mutable_xyzs().data() + 3 * first_point;
+  uint8_t* const rgbs =
+      color_image ? output->mutable_rgbs().data() + 3 * first_point : nullptr;
+  float* const normals =
+      output->has_normals()
+          ? output->mutable_normals().data() + 3 * first_point
+          : nullptr;
+
+  // Returns the point of pixel (u, v) in the camera frame, or false if it is
+  // not a measured point.
+  auto get_p_CQ = [&](int u, int v, Vector3f* p_CQ) {
+    const T raw = depth_image.at(u, v)[0];
+    const float z = scale * raw;
+    if (raw == kTooClose || raw == kTooFar || !std::isfinite(z)) return false;
+    *p_CQ = z * Vector3f(ray_x[u], ray_y[v], 1.f);
+    return true;
+  };
+
+  auto deproject_row = [&](int v) {
+    const T* const depth_row = depth_image.at(0, v);
+    const int first = v * width;
+    float* const xyz_row = xyzs + 3 * first;
+    // The direction R_PC * (ray_x[u], ray_y[v], 1) is row_ray + ray_x[u] *
+    // R_PC.col(0). The loop only reads local scalars, so that the compiler
+    // knows the stores to the cloud don't change them.
+    const Vector3f row_ray = ray_y[v] * R_PC.col(1) + R_PC.col(2);
+    const float r_x = R_PC(0, 0), r_y = R_PC(1, 0), r_z = R_PC(2, 0);
+    const float b_x = row_ray.x(), b_y = row_ray.y(), b_z = row_ray.z();
+    const float t_x = p_PC.x(), t_y = p_PC.y(), t_z = p_PC.z();
+    const float s = scale;
+    for (int u = 0; u < width; ++u) {
+      const T raw = depth_row[u];
+      const float z = s * raw;
+      const float ray = ray_x[u];
+      // N.B. NaN depths flow through to NaN points.
+      const bool valid = (raw != kTooClose) & (raw != kTooFar);
+      xyz_row[3 * u + 0] = valid ? z * (ray * r_x + b_x) + t_x : kInf;
+      xyz_row[3 * u + 1] = valid ? z * (ray * r_y + b_y) + t_y : kInf;
+      xyz_row[3 * u + 2] = valid ? z * (ray * r_z + b_z) + t_z : kInf;
+    }
+
+    if (color_image) {
+      const uint8_t* const color_row = color_image->at(0, v);
+      uint8_t* const rgb_row = rgbs + 3 * first;
+      for (int u = 0; u < width; ++u) {
+        for (int i = 0; i < 3; ++i) {
+          rgb_row[3 * u + i] = color_row[4 * u + i];
+        }
+      }
+    }
+
+    if (normals) {
+      // The normal is estimated from the cross product of the differences
+      // between the neighboring points, and points toward the camera. It is
+      // NaN when a neighbor (or the point itself) is not measured.
+      float* const normal_row = normals + 3 * first;
+      const int v_up = std::max(v - 1, 0);
+      const int v_down = std::min(v + 1, height - 1);
+      for (int u = 0; u < width; ++u) {
+        Vector3f n_P = Vector3f::Constant(kNaN);
+        Vector3f p_CQ, left, right, up, down;
+        if (get_p_CQ(u, v, &p_CQ) && get_p_CQ(std::max(u - 1, 0), v, &left) &&
+            get_p_CQ(std::min(u + 1, width - 1), v, &right) &&
+            get_p_CQ(u, v_up, &up) && get_p_CQ(u, v_down, &down)) {
+          const Vector3f n_C = (down - up).cross(right - left);
+          const float norm = n_C.norm();
+          if (norm > 0) {
+            n_P = R_PC * (n_C / norm);
+          }
+        }
+        Eigen::Map<Vector3f>(normal_row + 3 * u) = n_P;
+      }
+    }
+  };
+  if (pool != nullptr) {
+    pool->ParallelFor(height, deproject_row);
+  } else {
+    for (int v = 0; v < height; ++v) {
+      deproject_row(v);
+    }
+  }
+}
+
 // TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
 // cloud output? (This would require adding support for colored point clouds,
 // because current implementation assume that an RGB image will still line up).
+//
+// The optional `cached_ray_x` and `cached_ray_y` are the tables made by
+// MakePixelRays() for `camera_info`; they are recomputed if missing or not
+// sized for `depth_image`.
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
+               const std::vector<float>* cached_ray_x,
+               const std::vector<float>* cached_ray_y,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               WorkerPool* pool, PointCloud* output) {
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  std::vector<float> local_ray_x;
+  std::vector<float> local_ray_y;
+  if (cached_ray_x == nullptr || cached_ray_y == nullptr ||
+      static_cast<int>(cached_ray_x->size()) != width ||
+      static_cast<int>(cached_ray_y->size()) != height) {
+    internal::MakePixelRays(camera_info, width, height, &local_ray_x,
+                           &local_ray_y);
+    cached_ray_x = &local_ray_x;
+    cached_ray_y = &local_ray_y;
+  }
+  const float* const ray_x = cached_ray_x->data();
+  const float* const ray_y = cached_ray_y->data();
+  if (color_image) {
+    DRAKE_THROW_UNLESS(color_image->width() == width &&
+                       color_image->height() == height);
+  }
 
   // Reset the output size, if necessary.  We can leave the memory
   // uninitialized iff we are going to fill it in below.
   if (output->size() != depth_image.size()) {
-    const bool skip_initialize = (output->fields().base_fields() == kXYZs);
+    const pc_flags::BaseFieldT filled_fields =
+        pc_flags::kXYZs | pc_flags::kNormals |
+        (color_image ? pc_flags::kRGBs : pc_flags::kNone);
+    const bool skip_initialize =
+        (output->fields().base_fields() & ~filled_fields) == 0;
     output->resize(depth_image.size(), skip_initialize);
   }
-  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
-  }
-
-  const int height = depth_image.height();
-  const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
+  DeprojectRows(ray_x, ray_y, X_PC, depth_image, color_image, scale, 0, pool,
+                output);
+}
 
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
-      }
-    }
+// Implements the static DepthImageToPointCloud::Convert(), whose threads only
+// live for this call.
+template <PixelType pixel_type>
+void ConvertOnce(const CameraInfo& camera_info,
+                 const std::optional<RigidTransformd>& camera_pose,
+                 const Image<pixel_type>& depth_image,
+                 const std::optional<ImageRgba8U>& color_image,
+                 const std::optional<float>& scale, PointCloud* output,
+                 int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  std::optional<WorkerPool> pool;
+  if (num_threads > 1) {
+    pool.emplace(num_threads);
   }
+  DoConvert(std::nullopt, camera_info, nullptr, nullptr,
+            camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            pool ? &*pool : nullptr, output);
 }
 
 }  // namespace
 
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, int num_threads)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
       fields_(fields) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads > 1) {
+    pool_ = std::make_unique<WorkerPool>(num_threads);
+  }
+  internal::MakePixelRays(camera_info_, camera_info_.width(),
+                          camera_info_.height(), &ray_x_, &ray_y_);
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -138,10 +276,9 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth32F& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+    const std::optional<float>& scale, PointCloud* output, int num_threads) {
+  ConvertOnce(camera_info, camera_pose, depth_image, color_image, scale, output,
+              num_threads);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -149,10 +286,9 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth16U& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+    const std::optional<float>& scale, PointCloud* output, int num_threads) {
+  ConvertOnce(camera_info, camera_pose, depth_image, color_image, scale, output,
+              num_threads);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -164,8 +300,12 @@ void DepthImageToPointCloud::CalcOutput32F(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  std::unique_lock<std::mutex> lock;
+  if (pool_ != nullptr) {
+    lock = std::unique_lock<std::mutex>(pool_mutex_);
+  }
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, pool_.get(), output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -177,9 +317,54 @@ void DepthImageToPointCloud::CalcOutput16U(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  std::unique_lock<std::mutex> lock;
+  if (pool_ != nullptr) {
+    lock = std::unique_lock<std::mutex>(pool_mutex_);
+  }
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, pool_.get(), output);
+}
+
+namespace internal {
+
+void MakePixelRays(const CameraInfo& camera_info, int width, int height,
+                   std::vector<float>* ray_x, std::vector<float>* ray_y) {
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  ray_x->resize(width);
+  for (int u = 0; u < width; ++u) {
+    (*ray_x)[u] = (u - cx) * fx_inv;
+  }
+  ray_y->resize(height);
+  for (int v = 0; v < height; ++v) {
+    (*ray_y)[v] = (v - cy) * fy_inv;
+  }
+}
+
+void DeprojectDepthImage(const std::vector<float>& ray_x,
+                         const std::vector<float>& ray_y,
+                         const math::RigidTransformd& X_PC,
+                         const ImageDepth32F& depth_image,
+                         const ImageRgba8U* color_image, float scale,
+                         int first_point, WorkerPool* pool,
+                         PointCloud* output) {
+  DeprojectRows(ray_x.data(), ray_y.data(), X_PC.cast<float>(), depth_image,
+                color_image, scale, first_point, pool, output);
+}
+
+void DeprojectDepthImage(const std::vector<float>& ray_x,
+                         const std::vector<float>& ray_y,
+                         const math::RigidTransformd& X_PC,
+                         const ImageDepth16U& depth_image,
+                         const ImageRgba8U* color_image, float scale,
+                         int first_point, WorkerPool* pool,
+                         PointCloud* output) {
+  DeprojectRows(ray_x.data(), ray_y.data(), X_PC.cast<float>(), depth_image,
+                color_image, scale, first_point, pool, output);
 }
 
+}  // namespace internal
 }  // namespace perception
 }  // namespace drake
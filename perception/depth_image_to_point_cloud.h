@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/worker_pool.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/perception/point_cloud.h"
 #include "drake/systems/framework/context.h"
@@ -41,6 +43,15 @@ namespace perception {
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
 /// the Point Cloud Library (PCL).
 ///
+/// The point cloud is organized: the point (and color) of pixel (u, v) is at
+/// index `v * width + u`. If the point cloud has normals, each normal is
+/// estimated from the points of the four neighboring pixels and points toward
+/// the camera; it is (NaN, NaN, NaN) if the pixel or any of its neighbors does
+/// not have a finite point.
+///
+/// The rows of the image can be converted by several threads in parallel (see
+/// the `num_threads` arguments), which pays off for large images.
+///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
  public:
@@ -55,11 +66,15 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] num_threads The maximum number of threads used to convert an
+  ///   image, including the calling thread; must be positive. The threads
+  ///   are created by the constructor, and reused for every image.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      int num_threads = 1);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -92,13 +107,20 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// `cloud` must have the XYZ channel enabled.  When converting a stream of
+  /// images, pass the same `cloud` for every frame; its memory is reused
+  /// without reallocation as long as the image size doesn't change.
+  /// @param[in] num_threads The maximum number of threads used for the
+  /// conversion, including the calling thread; must be positive.
+  /// @throws std::exception if the color image's size differs from the depth
+  /// image's.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth32F& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      int num_threads = 1);
 
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
@@ -106,13 +128,20 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// `cloud` must have the XYZ channel enabled.  When converting a stream of
+  /// images, pass the same `cloud` for every frame; its memory is reused
+  /// without reallocation as long as the image size doesn't change.
+  /// @param[in] num_threads The maximum number of threads used for the
+  /// conversion, including the calling thread; must be positive.
+  /// @throws std::exception if the color image's size differs from the depth
+  /// image's.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth16U& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      int num_threads = 1);
 
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
@@ -122,11 +151,59 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  // The threads which convert the images, or nullptr for a single thread. The
+  // pool runs one conversion at a time, hence evaluations on different
+  // contexts take turns.
+  std::unique_ptr<drake::internal::WorkerPool> pool_;
+  mutable std::mutex pool_mutex_;
+  // The pixel deprojection tables for camera_info_ (see the .cc file).
+  std::vector<float> ray_x_;
+  std::vector<float> ray_y_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
   systems::InputPortIndex camera_pose_input_port_{};
 };
 
+namespace internal {
+
+/* Computes the per-column and per-row factors of the pinhole deprojection of a
+`width` x `height` image from a camera with `camera_info`: the pixel (u, v)
+with depth z is the point z * (ray_x[u], ray_y[v], 1) in the camera frame.
+Since the rays are separable, the tables hold width + height values instead of
+one ray per pixel. */
+void MakePixelRays(const systems::sensors::CameraInfo& camera_info, int width,
+                   int height, std::vector<float>* ray_x,
+                   std::vector<float>* ray_y);
+
+/* Converts `depth_image` as DepthImageToPointCloud does, given the tables of
+MakePixelRays() for its size, into the `depth_image.size()` points of `output`
+starting at `first_point`. The XYZs (expressed in the frame P) and the normals
+(iff `output` has them) are written, as well as the RGBs iff `color_image` is
+not nullptr.
+@pre `output` has at least `first_point + depth_image.size()` points, and
+`color_image` (if given) has the size of `depth_image`. The rows are converted
+on `pool`, or on the calling thread if `pool` is nullptr. */
+void DeprojectDepthImage(const std::vector<float>& ray_x,
+                         const std::vector<float>& ray_y,
+                         const math::RigidTransformd& X_PC,
+                         const systems::sensors::ImageDepth32F& depth_image,
+                         const systems::sensors::ImageRgba8U* color_image,
+                         float scale, int first_point,
+                         drake::internal::WorkerPool* pool,
+                         PointCloud* output);
+
+/* Overload of DeprojectDepthImage() for 16-bit depth images. */
+void DeprojectDepthImage(const std::vector<float>& ray_x,
+                         const std::vector<float>& ray_y,
+                         const math::RigidTransformd& X_PC,
+                         const systems::sensors::ImageDepth16U& depth_image,
+                         const systems::sensors::ImageRgba8U* color_image,
+                         float scale, int first_point,
+                         drake::internal::WorkerPool* pool,
+                         PointCloud* output);
+
+}  // namespace internal
+
 }  // namespace perception
 }  // namespace drake
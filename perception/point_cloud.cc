@@ -1,12 +1,22 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/worker_pool.h"
+#include "drake/perception/point_cloud_kd_tree.h"
 
+using drake::internal::WorkerPool;
 using Eigen::Map;
 using Eigen::NoChange;
 
@@ -20,6 +30,34 @@ typedef PointCloud::T T;
 typedef PointCloud::C C;
 typedef PointCloud::D D;
 
+// The number of points handled by each task of the spatial operations.
+constexpr int kChunkSize = 4096;
+
+int NumChunks(int num_points) {
+  return (num_points + kChunkSize - 1) / kChunkSize;
+}
+
+// Returns a pool for the `num_threads` threads of an operation, or nullptr if
+// it runs on the calling thread only.
+std::unique_ptr<WorkerPool> MakePool(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads == 1) return nullptr;
+  return std::make_unique<WorkerPool>(num_threads);
+}
+
+// Calls task(i) for each i in [0, num_tasks) on `pool`, or in order on the
+// calling thread if `pool` is nullptr.
+void RunTasks(WorkerPool* pool, int num_tasks,
+              const std::function<void(int)>& task) {
+  if (pool != nullptr) {
+    pool->ParallelFor(num_tasks, task);
+    return;
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    task(i);
+  }
+}
+
 }  // namespace
 
 /*
@@ -119,6 +157,64 @@ pc_flags::Fields ResolvePairFields(
   }
 }
 
+// Returns the indices, in increasing order, of the points of `cloud` with
+// finite XYZs for which `keep(xyz)` is true.
+template <typename Predicate>
+std::vector<int> SelectPoints(const PointCloud& cloud, WorkerPool* pool,
+                              const Predicate& keep) {
+  const Eigen::Ref<const Matrix3X<T>> xyzs = cloud.xyzs();
+  const int num_chunks = NumChunks(cloud.size());
+  // Each chunk collects its own points, to be merged in order.
+  std::vector<std::vector<int>> selected(num_chunks);
+  RunTasks(pool, num_chunks, [&](int chunk) {
+    const int end = std::min(cloud.size(), (chunk + 1) * kChunkSize);
+    for (int i = chunk * kChunkSize; i < end; ++i) {
+      const Vector3<T> xyz = xyzs.col(i);
+      if (xyz.allFinite() && keep(xyz)) {
+        selected[chunk].push_back(i);
+      }
+    }
+  });
+  std::vector<int> indices;
+  for (const std::vector<int>& chunk_indices : selected) {
+    indices.insert(indices.end(), chunk_indices.begin(), chunk_indices.end());
+  }
+  return indices;
+}
+
+// Returns a cloud, with the fields of `cloud`, of its points at `indices`.
+PointCloud CopyPoints(const PointCloud& cloud, const std::vector<int>& indices,
+                      WorkerPool* pool) {
+  const int size = static_cast<int>(indices.size());
+  PointCloud result(size, cloud.fields(), true /* skip_initialize */);
+  RunTasks(pool, NumChunks(size), [&](int chunk) {
+    const int begin = chunk * kChunkSize;
+    const int end = std::min(size, begin + kChunkSize);
+    auto copy = [&](const auto& from, auto to) {
+      for (int i = begin; i < end; ++i) {
+        to.col(i) = from.col(indices[i]);
+      }
+    };
+    if (cloud.has_xyzs()) copy(cloud.xyzs(), result.mutable_xyzs());
+    if (cloud.has_normals()) copy(cloud.normals(), result.mutable_normals());
+    if (cloud.has_rgbs()) copy(cloud.rgbs(), result.mutable_rgbs());
+    if (cloud.has_descriptors()) {
+      copy(cloud.descriptors(), result.mutable_descriptors());
+    }
+  });
+  return result;
+}
+
+// Hashes the integer coordinates of a voxel.
+struct VoxelHash {
+  size_t operator()(const Vector3<int64_t>& voxel) const {
+    // Unsigned arithmetic wraps around instead of overflowing.
+    const Vector3<uint64_t> v = voxel.cast<uint64_t>();
+    return static_cast<size_t>((v.x() * 73856093u) ^ (v.y() * 19349663u) ^
+                               (v.z() * 83492791u));
+  }
+};
+
 }  // namespace
 
 PointCloud::PointCloud(
@@ -318,5 +414,245 @@ void PointCloud::RequireExactFields(
   }
 }
 
+PointCloud PointCloud::Crop(const Vector3<T>& lower_xyz,
+                            const Vector3<T>& upper_xyz,
+                            int num_threads) const {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  const std::unique_ptr<WorkerPool> pool = MakePool(num_threads);
+  const std::vector<int> indices = SelectPoints(
+      *this, pool.get(), [&lower_xyz, &upper_xyz](const Vector3<T>& xyz) {
+        return (xyz.array() >= lower_xyz.array()).all() &&
+               (xyz.array() <= upper_xyz.array()).all();
+      });
+  return CopyPoints(*this, indices, pool.get());
+}
+
+PointCloud PointCloud::Crop(const math::RigidTransformd& X_CB,
+                            const Vector3<T>& lower_B,
+                            const Vector3<T>& upper_B,
+                            int num_threads) const {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  const std::unique_ptr<WorkerPool> pool = MakePool(num_threads);
+  const math::RigidTransformd X_BC = X_CB.inverse();
+  const Matrix3<T> R_BC = X_BC.rotation().matrix().cast<T>();
+  const Vector3<T> p_BC = X_BC.translation().cast<T>();
+  const std::vector<int> indices = SelectPoints(
+      *this, pool.get(), [&](const Vector3<T>& p_CQ) {
+        const Vector3<T> p_BQ = R_BC * p_CQ + p_BC;
+        return (p_BQ.array() >= lower_B.array()).all() &&
+               (p_BQ.array() <= upper_B.array()).all();
+      });
+  return CopyPoints(*this, indices, pool.get());
+}
+
+PointCloud PointCloud::VoxelizedDownSample(double voxel_size,
+                                           int num_threads) const {
+  const std::unique_ptr<WorkerPool> pool = MakePool(num_threads);
+  PointCloud result(0, fields());
+  internal::VoxelizedDownSample(*this, voxel_size, pool.get(), &result);
+  return result;
+}
+
+bool PointCloud::EstimateNormals(double radius, int num_closest,
+                                 int num_threads) {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(has_normals());
+  DRAKE_THROW_UNLESS(radius > 0);
+  DRAKE_THROW_UNLESS(num_closest >= 3);
+  // The tree is built on the same threads as the normals.
+  const std::unique_ptr<WorkerPool> pool = MakePool(num_threads);
+  const PointCloudKdTree tree(xyzs(), pool.get());
+  const Eigen::Ref<const Matrix3X<T>> points = xyzs();
+  Eigen::Ref<Matrix3X<T>> normals = mutable_normals();
+  std::atomic<bool> all_estimated{true};
+  RunTasks(pool.get(), NumChunks(size()), [&](int chunk) {
+    const int end = std::min(size(), (chunk + 1) * kChunkSize);
+    std::vector<int> neighbors;
+    std::vector<float> squared_distances;
+    for (int i = chunk * kChunkSize; i < end; ++i) {
+      const Vector3<T> xyz = points.col(i);
+      Vector3<T> normal = Vector3<T>::Constant(kDefaultValue);
+      if (xyz.allFinite()) {
+        tree.FindNearest(xyz, num_closest, &neighbors, &squared_distances,
+                         radius);
+        if (neighbors.size() >= 3) {
+          Vector3<double> mean = Vector3<double>::Zero();
+          for (int j : neighbors) {
+            mean += points.col(j).cast<double>();
+          }
+          mean /= neighbors.size();
+          Matrix3<double> covariance = Matrix3<double>::Zero();
+          for (int j : neighbors) {
+            const Vector3<double> offset = points.col(j).cast<double>() - mean;
+            covariance += offset * offset.transpose();
+          }
+          // The eigenvalues are sorted in increasing order.
+          Eigen::SelfAdjointEigenSolver<Matrix3<double>> solver;
+          solver.computeDirect(covariance);
+          Vector3<double> direction = solver.eigenvectors().col(0);
+          if (direction.dot(xyz.cast<double>()) > 0) {
+            direction = -direction;
+          }
+          normal = direction.cast<T>();
+        }
+        if (!normal.allFinite()) {
+          all_estimated = false;
+        }
+      }
+      normals.col(i) = normal;
+    }
+  });
+  return all_estimated;
+}
+
+namespace internal {
+
+void VoxelizedDownSample(const PointCloud& cloud, double voxel_size,
+                         WorkerPool* pool, PointCloud* output) {
+  DRAKE_THROW_UNLESS(cloud.has_xyzs());
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  DRAKE_THROW_UNLESS(output != nullptr && output != &cloud);
+  output->RequireExactFields(cloud.fields());
+  const Eigen::Ref<const Matrix3X<T>> points = cloud.xyzs();
+
+  // Find the voxel of each point, and bucket the points of each chunk by the
+  // hash of their voxel, so that the voxels of each partition can be found by
+  // a thread of its own. The points that are skipped are in no bucket.
+  const int num_partitions = pool != nullptr ? pool->num_threads() : 1;
+  const int num_chunks = NumChunks(cloud.size());
+  std::vector<Vector3<int64_t>> voxels(cloud.size());
+  std::vector<std::vector<std::vector<int>>> buckets(
+      num_chunks, std::vector<std::vector<int>>(num_partitions));
+  RunTasks(pool, num_chunks, [&](int chunk) {
+    const int end = std::min(cloud.size(), (chunk + 1) * kChunkSize);
+    for (int i = chunk * kChunkSize; i < end; ++i) {
+      const Vector3<T> xyz = points.col(i);
+      if (!xyz.allFinite()) continue;
+      // Clamping keeps the conversion to integers defined for tiny voxels.
+      constexpr double kMaxCoordinate = 1e18;
+      for (int j = 0; j < 3; ++j) {
+        voxels[i][j] = static_cast<int64_t>(std::clamp(
+            std::floor(xyz[j] / voxel_size), -kMaxCoordinate, kMaxCoordinate));
+      }
+      buckets[chunk][VoxelHash{}(voxels[i]) % num_partitions].push_back(i);
+    }
+  });
+
+  // Group the points of each partition by voxel. The buckets are visited in
+  // the order of their chunks, such that the voxels of a partition are
+  // numbered in the order of their first points, and the points of a voxel
+  // are in increasing order.
+  struct Partition {
+    // The first point of each voxel.
+    std::vector<int> firsts;
+    // The points of voxel k are members[j] for offsets[k] <= j < offsets[k+1].
+    std::vector<int> offsets;
+    std::vector<int> members;
+  };
+  std::vector<Partition> partitions(num_partitions);
+  RunTasks(pool, num_partitions, [&](int p) {
+    Partition& partition = partitions[p];
+    std::unordered_map<Vector3<int64_t>, int, VoxelHash> voxel_numbers;
+    // The voxel of each point of the partition, in the order of the points.
+    std::vector<int> point_voxels;
+    partition.offsets.push_back(0);
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      for (const int i : buckets[chunk][p]) {
+        const int next_voxel = static_cast<int>(partition.firsts.size());
+        const auto [iter, inserted] =
+            voxel_numbers.try_emplace(voxels[i], next_voxel);
+        if (inserted) {
+          partition.firsts.push_back(i);
+          partition.offsets.push_back(0);
+        }
+        point_voxels.push_back(iter->second);
+        ++partition.offsets[iter->second + 1];
+      }
+    }
+    const int num_partition_voxels = static_cast<int>(partition.firsts.size());
+    for (int k = 0; k < num_partition_voxels; ++k) {
+      partition.offsets[k + 1] += partition.offsets[k];
+    }
+    partition.members.resize(point_voxels.size());
+    std::vector<int> next_member(partition.offsets.begin(),
+                                 partition.offsets.end() - 1);
+    int point = 0;
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      for (const int i : buckets[chunk][p]) {
+        partition.members[next_member[point_voxels[point++]]++] = i;
+      }
+    }
+  });
+
+  // Number all of the voxels in the order of their first points.
+  struct VoxelRef {
+    int first;
+    int partition;
+    int index;
+  };
+  std::vector<VoxelRef> voxel_refs;
+  for (int p = 0; p < num_partitions; ++p) {
+    const std::vector<int>& firsts = partitions[p].firsts;
+    for (int k = 0; k < static_cast<int>(firsts.size()); ++k) {
+      voxel_refs.push_back({firsts[k], p, k});
+    }
+  }
+  std::sort(voxel_refs.begin(), voxel_refs.end(),
+            [](const VoxelRef& a, const VoxelRef& b) {
+              return a.first < b.first;
+            });
+  const int num_voxels = static_cast<int>(voxel_refs.size());
+
+  // Average the points of each voxel. The output keeps its storage, which is
+  // only resized.
+  output->resize(num_voxels, true /* skip_initialize */);
+  RunTasks(pool, NumChunks(num_voxels), [&](int chunk) {
+    const int end = std::min(num_voxels, (chunk + 1) * kChunkSize);
+    VectorX<double> descriptor_sum;
+    for (int v = chunk * kChunkSize; v < end; ++v) {
+      const Partition& partition = partitions[voxel_refs[v].partition];
+      const std::vector<int>& members = partition.members;
+      const int begin_member = partition.offsets[voxel_refs[v].index];
+      const int end_member = partition.offsets[voxel_refs[v].index + 1];
+      const double count = end_member - begin_member;
+      Vector3<double> xyz_sum = Vector3<double>::Zero();
+      for (int m = begin_member; m < end_member; ++m) {
+        xyz_sum += points.col(members[m]).cast<double>();
+      }
+      output->mutable_xyzs().col(v) = (xyz_sum / count).cast<T>();
+      if (cloud.has_normals()) {
+        Vector3<double> normal_sum = Vector3<double>::Zero();
+        for (int m = begin_member; m < end_member; ++m) {
+          const Vector3<T> normal = cloud.normals().col(members[m]);
+          if (normal.allFinite()) normal_sum += normal.cast<double>();
+        }
+        const double norm = normal_sum.norm();
+        output->mutable_normals().col(v) =
+            norm > 0 ? Vector3<T>((normal_sum / norm).cast<T>())
+                     : Vector3<T>::Constant(PointCloud::kDefaultValue);
+      }
+      if (cloud.has_rgbs()) {
+        Vector3<double> rgb_sum = Vector3<double>::Zero();
+        for (int m = begin_member; m < end_member; ++m) {
+          rgb_sum += cloud.rgbs().col(members[m]).cast<double>();
+        }
+        output->mutable_rgbs().col(v) =
+            (rgb_sum / count).array().round().cast<C>();
+      }
+      if (cloud.has_descriptors()) {
+        descriptor_sum.setZero(cloud.descriptors().rows());
+        for (int m = begin_member; m < end_member; ++m) {
+          descriptor_sum += cloud.descriptors().col(members[m]).cast<double>();
+        }
+        output->mutable_descriptors().col(v) =
+            (descriptor_sum / count).cast<D>();
+      }
+    }
+  });
+}
+
+}  // namespace internal
+
+
 }  // namespace perception
 }  // namespace drake
@@ -10,6 +10,8 @@
 #include <Eigen/Dense>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/worker_pool.h"
+#include "drake/math/rigid_transform.h"
 #include "drake/perception/point_cloud_flags.h"
 
 namespace drake {
@@ -276,6 +278,51 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Spatial Operations
+  /// These operations require `has_xyzs()`. Points with non-finite XYZ
+  /// values (e.g., the invalid points of a converted depth image) are ignored.
+  /// Each operation splits its work among up to `num_threads` threads
+  /// (including the calling thread); `num_threads` must be positive. The
+  /// results do not depend on the number of threads.
+  /// @{
+
+  /// Returns a cloud, with the same fields, of the points whose XYZ values lie
+  /// within the axis-aligned box [`lower_xyz`, `upper_xyz`] (inclusive). The
+  /// points keep their relative order.
+  PointCloud Crop(const Vector3<T>& lower_xyz, const Vector3<T>& upper_xyz,
+                  int num_threads = 1) const;
+
+  /// Returns a cloud, with the same fields, of the points that lie within an
+  /// oriented box. The box is axis-aligned in a frame B, whose pose in this
+  /// cloud's frame C is `X_CB`, and spans [`lower_B`, `upper_B`] (inclusive)
+  /// in B. The points keep their relative order and are still expressed in
+  /// C.
+  PointCloud Crop(const math::RigidTransformd& X_CB, const Vector3<T>& lower_B,
+                  const Vector3<T>& upper_B, int num_threads = 1) const;
+
+  /// Returns a cloud, with the same fields, with one point per occupied voxel
+  /// of a grid of cubic voxels with edge length `voxel_size`, whose corner is
+  /// at the origin. Each point is the average of the points in its voxel: the
+  /// XYZs, RGBs and descriptors are averaged, and the normals are averaged
+  /// (over the finite ones) and then normalized. The voxels are ordered by
+  /// the first of their points in this cloud.
+  /// @pre voxel_size > 0.
+  PointCloud VoxelizedDownSample(double voxel_size, int num_threads = 1) const;
+
+  /// Estimates the normal of each point from its (up to) `num_closest`
+  /// nearest neighbors (itself included) within `radius`, as the direction of
+  /// least variance of their XYZs. The normals are oriented to point toward
+  /// the origin of the cloud's frame (e.g., the camera, for a cloud made from
+  /// a depth image). Points with fewer than three such neighbors, or with
+  /// non-finite XYZs, are assigned NaN normals.
+  /// @returns true iff every point with finite XYZs was assigned a finite
+  ///   normal.
+  /// @pre `has_normals()`, radius > 0 and num_closest >= 3.
+  /// @see PointCloudKdTree, which finds the neighbors.
+  bool EstimateNormals(double radius, int num_closest, int num_threads = 1);
+
+  /// @}
+
   /// @name Fields
   /// @{
 
@@ -327,5 +374,18 @@ class PointCloud final {
 // homogeneous data (possibly with heterogeneous data, if strides can be
 // used).
 
+namespace internal {
+
+/* (Internal use only) Computes cloud.VoxelizedDownSample(voxel_size) into
+`output`, whose storage is resized rather than replaced, for callers which
+downsample repeatedly. The loops run on `pool`, or on the calling thread if
+`pool` is nullptr.
+@pre `output` is not nullptr, is not `cloud`, and has exactly the fields of
+`cloud`. */
+void VoxelizedDownSample(const PointCloud& cloud, double voxel_size,
+                         drake::internal::WorkerPool* pool,
+                         PointCloud* output);
+
+}  // namespace internal
 }  // namespace perception
 }  // namespace drake
@@ -0,0 +1,177 @@
+#include "drake/perception/point_cloud_fusion.h"
+
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/worker_pool.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+
+using math::RigidTransformd;
+using systems::Context;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::PixelType;
+
+namespace {
+
+// Throws unless `image` has the size of the camera with `camera_info`.
+template <typename ImageType>
+void CheckImageSize(const ImageType& image, const CameraInfo& camera_info,
+                    int camera) {
+  if (image.width() != camera_info.width() ||
+      image.height() != camera_info.height()) {
+    throw std::logic_error(fmt::format(
+        "PointCloudFusion: the {}x{} image of camera {} does not have the "
+        "{}x{} size of its camera info",
+        image.width(), image.height(), camera, camera_info.width(),
+        camera_info.height()));
+  }
+}
+
+}  // namespace
+
+PointCloudFusion::PointCloudFusion(std::vector<CameraInfo> camera_infos,
+                                   PixelType depth_pixel_type, float scale,
+                                   pc_flags::BaseFieldT fields,
+                                   std::optional<double> voxel_size,
+                                   int num_threads)
+    : camera_infos_(std::move(camera_infos)),
+      depth_pixel_type_(depth_pixel_type),
+      scale_(scale),
+      voxel_size_(voxel_size) {
+  DRAKE_THROW_UNLESS(!camera_infos_.empty());
+  DRAKE_THROW_UNLESS(depth_pixel_type == PixelType::kDepth32F ||
+                     depth_pixel_type == PixelType::kDepth16U);
+  DRAKE_THROW_UNLESS((fields & pc_flags::kXYZs) != 0);
+  DRAKE_THROW_UNLESS(
+      (fields & ~(pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs)) ==
+      0);
+  DRAKE_THROW_UNLESS(!voxel_size_ || *voxel_size_ > 0);
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads > 1) {
+    pool_ = std::make_unique<drake::internal::WorkerPool>(num_threads);
+  }
+
+  point_offsets_.push_back(0);
+  for (int i = 0; i < num_cameras(); ++i) {
+    const CameraInfo& camera_info = camera_infos_[i];
+    ray_x_.emplace_back();
+    ray_y_.emplace_back();
+    internal::MakePixelRays(camera_info, camera_info.width(),
+                            camera_info.height(), &ray_x_.back(),
+                            &ray_y_.back());
+    point_offsets_.push_back(point_offsets_.back() +
+                             camera_info.width() * camera_info.height());
+
+    if (depth_pixel_type == PixelType::kDepth32F) {
+      depth_image_input_ports_.push_back(
+          this->DeclareAbstractInputPort(fmt::format("depth_image_{}", i),
+                                         Value<ImageDepth32F>{})
+              .get_index());
+    } else {
+      depth_image_input_ports_.push_back(
+          this->DeclareAbstractInputPort(fmt::format("depth_image_{}", i),
+                                         Value<ImageDepth16U>{})
+              .get_index());
+    }
+    color_image_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("color_image_{}", i),
+                                       Value<ImageRgba8U>{})
+            .get_index());
+    camera_pose_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("camera_pose_{}", i),
+                                       Value<RigidTransformd>{})
+            .get_index());
+  }
+
+  if (voxel_size_) {
+    fused_cloud_cache_entry_ = &this->DeclareCacheEntry(
+        "fused point cloud", PointCloud{0, fields},
+        &PointCloudFusion::CalcFusedCloud);
+  }
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0, fields},
+                                  &PointCloudFusion::CalcOutput);
+}
+
+void PointCloudFusion::CalcFusedCloud(const Context<double>& context,
+                                      PointCloud* cloud) const {
+  // Every point is written below, so new memory needn't be initialized.
+  const int num_points = point_offsets_.back();
+  if (cloud->size() != num_points) {
+    cloud->resize(num_points, true /* skip_initialize */);
+  }
+  for (int i = 0; i < num_cameras(); ++i) {
+    const CameraInfo& camera_info = camera_infos_[i];
+    const ImageRgba8U* color_image = nullptr;
+    if (cloud->has_rgbs()) {
+      if (color_image_input_port(i).HasValue(context)) {
+        color_image =
+            &color_image_input_port(i).Eval<ImageRgba8U>(context);
+        CheckImageSize(*color_image, camera_info, i);
+      } else {
+        cloud->mutable_rgbs()
+            .middleCols(point_offsets_[i], point_offsets_[i + 1] -
+                                               point_offsets_[i])
+            .setConstant(PointCloud::kDefaultColor);
+      }
+    }
+    // The inputs are evaluated before taking the pool, so that other
+    // evaluations only wait for the conversions.
+    const RigidTransformd X_PC =
+        camera_pose_input_port(i).HasValue(context)
+            ? camera_pose_input_port(i).Eval<RigidTransformd>(context)
+            : RigidTransformd::Identity();
+    if (depth_pixel_type_ == PixelType::kDepth32F) {
+      const auto& depth_image =
+          depth_image_input_port(i).Eval<ImageDepth32F>(context);
+      CheckImageSize(depth_image, camera_info, i);
+      const std::unique_lock<std::mutex> lock = LockPool();
+      internal::DeprojectDepthImage(ray_x_[i], ray_y_[i], X_PC, depth_image,
+                                    color_image, scale_, point_offsets_[i],
+                                    pool_.get(), cloud);
+    } else {
+      const auto& depth_image =
+          depth_image_input_port(i).Eval<ImageDepth16U>(context);
+      CheckImageSize(depth_image, camera_info, i);
+      const std::unique_lock<std::mutex> lock = LockPool();
+      internal::DeprojectDepthImage(ray_x_[i], ray_y_[i], X_PC, depth_image,
+                                    color_image, scale_, point_offsets_[i],
+                                    pool_.get(), cloud);
+    }
+  }
+}
+
+std::unique_lock<std::mutex> PointCloudFusion::LockPool() const {
+  if (pool_ == nullptr) return {};
+  return std::unique_lock<std::mutex>(pool_mutex_);
+}
+
+void PointCloudFusion::CalcOutput(const Context<double>& context,
+                                  PointCloud* output) const {
+  if (!voxel_size_) {
+    CalcFusedCloud(context, output);
+    return;
+  }
+  // N.B. The pool is taken after the fused cloud is evaluated, since its
+  // evaluation takes the pool too.
+  const auto& fused_cloud =
+      fused_cloud_cache_entry_->Eval<PointCloud>(context);
+  const std::unique_lock<std::mutex> lock = LockPool();
+  internal::VoxelizedDownSample(fused_cloud, *voxel_size_, pool_.get(),
+                                output);
+}
+
+}  // namespace perception
+}  // namespace drake
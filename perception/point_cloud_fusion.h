@@ -0,0 +1,152 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/worker_pool.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/cache_entry.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/pixel_types.h"
+
+namespace drake {
+namespace perception {
+
+/// Fuses the depth images of several cameras into a single point cloud,
+/// expressed in a common frame P.
+///
+/// @system{ PointCloudFusion,
+///          @input_port{depth_image_0}
+///          @input_port{color_image_0 (optional)}
+///          @input_port{camera_pose_0 (optional)}
+///          @input_port{...}
+///          @input_port{depth_image_N-1}
+///          @input_port{color_image_N-1 (optional)}
+///          @input_port{camera_pose_N-1 (optional)},
+///          @output_port{point_cloud}
+/// }
+///
+/// Each camera i has a depth image input port, an optional color image input
+/// port and an optional camera pose input port that takes X_PC, the pose of
+/// the camera in P. If the camera pose input is not connected, the camera
+/// frame is P. The images of each camera are converted as
+/// DepthImageToPointCloud does (including its conventions for invalid depths
+/// and normals), in a single pass that writes straight into the output, and
+/// the tables used to deproject the pixels are computed once per camera, at
+/// construction.
+///
+/// Without downsampling, the point cloud is the concatenation of the
+/// organized clouds of the cameras: the point of pixel (u, v) of camera i is
+/// at index `point_offset(i) + v * width + u`. Its memory is reused from one
+/// evaluation to the next. If the point cloud has RGBs, the points of a camera
+/// whose color image input is not connected get PointCloud::kDefaultColor.
+///
+/// If a voxel size is given, the fused cloud is kept in a cache entry and the
+/// output is its PointCloud::VoxelizedDownSample(), which contains only the
+/// (averaged) measured points. The downsampled points are also written into
+/// the output's memory, which is only resized when the number of occupied
+/// voxels changes.
+///
+/// @ingroup perception_systems
+class PointCloudFusion final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudFusion)
+
+  /// Constructs the fusion of the cameras with the given `camera_infos`.
+  ///
+  /// @param[in] camera_infos The camera info of each camera; must not be
+  ///   empty. The depth (and color) images of camera i must have the size of
+  ///   `camera_infos[i]`.
+  /// @param[in] depth_pixel_type The pixel type of the depth image inputs.
+  ///   Only 16U and 32F are supported.
+  /// @param[in] scale The depth images are multiplied by this scale factor
+  ///   before projecting to a point cloud.
+  /// @param[in] fields The fields the point cloud contains; must include
+  ///   kXYZs, and may include kNormals and kRGBs.
+  /// @param[in] voxel_size If given, the edge length of the voxels used to
+  ///   downsample the point cloud; must be positive.
+  /// @param[in] num_threads The maximum number of threads used for the
+  ///   conversion (and the downsampling), including the calling thread; must
+  ///   be positive. The threads are created once, by the constructor, and
+  ///   evaluations on different contexts take turns using them.
+  explicit PointCloudFusion(
+      std::vector<systems::sensors::CameraInfo> camera_infos,
+      systems::sensors::PixelType depth_pixel_type =
+          systems::sensors::PixelType::kDepth32F,
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      std::optional<double> voxel_size = std::nullopt, int num_threads = 1);
+
+  /// Returns the number of cameras.
+  int num_cameras() const { return static_cast<int>(camera_infos_.size()); }
+
+  /// Returns the index of the first point of camera `i` in the point cloud,
+  /// when it is not downsampled.
+  int point_offset(int i) const { return point_offsets_.at(i); }
+
+  /// Returns the abstract valued input port that expects the depth image of
+  /// camera `i`, either an ImageDepth16U or ImageDepth32F (depending on the
+  /// constructor argument).
+  const systems::InputPort<double>& depth_image_input_port(int i) const {
+    return this->get_input_port(depth_image_input_ports_.at(i));
+  }
+
+  /// Returns the abstract valued input port that expects the ImageRgba8U of
+  /// camera `i`. (This input port does not need to be connected; refer to the
+  /// class overview for details.)
+  const systems::InputPort<double>& color_image_input_port(int i) const {
+    return this->get_input_port(color_image_input_ports_.at(i));
+  }
+
+  /// Returns the abstract valued input port that expects X_PC of camera `i`
+  /// as a RigidTransformd. (This input port does not need to be connected;
+  /// refer to the class overview for details.)
+  const systems::InputPort<double>& camera_pose_input_port(int i) const {
+    return this->get_input_port(camera_pose_input_ports_.at(i));
+  }
+
+  /// Returns the abstract valued output port that provides the PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  // Writes the points of all of the cameras to `cloud`.
+  void CalcFusedCloud(const systems::Context<double>& context,
+                      PointCloud* cloud) const;
+
+  void CalcOutput(const systems::Context<double>& context,
+                  PointCloud* output) const;
+
+  // Returns a lock on pool_ (or no lock, if there is no pool), to be held
+  // while running loops on it.
+  std::unique_lock<std::mutex> LockPool() const;
+
+  const std::vector<systems::sensors::CameraInfo> camera_infos_;
+  const systems::sensors::PixelType depth_pixel_type_;
+  const float scale_;
+  const std::optional<double> voxel_size_;
+  // The threads of the conversion and of the downsampling, iff num_threads >
+  // 1, which one evaluation at a time runs its loops on.
+  std::unique_ptr<drake::internal::WorkerPool> pool_;
+  mutable std::mutex pool_mutex_;
+  // The pixel deprojection tables of each camera.
+  std::vector<std::vector<float>> ray_x_;
+  std::vector<std::vector<float>> ray_y_;
+  // The index of the first point of each camera, followed by the total number
+  // of points.
+  std::vector<int> point_offsets_;
+
+  std::vector<systems::InputPortIndex> depth_image_input_ports_;
+  std::vector<systems::InputPortIndex> color_image_input_ports_;
+  std::vector<systems::InputPortIndex> camera_pose_input_ports_;
+  // The fused cloud, iff it is downsampled.
+  systems::CacheEntry* fused_cloud_cache_entry_{};
+};
+
+}  // namespace perception
+}  // namespace drake
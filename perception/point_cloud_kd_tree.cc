@@ -0,0 +1,258 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+// The maximum number of points in a leaf.
+constexpr int kLeafSize = 16;
+
+// Returns the number of nodes of a tree over `num_points` points. It only
+// depends on the number of points because the points are split in halves.
+int CountNodes(int num_points) {
+  if (num_points <= kLeafSize) return 1;
+  const int half = num_points / 2;
+  return 1 + CountNodes(half) + CountNodes(num_points - half);
+}
+
+// Returns a pool of `num_threads` threads, or nullptr for one thread.
+std::unique_ptr<drake::internal::WorkerPool> MakePool(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads == 1) return nullptr;
+  return std::make_unique<drake::internal::WorkerPool>(num_threads);
+}
+
+// The number of subtrees per thread which are built in parallel, such that
+// the threads stay busy although the subtrees differ in cost.
+constexpr int kSubtreesPerThread = 4;
+
+// A subtree yet to be built: its root node and its points [begin, end).
+struct Subtree {
+  int node{};
+  int begin{};
+  int end{};
+};
+
+}  // namespace
+
+struct PointCloudKdTree::IndexedPoint {
+  Vector3<float> xyz;
+  int index{};
+};
+
+// The points are kept in the caller's output vectors, so that repeated
+// queries need not allocate.
+struct PointCloudKdTree::Neighbors {
+  // Finds up to `k` points (without limit if `k` is negative) within
+  // sqrt(`max_squared_distance`), sorted by increasing distance iff `k` is
+  // not negative.
+  Neighbors(int k_in, float max_squared_distance, std::vector<int>* slots_in,
+            std::vector<float>* squared_distances_in)
+      : k(k_in),
+        bound(max_squared_distance),
+        slots(*slots_in),
+        squared_distances(*squared_distances_in) {
+    slots.clear();
+    squared_distances.clear();
+  }
+
+  void Add(float squared_distance, int slot) {
+    if (squared_distance > bound) return;
+    int i = static_cast<int>(slots.size());
+    if (k < 0 || i < k) {
+      slots.push_back(slot);
+      squared_distances.push_back(squared_distance);
+      if (k < 0) return;
+    } else {
+      --i;
+    }
+    // Insertion sort, dropping the farthest point if there are k already.
+    for (; i > 0 && squared_distances[i - 1] > squared_distance; --i) {
+      slots[i] = slots[i - 1];
+      squared_distances[i] = squared_distances[i - 1];
+    }
+    slots[i] = slot;
+    squared_distances[i] = squared_distance;
+    if (static_cast<int>(slots.size()) == k) {
+      bound = squared_distances.back();
+    }
+  }
+
+  const int k;
+  // The squared distance beyond which no point can be added.
+  float bound;
+  // The indices in points_ of the points found, and their squared distances.
+  std::vector<int>& slots;
+  std::vector<float>& squared_distances;
+};
+
+PointCloudKdTree::PointCloudKdTree(
+    const Eigen::Ref<const Matrix3X<float>>& xyzs, int num_threads)
+    : PointCloudKdTree(xyzs, MakePool(num_threads).get()) {}
+
+PointCloudKdTree::PointCloudKdTree(
+    const Eigen::Ref<const Matrix3X<float>>& xyzs,
+    drake::internal::WorkerPool* pool) {
+  std::vector<IndexedPoint> points;
+  points.reserve(xyzs.cols());
+  for (int i = 0; i < xyzs.cols(); ++i) {
+    if (xyzs.col(i).allFinite()) points.push_back({xyzs.col(i), i});
+  }
+  const int num_indexed = static_cast<int>(points.size());
+  if (num_indexed == 0) return;
+
+  nodes_.resize(CountNodes(num_indexed));
+  if (pool == nullptr) {
+    Build(0, 0, num_indexed, &points);
+  } else {
+    // Split the top levels on the calling thread, until there are enough
+    // subtrees to share among the threads. The subtrees own disjoint ranges
+    // of `points` and of nodes_, so they are then built concurrently.
+    const int num_subtrees = kSubtreesPerThread * pool->num_threads();
+    std::vector<Subtree> subtrees{{0, 0, num_indexed}};
+    while (!subtrees.empty() &&
+           static_cast<int>(subtrees.size()) < num_subtrees) {
+      std::vector<Subtree> children;
+      for (const Subtree& subtree : subtrees) {
+        const int mid =
+            Split(subtree.node, subtree.begin, subtree.end, &points);
+        if (mid < 0) continue;
+        children.push_back({subtree.node + 1, subtree.begin, mid});
+        children.push_back({nodes_[subtree.node].right, mid, subtree.end});
+      }
+      subtrees = std::move(children);
+    }
+    pool->ParallelFor(static_cast<int>(subtrees.size()), [&](int i) {
+      Build(subtrees[i].node, subtrees[i].begin, subtrees[i].end, &points);
+    });
+  }
+
+  points_.resize(3, num_indexed);
+  indices_.resize(num_indexed);
+  for (int i = 0; i < num_indexed; ++i) {
+    points_.col(i) = points[i].xyz;
+    indices_[i] = points[i].index;
+  }
+}
+
+int PointCloudKdTree::Split(int node, int begin, int end,
+                            std::vector<IndexedPoint>* points) {
+  Node& n = nodes_[node];
+  n.begin = begin;
+  n.end = end;
+  if (end - begin <= kLeafSize) return -1;
+
+  // Split along the axis of largest extent, at the median.
+  IndexedPoint* const first = points->data() + begin;
+  IndexedPoint* const last = points->data() + end;
+  Vector3<float> lower = first->xyz;
+  Vector3<float> upper = lower;
+  for (const IndexedPoint* p = first + 1; p != last; ++p) {
+    lower = lower.cwiseMin(p->xyz);
+    upper = upper.cwiseMax(p->xyz);
+  }
+  int axis{};
+  (upper - lower).maxCoeff(&axis);
+  const int mid = begin + (end - begin) / 2;
+  IndexedPoint* const median = points->data() + mid;
+  std::nth_element(first, median, last,
+                   [axis](const IndexedPoint& a, const IndexedPoint& b) {
+                     return a.xyz[axis] < b.xyz[axis];
+                   });
+  n.axis = axis;
+  n.split = median->xyz[axis];
+  n.right = node + 1 + CountNodes(mid - begin);
+  return mid;
+}
+
+void PointCloudKdTree::Build(int node, int begin, int end,
+                             std::vector<IndexedPoint>* points) {
+  const int mid = Split(node, begin, end, points);
+  if (mid < 0) return;
+  Build(node + 1, begin, mid, points);
+  Build(nodes_[node].right, mid, end, points);
+}
+
+void PointCloudKdTree::FindNearest(const Vector3<float>& query, int k,
+                                   std::vector<int>* indices,
+                                   std::vector<float>* squared_distances,
+                                   float max_distance) const {
+  DRAKE_THROW_UNLESS(k >= 0);
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  std::vector<float> distances_buffer;
+  Neighbors neighbors(
+      k, max_distance * max_distance, indices,
+      squared_distances != nullptr ? squared_distances : &distances_buffer);
+  if (k > 0 && !nodes_.empty()) {
+    Search(0, query, &neighbors);
+  }
+  for (int& i : *indices) {
+    i = indices_[i];
+  }
+}
+
+void PointCloudKdTree::FindWithinRadius(
+    const Vector3<float>& query, float radius, std::vector<int>* indices,
+    std::vector<float>* squared_distances) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  std::vector<float> distances_buffer;
+  Neighbors neighbors(
+      -1, radius * radius, indices,
+      squared_distances != nullptr ? squared_distances : &distances_buffer);
+  if (!nodes_.empty()) {
+    Search(0, query, &neighbors);
+  }
+  // Sort by distance, as FindNearest() does.
+  std::vector<std::pair<float, int>> found(indices->size());
+  for (size_t i = 0; i < found.size(); ++i) {
+    found[i] = {neighbors.squared_distances[i], indices_[(*indices)[i]]};
+  }
+  std::sort(found.begin(), found.end());
+  for (size_t i = 0; i < found.size(); ++i) {
+    neighbors.squared_distances[i] = found[i].first;
+    (*indices)[i] = found[i].second;
+  }
+}
+
+void PointCloudKdTree::Search(int node, const Vector3<float>& query,
+                              Neighbors* neighbors) const {
+  Vector3<float> offsets = Vector3<float>::Zero();
+  Search(node, query, 0, &offsets, neighbors);
+}
+
+void PointCloudKdTree::Search(int node, const Vector3<float>& query,
+                              float cell_squared_distance,
+                              Vector3<float>* offsets,
+                              Neighbors* neighbors) const {
+  const Node& n = nodes_[node];
+  if (n.axis < 0) {
+    for (int i = n.begin; i < n.end; ++i) {
+      neighbors->Add((points_.col(i) - query).squaredNorm(), i);
+    }
+    return;
+  }
+  const float offset = query[n.axis] - n.split;
+  const int near = offset < 0 ? node + 1 : n.right;
+  const int far = offset < 0 ? n.right : node + 1;
+  Search(near, query, cell_squared_distance, offsets, neighbors);
+  // The far child's cell is that of this node cut at the split, so its
+  // squared distance only changes along the split axis.
+  float& axis_offset = (*offsets)[n.axis];
+  const float far_squared_distance =
+      cell_squared_distance - axis_offset * axis_offset + offset * offset;
+  if (far_squared_distance <= neighbors->bound) {
+    const float old_offset = axis_offset;
+    axis_offset = offset;
+    Search(far, query, far_squared_distance, offsets, neighbors);
+    axis_offset = old_offset;
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
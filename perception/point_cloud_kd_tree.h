@@ -0,0 +1,108 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/worker_pool.h"
+
+namespace drake {
+namespace perception {
+
+/// A k-d tree over a set of 3D points (e.g., the `xyzs()` of a PointCloud) for
+/// nearest-neighbor and radius queries.
+///
+/// The tree holds its own copy of the points, so it remains valid after the
+/// source is modified or destroyed. Points with non-finite coordinates (e.g.,
+/// the NaN or infinite points of a converted depth image) are not indexed.
+/// Query results report the column indices of the points in the source.
+///
+/// The queries are const and may be run concurrently from several threads.
+class PointCloudKdTree final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PointCloudKdTree)
+
+  /// Builds the tree over the columns of `xyzs`.
+  /// @param num_threads The maximum number of threads used to build the tree,
+  ///   including the calling thread; must be positive.
+  explicit PointCloudKdTree(const Eigen::Ref<const Matrix3X<float>>& xyzs,
+                            int num_threads = 1);
+
+  /* (Internal use only) Builds the tree over the columns of `xyzs` on the
+  threads of `pool`, or on the calling thread only if `pool` is nullptr. */
+  PointCloudKdTree(const Eigen::Ref<const Matrix3X<float>>& xyzs,
+                   drake::internal::WorkerPool* pool);
+
+  /// Returns the number of indexed (i.e., finite) points.
+  int num_points() const { return static_cast<int>(indices_.size()); }
+
+  /// Finds the (up to) `k` indexed points nearest to `query` that are at most
+  /// `max_distance` away from it.
+  /// @param[out] indices The source indices of the points found, sorted by
+  ///   increasing distance to `query`; must not be nullptr.
+  /// @param[out] squared_distances If not nullptr, the squared distances of
+  ///   the points found, in the same order.
+  /// @pre k >= 0.
+  void FindNearest(const Vector3<float>& query, int k,
+                   std::vector<int>* indices,
+                   std::vector<float>* squared_distances = nullptr,
+                   float max_distance =
+                       std::numeric_limits<float>::infinity()) const;
+
+  /// Finds all of the indexed points that are at most `radius` away from
+  /// `query`, with the same outputs as FindNearest().
+  void FindWithinRadius(const Vector3<float>& query, float radius,
+                        std::vector<int>* indices,
+                        std::vector<float>* squared_distances = nullptr) const;
+
+ private:
+  // A node of the tree. An inner node splits its points at `split` along
+  // `axis`: its first (left) child, which immediately follows it in nodes_, has
+  // the points below the split, and its second child (at `right`) the others.
+  // A leaf (axis == -1) owns the points [begin, end) of points_.
+  struct Node {
+    int begin{};
+    int end{};
+    int axis{-1};
+    int right{};
+    float split{};
+  };
+
+  // A point and its source index, as sorted while building the tree.
+  struct IndexedPoint;
+
+  // The points found so far by a query.
+  struct Neighbors;
+
+  // Sets up nodes_[node] over the points [begin, end). If it is an inner node,
+  // partitions the points at its split and returns the first point of its
+  // right child; otherwise returns -1.
+  int Split(int node, int begin, int end, std::vector<IndexedPoint>* points);
+
+  // Builds the subtree of nodes_[node] over the points [begin, end), which it
+  // sorts into the order of its leaves.
+  void Build(int node, int begin, int end, std::vector<IndexedPoint>* points);
+
+  // Adds the points of the subtree of nodes_[node] to `neighbors`.
+  void Search(int node, const Vector3<float>& query,
+              Neighbors* neighbors) const;
+
+  // Implements Search(), where `cell_squared_distance` is a lower bound on the
+  // squared distance from `query` to the subtree's points, and `offsets` are
+  // the per-axis offsets from the subtree's cell to `query` that make it up
+  // (Arya and Mount's incremental distance).
+  void Search(int node, const Vector3<float>& query,
+              float cell_squared_distance, Vector3<float>* offsets,
+              Neighbors* neighbors) const;
+
+  // The indexed points in the order of the leaves, and their source indices.
+  Matrix3X<float> points_;
+  std::vector<int> indices_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace perception
+}  // namespace drake
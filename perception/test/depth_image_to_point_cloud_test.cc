@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <limits>
+#include <optional>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -482,6 +483,104 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies the normals of a fronto-parallel plane, with and without a pose.
+GTEST_TEST(DepthImageToPointCloudNormalsTest, Plane) {
+  const CameraInfo camera(8, 6, 10.0, 10.0, 4.0, 3.0);
+  systems::sensors::ImageDepth32F depth_image(8, 6, 2.0f);
+  // A pixel without a measurement has no normal, nor do its neighbors.
+  depth_image.at(5, 2)[0] = ImageTraits<PixelType::kDepth32F>::kTooClose;
+  const RigidTransformd X_PC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+
+  for (const auto& pose : {std::optional<RigidTransformd>{},
+                           std::optional<RigidTransformd>{X_PC}}) {
+    PointCloud cloud(0, pc_flags::kXYZs | pc_flags::kNormals);
+    DepthImageToPointCloud::Convert(camera, pose, depth_image, std::nullopt,
+                                    std::nullopt, &cloud);
+    ASSERT_EQ(cloud.size(), 48);
+    // The normals point toward the camera, i.e., along -Cz.
+    const Vector3f expected_normal =
+        pose ? (-pose->rotation().matrix().col(2)).cast<float>().eval()
+             : Vector3f(0, 0, -1);
+    for (int v = 0; v < 6; ++v) {
+      for (int u = 0; u < 8; ++u) {
+        const Vector3f normal = cloud.normal(v * 8 + u);
+        if (std::abs(u - 5) + std::abs(v - 2) <= 1) {
+          EXPECT_TRUE(normal.array().isNaN().all());
+        } else {
+          EXPECT_TRUE(CompareMatrices(normal, expected_normal, 1e-6));
+        }
+      }
+    }
+  }
+}
+
+// Verifies that the result doesn't depend on the number of threads, and that
+// the cloud's memory is reused for frames of the same size.
+GTEST_TEST(DepthImageToPointCloudThreadsTest, SameResult) {
+  const int width = 32;
+  const int height = 24;
+  const CameraInfo camera(width, height, M_PI / 3);
+  systems::sensors::ImageDepth16U depth_image(width, height);
+  ImageRgba8U color_image(width, height);
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      depth_image.at(u, v)[0] = (u * 37 + v * 101) % 2000;
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(u, v)[c] = (u * 3 + v * 5 + c) % 256;
+      }
+    }
+  }
+  const pc_flags::BaseFieldT fields =
+      pc_flags::kXYZs | pc_flags::kRGBs | pc_flags::kNormals;
+  const RigidTransformd X_PC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+
+  PointCloud expected(0, fields);
+  DepthImageToPointCloud::Convert(camera, X_PC, depth_image, color_image,
+                                  0.001f, &expected);
+
+  PointCloud cloud(0, fields);
+  DepthImageToPointCloud::Convert(camera, X_PC, depth_image, color_image,
+                                  0.001f, &cloud, 3);
+  const float* const xyzs = cloud.xyzs().data();
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), expected.xyzs()));
+  EXPECT_EQ(cloud.rgbs(), expected.rgbs());
+  EXPECT_TRUE(CompareMatrices(cloud.normals(), expected.normals()));
+  DepthImageToPointCloud::Convert(camera, X_PC, depth_image, color_image,
+                                  0.001f, &cloud, 3);
+  EXPECT_EQ(cloud.xyzs().data(), xyzs);
+
+  const DepthImageToPointCloud dut(camera, PixelType::kDepth16U, 0.001f,
+                                   fields, 3);
+  auto context = dut.CreateDefaultContext();
+  dut.depth_image_input_port().FixValue(context.get(), depth_image);
+  dut.color_image_input_port().FixValue(context.get(), color_image);
+  dut.camera_pose_input_port().FixValue(context.get(), X_PC);
+  const auto& output =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), expected.xyzs()));
+  EXPECT_EQ(output.rgbs(), expected.rgbs());
+  EXPECT_TRUE(CompareMatrices(output.normals(), expected.normals()));
+}
+
+GTEST_TEST(DepthImageToPointCloudErrorsTest, BadArguments) {
+  const CameraInfo camera(4, 3, M_PI / 3);
+  const systems::sensors::ImageDepth32F depth_image(4, 3, 1.0f);
+  PointCloud cloud(0, pc_flags::kXYZs | pc_flags::kRGBs);
+  EXPECT_THROW(DepthImageToPointCloud::Convert(camera, std::nullopt,
+                                               depth_image, ImageRgba8U(3, 4),
+                                               std::nullopt, &cloud),
+               std::exception);
+  EXPECT_THROW(DepthImageToPointCloud::Convert(camera, std::nullopt,
+                                               depth_image, std::nullopt,
+                                               std::nullopt, &cloud, 0),
+               std::exception);
+  EXPECT_THROW(DepthImageToPointCloud(camera, PixelType::kDepth32F, 1.0f,
+                                      pc_flags::kXYZs, 0),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
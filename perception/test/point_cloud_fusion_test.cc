@@ -0,0 +1,198 @@
+#include "drake/perception/point_cloud_fusion.h"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::PixelType;
+
+// Returns a depth image with a slanted plane, and a few invalid pixels.
+ImageDepth32F MakeDepthImage(int width, int height) {
+  ImageDepth32F image(width, height);
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      image.at(u, v)[0] = 1 + 0.01 * u + 0.02 * v;
+    }
+  }
+  image.at(1, 1)[0] = std::numeric_limits<float>::quiet_NaN();
+  image.at(2, 1)[0] = std::numeric_limits<float>::infinity();
+  return image;
+}
+
+ImageRgba8U MakeColorImage(int width, int height) {
+  ImageRgba8U image(width, height);
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      for (int i = 0; i < 4; ++i) {
+        image.at(u, v)[i] = u + v + i;
+      }
+    }
+  }
+  return image;
+}
+
+class PointCloudFusionTest : public ::testing::Test {
+ protected:
+  const std::vector<CameraInfo> camera_infos_{
+      CameraInfo(8, 6, M_PI / 3), CameraInfo(5, 4, M_PI / 4),
+      CameraInfo(6, 6, M_PI / 2)};
+  const std::vector<RigidTransformd> X_PCs_{
+      RigidTransformd::Identity(),
+      RigidTransformd(RollPitchYawd(0.1, 0.2, 0.3), Vector3d(1, 2, 3)),
+      RigidTransformd(RollPitchYawd(-0.3, 0, 0.5), Vector3d(-1, 0, 1))};
+};
+
+// The fused cloud is the concatenation of the clouds of the cameras.
+TEST_F(PointCloudFusionTest, MatchesDepthImageToPointCloud) {
+  const pc_flags::BaseFieldT fields =
+      pc_flags::kXYZs | pc_flags::kRGBs | pc_flags::kNormals;
+  for (int num_threads : {1, 3}) {
+    const PointCloudFusion dut(camera_infos_, PixelType::kDepth32F, 1.0,
+                               fields, std::nullopt, num_threads);
+    ASSERT_EQ(dut.num_cameras(), 3);
+    auto context = dut.CreateDefaultContext();
+    std::vector<PointCloud> expected;
+    for (int i = 0; i < 3; ++i) {
+      const CameraInfo& info = camera_infos_[i];
+      const ImageDepth32F depth = MakeDepthImage(info.width(), info.height());
+      dut.depth_image_input_port(i).FixValue(context.get(), depth);
+      // Camera 0 keeps its default pose, and camera 2 has no color.
+      if (i > 0) {
+        dut.camera_pose_input_port(i).FixValue(context.get(), X_PCs_[i]);
+      }
+      std::optional<ImageRgba8U> color;
+      if (i < 2) {
+        color = MakeColorImage(info.width(), info.height());
+        dut.color_image_input_port(i).FixValue(context.get(), *color);
+      }
+      expected.emplace_back(0, fields);
+      DepthImageToPointCloud::Convert(info, X_PCs_[i], depth, color,
+                                      std::nullopt, &expected.back());
+    }
+
+    const auto& cloud =
+        dut.point_cloud_output_port().Eval<PointCloud>(*context);
+    ASSERT_EQ(cloud.size(), 48 + 20 + 36);
+    for (int i = 0; i < 3; ++i) {
+      const int offset = dut.point_offset(i);
+      const int size = expected[i].size();
+      EXPECT_TRUE(CompareMatrices(cloud.xyzs().middleCols(offset, size),
+                                  expected[i].xyzs(), 1e-6));
+      EXPECT_TRUE(CompareMatrices(cloud.normals().middleCols(offset, size),
+                                  expected[i].normals(), 1e-5));
+      if (i < 2) {
+        EXPECT_EQ(cloud.rgbs().middleCols(offset, size), expected[i].rgbs());
+      } else {
+        EXPECT_TRUE((cloud.rgbs().middleCols(offset, size).array() ==
+                     PointCloud::kDefaultColor)
+                        .all());
+      }
+    }
+    EXPECT_EQ(dut.point_offset(3), cloud.size());
+  }
+}
+
+TEST_F(PointCloudFusionTest, Depth16U) {
+  const PointCloudFusion dut({camera_infos_[1]}, PixelType::kDepth16U, 0.001);
+  auto context = dut.CreateDefaultContext();
+  ImageDepth16U depth(5, 4, 1500);
+  dut.depth_image_input_port(0).FixValue(context.get(), depth);
+  const auto& cloud =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  ASSERT_EQ(cloud.size(), 20);
+  for (int i = 0; i < cloud.size(); ++i) {
+    EXPECT_NEAR(cloud.xyz(i).z(), 1.5, 1e-6);
+  }
+}
+
+TEST_F(PointCloudFusionTest, VoxelizedDownSample) {
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  const double voxel_size = 0.05;
+  auto fix_inputs = [this](const PointCloudFusion& system,
+                           systems::Context<double>* context) {
+    for (int i = 0; i < 3; ++i) {
+      const CameraInfo& info = camera_infos_[i];
+      system.depth_image_input_port(i).FixValue(
+          context, MakeDepthImage(info.width(), info.height()));
+      system.color_image_input_port(i).FixValue(
+          context, MakeColorImage(info.width(), info.height()));
+      system.camera_pose_input_port(i).FixValue(context, X_PCs_[i]);
+    }
+  };
+  const PointCloudFusion dut(camera_infos_, PixelType::kDepth32F, 1.0, fields,
+                             voxel_size, 2);
+  auto context = dut.CreateDefaultContext();
+  fix_inputs(dut, context.get());
+
+  // Compare to the downsampling of the fused cloud.
+  const PointCloudFusion fusion(camera_infos_, PixelType::kDepth32F, 1.0,
+                                fields);
+  auto fusion_context = fusion.CreateDefaultContext();
+  fix_inputs(fusion, fusion_context.get());
+  const PointCloud expected =
+      fusion.point_cloud_output_port()
+          .Eval<PointCloud>(*fusion_context)
+          .VoxelizedDownSample(voxel_size);
+
+  const auto& cloud =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  EXPECT_GT(cloud.size(), 0);
+  EXPECT_EQ(cloud.size(), expected.size());
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), expected.xyzs()));
+  EXPECT_EQ(cloud.rgbs(), expected.rgbs());
+  EXPECT_TRUE(cloud.xyzs().allFinite());
+}
+
+TEST_F(PointCloudFusionTest, BadArguments) {
+  DRAKE_EXPECT_THROWS_MESSAGE(PointCloudFusion({}), std::exception,
+                              ".*camera_infos_.empty.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PointCloudFusion(camera_infos_, PixelType::kRgba8U), std::exception,
+      ".*depth_pixel_type.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PointCloudFusion(camera_infos_, PixelType::kDepth32F, 1.0,
+                       pc_flags::kRGBs),
+      std::exception, ".*kXYZs.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PointCloudFusion(camera_infos_, PixelType::kDepth32F, 1.0,
+                       pc_flags::kXYZs, 0.0),
+      std::exception, ".*voxel_size_.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PointCloudFusion(camera_infos_, PixelType::kDepth32F, 1.0,
+                       pc_flags::kXYZs, std::nullopt, 0),
+      std::exception, ".*num_threads > 0.*");
+
+  // An image whose size differs from its camera info.
+  const PointCloudFusion dut({camera_infos_[0]});
+  auto context = dut.CreateDefaultContext();
+  dut.depth_image_input_port(0).FixValue(context.get(), ImageDepth32F(4, 4));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.point_cloud_output_port().Eval<PointCloud>(*context),
+      std::exception, ".*4x4 image of camera 0.*8x6.*");
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
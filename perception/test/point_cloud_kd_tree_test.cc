@@ -0,0 +1,142 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3Xf;
+using Eigen::Vector3f;
+using std::vector;
+
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Returns the (squared distance, index) of the finite points sorted by
+// distance to `query`.
+vector<std::pair<float, int>> SortByDistance(const Matrix3Xf& xyzs,
+                                             const Vector3f& query) {
+  vector<std::pair<float, int>> sorted;
+  for (int i = 0; i < xyzs.cols(); ++i) {
+    if (xyzs.col(i).allFinite()) {
+      sorted.emplace_back((xyzs.col(i) - query).squaredNorm(), i);
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+// Returns random points in the unit cube, with a few NaN points.
+Matrix3Xf MakePoints(int num_points) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(0, 1);
+  Matrix3Xf xyzs(3, num_points);
+  for (int i = 0; i < num_points; ++i) {
+    xyzs.col(i) = Vector3f(uniform(generator), uniform(generator),
+                           uniform(generator));
+  }
+  for (int i = 0; i < num_points; i += 97) {
+    xyzs(1, i) = kNaN;
+  }
+  return xyzs;
+}
+
+// Compares the queries to brute force search, for trees built with one and
+// several threads.
+GTEST_TEST(PointCloudKdTreeTest, MatchesBruteForce) {
+  const Matrix3Xf xyzs = MakePoints(5000);
+  const int num_finite = 5000 - (5000 + 96) / 97;
+  const vector<Vector3f> queries{Vector3f(0.5, 0.5, 0.5), Vector3f(0, 0, 0),
+                                 Vector3f(0.9, 0.1, 0.3),
+                                 Vector3f(2, -1, 0.5)};
+  for (int num_threads : {1, 3}) {
+    const PointCloudKdTree tree(xyzs, num_threads);
+    EXPECT_EQ(tree.num_points(), num_finite);
+    vector<int> indices;
+    vector<float> squared_distances;
+    for (const Vector3f& query : queries) {
+      const auto expected = SortByDistance(xyzs, query);
+
+      tree.FindNearest(query, 10, &indices, &squared_distances);
+      ASSERT_EQ(indices.size(), 10);
+      ASSERT_EQ(squared_distances.size(), 10);
+      for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(indices[i], expected[i].second);
+        EXPECT_EQ(squared_distances[i], expected[i].first);
+      }
+
+      // Only the five nearest points are within `max_distance`.
+      const float max_distance =
+          0.5 * (std::sqrt(expected[4].first) + std::sqrt(expected[5].first));
+      tree.FindNearest(query, 10, &indices, nullptr, max_distance);
+      EXPECT_EQ(indices.size(), 5);
+
+      const float radius = 0.1;
+      tree.FindWithinRadius(query, radius, &indices, &squared_distances);
+      const int num_within = std::count_if(
+          expected.begin(), expected.end(), [radius](const auto& entry) {
+            return entry.first <= radius * radius;
+          });
+      ASSERT_EQ(indices.size(), num_within);
+      for (int i = 0; i < num_within; ++i) {
+        EXPECT_EQ(indices[i], expected[i].second);
+        EXPECT_EQ(squared_distances[i], expected[i].first);
+      }
+    }
+
+    // Asking for more points than there are returns all of them.
+    tree.FindNearest(queries[0], 2 * num_finite, &indices);
+    EXPECT_EQ(indices.size(), num_finite);
+    tree.FindNearest(queries[0], 0, &indices);
+    EXPECT_TRUE(indices.empty());
+  }
+}
+
+GTEST_TEST(PointCloudKdTreeTest, Empty) {
+  const PointCloudKdTree tree(Matrix3Xf::Constant(3, 4, kNaN));
+  EXPECT_EQ(tree.num_points(), 0);
+  vector<int> indices{1, 2};
+  tree.FindNearest(Vector3f::Zero(), 3, &indices);
+  EXPECT_TRUE(indices.empty());
+  indices = {1, 2};
+  tree.FindWithinRadius(Vector3f::Zero(), 1, &indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+// Many coincident points must not break the splits.
+GTEST_TEST(PointCloudKdTreeTest, CoincidentPoints) {
+  Matrix3Xf xyzs = Matrix3Xf::Zero(3, 100);
+  xyzs.col(42) = Vector3f(1, 0, 0);
+  const PointCloudKdTree tree(xyzs, 2);
+  vector<int> indices;
+  tree.FindNearest(Vector3f(2, 0, 0), 1, &indices);
+  EXPECT_EQ(indices, vector<int>{42});
+  tree.FindWithinRadius(Vector3f::Zero(), 0.5, &indices);
+  EXPECT_EQ(indices.size(), 99);
+}
+
+GTEST_TEST(PointCloudKdTreeTest, BadArguments) {
+  const Matrix3Xf xyzs = MakePoints(10);
+  DRAKE_EXPECT_THROWS_MESSAGE(PointCloudKdTree(xyzs, 0), std::exception,
+                              ".*num_threads > 0.*");
+  const PointCloudKdTree tree(xyzs);
+  vector<int> indices;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      tree.FindNearest(Vector3f::Zero(), -1, &indices), std::exception,
+      ".*k >= 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(tree.FindNearest(Vector3f::Zero(), 1, nullptr),
+                              std::exception, ".*indices != nullptr.*");
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
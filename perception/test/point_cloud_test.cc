@@ -1,5 +1,6 @@
 #include "drake/perception/point_cloud.h"
 
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 
@@ -7,6 +8,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 
 using Eigen::Matrix3Xf;
 using Eigen::Matrix4Xf;
@@ -257,6 +259,153 @@ GTEST_TEST(PointCloudTest, Fields) {
   }
 }
 
+// Returns a cloud with all of the fields, whose i'th point has the XYZ
+// (i, 0, 0), and whose other fields are also set from i.
+PointCloud MakeLineCloud(int size) {
+  PointCloud cloud(size, pc_flags::kXYZs | pc_flags::kNormals |
+                             pc_flags::kRGBs | pc_flags::kDescriptorCurvature);
+  for (int i = 0; i < size; ++i) {
+    cloud.mutable_xyz(i) = Eigen::Vector3f(i, 0, 0);
+    cloud.mutable_normal(i) = Eigen::Vector3f(0, 0, 1);
+    cloud.mutable_rgb(i) = Vector3<uint8_t>(i, 2 * i, 3 * i);
+    cloud.mutable_descriptor(i)(0) = -i;
+  }
+  return cloud;
+}
+
+GTEST_TEST(PointCloudTest, Crop) {
+  const int size = 10000;
+  PointCloud cloud = MakeLineCloud(size);
+  cloud.mutable_xyz(5) = Eigen::Vector3f::Constant(PointCloud::kDefaultValue);
+  for (int num_threads : {1, 3}) {
+    const PointCloud cropped = cloud.Crop(
+        Eigen::Vector3f(2, -1, -1), Eigen::Vector3f(5000, 1, 1), num_threads);
+    EXPECT_EQ(cropped.fields(), cloud.fields());
+    // The points 2 to 5000, except the invalid point 5.
+    ASSERT_EQ(cropped.size(), 4998);
+    EXPECT_EQ(cropped.xyz(3), Eigen::Vector3f(6, 0, 0));
+    EXPECT_EQ(cropped.rgb(3), cloud.rgb(6));
+    EXPECT_EQ(cropped.normal(3), cloud.normal(6));
+    EXPECT_EQ(cropped.descriptor(3), cloud.descriptor(6));
+    EXPECT_EQ(cropped.xyz(4997), Eigen::Vector3f(5000, 0, 0));
+
+    // A box whose frame B is rotated 90 degrees about z, and displaced to
+    // x = 100, in the cloud's frame C: the line lies along B's -y axis.
+    const math::RigidTransformd X_CB(
+        math::RotationMatrixd::MakeZRotation(M_PI / 2),
+        Eigen::Vector3d(100, 0, 0));
+    const PointCloud oriented = cloud.Crop(
+        X_CB, Eigen::Vector3f(-0.5, -10.5, -0.5),
+        Eigen::Vector3f(0.5, 20.5, 0.5), num_threads);
+    ASSERT_EQ(oriented.size(), 31);
+    EXPECT_EQ(oriented.xyz(0), Eigen::Vector3f(80, 0, 0));
+    EXPECT_EQ(oriented.xyz(30), Eigen::Vector3f(110, 0, 0));
+  }
+}
+
+GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
+  // Points on a line with a spacing of 1, in voxels of size 4. The points in
+  // the voxel [8, 12) are given in reverse order.
+  const int size = 16;
+  PointCloud cloud = MakeLineCloud(size);
+  for (int i = 8; i < 12; ++i) {
+    cloud.mutable_xyz(i) = Eigen::Vector3f(19 - i, 0, 0);
+  }
+  cloud.mutable_xyz(15) = Eigen::Vector3f::Constant(PointCloud::kDefaultValue);
+  cloud.mutable_normal(0) = Eigen::Vector3f(0, 1, 0);
+  for (int num_threads : {1, 2}) {
+    const PointCloud down = cloud.VoxelizedDownSample(4, num_threads);
+    EXPECT_EQ(down.fields(), cloud.fields());
+    ASSERT_EQ(down.size(), 4);
+    EXPECT_EQ(down.xyz(0), Eigen::Vector3f(1.5, 0, 0));
+    EXPECT_EQ(down.xyz(1), Eigen::Vector3f(5.5, 0, 0));
+    EXPECT_EQ(down.xyz(2), Eigen::Vector3f(9.5, 0, 0));
+    // The last voxel has no point 15.
+    EXPECT_EQ(down.xyz(3), Eigen::Vector3f(13, 0, 0));
+    EXPECT_EQ(down.rgb(1), Vector3<uint8_t>(6, 11, 17));
+    EXPECT_EQ(down.descriptor(1)(0), -5.5);
+    EXPECT_TRUE(CompareMatrices(down.normal(0),
+                                Eigen::Vector3f(0, 1, 3).normalized(), 1e-6));
+    EXPECT_EQ(down.normal(1), Eigen::Vector3f(0, 0, 1));
+  }
+
+  // Points on both sides of the origin are in distinct voxels.
+  PointCloud signed_cloud(2);
+  signed_cloud.mutable_xyz(0) = Eigen::Vector3f(-0.1, 0, 0);
+  signed_cloud.mutable_xyz(1) = Eigen::Vector3f(0.1, 0, 0);
+  EXPECT_EQ(signed_cloud.VoxelizedDownSample(1).size(), 2);
+  EXPECT_EQ(signed_cloud.VoxelizedDownSample(1).xyz(0),
+            Eigen::Vector3f(-0.1, 0, 0));
+}
+
+// Compares the downsampling of a large random cloud with several threads to
+// the single-threaded result.
+GTEST_TEST(PointCloudTest, VoxelizedDownSampleThreads) {
+  PointCloud cloud(100000);
+  cloud.mutable_xyzs() = Eigen::Matrix3Xf::Random(3, cloud.size());
+  const PointCloud expected = cloud.VoxelizedDownSample(0.05);
+  const PointCloud down = cloud.VoxelizedDownSample(0.05, 4);
+  EXPECT_GT(down.size(), 10000);
+  EXPECT_TRUE(CompareMatrices(down.xyzs(), expected.xyzs()));
+
+  // The internal variant reuses a caller's pool and output, repeatedly.
+  drake::internal::WorkerPool pool(4);
+  PointCloud output(3);
+  for (int i = 0; i < 2; ++i) {
+    internal::VoxelizedDownSample(cloud, 0.05, &pool, &output);
+    EXPECT_TRUE(CompareMatrices(output.xyzs(), expected.xyzs()));
+  }
+  internal::VoxelizedDownSample(cloud, 0.05, nullptr, &output);
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), expected.xyzs()));
+}
+
+GTEST_TEST(PointCloudTest, EstimateNormals) {
+  // A grid on the plane z = 1 - x, with an invalid and an isolated point.
+  const int n = 50;
+  PointCloud cloud(n * n + 2, pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const float x = 0.01 * i;
+      cloud.mutable_xyz(i * n + j) = Eigen::Vector3f(x, 0.01 * j, 1 - x);
+    }
+  }
+  cloud.mutable_xyz(n * n) = Eigen::Vector3f(
+      PointCloud::kDefaultValue, 0, 0);
+  cloud.mutable_xyz(n * n + 1) = Eigen::Vector3f(10, 10, 10);
+
+  const Eigen::Vector3f expected = -Eigen::Vector3f(1, 0, 1).normalized();
+  for (int num_threads : {1, 3}) {
+    cloud.mutable_normals().setZero();
+    // The isolated point has no neighbors.
+    EXPECT_FALSE(cloud.EstimateNormals(0.05, 10, num_threads));
+    for (int i = 0; i < n * n; ++i) {
+      ASSERT_TRUE(CompareMatrices(cloud.normal(i), expected, 1e-4));
+    }
+    EXPECT_TRUE(cloud.normal(n * n).array().isNaN().all());
+    EXPECT_TRUE(cloud.normal(n * n + 1).array().isNaN().all());
+  }
+
+  cloud.resize(n * n);
+  EXPECT_TRUE(cloud.EstimateNormals(0.05, 10));
+}
+
+GTEST_TEST(PointCloudTest, SpatialOperationErrors) {
+  PointCloud cloud(10);
+  const Eigen::Vector3f zero = Eigen::Vector3f::Zero();
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.Crop(zero, zero, 0), std::exception,
+                              ".*num_threads > 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.VoxelizedDownSample(0), std::exception,
+                              ".*voxel_size > 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.EstimateNormals(1, 5), std::exception,
+                              ".*has_normals\\(\\).*");
+  PointCloud with_normals(10, pc_flags::kXYZs | pc_flags::kNormals);
+  DRAKE_EXPECT_THROWS_MESSAGE(with_normals.EstimateNormals(1, 2),
+                              std::exception, ".*num_closest >= 3.*");
+  PointCloud no_xyzs(10, pc_flags::kRGBs);
+  DRAKE_EXPECT_THROWS_MESSAGE(no_xyzs.VoxelizedDownSample(1), std::exception,
+                              ".*has_xyzs\\(\\).*");
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
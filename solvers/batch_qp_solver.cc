@@ -0,0 +1,422 @@
+#include "drake/solvers/batch_qp_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Cholesky>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+// The buffers of the dual active-set method, sized for one problem. The
+// active set holds at most num_vars constraints, plus the one being added.
+struct BatchQpWorkspace {
+  BatchQpWorkspace(int num_vars, int num_inequality_constraints)
+      : L(num_vars, num_vars),
+        J(num_vars, num_vars),
+        R(num_vars, num_vars),
+        z(num_vars),
+        d(num_vars),
+        r(num_vars + 1),
+        x_old(num_vars),
+        u(num_vars + 1),
+        u_old(num_vars + 1),
+        active(num_vars + 1),
+        active_old(num_vars + 1),
+        s(num_inequality_constraints),
+        is_candidate(num_inequality_constraints),
+        is_excluded(num_inequality_constraints) {}
+
+  // The Cholesky factor of Q = LLᵀ.
+  Eigen::MatrixXd L;
+  // J = L⁻ᵀQ₁ and R, where Q₁R is the QR factorization of L⁻¹N and the
+  // columns of N are the normals of the active constraints.
+  Eigen::MatrixXd J;
+  Eigen::MatrixXd R;
+  // The primal step direction.
+  Eigen::VectorXd z;
+  // d = Jᵀn⁺, where n⁺ is the normal of the constraint being added.
+  Eigen::VectorXd d;
+  // The negative dual step direction.
+  Eigen::VectorXd r;
+  Eigen::VectorXd x_old;
+  // The multipliers of the active constraints.
+  Eigen::VectorXd u;
+  Eigen::VectorXd u_old;
+  // The indices of the active constraints; equality constraint i is stored
+  // as -i - 1.
+  Eigen::VectorXi active;
+  Eigen::VectorXi active_old;
+  // The slacks of the inequality constraints.
+  Eigen::VectorXd s;
+  // Whether each inequality constraint is inactive, hence may be added.
+  std::vector<bool> is_candidate;
+  // Whether each inequality constraint is excluded for being linearly
+  // dependent on the active ones.
+  std::vector<bool> is_excluded;
+};
+}  // namespace internal
+
+namespace {
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using internal::BatchQpWorkspace;
+// A row of a column-major matrix.
+using RowRef = Eigen::Ref<const Eigen::RowVectorXd, 0, Eigen::InnerStride<>>;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// Computes the Givens rotation [c s; s -c] that maps (a, b) to (h, 0) with
+// h ≥ 0, and returns false if (a, b) = 0.
+bool MakeGivensRotation(double a, double b, double* h, double* cc,
+                        double* ss) {
+  *h = std::hypot(a, b);
+  if (*h == 0) {
+    return false;
+  }
+  *cc = a / *h;
+  *ss = b / *h;
+  return true;
+}
+
+// Applies the Givens rotation [c s; s -c] to the columns i and j of M.
+template <typename Derived>
+void RotateColumns(double cc, double ss, int i, int j,
+                   Eigen::MatrixBase<Derived>* M) {
+  for (int k = 0; k < M->rows(); ++k) {
+    const double t1 = (*M)(k, i);
+    const double t2 = (*M)(k, j);
+    (*M)(k, i) = cc * t1 + ss * t2;
+    (*M)(k, j) = ss * t1 - cc * t2;
+  }
+}
+
+// Applies the Givens rotation [c s; s -c] to the rows i and j of the columns
+// [begin, end) of M.
+void RotateRows(double cc, double ss, int i, int j, int begin, int end,
+                MatrixXd* M) {
+  for (int k = begin; k < end; ++k) {
+    const double t1 = (*M)(i, k);
+    const double t2 = (*M)(j, k);
+    (*M)(i, k) = cc * t1 + ss * t2;
+    (*M)(j, k) = ss * t1 - cc * t2;
+  }
+}
+
+// Adds the constraint with d = Jᵀn⁺ to the factorization of the num_active
+// active constraints, and increments num_active. Returns false if n⁺ is
+// linearly dependent on the active constraints.
+bool AddToFactorization(int* num_active, double* R_norm,
+                        BatchQpWorkspace* ws) {
+  const int n = ws->d.size();
+  const int q = *num_active;
+  // Rotates J such that d = Jᵀn⁺ has zeros below entry q.
+  for (int j = n - 1; j > q; --j) {
+    double h, cc, ss;
+    if (!MakeGivensRotation(ws->d(j - 1), ws->d(j), &h, &cc, &ss)) {
+      continue;
+    }
+    ws->d(j - 1) = h;
+    ws->d(j) = 0;
+    RotateColumns(cc, ss, j - 1, j, &ws->J);
+  }
+  ws->R.col(q).head(q + 1) = ws->d.head(q + 1);
+  *num_active = q + 1;
+  if (std::abs(ws->d(q)) <= kEps * (*R_norm)) {
+    return false;
+  }
+  *R_norm = std::max(*R_norm, std::abs(ws->d(q)));
+  return true;
+}
+
+// Computes d = Jᵀn⁺, z = J₂d₂ and r = R⁻¹d₁ for the normal n⁺ = sign * a,
+// where J = [J₁ J₂] and d = [d₁; d₂] are split after the num_active active
+// constraints. Returns zᵀn⁺.
+double ComputeStepDirections(const RowRef& a, double sign, int num_active,
+                             BatchQpWorkspace* ws) {
+  const int n = ws->d.size();
+  const int q = num_active;
+  ws->d.noalias() = ws->J.transpose() * a.transpose();
+  if (sign < 0) {
+    ws->d = -ws->d;
+  }
+  ws->z.noalias() = ws->J.rightCols(n - q) * ws->d.tail(n - q);
+  for (int i = q - 1; i >= 0; --i) {
+    double sum = ws->d(i);
+    for (int j = i + 1; j < q; ++j) {
+      sum -= ws->R(i, j) * ws->r(j);
+    }
+    ws->r(i) = sum / ws->R(i, i);
+  }
+  return sign * ws->z.dot(a.transpose());
+}
+
+// Removes the active constraint `constraint` from the factorization, and
+// decrements num_active. The pending constraint at index num_active is
+// shifted down along with the others.
+void RemoveFromFactorization(int constraint, int num_equality_constraints,
+                             int* num_active, BatchQpWorkspace* ws) {
+  const int q = *num_active;
+  int position = num_equality_constraints;
+  while (ws->active(position) != constraint) {
+    ++position;
+    DRAKE_DEMAND(position < q);
+  }
+  for (int i = position; i < q; ++i) {
+    ws->active(i) = ws->active(i + 1);
+    ws->u(i) = ws->u(i + 1);
+    if (i + 1 < q) {
+      ws->R.col(i) = ws->R.col(i + 1);
+    }
+  }
+  ws->active(q) = 0;
+  ws->u(q) = 0;
+  ws->R.col(q - 1).head(q).setZero();
+  *num_active = q - 1;
+  // The shift leaves R upper Hessenberg; rotates it back to upper triangular.
+  for (int j = position; j < q - 1; ++j) {
+    double h, cc, ss;
+    if (!MakeGivensRotation(ws->R(j, j), ws->R(j + 1, j), &h, &cc, &ss)) {
+      continue;
+    }
+    ws->R(j, j) = h;
+    ws->R(j + 1, j) = 0;
+    RotateRows(cc, ss, j, j + 1, j + 1, q - 1, &ws->R);
+    RotateColumns(cc, ss, j, j + 1, &ws->J);
+  }
+}
+
+BatchQpStatus SolveOne(const Eigen::Ref<const MatrixXd>& Q,
+                       const Eigen::Ref<const VectorXd>& c,
+                       const Eigen::Ref<const MatrixXd>& A_eq,
+                       const Eigen::Ref<const VectorXd>& b_eq,
+                       const Eigen::Ref<const MatrixXd>& A_in,
+                       const Eigen::Ref<const VectorXd>& b_in,
+                       int max_iterations, BatchQpWorkspace* ws,
+                       Eigen::Ref<VectorXd> x) {
+  const int num_eq = A_eq.rows();
+  const int num_in = A_in.rows();
+
+  ws->L.triangularView<Eigen::Lower>() = Q;
+  Eigen::LLT<Eigen::Ref<MatrixXd>> llt(ws->L);
+  if (llt.info() != Eigen::Success) {
+    return BatchQpStatus::kFailedToFactorize;
+  }
+  // J = L⁻ᵀ, and the unconstrained minimizer is x = -Q⁻¹c = -JJᵀc.
+  ws->J.setIdentity();
+  llt.matrixU().solveInPlace(ws->J);
+  ws->d.noalias() = ws->J.transpose() * c;
+  x.noalias() = ws->J * ws->d;
+  x = -x;
+  // Slacks above -tolerance are not violated, such that round-off does not
+  // re-add duplicated constraints.
+  const double tolerance = 100 * kEps * Q.trace() * ws->J.trace();
+  ws->R.setZero();
+  double R_norm = 1;
+  int q = 0;
+
+  // Adds the equality constraints one at a time, each with a full step.
+  for (int i = 0; i < num_eq; ++i) {
+    const double z_dot_normal = ComputeStepDirections(A_eq.row(i), 1, q, ws);
+    double t = 0;
+    if (ws->z.squaredNorm() > kEps) {
+      t = (b_eq(i) - A_eq.row(i).dot(x)) / z_dot_normal;
+    }
+    x += t * ws->z;
+    ws->u(q) = t;
+    ws->u.head(q) -= t * ws->r.head(q);
+    ws->active(q) = -i - 1;
+    if (!AddToFactorization(&q, &R_norm, ws)) {
+      return BatchQpStatus::kInfeasible;
+    }
+  }
+
+  // The inequality constraints are nᵢᵀx ≥ bᵢ with the normals
+  // nᵢ = -A_in.row(i)ᵀ and bᵢ = -b_in(i), hence the slacks
+  // sᵢ = b_in(i) - A_in.row(i) x.
+  std::fill(ws->is_candidate.begin(), ws->is_candidate.end(), true);
+  int iteration = 0;
+  while (true) {
+    // Step 1: stops if no constraint is violated.
+    for (int i = num_eq; i < q; ++i) {
+      ws->is_candidate[ws->active(i)] = false;
+    }
+    bool is_violated = false;
+    for (int i = 0; i < num_in; ++i) {
+      ws->is_excluded[i] = false;
+      ws->s(i) = b_in(i) - A_in.row(i).dot(x);
+      is_violated = is_violated || ws->s(i) < -tolerance;
+    }
+    if (!is_violated) {
+      return BatchQpStatus::kSolutionFound;
+    }
+    ws->u_old.head(q) = ws->u.head(q);
+    ws->active_old.head(q) = ws->active.head(q);
+    ws->x_old = x;
+
+    bool is_added = false;
+    while (!is_added) {
+      // Step 2: picks the most violated constraint which may be added.
+      int added = -1;
+      double min_slack = -tolerance;
+      for (int i = 0; i < num_in; ++i) {
+        if (ws->s(i) < min_slack && ws->is_candidate[i] &&
+            !ws->is_excluded[i]) {
+          min_slack = ws->s(i);
+          added = i;
+        }
+      }
+      if (added < 0) {
+        return BatchQpStatus::kSolutionFound;
+      }
+      ws->u(q) = 0;
+      ws->active(q) = added;
+
+      // Steps 2(a)-2(c), repeated while blocking constraints are dropped.
+      while (true) {
+        if (++iteration > max_iterations) {
+          return BatchQpStatus::kIterationLimit;
+        }
+        const double z_dot_normal =
+            ComputeStepDirections(A_in.row(added), -1, q, ws);
+        // The largest dual step which keeps the multipliers non-negative.
+        double t1 = kInf;
+        int blocking = -1;
+        for (int k = num_eq; k < q; ++k) {
+          if (ws->r(k) > 0 && ws->u(k) / ws->r(k) < t1) {
+            t1 = ws->u(k) / ws->r(k);
+            blocking = ws->active(k);
+          }
+        }
+        // The primal step which satisfies the added constraint.
+        double t2 = kInf;
+        if (ws->z.squaredNorm() > kEps) {
+          t2 = -ws->s(added) / z_dot_normal;
+        }
+        const double t = std::min(t1, t2);
+        if (t >= kInf) {
+          return BatchQpStatus::kInfeasible;
+        }
+        ws->u.head(q) -= t * ws->r.head(q);
+        ws->u(q) += t;
+        if (t2 >= kInf) {
+          // A step in the dual space only.
+          ws->is_candidate[blocking] = true;
+          RemoveFromFactorization(blocking, num_eq, &q, ws);
+          continue;
+        }
+        x += t * ws->z;
+        if (t == t2) {
+          // A full step, after which the added constraint is active.
+          if (AddToFactorization(&q, &R_norm, ws)) {
+            ws->is_candidate[added] = false;
+            is_added = true;
+            break;
+          }
+          // The added constraint is linearly dependent on the active ones;
+          // excludes it and restores the previous iterate.
+          ws->is_excluded[added] = true;
+          RemoveFromFactorization(added, num_eq, &q, ws);
+          std::fill(ws->is_candidate.begin(), ws->is_candidate.end(), true);
+          for (int i = num_eq; i < q; ++i) {
+            ws->active(i) = ws->active_old(i);
+            ws->u(i) = ws->u_old(i);
+            ws->is_candidate[ws->active(i)] = false;
+          }
+          x = ws->x_old;
+          break;
+        }
+        // A partial step, after which the blocking constraint is dropped.
+        ws->is_candidate[blocking] = true;
+        RemoveFromFactorization(blocking, num_eq, &q, ws);
+        ws->s(added) = b_in(added) - A_in.row(added).dot(x);
+      }
+    }
+  }
+}
+}  // namespace
+
+BatchQpSolver::BatchQpSolver(int num_vars, int num_equality_constraints,
+                             int num_inequality_constraints, int max_threads)
+    : num_vars_(num_vars),
+      num_equality_constraints_(num_equality_constraints),
+      num_inequality_constraints_(num_inequality_constraints),
+      max_iterations_(10 * (num_vars + num_equality_constraints +
+                             num_inequality_constraints)) {
+  DRAKE_THROW_UNLESS(num_vars > 0);
+  DRAKE_THROW_UNLESS(num_equality_constraints >= 0);
+  // The factorization holds at most num_vars active constraints.
+  DRAKE_THROW_UNLESS(num_equality_constraints <= num_vars);
+  DRAKE_THROW_UNLESS(num_inequality_constraints >= 0);
+  DRAKE_THROW_UNLESS(max_threads > 0);
+  for (int i = 0; i < max_threads; ++i) {
+    workspaces_.push_back(std::make_unique<internal::BatchQpWorkspace>(
+        num_vars, num_inequality_constraints));
+  }
+  pool_ = std::make_unique<drake::internal::WorkerPool>(max_threads);
+}
+
+BatchQpSolver::~BatchQpSolver() = default;
+
+void BatchQpSolver::set_max_iterations(int max_iterations) {
+  DRAKE_THROW_UNLESS(max_iterations > 0);
+  max_iterations_ = max_iterations;
+}
+
+void BatchQpSolver::Solve(const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                          const Eigen::Ref<const Eigen::MatrixXd>& c,
+                          const Eigen::Ref<const Eigen::MatrixXd>& A_eq,
+                          const Eigen::Ref<const Eigen::MatrixXd>& b_eq,
+                          const Eigen::Ref<const Eigen::MatrixXd>& A_in,
+                          const Eigen::Ref<const Eigen::MatrixXd>& b_in,
+                          Eigen::MatrixXd* x,
+                          std::vector<BatchQpStatus>* status) {
+  DRAKE_THROW_UNLESS(x != nullptr);
+  DRAKE_THROW_UNLESS(status != nullptr);
+  const int n = num_vars_;
+  const int num_problems = c.cols();
+  DRAKE_THROW_UNLESS(c.rows() == n);
+  DRAKE_THROW_UNLESS(Q.rows() == n && Q.cols() == num_problems * n);
+  DRAKE_THROW_UNLESS(A_eq.rows() == num_equality_constraints_ &&
+                     A_eq.cols() == num_problems * n);
+  DRAKE_THROW_UNLESS(b_eq.rows() == num_equality_constraints_ &&
+                     b_eq.cols() == num_problems);
+  DRAKE_THROW_UNLESS(A_in.rows() == num_inequality_constraints_ &&
+                     A_in.cols() == num_problems * n);
+  DRAKE_THROW_UNLESS(b_in.rows() == num_inequality_constraints_ &&
+                     b_in.cols() == num_problems);
+  x->resize(n, num_problems);
+  status->resize(num_problems);
+
+  // Task i solves the problems [begin(i), begin(i + 1)) with workspace i.
+  const int num_threads = std::min(max_threads(), num_problems);
+  auto begin = [num_problems, num_threads](int i) {
+    return static_cast<int>(static_cast<int64_t>(num_problems) * i /
+                            num_threads);
+  };
+  auto solve_range = [&](int task) {
+    for (int k = begin(task); k < begin(task + 1); ++k) {
+      (*status)[k] =
+          SolveOne(Q.middleCols(k * n, n), c.col(k), A_eq.middleCols(k * n, n),
+                   b_eq.col(k), A_in.middleCols(k * n, n), b_in.col(k),
+                   max_iterations_, workspaces_[task].get(), x->col(k));
+    }
+  };
+  if (num_threads <= 1) {
+    if (num_problems > 0) {
+      solve_range(0);
+    }
+    return;
+  }
+  pool_->ParallelFor(num_threads, solve_range);
+}
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/worker_pool.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+struct BatchQpWorkspace;
+}  // namespace internal
+
+/** The outcome of each problem solved by BatchQpSolver. */
+enum class BatchQpStatus {
+  /** The optimal solution was found. */
+  kSolutionFound,
+  /** The constraints are infeasible, or the equality constraints are linearly
+   * dependent. */
+  kInfeasible,
+  /** The Cholesky factorization of Q failed, namely Q is not positive
+   * definite. */
+  kFailedToFactorize,
+  /** The active-set iterations did not converge within max_iterations(). */
+  kIterationLimit,
+};
+
+/**
+ * Solves a batch of small dense strictly convex quadratic programs (QPs) of
+ * the same dimensions,
+ *
+ *     min ½xᵀQx + cᵀx
+ *     s.t. A_eq x = b_eq
+ *          A_in x ≤ b_in
+ *
+ * where Q is positive definite. This is meant for the many tiny QPs (up to a
+ * few dozen variables) solved at each tick by per-body controllers or
+ * contact-implicit planners, for which building a MathematicalProgram and
+ * setting up a general purpose solver for each problem costs much more than
+ * the solve itself.
+ *
+ * Each problem is solved with the dual active-set method of
+ *
+ * Goldfarb and Idnani, "A numerically stable dual method for solving strictly
+ * convex quadratic programs", Mathematical Programming, 1983,
+ *
+ * which starts from the unconstrained minimizer and needs no feasible initial
+ * guess. The workspace is allocated once by the constructor, so Solve() does
+ * no heap allocation per problem. When max_threads > 1, the problems are
+ * split over the threads of a pool which is also created by the constructor,
+ * each with its own workspace.
+ *
+ * The problem data is passed as structure of arrays: the data of all the
+ * problems is stacked side by side in one matrix per term, in which problem k
+ * owns the k'th block of columns.
+ */
+class BatchQpSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchQpSolver)
+
+  /**
+   * @param num_vars The number of decision variables of each problem.
+   * @param num_equality_constraints The number of rows of A_eq.
+   * @param num_inequality_constraints The number of rows of A_in.
+   * @param max_threads The maximal number of threads used by Solve(),
+   * including the calling thread.
+   * @throws std::exception if num_vars is not positive, if the number of
+   * constraints is negative, if there are more equality constraints than
+   * variables, or if max_threads is not positive.
+   */
+  BatchQpSolver(int num_vars, int num_equality_constraints,
+                int num_inequality_constraints, int max_threads = 1);
+
+  ~BatchQpSolver();
+
+  int num_vars() const { return num_vars_; }
+
+  int num_equality_constraints() const { return num_equality_constraints_; }
+
+  int num_inequality_constraints() const {
+    return num_inequality_constraints_;
+  }
+
+  int max_threads() const { return static_cast<int>(workspaces_.size()); }
+
+  /** The maximal number of constraints added to or removed from the active
+   * set while solving one problem. The default is 10 * (num_vars +
+   * num_equality_constraints + num_inequality_constraints). */
+  int max_iterations() const { return max_iterations_; }
+
+  void set_max_iterations(int max_iterations);
+
+  /**
+   * Solves the N problems
+   *
+   *     min ½xₖᵀQₖxₖ + cₖᵀxₖ s.t. A_eqₖ xₖ = b_eqₖ, A_inₖ xₖ ≤ b_inₖ
+   *
+   * for k = 0, ..., N - 1, where with n = num_vars(), Qₖ = Q.middleCols(k * n,
+   * n), cₖ = c.col(k), A_eqₖ = A_eq.middleCols(k * n, n), b_eqₖ = b_eq.col(k),
+   * and likewise for A_in and b_in. Only the lower triangular part of Qₖ is
+   * used.
+   * @param Q A num_vars() x (N * num_vars()) matrix.
+   * @param c A num_vars() x N matrix.
+   * @param A_eq A num_equality_constraints() x (N * num_vars()) matrix.
+   * @param b_eq A num_equality_constraints() x N matrix.
+   * @param A_in A num_inequality_constraints() x (N * num_vars()) matrix.
+   * @param b_in A num_inequality_constraints() x N matrix.
+   * @param[out] x The solutions, resized to num_vars() x N. Column k is only
+   * meaningful if (*status)[k] is BatchQpStatus::kSolutionFound.
+   * @param[out] status The status of each problem, resized to N.
+   * @throws std::exception if the sizes of the arguments are inconsistent.
+   */
+  void Solve(const Eigen::Ref<const Eigen::MatrixXd>& Q,
+             const Eigen::Ref<const Eigen::MatrixXd>& c,
+             const Eigen::Ref<const Eigen::MatrixXd>& A_eq,
+             const Eigen::Ref<const Eigen::MatrixXd>& b_eq,
+             const Eigen::Ref<const Eigen::MatrixXd>& A_in,
+             const Eigen::Ref<const Eigen::MatrixXd>& b_in,
+             Eigen::MatrixXd* x,
+             std::vector<BatchQpStatus>* status);
+
+ private:
+  int num_vars_{};
+  int num_equality_constraints_{};
+  int num_inequality_constraints_{};
+  int max_iterations_{};
+  std::vector<std::unique_ptr<internal::BatchQpWorkspace>> workspaces_;
+  // The threads which run Solve(); they sleep between the calls.
+  std::unique_ptr<drake::internal::WorkerPool> pool_;
+};
+}  // namespace solvers
+}  // namespace drake
@@ -7,8 +7,10 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/scope_exit.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/evaluator_base.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
 
@@ -91,10 +93,20 @@ void AddVectorOfConstraintsToProgram(
   }
 }
 
-SolutionResult SolveProgramWithSolver(const MathematicalProgram& prog,
-                                      const SolverId& solver_id,
-                                      MathematicalProgramResult* result) {
-  std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
+// Solves the program with a GurobiSolver which uses gurobi_license, if
+// solver_id is GurobiSolver::id() and gurobi_license is non-null.
+SolutionResult SolveProgramWithSolver(
+    const MathematicalProgram& prog, const SolverId& solver_id,
+    MathematicalProgramResult* result,
+    const std::shared_ptr<GurobiSolver::License>& gurobi_license = nullptr) {
+  std::unique_ptr<SolverInterface> solver;
+  if (solver_id == GurobiSolver::id() && gurobi_license != nullptr) {
+    auto gurobi_solver = std::make_unique<GurobiSolver>();
+    gurobi_solver->set_license(gurobi_license);
+    solver = std::move(gurobi_solver);
+  } else {
+    solver = MakeSolver(solver_id);
+  }
   DRAKE_ASSERT(solver.get());
   solver->Solve(prog, {}, {}, result);
   return result->get_solution_result();
@@ -202,11 +214,7 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   }
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
       new_prog, binary_variables_list, solver_id);
-  node->solution_result_ = SolveProgramWithSolver(
-      *node->prog_, solver_id, node->prog_result_.get());
-  if (node->solution_result_ == SolutionResult::kSolutionFound) {
-    node->CheckOptimalSolutionIsIntegral();
-  }
+  node->SolveProgram();
   return std::make_pair(std::unique_ptr<MixedIntegerBranchAndBoundNode>(node),
                         map_old_vars_to_new_vars);
 }
@@ -290,7 +298,7 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
+void MixedIntegerBranchAndBoundNode::AddChildren(
     const symbolic::Variable& binary_variable) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
@@ -300,20 +308,33 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
-      left_child_->prog_result_.get());
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
-      right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
+  // Warm-start the children from the solution of this node. The programs in
+  // the children have the same decision variables as this node.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    for (auto* child : {left_child_.get(), right_child_.get()}) {
+      child->prog_->SetInitialGuessForAllVariables(prog_result_->get_x_val());
+      child->prog_->SetInitialGuess(binary_variable,
+                                    child->fixed_binary_value_);
+    }
   }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::SolveProgram(
+    const std::shared_ptr<GurobiSolver::License>& gurobi_license) {
+  solution_result_ = SolveProgramWithSolver(*prog_, solver_id_,
+                                            prog_result_.get(), gurobi_license);
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
 }
 
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  AddChildren(binary_variable);
+  left_child_->SolveProgram();
+  right_child_->SolveProgram();
+}
+
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
     const MathematicalProgram& prog, const SolverId& solver_id)
     : root_{nullptr},
@@ -337,6 +358,20 @@ MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
 }
 
 SolutionResult MixedIntegerBranchAndBound::Solve() {
+  // The threads which solve the child nodes live until Solve() returns.
+  pool_ = std::make_unique<drake::internal::WorkerPool>(max_threads_);
+  ScopeExit guard([this]() {
+    pool_.reset();
+    gurobi_licenses_.clear();
+  });
+  // A Gurobi environment must not be used by several threads at once, hence
+  // each child in a batch gets its own.
+  if (max_threads_ > 1 && root_->solver_id() == GurobiSolver::id()) {
+    const int max_num_children = 2 * ((max_threads_ + 1) / 2);
+    for (int i = 0; i < max_num_children; ++i) {
+      gurobi_licenses_.push_back(GurobiSolver::AcquireNewLicense());
+    }
+  }
   // Call back on the root node.
   NodeCallback(*root_);
   // First check the status of the root node. If the root node is infeasible,
@@ -360,20 +395,23 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes();
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    std::vector<const symbolic::Variable*> branching_variables;
+    for (const auto* branching_node : branching_nodes) {
+      branching_variables.push_back(PickBranchingVariable(*branching_node));
+    }
+    BranchAndUpdate(branching_nodes, branching_variables);
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes();
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -393,6 +431,15 @@ void MixedIntegerBranchAndBound::NodeCallback(
   }
 }
 
+void MixedIntegerBranchAndBound::set_max_threads(int max_threads) {
+  if (max_threads < 1) {
+    throw std::runtime_error(fmt::format(
+        "set_max_threads(): max_threads should be positive, got {}.",
+        max_threads));
+  }
+  max_threads_ = max_threads;
+}
+
 double MixedIntegerBranchAndBound::GetOptimalCost() const {
   if (solutions_.empty()) {
     throw std::runtime_error(
@@ -535,6 +582,25 @@ MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
   }
 }
 
+// Appends the non-fathomed leaf nodes in the sub tree to @p leaf_nodes, from
+// the left to the right.
+void GetNonFathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaf_nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaf_nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    GetNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                     leaf_nodes);
+    GetNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                     leaf_nodes);
+  }
+}
+
 double BestLowerBoundInSubTree(
     const MixedIntegerBranchAndBound& bnb,
     const MixedIntegerBranchAndBoundNode& sub_tree_root) {
@@ -612,6 +678,50 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes() const {
+  const int batch_size = (max_threads_ + 1) / 2;
+  if (batch_size == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    MixedIntegerBranchAndBoundNode* node = PickBranchingNode();
+    if (node == nullptr) {
+      return {};
+    }
+    return {node};
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  GetNonFathomedLeafNodesInSubTree(*this, *root_, &nodes);
+  // Sort the nodes such that the first node is the one that
+  // PickBranchingNode() would pick, up to ties.
+  switch (node_selection_method_) {
+    case NodeSelectionMethod::kMinLowerBound: {
+      std::stable_sort(nodes.begin(), nodes.end(),
+                       [](const MixedIntegerBranchAndBoundNode* node1,
+                          const MixedIntegerBranchAndBoundNode* node2) {
+                         return node1->prog_result()->get_optimal_cost() <
+                                node2->prog_result()->get_optimal_cost();
+                       });
+      break;
+    }
+    case NodeSelectionMethod::kDepthFirst: {
+      std::stable_sort(nodes.begin(), nodes.end(),
+                       [](const MixedIntegerBranchAndBoundNode* node1,
+                          const MixedIntegerBranchAndBoundNode* node2) {
+                         return node1->remaining_binary_variables().size() <
+                                node2->remaining_binary_variables().size();
+                       });
+      break;
+    }
+    case NodeSelectionMethod::kUserDefined: {
+      DRAKE_UNREACHABLE();
+    }
+  }
+  if (static_cast<int>(nodes.size()) > batch_size) {
+    nodes.resize(batch_size);
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -655,7 +765,30 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
 void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
-  node->Branch(branching_variable);
+  BranchAndUpdate(std::vector<MixedIntegerBranchAndBoundNode*>{node},
+                  std::vector<const symbolic::Variable*>{&branching_variable});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+    const std::vector<const symbolic::Variable*>& branching_variables) {
+  DRAKE_DEMAND(nodes.size() == branching_variables.size());
+  std::vector<MixedIntegerBranchAndBoundNode*> children;
+  for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
+    nodes[i]->AddChildren(*branching_variables[i]);
+    children.push_back(nodes[i]->mutable_left_child());
+    children.push_back(nodes[i]->mutable_right_child());
+  }
+  // Each child solves its own program with its own solver instance (and its
+  // own Gurobi environment), so the children can be solved concurrently.
+  internal::EvaluateInParallel(
+      static_cast<int>(children.size()), pool_.get(),
+      [](int) { return true; },
+      [this, &children](int i) {
+        children[i]->SolveProgram(
+            i < static_cast<int>(gurobi_licenses_.size()) ? gurobi_licenses_[i]
+                                                          : nullptr);
+      });
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -663,7 +796,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (const auto* child : children) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
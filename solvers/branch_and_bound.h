@@ -5,7 +5,10 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "drake/common/worker_pool.h"
+#include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 
@@ -164,6 +167,10 @@ class MixedIntegerBranchAndBoundNode {
   const SolverId& solver_id() const { return solver_id_; }
 
  private:
+  // MixedIntegerBranchAndBound creates and solves the children of several
+  // nodes at once, see MixedIntegerBranchAndBound::set_max_threads().
+  friend class MixedIntegerBranchAndBound;
+
   /**
    * If the solution to a binary variable is either less than integral_tol or
    * larger than 1 - integral_tol, then we regard the solution to be binary.
@@ -192,6 +199,20 @@ class MixedIntegerBranchAndBoundNode {
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the left and right children by fixing @p binary_variable to 0 and
+  // 1 respectively, without solving their programs. If the program in this
+  // node has been solved, then the initial guess of the children is this
+  // node's solution, with binary_variable set to its fixed value.
+  void AddChildren(const symbolic::Variable& binary_variable);
+
+  // Solves the program in this node, and checks if its optimal solution is
+  // integral. Only modifies this node, so the programs of different nodes can
+  // be solved concurrently, provided that they use different Gurobi
+  // environments. If gurobi_license is null, GurobiSolver uses its shared
+  // environment.
+  void SolveProgram(
+      const std::shared_ptr<GurobiSolver::License>& gurobi_license = nullptr);
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -564,6 +585,26 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Setter for the maximal number of threads used in Solve().
+   * With more than one thread, Solve() branches on a batch of up to
+   * ceil(max_threads / 2) nodes at a time, and solves the programs of all the
+   * child nodes in the batch concurrently, each with its own solver instance.
+   * The nodes in a batch are the best ones according to the node selection
+   * method (a user-defined node selection function still picks one node at a
+   * time). The best bounds, the solutions and the user callback are updated
+   * on the calling thread after each batch, in the same order as the serial
+   * search; as a result, a node could be branched on in a batch, although an
+   * integral solution found in the same batch fathoms it. With
+   * GurobiSolver::id(), each child in a batch is solved in its own Gurobi
+   * environment (see GurobiSolver::AcquireNewLicense()).
+   * @throws std::runtime_error if max_threads is smaller than 1.
+   */
+  void set_max_threads(int max_threads);
+
+  /** Getter for the maximal number of threads used in Solve(). */
+  int max_threads() const { return max_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -583,6 +624,13 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickDepthFirstNode() const;
 
+  /**
+   * Pick the batch of nodes to branch in parallel. Returns at most one node if
+   * max_threads() is 1 or the node selection method is user defined, and an
+   * empty vector if there is no node to branch.
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes() const;
+
   /**
    * Pick the branching variable in a node.
    */
@@ -598,6 +646,16 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on several nodes, solve the optimization programs of all the child
+   * nodes concurrently, and then update the best lower and upper bounds.
+   * @param nodes. The nodes to be branched.
+   * @param branching_variables. Branch on branching_variables[i] in nodes[i].
+   */
+  void BranchAndUpdate(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+      const std::vector<const symbolic::Variable*>& branching_variables);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -682,6 +740,17 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  int max_threads_{1};
+
+  // The threads used by Solve() to solve the child nodes concurrently. Only
+  // non-null during Solve().
+  std::unique_ptr<drake::internal::WorkerPool> pool_;
+
+  // The Gurobi environments of the children solved concurrently by Solve(),
+  // one for each child in a batch. Only non-empty during Solve() with more
+  // than one thread and GurobiSolver::id().
+  std::vector<std::shared_ptr<GurobiSolver::License>> gurobi_licenses_;
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
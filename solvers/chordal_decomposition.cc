@@ -0,0 +1,108 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_set>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace solvers {
+
+std::vector<std::vector<int>> ChordalExtensionMaximalCliques(
+    int num_nodes, const std::vector<std::pair<int, int>>& edges) {
+  DRAKE_THROW_UNLESS(num_nodes >= 0);
+  // The neighbors of each node, among the nodes not yet eliminated.
+  std::vector<std::set<int>> neighbors(num_nodes);
+  for (const auto& [i, j] : edges) {
+    DRAKE_THROW_UNLESS(i >= 0 && i < num_nodes && j >= 0 && j < num_nodes);
+    if (i != j) {
+      neighbors[i].insert(j);
+      neighbors[j].insert(i);
+    }
+  }
+  // Eliminating a node v connects all its neighbors, and {v} ∪ neighbors(v)
+  // is a clique of the chordal extension. Every maximal clique of the
+  // extension is found this way.
+  std::vector<bool> is_eliminated(num_nodes, false);
+  std::vector<std::vector<int>> candidates;
+  for (int step = 0; step < num_nodes; ++step) {
+    int v = -1;
+    for (int i = 0; i < num_nodes; ++i) {
+      if (!is_eliminated[i] &&
+          (v < 0 || neighbors[i].size() < neighbors[v].size())) {
+        v = i;
+      }
+    }
+    std::vector<int> clique(neighbors[v].begin(), neighbors[v].end());
+    for (int i : clique) {
+      neighbors[i].erase(v);
+      for (int j : clique) {
+        if (i != j) {
+          neighbors[i].insert(j);
+        }
+      }
+    }
+    clique.insert(std::upper_bound(clique.begin(), clique.end(), v), v);
+    candidates.push_back(std::move(clique));
+    neighbors[v].clear();
+    is_eliminated[v] = true;
+  }
+  // Keeps the candidates which are not contained in a larger one.
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const std::vector<int>& c1, const std::vector<int>& c2) {
+                     return c1.size() > c2.size();
+                   });
+  std::vector<std::vector<int>> cliques;
+  for (const auto& candidate : candidates) {
+    const bool is_contained = std::any_of(
+        cliques.begin(), cliques.end(), [&candidate](const auto& clique) {
+          return std::includes(clique.begin(), clique.end(),
+                               candidate.begin(), candidate.end());
+        });
+    if (!is_contained) {
+      cliques.push_back(candidate);
+    }
+  }
+  return cliques;
+}
+
+std::vector<std::vector<int>> TermSparsityCliques(
+    const symbolic::Polynomial& p,
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis) {
+  const int n = monomial_basis.rows();
+  std::unordered_set<symbolic::Monomial> support;
+  for (const auto& term : p.monomial_to_coefficient_map()) {
+    support.insert(term.first);
+  }
+  for (int i = 0; i < n; ++i) {
+    support.insert(monomial_basis(i) * monomial_basis(i));
+  }
+  std::vector<std::vector<int>> cliques;
+  int num_edges = -1;
+  while (true) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < n; ++i) {
+      for (int j = i + 1; j < n; ++j) {
+        if (support.count(monomial_basis(i) * monomial_basis(j)) > 0) {
+          edges.emplace_back(i, j);
+        }
+      }
+    }
+    // The support only grows, hence so does the set of edges.
+    if (static_cast<int>(edges.size()) == num_edges) {
+      return cliques;
+    }
+    num_edges = static_cast<int>(edges.size());
+    cliques = ChordalExtensionMaximalCliques(n, edges);
+    for (const auto& clique : cliques) {
+      for (int i : clique) {
+        for (int j : clique) {
+          support.insert(monomial_basis(i) * monomial_basis(j));
+        }
+      }
+    }
+  }
+}
+}  // namespace solvers
+}  // namespace drake
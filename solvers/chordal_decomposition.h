@@ -0,0 +1,50 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace solvers {
+
+/**
+ * Computes a chordal extension of the undirected graph with the nodes 0, ...,
+ * num_nodes - 1 and the edges @p edges, and returns the maximal cliques of
+ * the extension. The extension adds the fill-in edges of the greedy minimum
+ * degree elimination ordering, which keeps the cliques small for sparse
+ * graphs. Each clique is sorted, and every node belongs to at least one
+ * clique.
+ *
+ * By Grone's theorem, a partial symmetric matrix whose specified entries form
+ * a chordal pattern has a positive semidefinite completion if and only if the
+ * principal submatrix of each maximal clique is positive semidefinite.
+ * @throws std::exception if an edge has a node outside [0, num_nodes).
+ */
+std::vector<std::vector<int>> ChordalExtensionMaximalCliques(
+    int num_nodes, const std::vector<std::pair<int, int>>& edges);
+
+/**
+ * Returns the cliques of the term sparsity pattern of the Gram matrix Q of
+ * p = mᵀQm, where m is @p monomial_basis. Two monomials mᵢ, mⱼ are adjacent
+ * if the product mᵢmⱼ appears in p or is the square of a monomial in m; the
+ * pattern is extended to a chordal one with ChordalExtensionMaximalCliques(),
+ * and the products within each clique are added to the support, until the
+ * cliques stop growing.
+ *
+ * Restricting Q to this pattern (namely p = ∑ₖ m_Cₖᵀ Qₖ m_Cₖ, where m_Cₖ are
+ * the monomials of the k'th clique and Qₖ ⪰ 0) is sufficient for p to be SOS,
+ * but more restrictive than a dense Q in general. See
+ *
+ * Wang, Magron and Lasserre, "TSSOS: A Moment-SOS Hierarchy That Exploits Term
+ * Sparsity", SIAM Journal on Optimization, 2021.
+ *
+ * @return The indices in @p monomial_basis of the monomials in each clique.
+ */
+std::vector<std::vector<int>> TermSparsityCliques(
+    const symbolic::Polynomial& p,
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis);
+}  // namespace solvers
+}  // namespace drake
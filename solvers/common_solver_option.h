@@ -25,6 +25,25 @@ enum class CommonSolverOption {
    * console.
    */
   kPrintToConsole,
+  /** Some nonlinear solvers (currently SnoptSolver and IpoptSolver) can
+   * evaluate the costs and constraints concurrently in their callbacks. The
+   * user can call SolverOptions::SetOption(kMaxThreads, n) with the integer
+   * n >= 1 to allow up to n threads. Only the bindings whose evaluator reports
+   * EvaluatorBase::is_thread_safe() are evaluated concurrently; the other
+   * bindings are still evaluated on the solver's thread. Defaults to 1, namely
+   * all bindings are evaluated sequentially.
+   */
+  kMaxThreads,
+  /** Before the program is passed to the solver, SolverBase::Solve() can
+   * simplify its linear constraints, namely remove the redundant rows, turn
+   * the rows with a single variable into bounds, and eliminate the fixed
+   * variables (see Presolver). The solution of the simplified program is then
+   * mapped back to the original program, including the dual solutions of the
+   * linear and bounding box constraints if the solver computes them. The user
+   * can call SolverOptions::SetOption(kPresolve, 1) to turn on the presolve,
+   * or SolverOptions::SetOption(kPresolve, 0) to turn it off (the default).
+   */
+  kPresolve,
 };
 
 std::ostream& operator<<(std::ostream& os,
@@ -137,6 +137,7 @@ LorentzConeConstraint::LorentzConeConstraint(
       eval_type_{eval_type} {
   DRAKE_DEMAND(A_.rows() >= 2);
   DRAKE_ASSERT(A_.rows() == b_.rows());
+  set_is_thread_safe(true);
 }
 
 namespace {
@@ -208,6 +208,7 @@ class QuadraticConstraint : public Constraint {
         b_(b) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   ~QuadraticConstraint() override {}
@@ -372,6 +373,7 @@ class RotatedLorentzConeConstraint : public Constraint {
         b_(b) {
     DRAKE_DEMAND(A_.rows() >= 3);
     DRAKE_ASSERT(A_.rows() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   /** Getter for A. */
@@ -510,6 +512,7 @@ class LinearConstraint : public Constraint {
                    const Eigen::MatrixBase<DerivedUB>& ub)
       : Constraint(a.rows(), a.cols(), lb, ub), A_(a) {
     DRAKE_DEMAND(a.rows() == lb.rows());
+    set_is_thread_safe(true);
   }
 
   ~LinearConstraint() override {}
@@ -587,7 +590,9 @@ class LinearEqualityConstraint : public LinearConstraint {
   template <typename DerivedA, typename DerivedB>
   LinearEqualityConstraint(const Eigen::MatrixBase<DerivedA>& Aeq,
                            const Eigen::MatrixBase<DerivedB>& beq)
-      : LinearConstraint(Aeq, beq, beq) {}
+      : LinearConstraint(Aeq, beq, beq) {
+    set_is_thread_safe(true);
+  }
 
   LinearEqualityConstraint(const Eigen::Ref<const Eigen::RowVectorXd>& a,
                            double beq)
@@ -643,7 +648,9 @@ class BoundingBoxConstraint : public LinearConstraint {
   BoundingBoxConstraint(const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub)
       : LinearConstraint(Eigen::MatrixXd::Identity(lb.rows(), lb.rows()), lb,
-                         ub) {}
+                         ub) {
+    set_is_thread_safe(true);
+  }
 
   ~BoundingBoxConstraint() override {}
 
@@ -684,7 +691,9 @@ class LinearComplementarityConstraint : public Constraint {
   template <typename DerivedM, typename Derivedq>
   LinearComplementarityConstraint(const Eigen::MatrixBase<DerivedM>& M,
                                   const Eigen::MatrixBase<Derivedq>& q)
-      : Constraint(q.rows(), M.cols()), M_(M), q_(q) {}
+      : Constraint(q.rows(), M.cols()), M_(M), q_(q) {
+    set_is_thread_safe(true);
+  }
 
   ~LinearComplementarityConstraint() override {}
 
@@ -1,5 +1,6 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
 #include <set>
 
 #include "drake/common/drake_throw.h"
@@ -84,7 +85,72 @@ void EvaluatorBase::SetGradientSparsityPattern(
                                  num_vars());
   }
   gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
+  std::vector<int> columns;
+  columns.reserve(gradient_sparsity_pattern.size());
+  for (const auto& nonzero_entry : gradient_sparsity_pattern) {
+    columns.push_back(nonzero_entry.second);
+  }
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  gradient_sparsity_columns_.emplace(std::move(columns));
+}
+
+namespace internal {
+AutoDiffVecXd InitializeAutoDiffForColumns(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const std::vector<int>& columns) {
+  const int num_columns = static_cast<int>(columns.size());
+  AutoDiffVecXd result(x.size());
+  for (int i = 0; i < x.size(); ++i) {
+    result(i).value() = x(i);
+    result(i).derivatives() = Eigen::VectorXd::Zero(num_columns);
+  }
+  for (int k = 0; k < num_columns; ++k) {
+    DRAKE_ASSERT(columns[k] >= 0 && columns[k] < x.size());
+    DRAKE_ASSERT(k == 0 || columns[k - 1] < columns[k]);
+    result(columns[k]).derivatives()(k) = 1;
+  }
+  return result;
+}
+
+int FindColumnPosition(const std::vector<int>& columns, const int column) {
+  const auto it = std::lower_bound(columns.begin(), columns.end(), column);
+  DRAKE_ASSERT(it != columns.end() && *it == column);
+  return static_cast<int>(it - columns.begin());
+}
+
+void EvaluateInParallel(int num_tasks, drake::internal::WorkerPool* pool,
+                        const std::function<bool(int)>& is_thread_safe,
+                        const std::function<void(int)>& task) {
+  std::vector<int> parallel_tasks;
+  std::vector<int> sequential_tasks;
+  if (pool != nullptr && pool->num_threads() > 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      if (is_thread_safe(i)) {
+        parallel_tasks.push_back(i);
+      } else {
+        sequential_tasks.push_back(i);
+      }
+    }
+  }
+  if (parallel_tasks.size() <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+  // The calling thread runs the sequential tasks while the workers already
+  // start on the parallel ones.
+  pool->ParallelFor(
+      static_cast<int>(parallel_tasks.size()),
+      [&](int k) { task(parallel_tasks[k]); },
+      [&]() {
+        for (const int i : sequential_tasks) {
+          task(i);
+        }
+      });
 }
+}  // namespace internal
 
 std::ostream& operator<<(std::ostream& os, const EvaluatorBase& e) {
   return e.Display(os);
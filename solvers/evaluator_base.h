@@ -1,9 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -14,6 +16,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
+#include "drake/common/worker_pool.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/function.h"
 
@@ -136,6 +139,35 @@ class EvaluatorBase {
     return gradient_sparsity_pattern_;
   }
 
+  /**
+   * Returns the sorted indices j of the variables x(j) which appear in
+   * gradient_sparsity_pattern(), namely the columns of ∂y/∂x which could have
+   * non-zero entries. A solver only needs to propagate the derivatives with
+   * respect to these variables (see internal::InitializeAutoDiffForColumns()).
+   * @retval gradient_sparsity_columns If nullopt, then we regard all columns
+   * of the gradient as potentially non-zero.
+   */
+  const std::optional<std::vector<int>>& gradient_sparsity_columns() const {
+    return gradient_sparsity_columns_;
+  }
+
+  /**
+   * Returns true if Eval() may be called concurrently from several threads on
+   * this evaluator (with distinct inputs and outputs), so that a solver may
+   * evaluate the bindings of this evaluator in parallel (see
+   * CommonSolverOption::kMaxThreads). An evaluator which modifies any internal
+   * scratch data in DoEval() is not thread safe, unless it guards that data.
+   * Defaults to false.
+   *
+   * Thread safety is not inherited: it only holds for an object whose
+   * concrete type is the class which declared itself thread safe, since a
+   * subclass may add its own unguarded state. A subclass of a thread-safe
+   * evaluator has to opt in again.
+   */
+  bool is_thread_safe() const {
+    return thread_safe_type_ != nullptr && typeid(*this) == *thread_safe_type_;
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -197,6 +229,15 @@ class EvaluatorBase {
   // matrix in the linear constraint is resized.
   void set_num_outputs(int num_outputs) { num_outputs_ = num_outputs; }
 
+  // Setter for is_thread_safe(). Sub-classes call this in their constructor
+  // when their DoEval() functions don't modify any unguarded state. The
+  // setting only applies to the class whose constructor calls this, and not to
+  // its own sub-classes (see is_thread_safe()).
+  void set_is_thread_safe(bool is_thread_safe) {
+    // While a constructor runs, typeid(*this) is the class being constructed.
+    thread_safe_type_ = is_thread_safe ? &typeid(*this) : nullptr;
+  }
+
  private:
   int num_vars_{};
   int num_outputs_{};
@@ -209,8 +250,49 @@ class EvaluatorBase {
   // false, the gradient matrix is regarded as non-sparse, i.e., every entry of
   // the gradient matrix can be non-zero.
   std::optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  // The sorted, unique column indices in gradient_sparsity_pattern_.
+  std::optional<std::vector<int>> gradient_sparsity_columns_;
+  // The concrete type which is thread safe, or nullptr if none is.
+  const std::type_info* thread_safe_type_{nullptr};
 };
 
+namespace internal {
+/*
+ * Returns @p x as an AutoDiffVecXd whose derivatives are only taken with
+ * respect to the entries x(columns[k]), such that x(columns[k]).derivatives()
+ * is the k'th unit vector of size columns.size(), and the derivatives of the
+ * other entries are zero. The derivative of y w.r.t x(columns[k]) is then
+ * y.derivatives()(k). Solvers use this with
+ * EvaluatorBase::gradient_sparsity_columns(), so that the cost of propagating
+ * the derivatives scales with the number of structurally non-zero columns
+ * rather than with the number of bound variables.
+ * @pre columns is sorted, unique, and within [0, x.size()).
+ */
+AutoDiffVecXd InitializeAutoDiffForColumns(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const std::vector<int>& columns);
+
+/*
+ * Returns the position k of @p column in the sorted vector @p columns.
+ * @pre column is in columns.
+ */
+int FindColumnPosition(const std::vector<int>& columns, int column);
+
+/*
+ * Calls task(i) for every i in [0, num_tasks). When @p pool is non-null and
+ * has more than one thread, the tasks with is_thread_safe(i) == true are run
+ * on the pool's threads, while the other tasks all run on the calling thread.
+ * Solvers create one pool per solve (sized by CommonSolverOption::kMaxThreads)
+ * and use this to evaluate the bindings of a program concurrently, so each
+ * task must only write to its own output (for example a disjoint slice of the
+ * constraint values and gradients). If any task throws, the first exception
+ * is rethrown on the calling thread after all the tasks have stopped.
+ */
+void EvaluateInParallel(int num_tasks, drake::internal::WorkerPool* pool,
+                        const std::function<bool(int)>& is_thread_safe,
+                        const std::function<void(int)>& task);
+}  // namespace internal
+
 /**
  * Print out the evaluator.
  */
@@ -0,0 +1,534 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/solvers/fbstab/fbstab_mpc.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// The location of a decision variable in the stage-wise variable
+// z(stage) = [x(stage); u(stage)] of FBstab.
+struct VariableLocation {
+  int stage{-1};
+  int index{-1};
+};
+
+// A linear constraint lb <= ∑ coefficient * z(variable_index) <= ub, where
+// terms maps the index of a decision variable in the program to its
+// coefficient.
+struct LinearRow {
+  std::map<int, double> terms;
+  double lb{};
+  double ub{};
+};
+
+// The data of the optimal control problem in the form of fbstab::FBstabMpc.
+struct MpcProblem {
+  int N{};
+  int nx{};
+  int nu{};
+  int nc{};
+  std::vector<MatrixXd> Q, R, S, A, B, E, L;
+  std::vector<VectorXd> q, r, c, d;
+  VectorXd x0;
+  // location[i] is the location of the i'th decision variable of the program.
+  std::vector<VariableLocation> location;
+};
+
+template <typename C>
+void AddLinearRows(const MathematicalProgram& prog,
+                   const std::vector<Binding<C>>& bindings,
+                   std::vector<LinearRow>* rows) {
+  for (const auto& binding : bindings) {
+    const auto& A = binding.evaluator()->A();
+    const VectorXd& lb = binding.evaluator()->lower_bound();
+    const VectorXd& ub = binding.evaluator()->upper_bound();
+    for (int i = 0; i < A.rows(); ++i) {
+      LinearRow row;
+      for (int j = 0; j < A.cols(); ++j) {
+        if (A(i, j) != 0) {
+          row.terms[prog.FindDecisionVariableIndex(binding.variables()(j))] +=
+              A(i, j);
+        }
+      }
+      row.lb = lb(i);
+      row.ub = ub(i);
+      rows->push_back(std::move(row));
+    }
+  }
+}
+
+// Returns the rows of the matrix M = [M₀ M₁] and the vector b, such that
+// the rows in @p rows are written as M₀ x(stage) + M₁ u(stage) = b for the
+// given stage, where columns maps the location index into the columns of M.
+void StackRows(const std::vector<const LinearRow*>& rows,
+               const std::vector<VariableLocation>& location, int stage,
+               int num_columns, MatrixXd* M, VectorXd* b) {
+  M->setZero(rows.size(), num_columns);
+  b->resize(rows.size());
+  for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+    for (const auto& [variable, coefficient] : rows[i]->terms) {
+      if (location[variable].stage == stage) {
+        (*M)(i, location[variable].index) += coefficient;
+      }
+    }
+    (*b)(i) = rows[i]->ub;
+  }
+}
+
+// Parses @p prog into the optimal control problem with the stage structure
+// @p stage_variables. Returns nullopt and sets @p failure if prog doesn't have
+// the required structure.
+std::optional<MpcProblem> ParseMpcProblem(
+    const MathematicalProgram& prog,
+    const FbstabSolver::StageVariables& stage_variables,
+    std::string* failure) {
+  MpcProblem problem;
+  problem.N = static_cast<int>(stage_variables.states.size()) - 1;
+  problem.nx = stage_variables.states[0].rows();
+  problem.nu = stage_variables.inputs[0].rows();
+  const int N = problem.N;
+  const int nx = problem.nx;
+  const int nu = problem.nu;
+
+  // Locate each decision variable in the stages.
+  std::vector<VariableLocation>& location = problem.location;
+  location.resize(prog.num_vars());
+  auto locate = [&prog, &location, failure](
+                    const VectorXDecisionVariable& vars, int stage,
+                    int offset) {
+    for (int j = 0; j < vars.rows(); ++j) {
+      const auto it = prog.decision_variable_index().find(vars(j).get_id());
+      if (it == prog.decision_variable_index().end()) {
+        *failure = fmt::format("{} is not a decision variable of the program",
+                               vars(j).get_name());
+        return false;
+      }
+      if (location[it->second].stage >= 0) {
+        *failure = fmt::format("{} appears more than once in the stages",
+                               vars(j).get_name());
+        return false;
+      }
+      location[it->second] = {stage, offset + j};
+    }
+    return true;
+  };
+  for (int k = 0; k <= N; ++k) {
+    if (!locate(stage_variables.states[k], k, 0) ||
+        !locate(stage_variables.inputs[k], k, nx)) {
+      return std::nullopt;
+    }
+  }
+  for (int i = 0; i < prog.num_vars(); ++i) {
+    if (location[i].stage < 0) {
+      *failure = fmt::format("{} is not in any stage",
+                             prog.decision_variable(i).get_name());
+      return std::nullopt;
+    }
+  }
+  auto is_state = [&location, nx](int variable) {
+    return location[variable].index < nx;
+  };
+
+  std::vector<LinearRow> rows;
+  AddLinearRows(prog, prog.linear_equality_constraints(), &rows);
+  AddLinearRows(prog, prog.linear_constraints(), &rows);
+  AddLinearRows(prog, prog.bounding_box_constraints(), &rows);
+
+  // Identify uₗ(m) with uⱼ(k) for the constraints uⱼ(k) = uₗ(m), k < m.
+  std::vector<bool> is_alias(rows.size(), false);
+  for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+    const LinearRow& row = rows[i];
+    if (row.terms.size() != 2 || row.lb != 0 || row.ub != 0) {
+      continue;
+    }
+    int first = row.terms.begin()->first;
+    int second = std::next(row.terms.begin())->first;
+    if (row.terms.begin()->second != -std::next(row.terms.begin())->second ||
+        is_state(first) || is_state(second) ||
+        location[first].stage == location[second].stage) {
+      continue;
+    }
+    if (location[first].stage > location[second].stage) {
+      std::swap(first, second);
+    }
+    location[second] = location[first];
+    is_alias[i] = true;
+  }
+
+  // Classify the remaining rows.
+  std::vector<const LinearRow*> initial_rows;
+  std::vector<std::vector<const LinearRow*>> dynamics_rows(N);
+  // Each inequality E(k) x(k) + L(k) u(k) + d(k) <= 0 is stored as the row
+  // [E(k) L(k) d(k)].
+  std::vector<std::vector<VectorXd>> inequality_rows(N + 1);
+  for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+    if (is_alias[i]) {
+      continue;
+    }
+    const LinearRow& row = rows[i];
+    std::set<int> stages;
+    bool only_states = true;
+    for (const auto& term : row.terms) {
+      stages.insert(location[term.first].stage);
+      only_states = only_states && is_state(term.first);
+    }
+    const bool is_equality = row.lb == row.ub;
+    if (stages.size() == 2 && is_equality &&
+        *stages.rbegin() == *stages.begin() + 1) {
+      const int next_stage = *stages.rbegin();
+      bool next_only_states = true;
+      for (const auto& term : row.terms) {
+        if (location[term.first].stage == next_stage) {
+          next_only_states = next_only_states && is_state(term.first);
+        }
+      }
+      if (next_only_states) {
+        dynamics_rows[*stages.begin()].push_back(&row);
+        continue;
+      }
+    }
+    if (stages.size() > 1) {
+      *failure = fmt::format(
+          "a constraint couples the stages {} to {}, but it isn't a part of "
+          "the dynamics",
+          *stages.begin(), *stages.rbegin());
+      return std::nullopt;
+    }
+    const int stage = stages.empty() ? 0 : *stages.begin();
+    if (is_equality && stage == 0 && only_states && !stages.empty()) {
+      initial_rows.push_back(&row);
+      continue;
+    }
+    VectorXd a = VectorXd::Zero(nx + nu + 1);
+    for (const auto& [variable, coefficient] : row.terms) {
+      a(location[variable].index) += coefficient;
+    }
+    if (!std::isinf(row.ub)) {
+      a(nx + nu) = -row.ub;
+      inequality_rows[stage].push_back(a);
+    }
+    if (!std::isinf(row.lb)) {
+      a.head(nx + nu) *= -1;
+      a(nx + nu) = row.lb;
+      inequality_rows[stage].push_back(a);
+    }
+  }
+
+  // The initial state.
+  if (static_cast<int>(initial_rows.size()) != nx) {
+    *failure = fmt::format(
+        "the initial state should be fixed by {} linear equality constraints, "
+        "got {}",
+        nx, initial_rows.size());
+    return std::nullopt;
+  }
+  {
+    MatrixXd M;
+    VectorXd b;
+    StackRows(initial_rows, location, 0, nx, &M, &b);
+    const Eigen::FullPivLU<MatrixXd> lu(M);
+    if (!lu.isInvertible()) {
+      *failure = "the constraints on the initial state are singular";
+      return std::nullopt;
+    }
+    problem.x0 = lu.solve(b);
+  }
+
+  // The dynamics x(k+1) = A(k) x(k) + B(k) u(k) + c(k).
+  for (int k = 0; k < N; ++k) {
+    if (static_cast<int>(dynamics_rows[k].size()) != nx) {
+      *failure = fmt::format(
+          "the dynamics between the stages {} and {} should have {} rows, got "
+          "{}",
+          k, k + 1, nx, dynamics_rows[k].size());
+      return std::nullopt;
+    }
+    MatrixXd M_next;
+    MatrixXd M_current;
+    VectorXd b;
+    StackRows(dynamics_rows[k], location, k + 1, nx, &M_next, &b);
+    StackRows(dynamics_rows[k], location, k, nx + nu, &M_current, &b);
+    const Eigen::FullPivLU<MatrixXd> lu(M_next);
+    if (!lu.isInvertible()) {
+      *failure = fmt::format(
+          "the dynamics between the stages {} and {} can't be solved for the "
+          "next state",
+          k, k + 1);
+      return std::nullopt;
+    }
+    problem.A.push_back(-lu.solve(M_current.leftCols(nx)));
+    problem.B.push_back(-lu.solve(M_current.rightCols(nu)));
+    problem.c.push_back(lu.solve(b));
+  }
+
+  // The inequality constraints, padded with 0 <= 1 such that every stage has
+  // the same (positive) number of constraints.
+  problem.nc = 1;
+  for (const auto& stage_rows : inequality_rows) {
+    problem.nc = std::max(problem.nc, static_cast<int>(stage_rows.size()));
+  }
+  for (int k = 0; k <= N; ++k) {
+    MatrixXd stacked = MatrixXd::Zero(problem.nc, nx + nu + 1);
+    stacked.col(nx + nu).setConstant(-1);
+    for (int i = 0; i < static_cast<int>(inequality_rows[k].size()); ++i) {
+      stacked.row(i) = inequality_rows[k][i].transpose();
+    }
+    problem.E.push_back(stacked.leftCols(nx));
+    problem.L.push_back(stacked.middleCols(nx, nu));
+    problem.d.push_back(stacked.col(nx + nu));
+  }
+
+  // The costs.
+  std::vector<MatrixXd> H(N + 1, MatrixXd::Zero(nx + nu, nx + nu));
+  std::vector<VectorXd> f(N + 1, VectorXd::Zero(nx + nu));
+  for (const auto& binding : prog.quadratic_costs()) {
+    const MatrixXd& Q = binding.evaluator()->Q();
+    const VectorXd& b = binding.evaluator()->b();
+    std::vector<VariableLocation> binding_location(binding.GetNumElements());
+    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
+      binding_location[i] = location[prog.FindDecisionVariableIndex(
+          binding.variables()(i))];
+    }
+    for (int i = 0; i < Q.rows(); ++i) {
+      for (int j = 0; j < Q.cols(); ++j) {
+        if (Q(i, j) == 0) {
+          continue;
+        }
+        if (binding_location[i].stage != binding_location[j].stage) {
+          *failure = fmt::format(
+              "a quadratic cost couples the stages {} and {}",
+              binding_location[i].stage, binding_location[j].stage);
+          return std::nullopt;
+        }
+        H[binding_location[i].stage](binding_location[i].index,
+                                     binding_location[j].index) += Q(i, j);
+      }
+      f[binding_location[i].stage](binding_location[i].index) += b(i);
+    }
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const VectorXd& a = binding.evaluator()->a();
+    for (int i = 0; i < a.rows(); ++i) {
+      const VariableLocation& variable_location =
+          location[prog.FindDecisionVariableIndex(binding.variables()(i))];
+      f[variable_location.stage](variable_location.index) += a(i);
+    }
+  }
+  for (int k = 0; k <= N; ++k) {
+    problem.Q.push_back(H[k].topLeftCorner(nx, nx));
+    problem.S.push_back(H[k].bottomLeftCorner(nu, nx));
+    problem.R.push_back(H[k].bottomRightCorner(nu, nu));
+    problem.q.push_back(f[k].head(nx));
+    problem.r.push_back(f[k].tail(nu));
+  }
+  return problem;
+}
+
+void SetFbstabOptions(const SolverOptions& options,
+                      fbstab::FBstabMpc* solver) {
+  for (const auto& [name, value] :
+       options.GetOptionsDouble(FbstabSolver::id())) {
+    solver->UpdateOption(name.c_str(), value);
+  }
+  for (const auto& [name, value] : options.GetOptionsInt(FbstabSolver::id())) {
+    if (name == "check_feasibility" || name == "record_solve_time") {
+      solver->UpdateOption(name.c_str(), value != 0);
+    } else {
+      solver->UpdateOption(name.c_str(), value);
+    }
+  }
+  const auto it = options.common_solver_options().find(
+      CommonSolverOption::kPrintToConsole);
+  const bool print_to_console =
+      it != options.common_solver_options().end() &&
+      std::get<int>(it->second) == 1;
+  solver->SetDisplayLevel(print_to_console
+                              ? fbstab::FBstabAlgoMpc::Display::ITER
+                              : fbstab::FBstabAlgoMpc::Display::OFF);
+}
+
+SolutionResult ConvertExitFlag(fbstab::ExitFlag exit_flag) {
+  switch (exit_flag) {
+    case fbstab::ExitFlag::SUCCESS:
+      return SolutionResult::kSolutionFound;
+    case fbstab::ExitFlag::MAXITERATIONS:
+      return SolutionResult::kIterationLimit;
+    case fbstab::ExitFlag::PRIMAL_INFEASIBLE:
+      return SolutionResult::kInfeasibleConstraints;
+    case fbstab::ExitFlag::DUAL_INFEASIBLE:
+      return SolutionResult::kUnbounded;
+    case fbstab::ExitFlag::PRIMAL_DUAL_INFEASIBLE:
+      return SolutionResult::kInfeasible_Or_Unbounded;
+    case fbstab::ExitFlag::DIVERGENCE:
+      return SolutionResult::kUnknownError;
+  }
+  DRAKE_UNREACHABLE();
+}
+}  // namespace
+
+FbstabSolver::FbstabSolver(StageVariables stage_variables)
+    : SolverBase(&id, &is_available, &is_enabled, &ProgramAttributesSatisfied),
+      stage_variables_(std::move(stage_variables)) {
+  const std::vector<VectorXDecisionVariable>& states = stage_variables_.states;
+  const std::vector<VectorXDecisionVariable>& inputs = stage_variables_.inputs;
+  if (states.size() < 2 || states.size() != inputs.size()) {
+    throw std::invalid_argument(fmt::format(
+        "FbstabSolver: expects the states and inputs of at least two stages, "
+        "got {} states and {} inputs.",
+        states.size(), inputs.size()));
+  }
+  for (size_t k = 0; k < states.size(); ++k) {
+    if (states[k].rows() == 0 || states[k].rows() != states[0].rows() ||
+        inputs[k].rows() == 0 || inputs[k].rows() != inputs[0].rows()) {
+      throw std::invalid_argument(
+          "FbstabSolver: the states (and the inputs) of all the stages should "
+          "have the same positive size.");
+    }
+  }
+}
+
+FbstabSolver::~FbstabSolver() = default;
+
+void FbstabSolver::DoSolve(
+    const MathematicalProgram& prog, const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+        "FbstabSolver doesn't support the feature of variable scaling.");
+  }
+
+  std::string failure;
+  const std::optional<MpcProblem> problem =
+      ParseMpcProblem(prog, stage_variables_, &failure);
+  if (!problem.has_value()) {
+    drake::log()->debug(
+        "FbstabSolver: the program doesn't have the stage structure of an "
+        "optimal control problem: {}.",
+        failure);
+    result->set_solution_result(SolutionResult::kInvalidInput);
+    return;
+  }
+  const int N = problem->N;
+  const int nx = problem->nx;
+  const int nu = problem->nu;
+  const int nc = problem->nc;
+
+  fbstab::FBstabMpc solver(N, nx, nu, nc);
+  SetFbstabOptions(merged_options, &solver);
+
+  fbstab::FBstabMpc::QPData data;
+  data.Q = &problem->Q;
+  data.R = &problem->R;
+  data.S = &problem->S;
+  data.q = &problem->q;
+  data.r = &problem->r;
+  data.A = &problem->A;
+  data.B = &problem->B;
+  data.c = &problem->c;
+  data.E = &problem->E;
+  data.L = &problem->L;
+  data.d = &problem->d;
+  data.x0 = &problem->x0;
+
+  // A complete initial guess warm starts the primal variables; the duals start
+  // at zero, and FBstab computes the constraint margins y from z.
+  VectorXd z = VectorXd::Zero((nx + nu) * (N + 1));
+  VectorXd l = VectorXd::Zero(nx * (N + 1));
+  VectorXd v = VectorXd::Zero(nc * (N + 1));
+  VectorXd y = VectorXd::Zero(nc * (N + 1));
+  const bool use_initial_guess = !initial_guess.hasNaN();
+  if (use_initial_guess) {
+    for (int k = 0; k <= N; ++k) {
+      for (int j = 0; j < nx; ++j) {
+        z((nx + nu) * k + j) = initial_guess(
+            prog.FindDecisionVariableIndex(stage_variables_.states[k](j)));
+      }
+      for (int j = 0; j < nu; ++j) {
+        z((nx + nu) * k + nx + j) = initial_guess(
+            prog.FindDecisionVariableIndex(stage_variables_.inputs[k](j)));
+      }
+    }
+  }
+  fbstab::FBstabMpc::QPVariable variable;
+  variable.z = &z;
+  variable.l = &l;
+  variable.v = &v;
+  variable.y = &y;
+  const fbstab::SolverOut out =
+      solver.Solve(data, &variable, use_initial_guess);
+
+  FbstabSolverDetails& solver_details =
+      result->SetSolverDetailsType<FbstabSolverDetails>();
+  solver_details.exit_flag = static_cast<int>(out.eflag);
+  solver_details.residual = out.residual;
+  solver_details.newton_iters = out.newton_iters;
+  solver_details.prox_iters = out.prox_iters;
+  solver_details.solve_time = out.solve_time;
+
+  VectorXd x_val(prog.num_vars());
+  for (int i = 0; i < prog.num_vars(); ++i) {
+    const VariableLocation& variable_location = problem->location[i];
+    x_val(i) =
+        z((nx + nu) * variable_location.stage + variable_location.index);
+  }
+  result->set_x_val(x_val);
+
+  const SolutionResult solution_result = ConvertExitFlag(out.eflag);
+  result->set_solution_result(solution_result);
+  if (solution_result == SolutionResult::kSolutionFound) {
+    double optimal_cost = 0;
+    for (const auto& binding : prog.GetAllCosts()) {
+      optimal_cost += prog.EvalBinding(binding, x_val)(0);
+    }
+    result->set_optimal_cost(optimal_cost);
+  } else if (solution_result == SolutionResult::kUnbounded) {
+    result->set_optimal_cost(MathematicalProgram::kUnboundedCost);
+  } else if (solution_result == SolutionResult::kInfeasibleConstraints) {
+    result->set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+  }
+}
+
+SolverId FbstabSolver::id() {
+  static const never_destroyed<SolverId> singleton{"FBstab"};
+  return singleton.access();
+}
+
+bool FbstabSolver::is_available() { return true; }
+
+bool FbstabSolver::is_enabled() { return true; }
+
+bool FbstabSolver::ProgramAttributesSatisfied(
+    const MathematicalProgram& prog) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kQuadraticCost, ProgramAttribute::kLinearCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  return AreRequiredAttributesSupported(prog.required_capabilities(),
+                                        solver_capabilities.access());
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/decision_variable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * The FBstab solver details after calling Solve() function. The user can call
+ * MathematicalProgramResult::get_solver_details<FbstabSolver>() to obtain the
+ * details.
+ */
+struct FbstabSolverDetails {
+  /// The exit flag of FBstab, namely the value of fbstab::ExitFlag. Please
+  /// refer to solvers/fbstab/fbstab_algorithm.h
+  int exit_flag{};
+  /// Norm of the natural residual at termination.
+  double residual{};
+  /// Number of Newton iterations taken.
+  int newton_iters{};
+  /// Number of proximal point iterations taken.
+  int prox_iters{};
+  /// CPU time taken by FBstab (seconds), or a negative value if the solve time
+  /// isn't recorded.
+  double solve_time{};
+};
+
+/**
+ * Solves a linear-quadratic optimal control problem (as arises in linear model
+ * predictive control) with FBstab, see solvers/fbstab/fbstab_mpc.h. Each
+ * Newton step of FBstab is computed by a Riccati recursion, whose cost grows
+ * linearly with the horizon length N, instead of by a generic sparse
+ * factorization.
+ *
+ * The decision variables of the program are partitioned into the states x(i)
+ * and inputs u(i) of the stages i = 0, ..., N (see StageVariables), such that
+ * the program is
+ *
+ *     min.  ∑ᵢ 1/2 [x(i)]' [Q(i) S(i)'] [x(i)] + [q(i)]' [x(i)]
+ *                  [u(i)]  [S(i) R(i) ] [u(i)]   [r(i)]  [u(i)]
+ *     s.t.  M(i) x(i+1) + A'(i) x(i) + B'(i) u(i) = b(i),   i = 0, ..., N-1
+ *           M₀ x(0) = b₀
+ *           lb(i) ≤ E(i) x(i) + L(i) u(i) ≤ ub(i),           i = 0, ..., N
+ *
+ * where M(i) and M₀ are nx x nx invertible matrices. Namely
+ * - every cost only couples the variables within one stage.
+ * - the linear equality constraints that couple two stages form the dynamics,
+ *   one block of nx rows for each pair of stages i and i+1, which involves
+ *   the state but not the input of stage i+1.
+ * - the linear equality constraints that only involve x(0) fix the initial
+ *   state.
+ * - all the other linear (equality or inequality) constraints and bounding
+ *   box constraints only involve the variables within one stage.
+ * As the only exception, a linear equality constraint uⱼ(k) = uₗ(m) between
+ * two entries of the inputs of different stages k < m identifies uₗ(m) with
+ * uⱼ(k) (this is how DirectTranscription handles the input at the final time
+ * sample), as long as uₗ(m) doesn't appear in any coupling cost or
+ * constraint.
+ *
+ * The stage structure is not deduced from the program; it is passed to the
+ * constructor. For a systems::trajectory_optimization::DirectTranscription
+ * `prog`, StageVariables::states and StageVariables::inputs hold
+ * prog.state(i) and prog.input(i) for each sample time i, as in
+ * systems::controllers::LinearModelPredictiveController.
+ * If the program doesn't have the structure above, Solve() reports
+ * SolutionResult::kInvalidInput (the reason is logged at the debug level).
+ *
+ * If the initial guess sets every decision variable, it warm starts the
+ * primal variables of FBstab (the duals always start at zero); otherwise FBstab
+ * starts at the origin. This solver doesn't report the dual solution:
+ * the multipliers of FBstab belong to the reformulated dynamics and
+ * inequalities, not to the constraints of the program, so
+ * MathematicalProgramResult::GetDualSolution() throws for its results.
+ *
+ * The user can set FBstab's options (see fbstab_algorithm.h) with
+ * SolverOptions::SetOption(FbstabSolver::id(), name, value), where the
+ * integer options "check_feasibility" and "record_solve_time" are interpreted
+ * as booleans. CommonSolverOption::kPrintToConsole prints FBstab's progress at
+ * each iteration.
+ */
+class FbstabSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FbstabSolver)
+
+  /// Type of details stored in MathematicalProgramResult.
+  using Details = FbstabSolverDetails;
+
+  /**
+   * The decision variables of each stage i = 0, ..., N of the optimal control
+   * problem.
+   */
+  struct StageVariables {
+    /// The states x(i), all of the same size nx > 0.
+    std::vector<VectorXDecisionVariable> states;
+    /// The inputs u(i), all of the same size nu > 0.
+    std::vector<VectorXDecisionVariable> inputs;
+  };
+
+  /**
+   * Constructs the solver for programs with the stage structure
+   * @p stage_variables.
+   * @throws std::exception if stage_variables has less than two stages, or if
+   * the states or the inputs have different or zero sizes.
+   */
+  explicit FbstabSolver(StageVariables stage_variables);
+  ~FbstabSolver() final;
+
+  const StageVariables& stage_variables() const { return stage_variables_; }
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  /// Note that this only checks the types of the costs and constraints, and
+  /// not that they respect the stage structure.
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+
+  StageVariables stage_variables_;
+};
+
+}  // namespace solvers
+}  // namespace drake
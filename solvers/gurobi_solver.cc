@@ -814,6 +814,10 @@ std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireLicense() {
   return GetScopedSingleton<GurobiSolver::License>();
 }
 
+std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireNewLicense() {
+  return std::make_shared<GurobiSolver::License>();
+}
+
 // TODO(hongkai.dai@tri.global): break this large DoSolve function to smaller
 // ones.
 void GurobiSolver::DoSolve(
@@ -3,6 +3,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
@@ -147,6 +148,29 @@ class GurobiSolver final : public SolverBase {
    */
   static std::shared_ptr<License> AcquireLicense();
 
+  /**
+   * This acquires a new Gurobi license environment, which, unlike the one of
+   * AcquireLicense(), is not shared with other GurobiSolver instances. A
+   * Gurobi environment must not be used by several threads at once, hence
+   * programs that are solved concurrently need GurobiSolver instances with
+   * different environments (see set_license()). Note that, depending on the
+   * license, each environment could count as a separate use of it.
+   * @return A shared pointer to the new license environment. If Gurobi is not
+   * available in your build, this will return a null (empty) shared_ptr.
+   * @throws std::runtime_error if Gurobi is available but a license cannot be
+   * obtained.
+   */
+  static std::shared_ptr<License> AcquireNewLicense();
+
+  /**
+   * Sets the license environment used by this solver, e.g., one acquired with
+   * AcquireNewLicense(). By default, the solver acquires the shared license
+   * environment of AcquireLicense() when it first solves a program.
+   */
+  void set_license(std::shared_ptr<License> license) {
+    license_ = std::move(license);
+  }
+
   /// @name Static versions of the instance methods with similar names.
   //@{
   static SolverId id();
@@ -16,6 +16,7 @@
 #include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
+#include "drake/common/worker_pool.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
@@ -137,7 +138,11 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern().has_value()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -160,6 +165,16 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern().has_value()) {
+    for (const auto& nonzero_entry : c.gradient_sparsity_pattern().value()) {
+      iRow[grad_index] = constraint_idx + nonzero_entry.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(nonzero_entry.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -202,8 +217,16 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
   }
 
+  // When the constraint declares its gradient sparsity, we only propagate the
+  // derivatives w.r.t. the variables in its sparsity pattern.
+  const std::optional<std::vector<int>>& gradient_sparsity_columns =
+      c.gradient_sparsity_columns();
   AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::initializeAutoDiff(this_x), &ty);
+  c.Eval(gradient_sparsity_columns.has_value()
+             ? internal::InitializeAutoDiffForColumns(
+                   this_x, gradient_sparsity_columns.value())
+             : math::initializeAutoDiff(this_x),
+         &ty);
 
   // Store the results.  Since IPOPT directly knows the bounds of the
   // constraint, we don't need to apply any bounding information here.
@@ -216,6 +239,17 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   size_t grad_idx = 0;
 
   DRAKE_ASSERT(ty.rows() == c.num_constraints());
+  if (c.gradient_sparsity_pattern().has_value()) {
+    for (const auto& nonzero_entry : c.gradient_sparsity_pattern().value()) {
+      const auto& derivatives = ty(nonzero_entry.first).derivatives();
+      grad[grad_idx++] =
+          derivatives.size() > 0
+              ? derivatives(internal::FindColumnPosition(
+                    gradient_sparsity_columns.value(), nonzero_entry.second))
+              : 0.0;
+    }
+    return grad_idx;
+  }
   for (int i = 0; i < ty.rows(); i++) {
     if (ty(i).derivatives().size() > 0) {
       for (int j = 0; j < variables.rows(); j++) {
@@ -280,10 +314,13 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init, int max_threads,
+                  MathematicalProgramResult* result)
+      : problem_(&problem),
+        pool_(max_threads),
+        x_init_{x_init},
+        result_(result) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -590,35 +627,47 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   }
 
  private:
+  // The costs and constraints are evaluated with internal::EvaluateInParallel,
+  // so the thread-safe bindings are evaluated concurrently on the threads of
+  // pool_, which live as long as this solve.
   void EvaluateCosts(Index n, const Number* x) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
-    Eigen::VectorXd this_x;
-
     cost_cache_->SetX(n, x);
     cost_cache_->result[0] = 0;
     cost_cache_->grad.assign(n, 0);
 
-    for (auto const& binding : problem_->GetAllCosts()) {
-      int num_v_variables = binding.GetNumElements();
-      this_x.resize(num_v_variables);
-      for (int i = 0; i < num_v_variables; ++i) {
-        this_x(i) =
-            xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
-      }
-
-      binding.evaluator()->Eval(math::initializeAutoDiff(this_x), &ty);
-
-      cost_cache_->result[0] += ty(0).value();
-
-      if (ty(0).derivatives().size() > 0) {
-        for (int j = 0; j < num_v_variables; ++j) {
+    // Each cost is evaluated into its own ty[k]; the results are then summed
+    // in order, such that the total doesn't depend on the number of threads.
+    const std::vector<Binding<Cost>> costs = problem_->GetAllCosts();
+    const int num_costs = static_cast<int>(costs.size());
+    std::vector<AutoDiffVecXd> ty(num_costs);
+    internal::EvaluateInParallel(
+        num_costs, &pool_,
+        [&costs](int k) { return costs[k].evaluator()->is_thread_safe(); },
+        [&](int k) {
+          const auto& binding = costs[k];
+          int num_v_variables = binding.GetNumElements();
+          Eigen::VectorXd this_x(num_v_variables);
+          for (int i = 0; i < num_v_variables; ++i) {
+            this_x(i) = xvec(
+                problem_->FindDecisionVariableIndex(binding.variables()(i)));
+          }
+          ty[k].resize(1);
+          binding.evaluator()->Eval(math::initializeAutoDiff(this_x), &ty[k]);
+        });
+
+    for (int k = 0; k < num_costs; ++k) {
+      const auto& binding = costs[k];
+      cost_cache_->result[0] += ty[k](0).value();
+
+      if (ty[k](0).derivatives().size() > 0) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
           const size_t vj_index =
               problem_->FindDecisionVariableIndex(binding.variables()(j));
-          cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
+          cost_cache_->grad[vj_index] += ty[k](0).derivatives()(j);
         }
       }
       // We do not need to add code for ty(0).derivatives().size() == 0, since
@@ -633,34 +682,42 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = constraint_cache_->grad.data();
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
+    // Each constraint writes its value and gradient to its own slice of the
+    // cache, so that the slices can be filled concurrently.
+    struct ConstraintSlice {
+      const Constraint* evaluator;
+      const VectorXDecisionVariable* variables;
+      Number* result;
+      Number* grad;
+    };
+    std::vector<ConstraintSlice> slices;
+    auto add_slices = [&slices, &result, &grad](const auto& constraints) {
+      for (const auto& c : constraints) {
+        slices.push_back({c.evaluator().get(), &c.variables(), result, grad});
+        Index num_grad{};
+        result +=
+            GetNumGradients(*c.evaluator(), c.variables().rows(), &num_grad);
+        grad += num_grad;
+      }
+    };
+    add_slices(problem_->generic_constraints());
+    add_slices(problem_->lorentz_cone_constraints());
+    add_slices(problem_->rotated_lorentz_cone_constraints());
+    add_slices(problem_->linear_constraints());
+    add_slices(problem_->linear_equality_constraints());
+
+    internal::EvaluateInParallel(
+        static_cast<int>(slices.size()), &pool_,
+        [&slices](int k) { return slices[k].evaluator->is_thread_safe(); },
+        [&](int k) {
+          EvaluateConstraint(*problem_, xvec, *slices[k].evaluator,
+                             *slices[k].variables, slices[k].result,
+                             slices[k].grad);
+        });
   }
 
   const MathematicalProgram* const problem_;
+  drake::internal::WorkerPool pool_;
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
@@ -822,7 +879,8 @@ void IpoptSolver::DoSolve(
   }
 
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess,
+                          internal::GetMaxThreads(merged_options), result);
   status = app->OptimizeTNLP(nlp);
 }
 
@@ -1,6 +1,7 @@
 #include "drake/solvers/mathematical_program.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <ostream>
@@ -19,6 +20,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
 #include "drake/math/matrix_util.h"
+#include "drake/solvers/chordal_decomposition.h"
 #include "drake/solvers/sos_basis_generator.h"
 #include "drake/solvers/symbolic_extraction.h"
 
@@ -56,10 +58,17 @@ MathematicalProgram::MathematicalProgram()
     : x_initial_guess_(0),
       optimal_cost_(numeric_limits<double>::quiet_NaN()),
       lower_bound_cost_(-numeric_limits<double>::infinity()),
-      required_capabilities_{} {}
+      required_capabilities_{} {
+  UpdateStructureRevision();
+}
 
 MathematicalProgram::~MathematicalProgram() = default;
 
+void MathematicalProgram::UpdateStructureRevision() {
+  static std::atomic<int64_t> next_revision{1};
+  structure_revision_ = next_revision++;
+}
+
 std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
   // The constructor of MathematicalProgram will construct each solver. It
   // also sets x_values_ and x_initial_guess_ to default values.
@@ -95,6 +104,7 @@ std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
   new_prog->solver_options_ = solver_options_;
 
   new_prog->required_capabilities_ = required_capabilities_;
+  new_prog->UpdateStructureRevision();
   return new_prog;
 }
 
@@ -140,6 +150,7 @@ void MathematicalProgram::AddDecisionVariables(
     decision_variable_index_.insert(std::make_pair(
         decision_variables(i).get_id(), num_existing_decision_vars + i));
   }
+  UpdateStructureRevision();
   decision_variables_.conservativeResize(num_existing_decision_vars +
                                          decision_variables.rows());
   decision_variables_.tail(decision_variables.rows()) = decision_variables;
@@ -327,6 +338,7 @@ Binding<Cost> MathematicalProgram::AddCost(const Binding<Cost>& binding) {
   } else {
     CheckBinding(binding);
     required_capabilities_.insert(ProgramAttribute::kGenericCost);
+    UpdateStructureRevision();
     generic_costs_.push_back(binding);
     return generic_costs_.back();
   }
@@ -336,6 +348,7 @@ Binding<LinearCost> MathematicalProgram::AddCost(
     const Binding<LinearCost>& binding) {
   CheckBinding(binding);
   required_capabilities_.insert(ProgramAttribute::kLinearCost);
+  UpdateStructureRevision();
   linear_costs_.push_back(binding);
   return linear_costs_.back();
 }
@@ -358,6 +371,7 @@ Binding<QuadraticCost> MathematicalProgram::AddCost(
                    static_cast<int>(binding.GetNumElements()) &&
                binding.evaluator()->b().rows() ==
                    static_cast<int>(binding.GetNumElements()));
+  UpdateStructureRevision();
   quadratic_costs_.push_back(binding);
   return quadratic_costs_.back();
 }
@@ -575,6 +589,7 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
   } else {
     CheckBinding(binding);
     required_capabilities_.insert(ProgramAttribute::kGenericConstraint);
+    UpdateStructureRevision();
     generic_constraints_.push_back(binding);
     return generic_constraints_.back();
   }
@@ -665,6 +680,7 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
                  static_cast<int>(binding.GetNumElements()));
     CheckBinding(binding);
     required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
+    UpdateStructureRevision();
     linear_constraints_.push_back(binding);
     return linear_constraints_.back();
   }
@@ -684,6 +700,7 @@ Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
                static_cast<int>(binding.GetNumElements()));
   CheckBinding(binding);
   required_capabilities_.insert(ProgramAttribute::kLinearEqualityConstraint);
+  UpdateStructureRevision();
   linear_equality_constraints_.push_back(binding);
   return linear_equality_constraints_.back();
 }
@@ -718,6 +735,7 @@ Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
   DRAKE_ASSERT(binding.evaluator()->num_outputs() ==
                static_cast<int>(binding.GetNumElements()));
   required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
+  UpdateStructureRevision();
   bbox_constraints_.push_back(binding);
   return bbox_constraints_.back();
 }
@@ -726,6 +744,7 @@ Binding<LorentzConeConstraint> MathematicalProgram::AddConstraint(
     const Binding<LorentzConeConstraint>& binding) {
   CheckBinding(binding);
   required_capabilities_.insert(ProgramAttribute::kLorentzConeConstraint);
+  UpdateStructureRevision();
   lorentz_cone_constraint_.push_back(binding);
   return lorentz_cone_constraint_.back();
 }
@@ -756,6 +775,7 @@ Binding<RotatedLorentzConeConstraint> MathematicalProgram::AddConstraint(
   CheckBinding(binding);
   required_capabilities_.insert(
       ProgramAttribute::kRotatedLorentzConeConstraint);
+  UpdateStructureRevision();
   rotated_lorentz_cone_constraint_.push_back(binding);
   return rotated_lorentz_cone_constraint_.back();
 }
@@ -805,6 +825,7 @@ Binding<LinearComplementarityConstraint> MathematicalProgram::AddConstraint(
   required_capabilities_.insert(
       ProgramAttribute::kLinearComplementarityConstraint);
 
+  UpdateStructureRevision();
   linear_complementarity_constraints_.push_back(binding);
   return linear_complementarity_constraints_.back();
 }
@@ -837,6 +858,7 @@ Binding<PositiveSemidefiniteConstraint> MathematicalProgram::AddConstraint(
       binding.evaluator()->matrix_rows())));
   required_capabilities_.insert(
       ProgramAttribute::kPositiveSemidefiniteConstraint);
+  UpdateStructureRevision();
   positive_semidefinite_constraint_.push_back(binding);
   return positive_semidefinite_constraint_.back();
 }
@@ -871,6 +893,7 @@ Binding<LinearMatrixInequalityConstraint> MathematicalProgram::AddConstraint(
                static_cast<int>(binding.GetNumElements()) + 1);
   required_capabilities_.insert(
       ProgramAttribute::kPositiveSemidefiniteConstraint);
+  UpdateStructureRevision();
   linear_matrix_inequality_constraint_.push_back(binding);
   return linear_matrix_inequality_constraint_.back();
 }
@@ -1046,6 +1069,7 @@ Binding<ExponentialConeConstraint> MathematicalProgram::AddConstraint(
     const Binding<ExponentialConeConstraint>& binding) {
   CheckBinding(binding);
   required_capabilities_.insert(ProgramAttribute::kExponentialConeConstraint);
+  UpdateStructureRevision();
   exponential_cone_constraints_.push_back(binding);
   return exponential_cone_constraints_.back();
 }
@@ -1126,6 +1150,29 @@ pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>> DoAddSosConstraint(
   const MatrixXDecisionVariable Q = prog->AddSosConstraint(p, m);
   return std::make_pair(Q, m);
 }
+// Body of MathematicalProgram::AddSparseSosConstraint(
+// const symbolic::Polynomial&).
+vector<pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>>
+DoAddSparseSosConstraint(MathematicalProgram* const prog,
+                         const symbolic::Polynomial& p) {
+  const VectorX<symbolic::Monomial> m = ConstructMonomialBasis(p);
+  vector<pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>> grams;
+  symbolic::Polynomial sos_poly{};
+  for (const vector<int>& clique : TermSparsityCliques(p, m)) {
+    VectorX<symbolic::Monomial> clique_basis(clique.size());
+    for (int i = 0; i < static_cast<int>(clique.size()); ++i) {
+      clique_basis(i) = m(clique[i]);
+    }
+    const auto pair = prog->NewSosPolynomial(clique_basis);
+    sos_poly += pair.first;
+    grams.emplace_back(pair.second, clique_basis);
+  }
+  const symbolic::Polynomial poly_diff = sos_poly - p;
+  for (const auto& term : poly_diff.monomial_to_coefficient_map()) {
+    prog->AddLinearEqualityConstraint(term.second, 0);
+  }
+  return grams;
+}
 
 }  // namespace
 
@@ -1174,6 +1221,27 @@ MathematicalProgram::AddSosConstraint(const symbolic::Expression& e) {
       symbolic::Polynomial{e, symbolic::Variables{indeterminates_}});
 }
 
+vector<pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>>
+MathematicalProgram::AddSparseSosConstraint(const symbolic::Polynomial& p) {
+  const Variables indeterminates_vars{indeterminates()};
+  if (Variables(p.indeterminates()).IsSubsetOf(indeterminates_vars) &&
+      intersect(indeterminates_vars, Variables(p.decision_variables()))
+          .empty()) {
+    return DoAddSparseSosConstraint(this, p);
+  } else {
+    // Need to reparse p, we first make a copy of p and reparse that.
+    symbolic::Polynomial p_reparsed{p};
+    Reparse(&p_reparsed);
+    return DoAddSparseSosConstraint(this, p_reparsed);
+  }
+}
+
+vector<pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>>
+MathematicalProgram::AddSparseSosConstraint(const symbolic::Expression& e) {
+  return AddSparseSosConstraint(
+      symbolic::Polynomial{e, symbolic::Variables{indeterminates_}});
+}
+
 void MathematicalProgram::AddEqualityConstraintBetweenPolynomials(
     const symbolic::Polynomial& p1, const symbolic::Polynomial& p2) {
   symbolic::Polynomial poly_diff = p1 - p2;
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <list>
@@ -2270,6 +2271,34 @@ class MathematicalProgram {
   std::pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>
   AddSosConstraint(const symbolic::Expression& e);
 
+  /**
+   * Adds constraints that a given polynomial @p p is a sums-of-squares (SOS),
+   * exploiting the term sparsity of @p p. Instead of a single Gram matrix Q for
+   * the monomial basis m selected from the sparsity of @p p, Q is restricted
+   * to a chordal sparsity pattern (see TermSparsityCliques()), and is
+   * decomposed into smaller positive semidefinite matrices Qₖ on the
+   * overlapping cliques of that pattern, namely p = ∑ₖ m_Cₖᵀ Qₖ m_Cₖ. This
+   * can be much cheaper to solve than AddSosConstraint() for polynomials with
+   * many variables, but it is more restrictive in general: it is sufficient
+   * but not necessary for p being SOS.
+   *
+   * @note It calls `Reparse` to enforce `p` to have this MathematicalProgram's
+   * indeterminates if necessary.
+   *
+   * @return For each clique, the positive semidefinite matrix Qₖ and the
+   * monomial basis m_Cₖ.
+   */
+  std::vector<std::pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>>
+  AddSparseSosConstraint(const symbolic::Polynomial& p);
+
+  /**
+   * Overloads AddSparseSosConstraint(), where the polynomial is obtained by
+   * decomposing @p e with respect to `indeterminates()` in this mathematical
+   * program.
+   */
+  std::vector<std::pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>>
+  AddSparseSosConstraint(const symbolic::Expression& e);
+
   /**
    * Constraining that two polynomials are the same (i.e., they have the same
    * coefficients for each monomial). This function is often used in
@@ -2604,6 +2633,25 @@ class MathematicalProgram {
   /** Getter for number of variables in the optimization program */
   int num_vars() const { return decision_variables_.rows(); }
 
+  /**
+   * Returns a number which changes whenever decision variables, costs, or
+   * constraints are added to this program. The number is unique across all
+   * programs, so a solver which sees the same revision again can assume that
+   * the structure of the program (its decision variables and the list of its
+   * bindings) is unchanged, e.g., to reuse the symbolic factorization of a
+   * previous solve.
+   *
+   * This supports the "build once, update every tick" usage: build the
+   * program once, keep the Binding objects returned by the Add methods, and
+   * before each solve update the coefficients in place through their
+   * evaluators, e.g., LinearConstraint::UpdateCoefficients(),
+   * Constraint::set_bounds(), or QuadraticCost::UpdateCoefficients(). Such
+   * updates do not change the revision. Note that they may still change the
+   * number of rows or the sparsity of an evaluator; solvers must check those
+   * themselves.
+   */
+  int64_t structure_revision() const { return structure_revision_; }
+
   /** Getter for the initial guess */
   const Eigen::VectorXd& initial_guess() const { return x_initial_guess_; }
 
@@ -2853,6 +2901,9 @@ class MathematicalProgram {
  private:
   static void AppendNanToEnd(int new_var_size, Eigen::VectorXd* vector);
 
+  // Assigns a new, globally unique value to structure_revision_.
+  void UpdateStructureRevision();
+
   // maps the ID of a symbolic variable to the index of the variable stored in
   // the optimization program.
   std::unordered_map<symbolic::Variable::Id, int> decision_variable_index_{};
@@ -2904,6 +2955,9 @@ class MathematicalProgram {
 
   ProgramAttributes required_capabilities_{};
 
+  // See structure_revision().
+  int64_t structure_revision_{};
+
   template <typename T>
   void NewVariables_impl(
       VarType type, const T& names, bool is_symmetric,
@@ -2941,6 +2995,7 @@ class MathematicalProgram {
       num_new_vars = rows * (rows + 1) / 2;
     }
     DRAKE_ASSERT(static_cast<int>(names.size()) == num_new_vars);
+    UpdateStructureRevision();
     decision_variables_.conservativeResize(num_vars() + num_new_vars,
                                            Eigen::NoChange);
     AppendNanToEnd(num_new_vars, &x_values_);
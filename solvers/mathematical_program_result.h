@@ -21,6 +21,8 @@
 
 namespace drake {
 namespace solvers {
+class Presolver;
+
 /**
  * Retrieve the value of a single variable @p var from @p variable_values.
  * @param var The variable whose value is going to be retrieved. @p var.get_id()
@@ -460,6 +462,10 @@ class MathematicalProgramResult final {
   // @}
 
  private:
+  // Presolver::Postsolve() maps the solver details, suboptimal solutions and
+  // dual solutions of the presolved program to the original program.
+  friend class Presolver;
+
   std::optional<std::unordered_map<symbolic::Variable::Id, int>>
       decision_variable_index_{};
   SolutionResult solution_result_{};
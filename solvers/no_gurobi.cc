@@ -10,6 +10,10 @@ std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireLicense() {
   return {};
 }
 
+std::shared_ptr<GurobiSolver::License> GurobiSolver::AcquireNewLicense() {
+  return {};
+}
+
 bool GurobiSolver::is_available() { return false; }
 
 void GurobiSolver::DoSolve(
@@ -2,6 +2,7 @@
 #include "drake/solvers/osqp_solver.h"
 /* clang-format on */
 
+#include <memory>
 #include <stdexcept>
 
 namespace drake {
@@ -19,5 +20,29 @@ void OsqpSolver::DoSolve(
       "solver.");
 }
 
+class OsqpSolverSession::Impl {};
+
+OsqpSolverSession::OsqpSolverSession()
+    : SolverBase(&OsqpSolver::id, &OsqpSolver::is_available,
+                 &OsqpSolver::is_enabled,
+                 &OsqpSolver::ProgramAttributesSatisfied),
+      impl_{std::make_unique<Impl>()} {}
+
+OsqpSolverSession::~OsqpSolverSession() = default;
+
+void OsqpSolverSession::DoSolve(
+    const MathematicalProgram&,
+    const Eigen::VectorXd&,
+    const SolverOptions&,
+    MathematicalProgramResult*) const {
+  throw std::runtime_error(
+      "The OSQP bindings were not compiled.  You'll need to use a different "
+      "solver.");
+}
+
+bool OsqpSolverSession::reused_workspace() const { return false; }
+
+void OsqpSolverSession::Reset() {}
+
 }  // namespace solvers
 }  // namespace drake
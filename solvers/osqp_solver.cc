@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include <osqp.h>
@@ -11,7 +15,41 @@
 namespace drake {
 namespace solvers {
 namespace {
+// Finds the indices of the variables of each binding in the decision variables
+// of a program. The bindings must be visited in the same order in every parse
+// of the program. The indices only depend on the structure of the program, so
+// they are looked up once and reused while
+// MathematicalProgram::structure_revision() does not change.
+class VariableIndices {
+ public:
+  // Prepares for parsing @p prog, discarding the indices found for a previous
+  // structure revision.
+  void Start(const MathematicalProgram& prog) {
+    if (prog.structure_revision() != structure_revision_) {
+      structure_revision_ = prog.structure_revision();
+      indices_.clear();
+    }
+    next_ = 0;
+  }
+
+  // Returns the indices of the variables of the next binding, @p vars.
+  const std::vector<int>& Find(const MathematicalProgram& prog,
+                               const VectorXDecisionVariable& vars) {
+    if (next_ == indices_.size()) {
+      indices_.push_back(prog.FindDecisionVariableIndices(vars));
+    }
+    DRAKE_ASSERT(static_cast<int>(indices_[next_].size()) == vars.rows());
+    return indices_[next_++];
+  }
+
+ private:
+  int64_t structure_revision_{0};
+  std::vector<std::vector<int>> indices_;
+  size_t next_{0};
+};
+
 void ParseQuadraticCosts(const MathematicalProgram& prog,
+                         VariableIndices* indices,
                          Eigen::SparseMatrix<c_float>* P,
                          std::vector<c_float>* q, double* constant_cost_term) {
   DRAKE_ASSERT(static_cast<int>(q->size()) == prog.num_vars());
@@ -23,7 +61,7 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
     const VectorXDecisionVariable& x = quadratic_cost.variables();
     // x_indices are the indices of the variables x (the variables bound with
     // this quadratic cost) in the program decision variables.
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    const std::vector<int>& x_indices = indices->Find(prog, x);
 
     // Add quadratic_cost.Q to the Hessian P.
     const std::vector<Eigen::Triplet<double>> Qi_triplets =
@@ -53,19 +91,20 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
   P->setFromTriplets(P_triplets.begin(), P_triplets.end());
 }
 
-void ParseLinearCosts(const MathematicalProgram& prog, std::vector<c_float>* q,
+void ParseLinearCosts(const MathematicalProgram& prog,
+                      VariableIndices* indices, std::vector<c_float>* q,
                       double* constant_cost_term) {
   // Add the linear costs to the osqp cost.
   DRAKE_ASSERT(static_cast<int>(q->size()) == prog.num_vars());
 
   // Loop over the linear costs stored inside prog.
   for (const auto& linear_cost : prog.linear_costs()) {
+    const std::vector<int>& x_indices =
+        indices->Find(prog, linear_cost.variables());
     for (int i = 0; i < static_cast<int>(linear_cost.GetNumElements()); ++i) {
       // Append the linear cost term to q.
       if (linear_cost.evaluator()->a()(i) != 0) {
-        const int x_index =
-            prog.FindDecisionVariableIndex(linear_cost.variables()(i));
-        q->at(x_index) += linear_cost.evaluator()->a()(i);
+        q->at(x_indices[i]) += linear_cost.evaluator()->a()(i);
       }
     }
     // Add the constant cost term to constant_cost_term.
@@ -88,15 +127,15 @@ c_float ConvertInfinity(double val) {
 // LinearEqualityConstraint.
 template <typename C>
 void ParseLinearConstraints(
-    const MathematicalProgram& prog,
+    const MathematicalProgram& prog, VariableIndices* indices,
     const std::vector<Binding<C>>& linear_constraints,
     std::vector<Eigen::Triplet<c_float>>* A_triplets, std::vector<c_float>* l,
     std::vector<c_float>* u, int* num_A_rows,
     std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
   // Loop over the linear constraints, stack them to get l, u and A.
   for (const auto& constraint : linear_constraints) {
-    const std::vector<int> x_indices =
-        prog.FindDecisionVariableIndices(constraint.variables());
+    const std::vector<int>& x_indices =
+        indices->Find(prog, constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
         math::SparseMatrixToTriplets(constraint.evaluator()->A());
     const Binding<Constraint> constraint_cast =
@@ -120,7 +159,7 @@ void ParseLinearConstraints(
 }
 
 void ParseBoundingBoxConstraints(
-    const MathematicalProgram& prog,
+    const MathematicalProgram& prog, VariableIndices* indices,
     std::vector<Eigen::Triplet<c_float>>* A_triplets, std::vector<c_float>* l,
     std::vector<c_float>* u, int* num_A_rows,
     std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
@@ -129,12 +168,12 @@ void ParseBoundingBoxConstraints(
     const Binding<Constraint> constraint_cast =
         internal::BindingDynamicCast<Constraint>(constraint);
     constraint_start_row->emplace(constraint_cast, *num_A_rows);
+    const std::vector<int>& x_indices =
+        indices->Find(prog, constraint.variables());
     // Append constraint.A to osqp A.
     for (int i = 0; i < static_cast<int>(constraint.GetNumElements()); ++i) {
-      A_triplets->emplace_back(
-          *num_A_rows + i,
-          prog.FindDecisionVariableIndex(constraint.variables()(i)),
-          static_cast<c_float>(1));
+      A_triplets->emplace_back(*num_A_rows + i, x_indices[i],
+                               static_cast<c_float>(1));
     }
     const int num_Ai_rows = constraint.evaluator()->num_constraints();
     l->reserve(l->size() + num_Ai_rows);
@@ -148,18 +187,19 @@ void ParseBoundingBoxConstraints(
 }
 
 void ParseAllLinearConstraints(
-    const MathematicalProgram& prog, Eigen::SparseMatrix<c_float>* A,
+    const MathematicalProgram& prog, VariableIndices* indices,
+    Eigen::SparseMatrix<c_float>* A,
     std::vector<c_float>* l, std::vector<c_float>* u,
     std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
   std::vector<Eigen::Triplet<c_float>> A_triplets;
   l->clear();
   u->clear();
   int num_A_rows = 0;
-  ParseLinearConstraints(prog, prog.linear_constraints(), &A_triplets, l, u,
-                         &num_A_rows, constraint_start_row);
-  ParseLinearConstraints(prog, prog.linear_equality_constraints(), &A_triplets,
-                         l, u, &num_A_rows, constraint_start_row);
-  ParseBoundingBoxConstraints(prog, &A_triplets, l, u, &num_A_rows,
+  ParseLinearConstraints(prog, indices, prog.linear_constraints(),
+                         &A_triplets, l, u, &num_A_rows, constraint_start_row);
+  ParseLinearConstraints(prog, indices, prog.linear_equality_constraints(),
+                         &A_triplets, l, u, &num_A_rows, constraint_start_row);
+  ParseBoundingBoxConstraints(prog, indices, &A_triplets, l, u, &num_A_rows,
                               constraint_start_row);
   A->resize(num_A_rows, prog.num_vars());
   A->setFromTriplets(A_triplets.begin(), A_triplets.end());
@@ -189,6 +229,96 @@ csc* EigenSparseToCSC(const Eigen::SparseMatrix<c_float>& mat) {
                     inner_indices, outer_indices);
 }
 
+// Frees a csc matrix allocated by EigenSparseToCSC().
+void FreeCSC(csc* mat) {
+  if (mat != nullptr) {
+    c_free(mat->x);
+    c_free(mat->i);
+    c_free(mat->p);
+    c_free(mat);
+  }
+}
+
+// Returns true if @p a and @p b have the same size and sparsity pattern. Both
+// matrices must be compressed.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& a,
+                             const Eigen::SparseMatrix<c_float>& b) {
+  DRAKE_ASSERT(a.isCompressed() && b.isCompressed());
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true if the nonzero values of @p a and @p b are the same. The
+// matrices must have the same sparsity pattern.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  DRAKE_ASSERT(HaveSameSparsityPattern(a, b));
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
+// The QP parsed from a MathematicalProgram, in the form solved by OSQP
+// min 0.5 xᵀPx + qᵀx
+// s.t l ≤ Ax ≤ u
+struct OsqpProblem {
+  Eigen::SparseMatrix<c_float> P;
+  std::vector<c_float> q;
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+  double constant_cost_term{0};
+  // constraint_start_row[binding] stores the starting row index in A
+  // corresponding to the linear constraint `binding`.
+  std::unordered_map<Binding<Constraint>, int> constraint_start_row;
+};
+
+void ParseProblem(const MathematicalProgram& prog, VariableIndices* indices,
+                  OsqpProblem* problem) {
+  indices->Start(prog);
+  problem->q.assign(prog.num_vars(), 0);
+  problem->constant_cost_term = 0;
+  problem->constraint_start_row.clear();
+  ParseQuadraticCosts(prog, indices, &problem->P, &problem->q,
+                      &problem->constant_cost_term);
+  ParseLinearCosts(prog, indices, &problem->q, &problem->constant_cost_term);
+  ParseAllLinearConstraints(prog, indices, &problem->A, &problem->l,
+                            &problem->u, &problem->constraint_start_row);
+}
+
+// Sets up the OSQP workspace @p work for @p problem. OSQP copies the problem
+// data into the workspace, so nothing else needs to outlive this call.
+// Returns the error code of osqp_setup().
+c_int SetupWorkspace(const OsqpProblem& problem, const OSQPSettings& settings,
+                     OSQPWorkspace** work) {
+  OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  data->n = problem.P.cols();
+  data->m = problem.A.rows();
+  data->P = EigenSparseToCSC(problem.P);
+  data->q = const_cast<c_float*>(problem.q.data());
+  data->A = EigenSparseToCSC(problem.A);
+  data->l = const_cast<c_float*>(problem.l.data());
+  data->u = const_cast<c_float*>(problem.u.data());
+  const c_int osqp_setup_err = osqp_setup(work, data, &settings);
+  FreeCSC(data->P);
+  FreeCSC(data->A);
+  c_free(data);
+  return osqp_setup_err;
+}
+
+// Warm-starts the primal variables of @p work with @p initial_guess, unless
+// some of its entries are unset (NaN).
+void WarmStartFromInitialGuess(const Eigen::VectorXd& initial_guess,
+                               OSQPWorkspace* work) {
+  if (initial_guess.size() > 0 && initial_guess.allFinite()) {
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1> x =
+        initial_guess.cast<c_float>();
+    osqp_warm_start_x(work, x.data());
+  }
+}
+
 template <typename T1, typename T2>
 void SetOsqpSolverSetting(const std::unordered_map<std::string, T1>& options,
                           const std::string& option_name,
@@ -250,82 +380,15 @@ void SetDualSolution(
                                    constraint.evaluator()->num_constraints()));
   }
 }
-}  // namespace
-
-bool OsqpSolver::is_available() { return true; }
-
-void OsqpSolver::DoSolve(
-    const MathematicalProgram& prog,
-    const Eigen::VectorXd& initial_guess,
-    const SolverOptions& merged_options,
-    MathematicalProgramResult* result) const {
-  if (!prog.GetVariableScaling().empty()) {
-    static const logging::Warn log_once(
-      "OsqpSolver doesn't support the feature of variable scaling.");
-  }
 
+// Solves the problem set up in @p work, and stores the result.
+void SolveAndExtractResult(const MathematicalProgram& prog,
+                           const OsqpProblem& problem, OSQPWorkspace* work,
+                           std::optional<SolutionResult> solution_result,
+                           MathematicalProgramResult* result) {
   OsqpSolverDetails& solver_details =
       result->SetSolverDetailsType<OsqpSolverDetails>();
 
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
-
-  // OSQP solves a convex quadratic programming problem
-  // min 0.5 xᵀPx + qᵀx
-  // s.t l ≤ Ax ≤ u
-  // OSQP is written in C, so this function will be in C style.
-
-  // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
-  double constant_cost_term{0};
-
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
-  ParseLinearCosts(prog, &q, &constant_cost_term);
-
-  // linear_constraint_start_row[binding] stores the starting row index in A
-  // corresponding to the linear constraint `binding`.
-  std::unordered_map<Binding<Constraint>, int> constraint_start_row;
-
-  // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
-  std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
-
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-
-  SetOsqpSolverSettings(merged_options, settings);
-
-  // If any step fails, it will set the solution_result and skip other steps.
-  std::optional<SolutionResult> solution_result;
-
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
-    if (osqp_setup_err != 0) {
-      solution_result = SolutionResult::kInvalidInput;
-    }
-  }
-
   // Solve problem.
   if (!solution_result) {
     DRAKE_THROW_UNLESS(work != nullptr);
@@ -354,16 +417,17 @@ void OsqpSolver::DoSolve(
         const Eigen::Map<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> osqp_sol(
             work->solution->x, prog.num_vars());
         result->set_x_val(osqp_sol.cast<double>());
-        result->set_optimal_cost(work->info->obj_val + constant_cost_term);
+        result->set_optimal_cost(work->info->obj_val +
+                                 problem.constant_cost_term);
         solver_details.y =
             Eigen::Map<Eigen::VectorXd>(work->solution->y, work->data->m);
         solution_result = SolutionResult::kSolutionFound;
         SetDualSolution(prog.linear_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.linear_equality_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.bounding_box_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
 
         break;
       }
@@ -389,20 +453,175 @@ void OsqpSolver::DoSolve(
     }
   }
   result->set_solution_result(solution_result.value());
+}
+}  // namespace
+
+bool OsqpSolver::is_available() { return true; }
+
+void OsqpSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+      "OsqpSolver doesn't support the feature of variable scaling.");
+  }
+
+  // OSQP solves a convex quadratic programming problem
+  // min 0.5 xᵀPx + qᵀx
+  // s.t l ≤ Ax ≤ u
+  // OSQP is written in C, so this function will be in C style.
+  OsqpProblem problem;
+  VariableIndices indices;
+  ParseProblem(prog, &indices, &problem);
+
+  // Define Solver settings as default.
+  // Problem settings
+  OSQPSettings* settings =
+      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+  osqp_set_default_settings(settings);
+
+  SetOsqpSolverSettings(merged_options, settings);
+
+  // If any step fails, it will set the solution_result and skip other steps.
+  std::optional<SolutionResult> solution_result;
+
+  // Setup workspace.
+  OSQPWorkspace* work = nullptr;
+  if (SetupWorkspace(problem, *settings, &work) != 0) {
+    solution_result = SolutionResult::kInvalidInput;
+  } else {
+    WarmStartFromInitialGuess(initial_guess, work);
+  }
+
+  SolveAndExtractResult(prog, problem, work, solution_result, result);
 
   // Clean workspace.
   osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
   c_free(settings);
 }
 
+class OsqpSolverSession::Impl {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
+
+  Impl() = default;
+
+  ~Impl() { Reset(); }
+
+  void Reset() {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+    reused_workspace_ = false;
+  }
+
+  bool reused_workspace() const { return reused_workspace_; }
+
+  void Solve(const MathematicalProgram& prog,
+             const Eigen::VectorXd& initial_guess,
+             const SolverOptions& merged_options,
+             MathematicalProgramResult* result) {
+    // The variable indices are reused while the structure of prog does not
+    // change, so that only the coefficients are parsed again.
+    OsqpProblem problem;
+    ParseProblem(prog, &indices_, &problem);
+
+    OSQPSettings settings;
+    osqp_set_default_settings(&settings);
+    SetOsqpSolverSettings(merged_options, &settings);
+    // Warm start from the previous primal and dual solutions.
+    settings.warm_start = 1;
+
+    reused_workspace_ =
+        work_ != nullptr && CanReuseWorkspace(problem, settings);
+    std::optional<SolutionResult> solution_result;
+    if (reused_workspace_) {
+      // Only the values change, so OSQP keeps its (symbolic) factorization and
+      // its previous iterates.
+      c_int update_err = osqp_update_lin_cost(work_, problem.q.data());
+      if (update_err == 0) {
+        update_err = osqp_update_bounds(work_, problem.l.data(),
+                                        problem.u.data());
+      }
+      // Updating P or A triggers a numeric refactorization, so we skip it
+      // when their values did not change.
+      if (update_err == 0 && !(HaveSameValues(problem.P, problem_.P) &&
+                               HaveSameValues(problem.A, problem_.A))) {
+        update_err = osqp_update_P_A(
+            work_, problem.P.valuePtr(), OSQP_NULL, problem.P.nonZeros(),
+            problem.A.valuePtr(), OSQP_NULL, problem.A.nonZeros());
+      }
+      if (update_err != 0) {
+        solution_result = SolutionResult::kInvalidInput;
+        Reset();
+      }
+    } else {
+      Reset();
+      if (SetupWorkspace(problem, settings, &work_) != 0) {
+        solution_result = SolutionResult::kInvalidInput;
+        osqp_cleanup(work_);
+        work_ = nullptr;
+      }
+    }
+    if (!solution_result) {
+      WarmStartFromInitialGuess(initial_guess, work_);
+    }
+
+    SolveAndExtractResult(prog, problem, work_, solution_result, result);
+
+    problem_ = std::move(problem);
+    settings_ = settings;
+  }
+
+ private:
+  // Returns true if the workspace was set up for a problem with the same
+  // dimensions and sparsity pattern as @p problem, with the same @p settings.
+  bool CanReuseWorkspace(const OsqpProblem& problem,
+                         const OSQPSettings& settings) const {
+    return HaveSameSparsityPattern(problem.P, problem_.P) &&
+           HaveSameSparsityPattern(problem.A, problem_.A) &&
+           settings.rho == settings_.rho && settings.sigma == settings_.sigma &&
+           settings.scaling == settings_.scaling &&
+           settings.max_iter == settings_.max_iter &&
+           settings.polish_refine_iter == settings_.polish_refine_iter &&
+           settings.verbose == settings_.verbose &&
+           settings.polish == settings_.polish;
+  }
+
+  OSQPWorkspace* work_{nullptr};
+  VariableIndices indices_;
+  // The problem and the settings of the previous solve.
+  OsqpProblem problem_;
+  OSQPSettings settings_{};
+  bool reused_workspace_{false};
+};
+
+OsqpSolverSession::OsqpSolverSession()
+    : SolverBase(&OsqpSolver::id, &OsqpSolver::is_available,
+                 &OsqpSolver::is_enabled,
+                 &OsqpSolver::ProgramAttributesSatisfied),
+      impl_{std::make_unique<Impl>()} {}
+
+OsqpSolverSession::~OsqpSolverSession() = default;
+
+void OsqpSolverSession::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+      "OsqpSolverSession doesn't support the feature of variable scaling.");
+  }
+  impl_->Solve(prog, initial_guess, merged_options, result);
+}
+
+bool OsqpSolverSession::reused_workspace() const {
+  return impl_->reused_workspace();
+}
+
+void OsqpSolverSession::Reset() { impl_->Reset(); }
+
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -60,5 +62,55 @@ class OsqpSolver final : public SolverBase {
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
 };
+
+/**
+ * Solves a sequence of QPs with OSQP, keeping the OSQP workspace alive between
+ * the solves. This is intended for applications such as MPC or differential
+ * inverse kinematics, which repeatedly solve QPs whose matrices keep the same
+ * sparsity pattern while their values change.
+ *
+ * When a QP has the same sparsity pattern in P and A (see OsqpSolver) and is
+ * solved with the same OSQP settings as the previous one, only the changed
+ * data is passed to OSQP (via `osqp_update_lin_cost`, `osqp_update_bounds`
+ * and, if needed, `osqp_update_P_A`), so the KKT system is not set up nor
+ * symbolically factored again. The solve is then warm-started from the primal
+ * and dual solution of the previous solve. Otherwise, the workspace is set up
+ * from scratch as in OsqpSolver.
+ *
+ * In both cases, an initial guess without NaN entries (see
+ * MathematicalProgram::SetInitialGuess()) overrides the warm start of the
+ * primal variables.
+ *
+ * The results are the same type as those of OsqpSolver, i.e., the details can
+ * be obtained by MathematicalProgramResult::get_solver_details<OsqpSolver>().
+ *
+ * This class is not thread-safe, even through its const methods, as the
+ * workspace is modified by each solve.
+ */
+class OsqpSolverSession final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolverSession)
+
+  OsqpSolverSession();
+  ~OsqpSolverSession() final;
+
+  /// Returns true if the most recent solve reused the workspace of the solve
+  /// before it.
+  bool reused_workspace() const;
+
+  /// Discards the workspace, so that the next solve sets it up from scratch.
+  void Reset();
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  class Impl;
+
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+
+  std::unique_ptr<Impl> impl_;
+};
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,647 @@
+#include "drake/solvers/presolve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <unordered_set>
+
+namespace drake {
+namespace solvers {
+namespace {
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using Terms = std::vector<std::pair<int, double>>;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Returns the nonzero terms of the i'th row of A * vars, sorted by the
+// variable index in prog. A variable appearing several times in vars gets the
+// sum of its coefficients.
+Terms GetRowTerms(const MathematicalProgram& prog, const MatrixXd& A, int i,
+                  const VectorXDecisionVariable& vars) {
+  std::map<int, double> coefficients;
+  for (int j = 0; j < A.cols(); ++j) {
+    if (A(i, j) != 0) {
+      coefficients[prog.FindDecisionVariableIndex(vars(j))] += A(i, j);
+    }
+  }
+  Terms terms;
+  for (const auto& [variable, coefficient] : coefficients) {
+    if (coefficient != 0) {
+      terms.emplace_back(variable, coefficient);
+    }
+  }
+  return terms;
+}
+
+// Returns true if the lower bound lb exceeds the upper bound ub by more than
+// the round-off error.
+bool ExceedsBound(double lb, double ub) {
+  return lb > ub + 1E-9 * std::max({1.0, std::abs(lb), std::abs(ub)});
+}
+}  // namespace
+
+Presolver::Presolver(const MathematicalProgram& prog)
+    : prog_(&prog),
+      presolved_program_(std::make_unique<MathematicalProgram>()) {
+  const int num_vars = prog.num_vars();
+  lower_bounds_ = VectorXd::Constant(num_vars, -kInf);
+  upper_bounds_ = VectorXd::Constant(num_vars, kInf);
+  lower_sources_.resize(num_vars);
+  upper_sources_.resize(num_vars);
+
+  // Only the variables that appear in linear or quadratic costs, and linear or
+  // bounding box constraints, can be eliminated.
+  std::vector<bool> is_eliminable(num_vars, true);
+  auto mark_not_eliminable = [&prog, &is_eliminable](const auto& bindings) {
+    for (const auto& binding : bindings) {
+      for (int i = 0; i < binding.variables().rows(); ++i) {
+        is_eliminable[prog.FindDecisionVariableIndex(
+            binding.variables()(i))] = false;
+      }
+    }
+  };
+  mark_not_eliminable(prog.generic_costs());
+  mark_not_eliminable(prog.generic_constraints());
+  mark_not_eliminable(prog.lorentz_cone_constraints());
+  mark_not_eliminable(prog.rotated_lorentz_cone_constraints());
+  mark_not_eliminable(prog.positive_semidefinite_constraints());
+  mark_not_eliminable(prog.linear_matrix_inequality_constraints());
+  mark_not_eliminable(prog.exponential_cone_constraints());
+  mark_not_eliminable(prog.linear_complementarity_constraints());
+  mark_not_eliminable(prog.visualization_callbacks());
+
+  // The bounds of the variables.
+  const auto& bounding_boxes = prog.bounding_box_constraints();
+  for (int b = 0; b < static_cast<int>(bounding_boxes.size()); ++b) {
+    const auto& binding = bounding_boxes[b];
+    for (int i = 0; i < binding.variables().rows(); ++i) {
+      const int j = prog.FindDecisionVariableIndex(binding.variables()(i));
+      if (binding.evaluator()->lower_bound()(i) > lower_bounds_(j)) {
+        lower_bounds_(j) = binding.evaluator()->lower_bound()(i);
+        lower_sources_[j] = {BoundSource::Type::kBoundingBox, b, i, 1};
+      }
+      if (binding.evaluator()->upper_bound()(i) < upper_bounds_(j)) {
+        upper_bounds_(j) = binding.evaluator()->upper_bound()(i);
+        upper_sources_[j] = {BoundSource::Type::kBoundingBox, b, i, 1};
+      }
+    }
+  }
+
+  // The rows of the linear constraints.
+  auto add_rows = [this, &prog](const auto& bindings,
+                                bool is_equality_binding) {
+    for (int b = 0; b < static_cast<int>(bindings.size()); ++b) {
+      const auto& binding = bindings[b];
+      const MatrixXd& A = binding.evaluator()->A();
+      for (int i = 0; i < A.rows(); ++i) {
+        rows_.push_back({GetRowTerms(prog, A, i, binding.variables()),
+                         binding.evaluator()->lower_bound()(i),
+                         binding.evaluator()->upper_bound()(i),
+                         is_equality_binding, b, i});
+      }
+    }
+  };
+  add_rows(prog.linear_constraints(), false);
+  add_rows(prog.linear_equality_constraints(), true);
+  for (int r = 0; r < static_cast<int>(rows_.size()); ++r) {
+    PresolvedRow row;
+    row.terms = rows_[r].terms;
+    row.lb = rows_[r].lb;
+    row.ub = rows_[r].ub;
+    row.lower_source = {BoundSource::Type::kRow, r, -1, 1};
+    row.upper_source = row.lower_source;
+    presolved_rows_.push_back(row);
+  }
+
+  // Divides the row by c ≠ 0, and updates the sources of its bounds.
+  auto divide_row = [](double c, PresolvedRow* row) {
+    for (auto& term : row->terms) {
+      term.second /= c;
+    }
+    double lb = row->lb / c;
+    double ub = row->ub / c;
+    row->lower_source.factor *= c;
+    row->upper_source.factor *= c;
+    if (c < 0) {
+      std::swap(lb, ub);
+      std::swap(row->lower_source, row->upper_source);
+    }
+    row->lb = lb;
+    row->ub = ub;
+  };
+  auto remove_row = [this](PresolvedRow* row) {
+    row->active = false;
+    ++num_removed_rows_;
+  };
+
+  std::vector<bool> is_eliminated(num_vars, false);
+  bool changed = true;
+  while (changed && !is_infeasible_) {
+    changed = false;
+    // Maps the terms of the rows scaled to have a largest coefficient of 1, to
+    // the index of the first such row.
+    std::map<Terms, int> scaled_rows;
+    for (int r = 0; r < static_cast<int>(presolved_rows_.size()); ++r) {
+      PresolvedRow& row = presolved_rows_[r];
+      if (!row.active) {
+        continue;
+      }
+      // Substitutes the eliminated variables with their values.
+      Terms terms;
+      for (const auto& [variable, coefficient] : row.terms) {
+        if (is_eliminated[variable]) {
+          row.lb -= coefficient * lower_bounds_(variable);
+          row.ub -= coefficient * lower_bounds_(variable);
+        } else {
+          terms.emplace_back(variable, coefficient);
+        }
+      }
+      row.terms = std::move(terms);
+      if (row.terms.empty()) {
+        if (ExceedsBound(row.lb, 0) || ExceedsBound(0, row.ub)) {
+          is_infeasible_ = true;
+        }
+        remove_row(&row);
+        changed = true;
+        continue;
+      }
+      const auto largest = std::max_element(
+          row.terms.begin(), row.terms.end(),
+          [](const auto& term1, const auto& term2) {
+            return std::abs(term1.second) < std::abs(term2.second);
+          });
+      divide_row(largest->second, &row);
+      if (row.terms.size() == 1) {
+        // The row lb ≤ xⱼ ≤ ub is a bound on xⱼ.
+        const int j = row.terms[0].first;
+        if (row.lb > lower_bounds_(j)) {
+          lower_bounds_(j) = row.lb;
+          lower_sources_[j] = row.lower_source;
+        }
+        if (row.ub < upper_bounds_(j)) {
+          upper_bounds_(j) = row.ub;
+          upper_sources_[j] = row.upper_source;
+        }
+        remove_row(&row);
+        changed = true;
+        continue;
+      }
+      const auto [it, inserted] = scaled_rows.emplace(row.terms, r);
+      if (!inserted) {
+        // Merges the row into an identical one.
+        PresolvedRow& merged_row = presolved_rows_[it->second];
+        if (row.lb > merged_row.lb) {
+          merged_row.lb = row.lb;
+          merged_row.lower_source = row.lower_source;
+        }
+        if (row.ub < merged_row.ub) {
+          merged_row.ub = row.ub;
+          merged_row.upper_source = row.upper_source;
+        }
+        if (ExceedsBound(merged_row.lb, merged_row.ub)) {
+          is_infeasible_ = true;
+        }
+        remove_row(&row);
+        changed = true;
+      }
+    }
+    // Eliminates the fixed variables.
+    for (int j = 0; j < num_vars && !is_infeasible_; ++j) {
+      if (is_eliminated[j]) {
+        continue;
+      }
+      if (ExceedsBound(lower_bounds_(j), upper_bounds_(j))) {
+        is_infeasible_ = true;
+      } else if (is_eliminable[j] && std::isfinite(lower_bounds_(j)) &&
+                 lower_bounds_(j) >= upper_bounds_(j)) {
+        is_eliminated[j] = true;
+        eliminated_variables_.push_back(j);
+        changed = true;
+      }
+    }
+  }
+  num_eliminated_variables_ = static_cast<int>(eliminated_variables_.size());
+  has_reductions_ = is_infeasible_ || num_removed_rows_ > 0 ||
+                    num_eliminated_variables_ > 0;
+  if (is_infeasible_ || !has_reductions_) {
+    return;
+  }
+  presolved_variable_index_.assign(num_vars, -1);
+  int num_presolved_vars = 0;
+  for (int j = 0; j < num_vars; ++j) {
+    if (!is_eliminated[j]) {
+      presolved_variable_index_[j] = num_presolved_vars++;
+    }
+  }
+  BuildPresolvedProgram();
+}
+
+Presolver::~Presolver() = default;
+
+void Presolver::BuildPresolvedProgram() {
+  const MathematicalProgram& prog = *prog_;
+  const int num_vars = prog.num_vars();
+  auto index = [&prog](const symbolic::Variable& var) {
+    return prog.FindDecisionVariableIndex(var);
+  };
+  auto is_eliminated = [this, &index](const symbolic::Variable& var) {
+    return presolved_variable_index_[index(var)] < 0;
+  };
+
+  VectorXDecisionVariable presolved_vars(num_vars - num_eliminated_variables_);
+  for (int j = 0; j < num_vars; ++j) {
+    if (presolved_variable_index_[j] >= 0) {
+      presolved_vars(presolved_variable_index_[j]) = prog.decision_variable(j);
+    }
+  }
+  presolved_program_->AddDecisionVariables(presolved_vars);
+  // SetVariableScaling() looks up the variables in the presolved program, which
+  // remaps their indices. The scaling of the eliminated variables is dropped.
+  for (const auto& [j, scale] : prog.GetVariableScaling()) {
+    if (presolved_variable_index_[j] >= 0) {
+      presolved_program_->SetVariableScaling(prog.decision_variable(j), scale);
+    }
+  }
+
+  // Substitutes the eliminated variables in the linear and quadratic costs.
+  for (const auto& binding : prog.linear_costs()) {
+    const VectorXDecisionVariable& vars = binding.variables();
+    const VectorXd& a = binding.evaluator()->a();
+    double b = binding.evaluator()->b();
+    std::vector<int> kept;
+    for (int i = 0; i < vars.rows(); ++i) {
+      if (is_eliminated(vars(i))) {
+        b += a(i) * lower_bounds_(index(vars(i)));
+      } else {
+        kept.push_back(i);
+      }
+    }
+    if (static_cast<int>(kept.size()) == vars.rows()) {
+      presolved_program_->AddCost(binding);
+    } else if (kept.empty()) {
+      constant_cost_ += b;
+    } else {
+      VectorXd kept_a(kept.size());
+      VectorXDecisionVariable kept_vars(kept.size());
+      for (int k = 0; k < static_cast<int>(kept.size()); ++k) {
+        kept_a(k) = a(kept[k]);
+        kept_vars(k) = vars(kept[k]);
+      }
+      presolved_program_->AddLinearCost(kept_a, b, kept_vars);
+    }
+  }
+  for (const auto& binding : prog.quadratic_costs()) {
+    const VectorXDecisionVariable& vars = binding.variables();
+    const MatrixXd& Q = binding.evaluator()->Q();
+    const VectorXd& b = binding.evaluator()->b();
+    std::vector<int> kept;
+    // The values of the eliminated variables, and 0 for the other ones.
+    VectorXd fixed_values = VectorXd::Zero(vars.rows());
+    for (int i = 0; i < vars.rows(); ++i) {
+      if (is_eliminated(vars(i))) {
+        fixed_values(i) = lower_bounds_(index(vars(i)));
+      } else {
+        kept.push_back(i);
+      }
+    }
+    if (static_cast<int>(kept.size()) == vars.rows()) {
+      presolved_program_->AddCost(binding);
+      continue;
+    }
+    // With x = y + fixed_values, where y is zero at the eliminated variables,
+    // 0.5 xᵀQx + bᵀx + c = 0.5 yᵀQy + (b + 0.5 (Q + Qᵀ) fixed_values)ᵀy +
+    // 0.5 fixed_valuesᵀQ fixed_values + bᵀfixed_values + c.
+    const VectorXd linear_coeff =
+        b + 0.5 * (Q + Q.transpose()) * fixed_values;
+    const double constant = 0.5 * fixed_values.dot(Q * fixed_values) +
+                            b.dot(fixed_values) + binding.evaluator()->c();
+    if (kept.empty()) {
+      constant_cost_ += constant;
+      continue;
+    }
+    MatrixXd kept_Q(kept.size(), kept.size());
+    VectorXd kept_b(kept.size());
+    VectorXDecisionVariable kept_vars(kept.size());
+    for (int k = 0; k < static_cast<int>(kept.size()); ++k) {
+      for (int l = 0; l < static_cast<int>(kept.size()); ++l) {
+        kept_Q(k, l) = Q(kept[k], kept[l]);
+      }
+      kept_b(k) = linear_coeff(kept[k]);
+      kept_vars(k) = vars(kept[k]);
+    }
+    presolved_program_->AddQuadraticCost(kept_Q, kept_b, constant, kept_vars);
+  }
+  for (const auto& binding : prog.generic_costs()) {
+    presolved_program_->AddCost(binding);
+  }
+
+  // The constraints that are not presolved.
+  auto add_constraints = [this](const auto& bindings) {
+    for (const auto& binding : bindings) {
+      presolved_program_->AddConstraint(binding);
+    }
+  };
+  add_constraints(prog.generic_constraints());
+  add_constraints(prog.lorentz_cone_constraints());
+  add_constraints(prog.rotated_lorentz_cone_constraints());
+  add_constraints(prog.positive_semidefinite_constraints());
+  add_constraints(prog.linear_matrix_inequality_constraints());
+  add_constraints(prog.exponential_cone_constraints());
+  add_constraints(prog.linear_complementarity_constraints());
+  for (const auto& binding : prog.visualization_callbacks()) {
+    const std::shared_ptr<VisualizationCallback> callback =
+        binding.evaluator();
+    presolved_program_->AddVisualizationCallback(
+        [callback](const Eigen::Ref<const VectorXd>& x) {
+          callback->EvalCallback(x);
+        },
+        binding.variables());
+  }
+
+  // The remaining rows are grouped by the binding of the original row they
+  // started from, and split into the equality and the inequality rows.
+  std::map<std::pair<bool, int>, std::vector<int>> rows_by_binding;
+  for (int r = 0; r < static_cast<int>(presolved_rows_.size()); ++r) {
+    if (presolved_rows_[r].active) {
+      rows_by_binding[{rows_[r].is_equality_binding, rows_[r].binding_index}]
+          .push_back(r);
+    }
+  }
+  auto add_rows = [this, &prog](const std::vector<int>& rows,
+                                bool is_equality) {
+    if (rows.empty()) {
+      return;
+    }
+    // Maps the variable index in prog to the column in A.
+    std::map<int, int> columns;
+    for (int r : rows) {
+      for (const auto& term : presolved_rows_[r].terms) {
+        columns.emplace(term.first, 0);
+      }
+    }
+    VectorXDecisionVariable vars(columns.size());
+    int column = 0;
+    for (auto& [variable, variable_column] : columns) {
+      variable_column = column;
+      vars(column++) = prog.decision_variable(variable);
+    }
+    MatrixXd A = MatrixXd::Zero(rows.size(), columns.size());
+    VectorXd lb(rows.size());
+    VectorXd ub(rows.size());
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+      PresolvedRow& row = presolved_rows_[rows[i]];
+      for (const auto& [variable, coefficient] : row.terms) {
+        A(i, columns.at(variable)) = coefficient;
+      }
+      lb(i) = row.lb;
+      ub(i) = row.ub;
+      row.binding_index = static_cast<int>(presolved_linear_bindings_.size());
+      row.row_in_binding = i;
+    }
+    if (is_equality) {
+      presolved_linear_bindings_.push_back(
+          presolved_program_->AddLinearEqualityConstraint(A, lb, vars));
+    } else {
+      presolved_linear_bindings_.push_back(
+          presolved_program_->AddLinearConstraint(A, lb, ub, vars));
+    }
+  };
+  for (const auto& [binding, rows] : rows_by_binding) {
+    std::vector<int> equality_rows;
+    std::vector<int> inequality_rows;
+    for (int r : rows) {
+      if (presolved_rows_[r].lb == presolved_rows_[r].ub) {
+        equality_rows.push_back(r);
+      } else {
+        inequality_rows.push_back(r);
+      }
+    }
+    add_rows(inequality_rows, false);
+    add_rows(equality_rows, true);
+  }
+
+  // The bounds of the remaining variables.
+  for (int j = 0; j < num_vars; ++j) {
+    if (presolved_variable_index_[j] >= 0 &&
+        (std::isfinite(lower_bounds_(j)) || std::isfinite(upper_bounds_(j)))) {
+      bounded_variables_.push_back(j);
+    }
+  }
+  if (!bounded_variables_.empty()) {
+    VectorXd lb(bounded_variables_.size());
+    VectorXd ub(bounded_variables_.size());
+    VectorXDecisionVariable vars(bounded_variables_.size());
+    for (int i = 0; i < static_cast<int>(bounded_variables_.size()); ++i) {
+      const int j = bounded_variables_[i];
+      lb(i) = lower_bounds_(j);
+      ub(i) = std::max(lower_bounds_(j), upper_bounds_(j));
+      vars(i) = prog.decision_variable(j);
+    }
+    presolved_bounding_box_ =
+        presolved_program_->AddBoundingBoxConstraint(lb, ub, vars);
+  }
+}
+
+VectorXd Presolver::PresolveVariableValues(const VectorXd& x) const {
+  DRAKE_DEMAND(x.rows() == prog_->num_vars());
+  if (!has_reductions_ || is_infeasible_) {
+    return x;
+  }
+  VectorXd presolved_x(presolved_program_->num_vars());
+  for (int j = 0; j < x.rows(); ++j) {
+    if (presolved_variable_index_[j] >= 0) {
+      presolved_x(presolved_variable_index_[j]) = x(j);
+    }
+  }
+  return presolved_x;
+}
+
+VectorXd Presolver::LinearAndQuadraticCostGradient(const VectorXd& x) const {
+  VectorXd gradient = VectorXd::Zero(x.rows());
+  for (const auto& binding : prog_->linear_costs()) {
+    for (int i = 0; i < binding.variables().rows(); ++i) {
+      gradient(prog_->FindDecisionVariableIndex(binding.variables()(i))) +=
+          binding.evaluator()->a()(i);
+    }
+  }
+  for (const auto& binding : prog_->quadratic_costs()) {
+    const int num_binding_vars = binding.variables().rows();
+    std::vector<int> indices(num_binding_vars);
+    VectorXd binding_x(num_binding_vars);
+    for (int i = 0; i < num_binding_vars; ++i) {
+      indices[i] = prog_->FindDecisionVariableIndex(binding.variables()(i));
+      binding_x(i) = x(indices[i]);
+    }
+    const MatrixXd& Q = binding.evaluator()->Q();
+    const VectorXd binding_gradient =
+        0.5 * (Q + Q.transpose()) * binding_x + binding.evaluator()->b();
+    for (int i = 0; i < num_binding_vars; ++i) {
+      gradient(indices[i]) += binding_gradient(i);
+    }
+  }
+  return gradient;
+}
+
+MathematicalProgramResult Presolver::Postsolve(
+    const MathematicalProgramResult& presolved_result) const {
+  DRAKE_DEMAND(has_reductions_);
+  const MathematicalProgram& prog = *prog_;
+  MathematicalProgramResult result;
+  result.set_solver_id(presolved_result.get_solver_id());
+  result.set_decision_variable_index(prog.decision_variable_index());
+  if (is_infeasible_) {
+    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
+    result.set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+    return result;
+  }
+  const bool is_solved = presolved_program_->num_vars() > 0;
+  if (is_solved) {
+    result.solver_details_ = presolved_result.solver_details_;
+    result.set_solution_result(presolved_result.get_solution_result());
+    result.set_optimal_cost(presolved_result.get_optimal_cost() +
+                            constant_cost_);
+  } else {
+    result.set_solution_result(SolutionResult::kSolutionFound);
+    result.set_optimal_cost(constant_cost_);
+  }
+
+  auto postsolve_variable_values = [this](const VectorXd& presolved_x) {
+    VectorXd x(prog_->num_vars());
+    for (int j = 0; j < x.rows(); ++j) {
+      x(j) = presolved_variable_index_[j] >= 0
+                 ? presolved_x(presolved_variable_index_[j])
+                 : lower_bounds_(j);
+    }
+    return x;
+  };
+  const VectorXd x = postsolve_variable_values(
+      is_solved ? presolved_result.get_x_val() : VectorXd(0));
+  result.set_x_val(x);
+  for (int k = 0; k < presolved_result.num_suboptimal_solution(); ++k) {
+    result.AddSuboptimalSolution(
+        presolved_result.get_suboptimal_objective(k) + constant_cost_,
+        postsolve_variable_values(presolved_result.suboptimal_x_val_[k]));
+  }
+
+  // The dual solutions of the constraints passed through.
+  std::unordered_set<const EvaluatorBase*> presolved_evaluators;
+  for (const auto& binding : presolved_linear_bindings_) {
+    presolved_evaluators.insert(binding.evaluator().get());
+  }
+  if (presolved_bounding_box_) {
+    presolved_evaluators.insert(presolved_bounding_box_->evaluator().get());
+  }
+  for (const auto& [binding, dual] : presolved_result.dual_solutions_) {
+    if (presolved_evaluators.count(binding.evaluator().get()) == 0) {
+      result.dual_solutions_.emplace(binding, dual);
+    }
+  }
+
+  // The dual solutions of the presolved linear constraints.
+  auto find_dual = [&presolved_result](const auto& binding) {
+    return presolved_result.dual_solutions_.find(
+        internal::BindingDynamicCast<Constraint>(binding));
+  };
+  for (const auto& binding : presolved_linear_bindings_) {
+    if (find_dual(binding) == presolved_result.dual_solutions_.end()) {
+      return result;
+    }
+  }
+  if (presolved_bounding_box_ &&
+      find_dual(*presolved_bounding_box_) ==
+          presolved_result.dual_solutions_.end()) {
+    return result;
+  }
+  auto zero_duals = [](const auto& bindings) {
+    std::vector<VectorXd> duals;
+    for (const auto& binding : bindings) {
+      duals.push_back(VectorXd::Zero(binding.evaluator()->num_constraints()));
+    }
+    return duals;
+  };
+  std::vector<VectorXd> linear_duals = zero_duals(prog.linear_constraints());
+  std::vector<VectorXd> equality_duals =
+      zero_duals(prog.linear_equality_constraints());
+  std::vector<VectorXd> bounding_box_duals =
+      zero_duals(prog.bounding_box_constraints());
+  auto row_dual = [&](int r) -> double& {
+    const Row& row = rows_[r];
+    return row.is_equality_binding
+               ? equality_duals[row.binding_index](row.row_in_binding)
+               : linear_duals[row.binding_index](row.row_in_binding);
+  };
+  // A constraint whose lower bound is determined by lower_source, and upper
+  // bound by upper_source, has the dual solution `dual`: the dual solution is
+  // assigned to the source of the active bound.
+  auto assign_dual = [&](const BoundSource& lower_source,
+                         const BoundSource& upper_source, double dual) {
+    const BoundSource& source = dual >= 0 ? lower_source : upper_source;
+    switch (source.type) {
+      case BoundSource::Type::kNone: {
+        break;
+      }
+      case BoundSource::Type::kBoundingBox: {
+        bounding_box_duals[source.index](source.entry) += dual / source.factor;
+        break;
+      }
+      case BoundSource::Type::kRow: {
+        row_dual(source.index) += dual / source.factor;
+        break;
+      }
+    }
+  };
+  for (const PresolvedRow& row : presolved_rows_) {
+    if (row.active) {
+      const double dual =
+          find_dual(presolved_linear_bindings_[row.binding_index])
+              ->second(row.row_in_binding);
+      assign_dual(row.lower_source, row.upper_source, dual);
+    }
+  }
+  if (presolved_bounding_box_) {
+    const VectorXd& dual = find_dual(*presolved_bounding_box_)->second;
+    for (int i = 0; i < static_cast<int>(bounded_variables_.size()); ++i) {
+      const int j = bounded_variables_[i];
+      assign_dual(lower_sources_[j], upper_sources_[j], dual(i));
+    }
+  }
+  // The bound of an eliminated variable xⱼ gets its reduced cost
+  // ∂cost/∂xⱼ - ∑ᵣ λᵣ aᵣⱼ. The rows whose dual solutions depend on the reduced
+  // cost of xⱼ only contain variables eliminated before xⱼ, so the variables
+  // are processed in the reverse order of elimination.
+  if (!eliminated_variables_.empty()) {
+    std::vector<std::vector<std::pair<int, double>>> variable_rows(
+        prog.num_vars());
+    for (int r = 0; r < static_cast<int>(rows_.size()); ++r) {
+      for (const auto& [variable, coefficient] : rows_[r].terms) {
+        variable_rows[variable].emplace_back(r, coefficient);
+      }
+    }
+    const VectorXd gradient = LinearAndQuadraticCostGradient(x);
+    for (auto it = eliminated_variables_.rbegin();
+         it != eliminated_variables_.rend(); ++it) {
+      const int j = *it;
+      double reduced_cost = gradient(j);
+      for (const auto& [r, coefficient] : variable_rows[j]) {
+        reduced_cost -= row_dual(r) * coefficient;
+      }
+      assign_dual(lower_sources_[j], upper_sources_[j], reduced_cost);
+    }
+  }
+  auto set_duals = [&result](const auto& bindings,
+                             const std::vector<VectorXd>& duals) {
+    for (int b = 0; b < static_cast<int>(bindings.size()); ++b) {
+      result.set_dual_solution(bindings[b], duals[b]);
+    }
+  };
+  set_duals(prog.linear_constraints(), linear_duals);
+  set_duals(prog.linear_equality_constraints(), equality_duals);
+  set_duals(prog.bounding_box_constraints(), bounding_box_duals);
+  return result;
+}
+
+}  // namespace solvers
+}  // namespace drake
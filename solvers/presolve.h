@@ -0,0 +1,189 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Simplifies the linear constraints of a MathematicalProgram before it is
+ * passed to a solver, and maps the result of the simplified (presolved)
+ * program back to the original program. The presolve repeats the following
+ * reductions, until none of them applies:
+ *
+ * - A linear constraint row lb ≤ a xⱼ ≤ ub with a single variable (possibly
+ *   after the fixed variables are eliminated) tightens the bounds of xⱼ, and
+ *   is removed.
+ * - Linear constraint rows that are equal up to a scaling are merged into a
+ *   single row, with the intersection of their bounds.
+ * - A variable whose lower and upper bounds are equal is fixed to that value,
+ *   and eliminated from the program if it only appears in linear or quadratic
+ *   costs, and in linear (equality) or bounding box constraints.
+ * - A linear constraint row without any variable is removed; the program is
+ *   infeasible if the bounds of that row exclude 0.
+ *
+ * All the other costs and constraints are passed to the presolved program
+ * unchanged. The remaining linear constraint rows are scaled such that their
+ * largest coefficient is 1.
+ *
+ * The user normally doesn't construct a %Presolver, but asks the solver to
+ * presolve the program with
+ * SolverOptions::SetOption(CommonSolverOption::kPresolve, 1).
+ */
+class Presolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Presolver)
+
+  /**
+   * Presolves @p prog.
+   * @param prog The original program. Note that this is aliased for the
+   * lifetime of this object.
+   */
+  explicit Presolver(const MathematicalProgram& prog);
+
+  ~Presolver();
+
+  /**
+   * Returns true if the presolve removed any linear constraint row or
+   * eliminated any variable, or detected that the program is infeasible. If
+   * false, the original program can be solved directly.
+   */
+  bool has_reductions() const { return has_reductions_; }
+
+  /** Returns true if the presolve detected that the program is infeasible. */
+  bool is_infeasible() const { return is_infeasible_; }
+
+  /** Returns the number of linear constraint rows removed by the presolve. */
+  int num_removed_rows() const { return num_removed_rows_; }
+
+  /** Returns the number of variables eliminated by the presolve. */
+  int num_eliminated_variables() const { return num_eliminated_variables_; }
+
+  /**
+   * Returns the presolved program. Its decision variables are the original
+   * decision variables that were not eliminated. The presolved program is
+   * empty (and shouldn't be solved) if is_infeasible() is true.
+   */
+  const MathematicalProgram& presolved_program() const {
+    return *presolved_program_;
+  }
+
+  /**
+   * Returns the entries of @p x, a vector of values of the original decision
+   * variables, for the decision variables of presolved_program().
+   */
+  Eigen::VectorXd PresolveVariableValues(const Eigen::VectorXd& x) const;
+
+  /**
+   * Maps the result of solving presolved_program() back to the original
+   * program.
+   *
+   * The values of the eliminated variables are their fixed values, and the
+   * optimal cost includes the constant cost of the eliminated variables. The
+   * dual solutions of the linear (equality) and bounding box constraints of
+   * the original program are recovered if the solver computed the dual
+   * solutions of the presolved program: a removed row gets the dual solution
+   * of the bound or merged row that it determined (or 0 if it was redundant),
+   * and the bound of an eliminated variable gets its reduced cost. The dual
+   * solutions of the other constraints are passed through.
+   *
+   * @param presolved_result The result of solving presolved_program(). If
+   * is_infeasible() is true, or the presolved program has no decision
+   * variable, then only its solver id is used, and the program doesn't need
+   * to be solved.
+   */
+  MathematicalProgramResult Postsolve(
+      const MathematicalProgramResult& presolved_result) const;
+
+ private:
+  // The constraint that determines a bound, namely the bound is the
+  // corresponding bound of the constraint divided by `factor`.
+  struct BoundSource {
+    enum class Type { kNone, kBoundingBox, kRow };
+    Type type{Type::kNone};
+    // For kBoundingBox, the index of the binding in
+    // prog.bounding_box_constraints(). For kRow, the index in rows_.
+    int index{-1};
+    // For kBoundingBox, the row in the binding.
+    int entry{-1};
+    double factor{1};
+  };
+
+  // A row lb ≤ ∑ aᵢ xᵢ ≤ ub of a linear (equality) constraint in the original
+  // program.
+  struct Row {
+    // The (variable index, coefficient) pairs with nonzero coefficients.
+    std::vector<std::pair<int, double>> terms;
+    double lb{};
+    double ub{};
+    // The binding is prog.linear_equality_constraints()[binding_index] if
+    // is_equality_binding is true, otherwise prog.linear_constraints()[...].
+    bool is_equality_binding{};
+    int binding_index{};
+    int row_in_binding{};
+  };
+
+  // A row lb ≤ ∑ aᵢ xᵢ ≤ ub being presolved. presolved_rows_[i] starts as
+  // rows_[i], and it is kept in the presolved program if it is still active at
+  // the end of the presolve.
+  struct PresolvedRow {
+    std::vector<std::pair<int, double>> terms;
+    double lb{};
+    double ub{};
+    BoundSource lower_source;
+    BoundSource upper_source;
+    bool active{true};
+    // The index of the binding in presolved_linear_bindings_, and the row in
+    // that binding.
+    int binding_index{-1};
+    int row_in_binding{-1};
+  };
+
+  // Builds presolved_program_ from the active presolved rows, the bounds and
+  // the variables which are not eliminated.
+  void BuildPresolvedProgram();
+
+  // Computes the gradient of the linear and quadratic costs with respect to
+  // the original decision variables at x.
+  Eigen::VectorXd LinearAndQuadraticCostGradient(
+      const Eigen::VectorXd& x) const;
+
+  const MathematicalProgram* const prog_;
+  std::unique_ptr<MathematicalProgram> presolved_program_;
+
+  bool has_reductions_{false};
+  bool is_infeasible_{false};
+  int num_removed_rows_{0};
+  int num_eliminated_variables_{0};
+
+  std::vector<Row> rows_;
+  std::vector<PresolvedRow> presolved_rows_;
+  // The bounds of each original decision variable, and their sources.
+  Eigen::VectorXd lower_bounds_;
+  Eigen::VectorXd upper_bounds_;
+  std::vector<BoundSource> lower_sources_;
+  std::vector<BoundSource> upper_sources_;
+  // The index of each original decision variable in presolved_program_, or -1
+  // if the variable is eliminated.
+  std::vector<int> presolved_variable_index_;
+  // The eliminated variables, in the order of elimination.
+  std::vector<int> eliminated_variables_;
+  // The constant cost of the eliminated variables.
+  double constant_cost_{0};
+  // The linear (equality) constraints in presolved_program_, and the bounding
+  // box constraint on the variables in bounded_variables_ (if any).
+  std::vector<Binding<LinearConstraint>> presolved_linear_bindings_;
+  std::optional<Binding<BoundingBoxConstraint>> presolved_bounding_box_;
+  std::vector<int> bounded_variables_;
+};
+
+}  // namespace solvers
+}  // namespace drake
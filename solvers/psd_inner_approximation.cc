@@ -0,0 +1,179 @@
+#include "drake/solvers/psd_inner_approximation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+
+#include "drake/common/drake_throw.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using Eigen::MatrixXd;
+using symbolic::Expression;
+
+// Returns the matrix X constrained to be positive semidefinite by the binding.
+MatrixX<Expression> GetPsdMatrix(
+    const Binding<PositiveSemidefiniteConstraint>& binding) {
+  const int n = binding.evaluator()->matrix_rows();
+  MatrixX<Expression> X(n, n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      X(i, j) = binding.variables()(j * n + i);
+    }
+  }
+  return X;
+}
+
+// Returns the matrix F₀ + ∑ᵢ Fᵢxᵢ constrained to be positive semidefinite by
+// the binding.
+MatrixX<Expression> GetPsdMatrix(
+    const Binding<LinearMatrixInequalityConstraint>& binding) {
+  const std::vector<MatrixXd>& F = binding.evaluator()->F();
+  MatrixX<Expression> X = F[0].cast<Expression>();
+  for (int i = 0; i < binding.variables().rows(); ++i) {
+    X += F[i + 1].cast<Expression>() * Expression(binding.variables()(i));
+  }
+  return X;
+}
+
+// Returns U⁻¹, where the symmetric matrix X = UᵀU. The eigenvalues of X are
+// clamped to a small positive value, such that U is invertible.
+MatrixXd ComputeBasisInverse(const MatrixXd& X) {
+  const Eigen::SelfAdjointEigenSolver<MatrixXd> es(0.5 * (X + X.transpose()));
+  DRAKE_DEMAND(es.info() == Eigen::Success);
+  const double min_eigenvalue =
+      1E-6 * std::max(1.0, es.eigenvalues().cwiseAbs().maxCoeff());
+  // With X = VΛVᵀ, U = Λ^½Vᵀ and U⁻¹ = VΛ^-½.
+  const Eigen::VectorXd inverse_sqrt_eigenvalues =
+      es.eigenvalues().cwiseMax(min_eigenvalue).cwiseSqrt().cwiseInverse();
+  return es.eigenvectors() * inverse_sqrt_eigenvalues.asDiagonal();
+}
+
+// Returns the program where each matrix in psd_matrices is replaced by
+// X = UᵀDU with D (scaled) diagonally dominant, namely D = U⁻ᵀXU⁻¹ is
+// constrained to be (scaled) diagonally dominant.
+std::unique_ptr<MathematicalProgram> MakeApproximatedProgram(
+    const MathematicalProgram& prog,
+    const std::vector<MatrixX<Expression>>& psd_matrices,
+    const std::vector<MatrixXd>& basis_inverses, PsdInnerApproximation type) {
+  auto approximated = std::make_unique<MathematicalProgram>();
+  approximated->AddDecisionVariables(prog.decision_variables());
+  approximated->SetInitialGuessForAllVariables(prog.initial_guess());
+  approximated->SetSolverOptions(prog.solver_options());
+  // The decision variables of prog come first, hence keep their indices.
+  for (const auto& [index, scale] : prog.GetVariableScaling()) {
+    approximated->SetVariableScaling(prog.decision_variable(index), scale);
+  }
+  for (const auto& binding : prog.visualization_callbacks()) {
+    const std::shared_ptr<VisualizationCallback> callback =
+        binding.evaluator();
+    approximated->AddVisualizationCallback(
+        [callback](const Eigen::Ref<const Eigen::VectorXd>& x) {
+          callback->EvalCallback(x);
+        },
+        binding.variables());
+  }
+  for (const auto& binding : prog.GetAllCosts()) {
+    approximated->AddCost(binding);
+  }
+  auto add_constraints = [&approximated](const auto& bindings) {
+    for (const auto& binding : bindings) {
+      approximated->AddConstraint(binding);
+    }
+  };
+  add_constraints(prog.generic_constraints());
+  add_constraints(prog.linear_constraints());
+  add_constraints(prog.linear_equality_constraints());
+  add_constraints(prog.bounding_box_constraints());
+  add_constraints(prog.lorentz_cone_constraints());
+  add_constraints(prog.rotated_lorentz_cone_constraints());
+  add_constraints(prog.exponential_cone_constraints());
+  add_constraints(prog.linear_complementarity_constraints());
+  for (int k = 0; k < static_cast<int>(psd_matrices.size()); ++k) {
+    const MatrixX<Expression> U_inverse =
+        basis_inverses[k].cast<Expression>();
+    const MatrixX<Expression> D =
+        U_inverse.transpose() * psd_matrices[k] * U_inverse;
+    switch (type) {
+      case PsdInnerApproximation::kDiagonallyDominant: {
+        approximated->AddPositiveDiagonallyDominantMatrixConstraint(D);
+        break;
+      }
+      case PsdInnerApproximation::kScaledDiagonallyDominant: {
+        approximated->AddScaledDiagonallyDominantMatrixConstraint(D);
+        break;
+      }
+    }
+  }
+  return approximated;
+}
+}  // namespace
+
+MathematicalProgramResult SolveWithPsdInnerApproximation(
+    const MathematicalProgram& prog,
+    const PsdInnerApproximationOptions& options) {
+  DRAKE_THROW_UNLESS(options.max_iterations > 0);
+  std::vector<MatrixX<Expression>> psd_matrices;
+  for (const auto& binding : prog.positive_semidefinite_constraints()) {
+    psd_matrices.push_back(GetPsdMatrix(binding));
+  }
+  for (const auto& binding : prog.linear_matrix_inequality_constraints()) {
+    psd_matrices.push_back(GetPsdMatrix(binding));
+  }
+  std::vector<MatrixXd> basis_inverses;
+  for (const auto& X : psd_matrices) {
+    basis_inverses.push_back(MatrixXd::Identity(X.rows(), X.rows()));
+  }
+  const bool has_cost = !prog.GetAllCosts().empty();
+  std::unique_ptr<SolverInterface> solver;
+  if (options.solver_id) {
+    solver = MakeSolver(*options.solver_id);
+  }
+
+  MathematicalProgramResult result;
+  for (int iteration = 0; iteration < options.max_iterations; ++iteration) {
+    const std::unique_ptr<MathematicalProgram> approximated =
+        MakeApproximatedProgram(prog, psd_matrices, basis_inverses,
+                                options.type);
+    MathematicalProgramResult iteration_result;
+    if (solver) {
+      solver->Solve(*approximated, std::nullopt, options.solver_options,
+                    &iteration_result);
+    } else {
+      iteration_result =
+          Solve(*approximated, std::nullopt, options.solver_options);
+    }
+    if (!iteration_result.is_success()) {
+      if (iteration == 0) {
+        result = std::move(iteration_result);
+      }
+      break;
+    }
+    const bool is_improved =
+        iteration == 0 ||
+        result.get_optimal_cost() - iteration_result.get_optimal_cost() >
+            options.relative_cost_tolerance *
+                std::max(1.0, std::abs(result.get_optimal_cost()));
+    if (iteration == 0 ||
+        iteration_result.get_optimal_cost() <= result.get_optimal_cost()) {
+      result = std::move(iteration_result);
+    }
+    if (!has_cost || !is_improved) {
+      break;
+    }
+    for (int k = 0; k < static_cast<int>(psd_matrices.size()); ++k) {
+      basis_inverses[k] = ComputeBasisInverse(
+          symbolic::Evaluate(result.GetSolution(psd_matrices[k])));
+    }
+  }
+  return result;
+}
+
+}  // namespace solvers
+}  // namespace drake
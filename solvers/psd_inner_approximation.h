@@ -0,0 +1,85 @@
+#pragma once
+
+#include <optional>
+
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_id.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * The cones used to approximate the positive semidefinite cone from inside,
+ * see SolveWithPsdInnerApproximation().
+ */
+enum class PsdInnerApproximation {
+  /** Diagonally dominant matrices with non-negative diagonal entries, which
+   * are described by linear constraints (see
+   * MathematicalProgram::AddPositiveDiagonallyDominantMatrixConstraint()). */
+  kDiagonallyDominant,
+  /** Scaled diagonally dominant matrices, which are described by rotated
+   * Lorentz cone constraints (see
+   * MathematicalProgram::AddScaledDiagonallyDominantMatrixConstraint()). */
+  kScaledDiagonallyDominant,
+};
+
+/** The options of SolveWithPsdInnerApproximation(). */
+struct PsdInnerApproximationOptions {
+  /** The cone that replaces the positive semidefinite cone. */
+  PsdInnerApproximation type{PsdInnerApproximation::kScaledDiagonallyDominant};
+
+  /** The maximal number of programs solved, namely one more than the maximal
+   * number of changes of basis. Must be positive. */
+  int max_iterations{10};
+
+  /** The iterations stop once a change of basis decreases the optimal cost by
+   * less than relative_cost_tolerance * max(1, |cost|). */
+  double relative_cost_tolerance{1E-4};
+
+  /** If set, the approximated programs are solved with this solver, otherwise
+   * with the solver picked by ChooseBestSolver(). */
+  std::optional<SolverId> solver_id{};
+
+  /** The options passed to the solver, in addition to those stored in the
+   * program. */
+  std::optional<SolverOptions> solver_options{};
+};
+
+/**
+ * Solves @p prog after replacing each of its positive semidefinite (PSD) and
+ * linear matrix inequality constraints X ⪰ 0 with the inner approximation
+ * X = UᵀDU, where D is (scaled) diagonally dominant, such that the
+ * approximated program is a linear program or a second order cone program.
+ * These are much cheaper to solve than the semidefinite program for large
+ * matrices, for example the Gram matrices of sums-of-squares programs (the
+ * DSOS and SDSOS programs of Ahmadi and Majumdar).
+ *
+ * The approximation is tightened by an iterative change of basis: the first
+ * program uses U = I, and every next one uses U such that the solution X* of
+ * the previous program is UᵀU, namely D = I. Hence the previous solution
+ * remains feasible, and the optimal cost never increases. See
+ *
+ * Ahmadi and Hall, "Sum of Squares Basis Pursuit with Linear and Second Order
+ * Cone Programming", Contemporary Mathematics, 2017.
+ *
+ * The approximated programs keep the initial guess, solver options, variable
+ * scaling and visualization callbacks of @p prog.
+ *
+ * The iterations stop once the optimal cost stops decreasing (see
+ * PsdInnerApproximationOptions), or after the first successful program if
+ * @p prog has no cost.
+ *
+ * @return The result of the last successfully solved approximated program, or
+ * of the first approximated program if that one fails. Its solution satisfies
+ * all the constraints of @p prog. Note that the approximated programs have
+ * additional slack variables, so the result has more decision variables than
+ * @p prog.
+ * @throws std::exception if options.max_iterations is not positive.
+ */
+MathematicalProgramResult SolveWithPsdInnerApproximation(
+    const MathematicalProgram& prog,
+    const PsdInnerApproximationOptions& options = {});
+
+}  // namespace solvers
+}  // namespace drake
@@ -20,6 +20,7 @@
 
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/worker_pool.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
@@ -234,12 +235,16 @@ class SnoptUserFunInfo {
   // Pointers to the parameters ('prog' and 'nonlinear_cost_gradient_indices')
   // are retained internally, so the supplied objects must have lifetimes longer
   // than the SnoptUserFuncInfo object.
-  explicit SnoptUserFunInfo(const MathematicalProgram* prog)
+  SnoptUserFunInfo(const MathematicalProgram* prog, int max_threads)
       : this_pointer_as_int_array_(MakeThisAsInts()),
-        prog_(*prog) {}
+        prog_(*prog),
+        pool_(max_threads) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  // The threads which evaluate the costs and constraints during this solve.
+  drake::internal::WorkerPool* pool() const { return &pool_; }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -289,6 +294,7 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  mutable drake::internal::WorkerPool pool_;
   std::set<int> nonlinear_cost_gradient_indices_;
 };
 
@@ -359,6 +365,95 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
                     constraint.q().cast<AutoDiffXd>());
 }
 
+// Return the number of entries in the gradient of the nonlinear constraint in
+// @p binding, as stored in SNOPT's G array.
+template <typename C>
+int SingleNonlinearConstraintGradientSize(const Binding<C>& binding) {
+  const auto& gradient_sparsity_pattern =
+      binding.evaluator()->gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    return static_cast<int>(gradient_sparsity_pattern.value().size());
+  }
+  return SingleNonlinearConstraintSize(*binding.evaluator()) *
+         binding.GetNumElements();
+}
+
+// Evaluate the value and gradient of the nonlinear constraint in @p binding,
+// and write them to F[0, ...) and G[0, ...) respectively.
+template <typename C>
+void EvaluateSingleNonlinearConstraintBinding(const MathematicalProgram& prog,
+                                              const Binding<C>& binding,
+                                              const Eigen::VectorXd& xvec,
+                                              double F[], double G[]) {
+  const auto & scale_map = prog.GetVariableScaling();
+  const auto& c = binding.evaluator();
+  int num_constraints = SingleNonlinearConstraintSize(*c);
+
+  const int num_variables = binding.GetNumElements();
+  Eigen::VectorXd this_x(num_variables);
+  // binding_var_indices[i] is the index of binding.variables()(i) in prog's
+  // decision variables.
+  std::vector<int> binding_var_indices(num_variables);
+  for (int i = 0; i < num_variables; ++i) {
+    binding_var_indices[i] =
+        prog.FindDecisionVariableIndex(binding.variables()(i));
+    this_x(i) = xvec(binding_var_indices[i]);
+  }
+
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern =
+          binding.evaluator()->gradient_sparsity_pattern();
+  const std::optional<std::vector<int>>& gradient_sparsity_columns =
+      binding.evaluator()->gradient_sparsity_columns();
+
+  // Scale this_x. When the evaluator declares its gradient sparsity, we only
+  // propagate the derivatives w.r.t. the variables in its sparsity pattern.
+  auto this_x_scaled =
+      gradient_sparsity_columns.has_value()
+          ? internal::InitializeAutoDiffForColumns(
+                this_x, gradient_sparsity_columns.value())
+          : math::initializeAutoDiff(this_x);
+  for (int i = 0; i < num_variables; i++) {
+    auto it = scale_map.find(binding_var_indices[i]);
+    if (it != scale_map.end()) {
+      this_x_scaled(i) *= it->second;
+    }
+  }
+
+  AutoDiffVecXd ty;
+  ty.resize(num_constraints);
+  EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
+
+  for (int i = 0; i < num_constraints; i++) {
+    F[i] = ty(i).value();
+  }
+
+  int grad_index = 0;
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      G[grad_index++] =
+          ty(nonzero_entry.first).derivatives().size() > 0
+              ? ty(nonzero_entry.first).derivatives()(
+                    internal::FindColumnPosition(
+                        gradient_sparsity_columns.value(),
+                        nonzero_entry.second))
+              : 0.0;
+    }
+  } else {
+    for (int i = 0; i < num_constraints; i++) {
+      if (ty(i).derivatives().size() > 0) {
+        for (int j = 0; j < num_variables; ++j) {
+          G[grad_index++] = ty(i).derivatives()(j);
+        }
+      } else {
+        for (int j = 0; j < num_variables; ++j) {
+          G[grad_index++] = 0.0;
+        }
+      }
+    }
+  }
+}
+
 /*
  * Evaluate the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
@@ -371,70 +466,36 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
  * @param xvec the value of the decision variables.
+ * @param pool The threads used to evaluate the thread-safe constraints
+ * concurrently. Each binding writes to its own slice
+ * of F and G, so the threads never write to the same entry.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
-  const auto & scale_map = prog.GetVariableScaling();
-  Eigen::VectorXd this_x;
-  for (const auto& binding : constraint_list) {
-    const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
-
-    const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
-    for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = xvec(binding_var_indices[i]);
-    }
-
-    // Scale this_x
-    auto this_x_scaled = math::initializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
-      if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
-      }
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
-
-    for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
-    }
-
-    const std::optional<std::vector<std::pair<int, int>>>&
-        gradient_sparsity_pattern =
-            binding.evaluator()->gradient_sparsity_pattern();
-    if (gradient_sparsity_pattern.has_value()) {
-      for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
-            ty(nonzero_entry.first).derivatives().size() > 0
-                ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
-                : 0.0;
-      }
-    } else {
-      for (int i = 0; i < num_constraints; i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
-          }
-        }
-      }
-    }
+    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec,
+    drake::internal::WorkerPool* pool) {
+  const int num_bindings = static_cast<int>(constraint_list.size());
+  // The starting index of each binding in F and G.
+  std::vector<size_t> F_start(num_bindings);
+  std::vector<size_t> G_start(num_bindings);
+  for (int i = 0; i < num_bindings; ++i) {
+    F_start[i] = *constraint_index;
+    G_start[i] = *grad_index;
+    *constraint_index +=
+        SingleNonlinearConstraintSize(*constraint_list[i].evaluator());
+    *grad_index += SingleNonlinearConstraintGradientSize(constraint_list[i]);
   }
+  internal::EvaluateInParallel(
+      num_bindings, pool,
+      [&constraint_list](int i) {
+        return constraint_list[i].evaluator()->is_thread_safe();
+      },
+      [&](int i) {
+        EvaluateSingleNonlinearConstraintBinding(
+            prog, constraint_list[i], xvec, F + F_start[i], G + G_start[i]);
+      });
 }
 
 // Find the variables with non-zero gradient in @p costs, and add the indices of
@@ -471,42 +532,56 @@ std::set<int> GetAllNonlinearCostNonzeroGradientIndices(
 /*
  * Evaluates all the nonlinear costs, adds the value of the costs to
  * @p total_cost, and also adds the gradients to @p nonlinear_cost_gradients.
+ * The thread-safe costs are evaluated concurrently on the threads of @p pool,
+ * each into its own storage, and are then summed in order on the calling
+ * thread, such that the result doesn't depend on the number of threads.
  */
 template <typename C>
 void EvaluateAndAddNonlinearCosts(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& nonlinear_costs, const Eigen::VectorXd& x,
-    double* total_cost, std::vector<double>* nonlinear_cost_gradients) {
+    double* total_cost, std::vector<double>* nonlinear_cost_gradients,
+    drake::internal::WorkerPool* pool) {
   const auto & scale_map = prog.GetVariableScaling();
-  for (const auto& binding : nonlinear_costs) {
-    const auto& obj = binding.evaluator();
-    const int num_variables = binding.GetNumElements();
-
-    Eigen::VectorXd this_x(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
-    for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = x(binding_var_indices[i]);
-    }
-    AutoDiffVecXd ty(1);
-    // Scale this_x
-    auto this_x_scaled = math::initializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
-      if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
-      }
-    }
-    obj->Eval(this_x_scaled, &ty);
-
-    *total_cost += ty(0).value();
-    if (ty(0).derivatives().size() > 0) {
-      for (int i = 0; i < num_variables; ++i) {
-        (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-            ty(0).derivatives()(i);
+  const int num_bindings = static_cast<int>(nonlinear_costs.size());
+  // binding_var_indices[k][i] is the index of
+  // nonlinear_costs[k].variables()(i) in prog's decision variables.
+  std::vector<std::vector<int>> binding_var_indices(num_bindings);
+  std::vector<AutoDiffVecXd> ty(num_bindings);
+  internal::EvaluateInParallel(
+      num_bindings, pool,
+      [&nonlinear_costs](int k) {
+        return nonlinear_costs[k].evaluator()->is_thread_safe();
+      },
+      [&](int k) {
+        const auto& binding = nonlinear_costs[k];
+        const int num_variables = binding.GetNumElements();
+        Eigen::VectorXd this_x(num_variables);
+        binding_var_indices[k].resize(num_variables);
+        for (int i = 0; i < num_variables; ++i) {
+          binding_var_indices[k][i] =
+              prog.FindDecisionVariableIndex(binding.variables()(i));
+          this_x(i) = x(binding_var_indices[k][i]);
+        }
+        ty[k].resize(1);
+        // Scale this_x
+        auto this_x_scaled = math::initializeAutoDiff(this_x);
+        for (int i = 0; i < num_variables; i++) {
+          auto it = scale_map.find(binding_var_indices[k][i]);
+          if (it != scale_map.end()) {
+            this_x_scaled(i) *= it->second;
+          }
+        }
+        binding.evaluator()->Eval(this_x_scaled, &ty[k]);
+      });
+
+  for (int k = 0; k < num_bindings; ++k) {
+    *total_cost += ty[k](0).value();
+    if (ty[k](0).derivatives().size() > 0) {
+      for (int i = 0; i < static_cast<int>(binding_var_indices[k].size());
+           ++i) {
+        (*nonlinear_cost_gradients)[binding_var_indices[k][i]] +=
+            ty[k](0).derivatives()(i);
       }
     }
   }
@@ -518,15 +593,16 @@ void EvaluateAndAddNonlinearCosts(
 // will store the nonzero gradient of the cost.
 void EvaluateAllNonlinearCosts(
     const MathematicalProgram& prog, const Eigen::VectorXd& xvec,
-    const std::set<int>& nonlinear_cost_gradient_indices, double F[],
-    double G[], size_t* grad_index) {
+    const std::set<int>& nonlinear_cost_gradient_indices,
+    drake::internal::WorkerPool* pool, double F[], double G[],
+    size_t* grad_index) {
   std::vector<double> cost_gradients(prog.num_vars(), 0);
   // Quadratic costs.
   EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+                               &cost_gradients, pool);
   // Generic costs.
   EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+                               &cost_gradients, pool);
 
   for (const int cost_gradient_index : nonlinear_cost_gradient_indices) {
     G[*grad_index] = cost_gradients[cost_gradient_index];
@@ -559,8 +635,8 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   current_problem.EvalVisualizationCallbacks(xvec_scaled);
 
   EvaluateAllNonlinearCosts(current_problem, xvec,
-                            info.nonlinear_cost_gradient_indices(), F, G,
-                            &grad_index);
+                            info.nonlinear_cost_gradient_indices(),
+                            info.pool(), F, G, &grad_index);
 
   // The constraint index starts at 1 because the cost is the
   // first row.
@@ -568,16 +644,18 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   // The gradient_index also starts after the cost.
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec,
+                               info.pool());
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec,
+                               info.pool());
   EvaluateNonlinearConstraints(
       current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
+      &constraint_index, &grad_index, xvec, info.pool());
   EvaluateNonlinearConstraints(
       current_problem, current_problem.linear_complementarity_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      G, &constraint_index, &grad_index, xvec, info.pool());
 }
 
 /*
@@ -1020,11 +1098,11 @@ void SolveWithGivenOptions(
     const std::unordered_map<std::string, std::string>& snopt_options_string,
     const std::unordered_map<std::string, int>& snopt_options_int,
     const std::unordered_map<std::string, double>& snopt_options_double,
-    MathematicalProgramResult* result) {
+    int max_threads, MathematicalProgramResult* result) {
   SnoptSolverDetails& solver_details =
       result->SetSolverDetailsType<SnoptSolverDetails>();
 
-  SnoptUserFunInfo user_info(&prog);
+  SnoptUserFunInfo user_info(&prog, max_threads);
   WorkspaceStorage storage(&user_info);
   const auto & scale_map = prog.GetVariableScaling();
 
@@ -1304,7 +1382,7 @@ void SnoptSolver::DoSolve(
 
   SolveWithGivenOptions(prog, initial_guess, merged_options.GetOptionsStr(id()),
                         int_options, merged_options.GetOptionsDouble(id()),
-                        result);
+                        internal::GetMaxThreads(merged_options), result);
 }
 
 bool SnoptSolver::is_bounded_lp_broken() { return true; }
@@ -7,6 +7,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/solvers/presolve.h"
 
 namespace drake {
 namespace solvers {
@@ -69,13 +70,32 @@ void SolverBase::Solve(const MathematicalProgram& prog,
         fmt::format("Solve expects initial guess of size {}, got {}.",
                     prog.num_vars(), x_init.rows()));
   }
-  if (!solver_options) {
-    DoSolve(prog, x_init, prog.solver_options(), result);
-  } else {
-    SolverOptions merged_options = *solver_options;
-    merged_options.Merge(prog.solver_options());
-    DoSolve(prog, x_init, merged_options, result);
+  std::optional<SolverOptions> merged_options;
+  if (solver_options) {
+    merged_options = *solver_options;
+    merged_options->Merge(prog.solver_options());
   }
+  const SolverOptions& options =
+      merged_options ? *merged_options : prog.solver_options();
+  if (!internal::IsPresolveEnabled(options)) {
+    DoSolve(prog, x_init, options, result);
+    return;
+  }
+  const Presolver presolver(prog);
+  if (!presolver.has_reductions()) {
+    DoSolve(prog, x_init, options, result);
+    return;
+  }
+  const MathematicalProgram& presolved_prog = presolver.presolved_program();
+  MathematicalProgramResult presolved_result;
+  presolved_result.set_solver_id(solver_id());
+  presolved_result.set_decision_variable_index(
+      presolved_prog.decision_variable_index());
+  if (!presolver.is_infeasible() && presolved_prog.num_vars() > 0) {
+    DoSolve(presolved_prog, presolver.PresolveVariableValues(x_init), options,
+            &presolved_result);
+  }
+  *result = presolver.Postsolve(presolved_result);
 }
 
 bool SolverBase::available() const {
@@ -38,7 +38,8 @@ void SolverOptions::SetOption(
     CommonSolverOption key,
     const std::variant<double, int, std::string>& value) {
   switch (key) {
-    case CommonSolverOption::kPrintToConsole: {
+    case CommonSolverOption::kPrintToConsole:
+    case CommonSolverOption::kPresolve: {
       if (!std::holds_alternative<int>(value)) {
         throw std::runtime_error(fmt::format(
             "SolverOptions::SetOption support {} only with int value.", key));
@@ -60,6 +61,18 @@ void SolverOptions::SetOption(
       common_solver_options_[key] = value;
       return;
     }
+    case CommonSolverOption::kMaxThreads: {
+      if (!std::holds_alternative<int>(value)) {
+        throw std::runtime_error(fmt::format(
+            "SolverOptions::SetOption support {} only with int value.", key));
+      }
+      if (std::get<int>(value) < 1) {
+        throw std::runtime_error(
+            fmt::format("{} expects a positive value", key));
+      }
+      common_solver_options_[key] = value;
+      return;
+    }
   }
   DRAKE_UNREACHABLE();
 }
@@ -224,5 +237,23 @@ void SolverOptions::CheckOptionKeysForSolver(
                                  solver_id.name());
 }
 
+namespace internal {
+int GetMaxThreads(const SolverOptions& options) {
+  const auto it =
+      options.common_solver_options().find(CommonSolverOption::kMaxThreads);
+  if (it == options.common_solver_options().end()) {
+    return 1;
+  }
+  return std::get<int>(it->second);
+}
+
+bool IsPresolveEnabled(const SolverOptions& options) {
+  const auto it =
+      options.common_solver_options().find(CommonSolverOption::kPresolve);
+  return it != options.common_solver_options().end() &&
+         std::get<int>(it->second) == 1;
+}
+}  // namespace internal
+
 }  // namespace solvers
 }  // namespace drake
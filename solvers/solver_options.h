@@ -150,5 +150,18 @@ class SolverOptions {
 std::string to_string(const SolverOptions&);
 std::ostream& operator<<(std::ostream&, const SolverOptions&);
 
+namespace internal {
+/*
+ * Returns the value of CommonSolverOption::kMaxThreads in @p options, or 1 if
+ * the option is not set.
+ */
+int GetMaxThreads(const SolverOptions& options);
+
+/*
+ * Returns true if CommonSolverOption::kPresolve is set to 1 in @p options.
+ */
+bool IsPresolveEnabled(const SolverOptions& options);
+}  // namespace internal
+
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,259 @@
+#include "drake/solvers/batch_qp_solver.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using Eigen::MatrixXd;
+
+const double kTol = 1E-10;
+
+// The batch of problems min ½|x - pₖ|² s.t. lb ≤ x ≤ ub, whose solutions are
+// xₖ = clamp(pₖ, lb, ub).
+class BatchQpSolverBoxTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const Eigen::Vector3d lb(-1, 0, 2);
+    const Eigen::Vector3d ub(1, 3, 2.5);
+    Q_.resize(kNumVars, kNumVars * kNumProblems);
+    c_.resize(kNumVars, kNumProblems);
+    A_eq_.resize(0, kNumVars * kNumProblems);
+    b_eq_.resize(0, kNumProblems);
+    A_in_.resize(2 * kNumVars, kNumVars * kNumProblems);
+    b_in_.resize(2 * kNumVars, kNumProblems);
+    x_expected_.resize(kNumVars, kNumProblems);
+    for (int k = 0; k < kNumProblems; ++k) {
+      const Eigen::Vector3d p(std::sin(k), 3 * std::cos(k), 0.1 * k);
+      Q_.middleCols<kNumVars>(k * kNumVars).setIdentity();
+      c_.col(k) = -p;
+      A_in_.middleCols<kNumVars>(k * kNumVars)
+          << Eigen::Matrix3d::Identity(), -Eigen::Matrix3d::Identity();
+      b_in_.col(k) << ub, -lb;
+      x_expected_.col(k) = p.cwiseMax(lb).cwiseMin(ub);
+    }
+  }
+
+  static constexpr int kNumVars{3};
+  static constexpr int kNumProblems{100};
+  MatrixXd Q_;
+  MatrixXd c_;
+  MatrixXd A_eq_;
+  MatrixXd b_eq_;
+  MatrixXd A_in_;
+  MatrixXd b_in_;
+  MatrixXd x_expected_;
+};
+
+TEST_F(BatchQpSolverBoxTest, Solve) {
+  for (int max_threads : {1, 4}) {
+    BatchQpSolver solver(kNumVars, 0, 2 * kNumVars, max_threads);
+    EXPECT_EQ(solver.max_threads(), max_threads);
+    MatrixXd x;
+    std::vector<BatchQpStatus> status;
+    solver.Solve(Q_, c_, A_eq_, b_eq_, A_in_, b_in_, &x, &status);
+    ASSERT_EQ(static_cast<int>(status.size()), kNumProblems);
+    for (int k = 0; k < kNumProblems; ++k) {
+      EXPECT_EQ(status[k], BatchQpStatus::kSolutionFound);
+    }
+    EXPECT_TRUE(CompareMatrices(x, x_expected_, kTol));
+  }
+}
+
+TEST_F(BatchQpSolverBoxTest, NoHeapAllocation) {
+  BatchQpSolver solver(kNumVars, 0, 2 * kNumVars);
+  MatrixXd x(kNumVars, kNumProblems);
+  std::vector<BatchQpStatus> status(kNumProblems);
+  {
+    test::LimitMalloc guard;
+    solver.Solve(Q_, c_, A_eq_, b_eq_, A_in_, b_in_, &x, &status);
+  }
+  EXPECT_TRUE(CompareMatrices(x, x_expected_, kTol));
+}
+
+// Compares against EqualityConstrainedQPSolver on problems with only equality
+// constraints.
+GTEST_TEST(BatchQpSolverTest, EqualityConstraints) {
+  const int num_problems = 3;
+  const int n = 4;
+  MatrixXd Q(n, n * num_problems);
+  MatrixXd c(n, num_problems);
+  MatrixXd A_eq(2, n * num_problems);
+  MatrixXd b_eq(2, num_problems);
+  for (int k = 0; k < num_problems; ++k) {
+    const MatrixXd M =
+        MatrixXd::Identity(n, n) + 0.1 * (k + 1) * MatrixXd::Ones(n, n);
+    Q.middleCols(k * n, n) = M * M.transpose();
+    c.col(k) << 1, -k, 2, 0.5;
+    A_eq.middleCols(k * n, n) << 1, 2, 0, -1, 0, 1, k, 1;
+    b_eq.col(k) << 1, -2;
+  }
+  BatchQpSolver solver(n, 2, 0);
+  MatrixXd x;
+  std::vector<BatchQpStatus> status;
+  solver.Solve(Q, c, A_eq, b_eq, MatrixXd(0, n * num_problems),
+               MatrixXd(0, num_problems), &x, &status);
+  for (int k = 0; k < num_problems; ++k) {
+    EXPECT_EQ(status[k], BatchQpStatus::kSolutionFound);
+    MathematicalProgram prog;
+    const auto y = prog.NewContinuousVariables(n);
+    prog.AddQuadraticCost(Q.middleCols(k * n, n), c.col(k), y);
+    prog.AddLinearEqualityConstraint(A_eq.middleCols(k * n, n), b_eq.col(k),
+                                     y);
+    MathematicalProgramResult result;
+    EqualityConstrainedQPSolver().Solve(prog, {}, {}, &result);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(x.col(k), result.GetSolution(y), 1E-8));
+  }
+}
+
+// Checks the KKT conditions of x for min ½xᵀQx + cᵀx s.t. A_eq x = b_eq,
+// A_in x ≤ b_in, which are sufficient for optimality as Q is positive
+// definite. The multipliers are recovered by least squares on the equality
+// constraints and the active inequality constraints.
+void CheckKktConditions(const MatrixXd& Q, const Eigen::VectorXd& c,
+                        const MatrixXd& A_eq, const Eigen::VectorXd& b_eq,
+                        const MatrixXd& A_in, const Eigen::VectorXd& b_in,
+                        const Eigen::VectorXd& x, double tol) {
+  const int n = x.size();
+  EXPECT_TRUE(CompareMatrices(A_eq * x, b_eq, tol));
+  const Eigen::VectorXd slack = b_in - A_in * x;
+  EXPECT_GE(slack.minCoeff(), -tol);
+  MatrixXd N(n, A_eq.rows() + A_in.rows());
+  N.leftCols(A_eq.rows()) = A_eq.transpose();
+  int num_active = 0;
+  for (int i = 0; i < A_in.rows(); ++i) {
+    if (slack(i) <= tol) {
+      N.col(A_eq.rows() + num_active++) = A_in.row(i).transpose();
+    }
+  }
+  const MatrixXd N_active = N.leftCols(A_eq.rows() + num_active);
+  const Eigen::VectorXd gradient = Q * x + c;
+  const Eigen::VectorXd multipliers =
+      N_active.colPivHouseholderQr().solve(-gradient);
+  EXPECT_TRUE(CompareMatrices(N_active * multipliers, -gradient, tol));
+  if (num_active > 0) {
+    EXPECT_GE(multipliers.tail(num_active).minCoeff(), -tol);
+  }
+}
+
+// Random problems with both equality and inequality constraints, whose
+// unconstrained minimizers are far outside the feasible set. Reaching the
+// optimal active set requires dropping constraints, both through partial
+// steps blocked by a multiplier and through steps in the dual space only.
+GTEST_TEST(BatchQpSolverTest, MixedConstraints) {
+  const int num_problems = 200;
+  const int n = 4;
+  const int num_eq = 2;
+  const int num_in = 10;
+  std::mt19937 generator(1234);
+  std::normal_distribution<double> normal;
+  const auto random_matrix = [&](int rows, int cols) {
+    return MatrixXd::NullaryExpr(rows, cols, [&]() {
+      return normal(generator);
+    }).eval();
+  };
+  MatrixXd Q(n, n * num_problems);
+  MatrixXd c(n, num_problems);
+  MatrixXd A_eq(num_eq, n * num_problems);
+  MatrixXd b_eq(num_eq, num_problems);
+  MatrixXd A_in(num_in, n * num_problems);
+  MatrixXd b_in(num_in, num_problems);
+  for (int k = 0; k < num_problems; ++k) {
+    const MatrixXd M = random_matrix(n, n);
+    Q.middleCols(k * n, n) =
+        M * M.transpose() + 0.1 * MatrixXd::Identity(n, n);
+    c.col(k) = 20 * random_matrix(n, 1);
+    // The point x0 is feasible, such that every problem has a solution.
+    const Eigen::VectorXd x0 = random_matrix(n, 1);
+    A_eq.middleCols(k * n, n) = random_matrix(num_eq, n);
+    b_eq.col(k) = A_eq.middleCols(k * n, n) * x0;
+    A_in.middleCols(k * n, n) = random_matrix(num_in, n);
+    b_in.col(k) = A_in.middleCols(k * n, n) * x0 +
+                  random_matrix(num_in, 1).cwiseAbs();
+  }
+  for (int max_threads : {1, 3}) {
+    BatchQpSolver solver(n, num_eq, num_in, max_threads);
+    MatrixXd x;
+    std::vector<BatchQpStatus> status;
+    solver.Solve(Q, c, A_eq, b_eq, A_in, b_in, &x, &status);
+    for (int k = 0; k < num_problems; ++k) {
+      ASSERT_EQ(status[k], BatchQpStatus::kSolutionFound);
+      CheckKktConditions(Q.middleCols(k * n, n), c.col(k),
+                         A_eq.middleCols(k * n, n), b_eq.col(k),
+                         A_in.middleCols(k * n, n), b_in.col(k), x.col(k),
+                         1E-8);
+    }
+  }
+}
+
+// A problem whose solution requires dropping a constraint after a partial
+// step: min ½|x - (0, 0, 3)|² s.t. x₂ = 1, x₀ + x₁ ≥ 4, x₁ ≥ 5 and x₀ ≤ 10.
+// The most violated constraint 2x₀ + 2x₁ ≥ 8 is added first, but is inactive
+// at the solution x = (0, 5, 1), and its multiplier reaches zero while x₁ ≥ 5
+// is added.
+GTEST_TEST(BatchQpSolverTest, DropConstraint) {
+  const MatrixXd Q = MatrixXd::Identity(3, 3);
+  const Eigen::Vector3d c(0, 0, -3);
+  const Eigen::RowVector3d A_eq(0, 0, 1);
+  const Eigen::Matrix<double, 1, 1> b_eq(1);
+  MatrixXd A_in(3, 3);
+  // clang-format off
+  A_in << -2, -2, 0,
+           0, -1, 0,
+           1,  0, 0;
+  // clang-format on
+  const Eigen::Vector3d b_in(-8, -5, 10);
+  BatchQpSolver solver(3, 1, 3);
+  MatrixXd x;
+  std::vector<BatchQpStatus> status;
+  solver.Solve(Q, c, A_eq, b_eq, A_in, b_in, &x, &status);
+  ASSERT_EQ(status[0], BatchQpStatus::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(x, Eigen::Vector3d(0, 5, 1), kTol));
+  CheckKktConditions(Q, c, A_eq, b_eq, A_in, b_in, x.col(0), kTol);
+}
+
+GTEST_TEST(BatchQpSolverTest, Failures) {
+  // The first problem has the infeasible constraints x ≤ 0 and x ≥ 1, and the
+  // second one has a Q which is not positive definite.
+  const Eigen::RowVector2d Q(1, -1);
+  const Eigen::RowVector2d c(0, 0);
+  const Eigen::Matrix2d A_in = (Eigen::Matrix2d() << 1, 1, -1, -1).finished();
+  const Eigen::Matrix2d b_in = (Eigen::Matrix2d() << 0, 0, -1, -1).finished();
+  BatchQpSolver solver(1, 0, 2);
+  MatrixXd x;
+  std::vector<BatchQpStatus> status;
+  solver.Solve(Q, c, MatrixXd(0, 2), MatrixXd(0, 2), A_in, b_in, &x, &status);
+  EXPECT_EQ(status[0], BatchQpStatus::kInfeasible);
+  EXPECT_EQ(status[1], BatchQpStatus::kFailedToFactorize);
+}
+
+GTEST_TEST(BatchQpSolverTest, InvalidArguments) {
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchQpSolver(0, 0, 0), std::exception,
+                              ".*num_vars > 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchQpSolver(2, 3, 0), std::exception,
+                              ".*num_equality_constraints <= num_vars.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchQpSolver(1, 0, 0, 0), std::exception,
+                              ".*max_threads > 0.*");
+  BatchQpSolver solver(2, 0, 0);
+  MatrixXd x;
+  std::vector<BatchQpStatus> status;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver.Solve(MatrixXd::Identity(2, 2), MatrixXd::Zero(2, 2),
+                   MatrixXd(0, 4), MatrixXd(0, 2), MatrixXd(0, 4),
+                   MatrixXd(0, 2), &x, &status),
+      std::exception, ".*Q.cols\\(\\) == num_problems \\* n.*");
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
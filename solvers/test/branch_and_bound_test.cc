@@ -1,6 +1,9 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -922,6 +925,129 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve4) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  // Solves prog 2 with several threads, the result should match TestSolve2.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+      bnb.set_max_threads(4);
+      EXPECT_EQ(bnb.max_threads(), 4);
+      bnb.SetNodeSelectionMethod(pick_node);
+      bnb.SetVariableSelectionMethod(pick_variable);
+
+      const SolutionResult solution_result = bnb.Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                  MatrixCompareType::absolute));
+      // The costs are in the ascending order.
+      double previous_cost = bnb.GetOptimalCost();
+      for (int i = 1; i < static_cast<int>(bnb.solutions().size()); ++i) {
+        EXPECT_GE(bnb.GetSubOptimalCost(i - 1), previous_cost);
+        previous_cost = bnb.GetSubOptimalCost(i - 1);
+      }
+    }
+  }
+
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_THROW(bnb.set_max_threads(0), std::runtime_error);
+  EXPECT_EQ(bnb.max_threads(), 1);
+}
+
+// Checks that the trees rooted at node1 and node2 branch on the same
+// variables, and that their nodes have the same solution results and costs.
+void CompareTrees(const MixedIntegerBranchAndBoundNode& node1,
+                  const MixedIntegerBranchAndBoundNode& node2, double tol) {
+  EXPECT_EQ(node1.solution_result(), node2.solution_result());
+  if (node1.solution_result() == SolutionResult::kSolutionFound) {
+    EXPECT_NEAR(node1.prog_result()->get_optimal_cost(),
+                node2.prog_result()->get_optimal_cost(), tol);
+  }
+  ASSERT_EQ(node1.IsLeaf(), node2.IsLeaf());
+  if (!node1.IsLeaf()) {
+    EXPECT_EQ(node1.left_child()->fixed_binary_variable().get_name(),
+              node2.left_child()->fixed_binary_variable().get_name());
+    CompareTrees(*node1.left_child(), *node2.left_child(), tol);
+    CompareTrees(*node1.right_child(), *node2.right_child(), tol);
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelTree) {
+  // With max_threads = 2, the batches contain a single node, hence the
+  // parallel search explores the same tree and updates the same bounds as the
+  // serial one. With more threads, the search is deterministic, and its bounds
+  // are monotonic.
+  auto prog = ConstructMathematicalProgram2();
+  const double tol{1E-6};
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      std::vector<std::unique_ptr<MixedIntegerBranchAndBound>> bnbs;
+      std::vector<std::vector<std::pair<double, double>>> bounds;
+      for (int max_threads : {1, 2, 4, 4}) {
+        bnbs.push_back(
+            std::make_unique<MixedIntegerBranchAndBound>(*prog,
+                                                         GurobiSolver::id()));
+        bnbs.back()->set_max_threads(max_threads);
+        bnbs.back()->SetNodeSelectionMethod(pick_node);
+        bnbs.back()->SetVariableSelectionMethod(pick_variable);
+        bounds.emplace_back();
+        auto* bounds_history = &bounds.back();
+        bnbs.back()->SetUserDefinedNodeCallbackFunction(
+            [bounds_history](const MixedIntegerBranchAndBoundNode&,
+                             MixedIntegerBranchAndBound* bnb) {
+              bounds_history->emplace_back(bnb->best_lower_bound(),
+                                           bnb->best_upper_bound());
+            });
+        EXPECT_EQ(bnbs.back()->Solve(), SolutionResult::kSolutionFound);
+      }
+      for (int i : {1, 3}) {
+        CompareTrees(*bnbs[i - 1]->root(), *bnbs[i]->root(), tol);
+        ASSERT_EQ(bounds[i - 1].size(), bounds[i].size());
+        for (int j = 0; j < static_cast<int>(bounds[i].size()); ++j) {
+          EXPECT_EQ(bounds[i - 1][j], bounds[i][j]);
+        }
+      }
+      for (int j = 1; j < static_cast<int>(bounds[2].size()); ++j) {
+        EXPECT_GE(bounds[2][j].first, bounds[2][j - 1].first - tol);
+        EXPECT_LE(bounds[2][j].second, bounds[2][j - 1].second);
+      }
+      EXPECT_NEAR(bnbs[2]->GetOptimalCost(), bnbs[0]->GetOptimalCost(), tol);
+    }
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelWithScs) {
+  // ScsSolver keeps no state shared among its instances, so the children in a
+  // batch are solved concurrently without any Gurobi environment. The result
+  // should match the serial search.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  const double tol{1E-3};
+  Eigen::Matrix<double, 5, 1> x_expected0;
+  x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      for (int max_threads : {1, 4}) {
+        MixedIntegerBranchAndBound bnb(*prog, ScsSolver::id());
+        bnb.set_max_threads(max_threads);
+        bnb.SetNodeSelectionMethod(pick_node);
+        bnb.SetVariableSelectionMethod(pick_variable);
+
+        EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+        EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+        EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                    MatrixCompareType::absolute));
+      }
+    }
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   // This problem is taken from
   // "An application of Mixed Integer Programming in a Swedish Steel Mill"
@@ -0,0 +1,73 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using Cliques = std::set<std::vector<int>>;
+
+Cliques MakeCliques(const std::vector<std::vector<int>>& cliques) {
+  return Cliques(cliques.begin(), cliques.end());
+}
+
+GTEST_TEST(ChordalExtensionMaximalCliquesTest, Cycle) {
+  // A cycle of 4 nodes is not chordal; eliminating node 0 adds the edge 1-3.
+  const auto cliques =
+      ChordalExtensionMaximalCliques(4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}});
+  EXPECT_EQ(MakeCliques(cliques), Cliques({{0, 1, 3}, {1, 2, 3}}));
+}
+
+GTEST_TEST(ChordalExtensionMaximalCliquesTest, Tree) {
+  // A tree is chordal, and its maximal cliques are its edges.
+  const auto cliques =
+      ChordalExtensionMaximalCliques(4, {{0, 1}, {1, 2}, {1, 3}});
+  EXPECT_EQ(MakeCliques(cliques), Cliques({{0, 1}, {1, 2}, {1, 3}}));
+}
+
+GTEST_TEST(ChordalExtensionMaximalCliquesTest, CompleteAndIsolated) {
+  // Nodes 0, 1, 2 form a complete graph; node 3 is isolated. The repeated
+  // edge and the self loop are ignored.
+  const auto cliques = ChordalExtensionMaximalCliques(
+      4, {{0, 1}, {1, 2}, {2, 0}, {1, 0}, {2, 2}});
+  EXPECT_EQ(MakeCliques(cliques), Cliques({{0, 1, 2}, {3}}));
+}
+
+GTEST_TEST(ChordalExtensionMaximalCliquesTest, InvalidEdge) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ChordalExtensionMaximalCliques(2, {{0, 2}}),
+                              std::exception, ".*num_nodes.*");
+}
+
+GTEST_TEST(TermSparsityCliquesTest, SeparablePolynomial) {
+  const symbolic::Variable x0("x0");
+  const symbolic::Variable x1("x1");
+  // p = x₀⁴ + x₁⁴ - 2x₀² - 2x₁² + 2.
+  const symbolic::Polynomial p(pow(x0, 4) + pow(x1, 4) - 2 * x0 * x0 -
+                               2 * x1 * x1 + 2);
+  Vector6<symbolic::Monomial> monomial_basis;
+  monomial_basis << symbolic::Monomial(), symbolic::Monomial(x0),
+      symbolic::Monomial(x1), symbolic::Monomial(x0, 2),
+      symbolic::Monomial(x0) * symbolic::Monomial(x1),
+      symbolic::Monomial(x1, 2);
+  // Only the products of 1, x₀² and x₁² appear in p or are squares.
+  const auto cliques = TermSparsityCliques(p, monomial_basis);
+  EXPECT_EQ(MakeCliques(cliques), Cliques({{0, 3, 5}, {1}, {2}, {4}}));
+}
+
+GTEST_TEST(TermSparsityCliquesTest, DensePolynomial) {
+  const symbolic::Variable x("x");
+  // p = (1 + x + x²)², all the products of the basis appear in p.
+  const symbolic::Polynomial p(pow(1 + x + x * x, 2));
+  Vector3<symbolic::Monomial> monomial_basis;
+  monomial_basis << symbolic::Monomial(), symbolic::Monomial(x),
+      symbolic::Monomial(x, 2);
+  const auto cliques = TermSparsityCliques(p, monomial_basis);
+  EXPECT_EQ(MakeCliques(cliques), Cliques({{0, 1, 2}}));
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -618,6 +618,30 @@ GTEST_TEST(testConstraint, testExponentialConeConstraint) {
       math::autoDiffToGradientMatrix(y_autodiff_expected), tol));
 }
 
+// A user-defined subclass of a thread-safe constraint, which could add its own
+// unguarded state, is not thread safe unless it opts in again.
+class UserLinearConstraint : public LinearConstraint {
+ public:
+  UserLinearConstraint()
+      : LinearConstraint(Eigen::RowVector2d(1, 2), Vector1d(0), Vector1d(1)) {}
+};
+
+GTEST_TEST(testConstraint, IsThreadSafe) {
+  const Eigen::RowVector2d a(1, 2);
+  EXPECT_TRUE(LinearConstraint(a, Vector1d(0), Vector1d(1)).is_thread_safe());
+  EXPECT_TRUE(LinearEqualityConstraint(a, 1).is_thread_safe());
+  EXPECT_TRUE(BoundingBoxConstraint(Eigen::Vector2d::Zero(),
+                                    Eigen::Vector2d::Ones())
+                  .is_thread_safe());
+  EXPECT_TRUE(QuadraticConstraint(Eigen::Matrix2d::Identity(),
+                                  Eigen::Vector2d::Zero(), 0, 1)
+                  .is_thread_safe());
+  EXPECT_TRUE(LorentzConeConstraint(Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d::Zero())
+                  .is_thread_safe());
+  EXPECT_FALSE(UserLinearConstraint().is_thread_safe());
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -236,6 +237,72 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
   }
 }
 
+GTEST_TEST(EvaluatorBaseTest, GradientSparsityColumns) {
+  SimpleEvaluator evaluator;
+  EXPECT_FALSE(evaluator.gradient_sparsity_columns().has_value());
+  // The (fictitious) pattern only uses the columns 0 and 2.
+  evaluator.SetGradientSparsityPattern({{1, 2}, {0, 0}, {1, 0}});
+  const std::vector<int>& columns =
+      evaluator.gradient_sparsity_columns().value();
+  EXPECT_EQ(columns, std::vector<int>({0, 2}));
+  EXPECT_EQ(internal::FindColumnPosition(columns, 0), 0);
+  EXPECT_EQ(internal::FindColumnPosition(columns, 2), 1);
+
+  // Only the derivatives w.r.t. x(0) and x(2) are propagated.
+  const Eigen::Vector3d x(1, 2, 3);
+  const AutoDiffVecXd x_autodiff =
+      internal::InitializeAutoDiffForColumns(x, columns);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(x_autodiff), x));
+  AutoDiffVecXd y;
+  evaluator.Eval(x_autodiff, &y);
+  Eigen::Matrix<double, 2, 3> c;
+  c << 1, 2, 3, 4, 5, 6;
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y), c * x));
+  Eigen::Matrix2d expected_gradient;
+  expected_gradient << c.col(0), c.col(2);
+  EXPECT_TRUE(
+      CompareMatrices(math::autoDiffToGradientMatrix(y), expected_gradient));
+}
+
+GTEST_TEST(EvaluatorBaseTest, EvaluateInParallel) {
+  SimpleEvaluator evaluator;
+  EXPECT_FALSE(evaluator.is_thread_safe());
+
+  // Every task writes to its own entry of y, the odd ones being "thread
+  // safe".
+  const int num_tasks = 100;
+  auto is_thread_safe = [](int i) { return i % 2 == 1; };
+  std::vector<int> y(num_tasks, 0);
+  internal::EvaluateInParallel(num_tasks, nullptr, is_thread_safe,
+                               [&y](int i) { y[i] += i * i; });
+  for (int i = 0; i < num_tasks; ++i) {
+    EXPECT_EQ(y[i], i * i);
+  }
+  // The same pool is reused by several evaluations.
+  for (const int num_threads : {1, 2, 8}) {
+    drake::internal::WorkerPool pool(num_threads);
+    for (int repeat = 0; repeat < 3; ++repeat) {
+      std::vector<int> z(num_tasks, 0);
+      internal::EvaluateInParallel(num_tasks, &pool, is_thread_safe,
+                                   [&z](int i) { z[i] += i * i; });
+      EXPECT_EQ(z, y);
+    }
+  }
+
+  // An exception thrown by a task is rethrown on the calling thread.
+  for (const int num_threads : {1, 4}) {
+    drake::internal::WorkerPool pool(num_threads);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        internal::EvaluateInParallel(num_tasks, &pool, is_thread_safe,
+                                     [](int i) {
+                                       if (i == 51) {
+                                         throw std::runtime_error("task 51");
+                                       }
+                                     }),
+        std::runtime_error, "task 51");
+  }
+}
+
 /**
  * An evaluator with dynamic sized input.
  */
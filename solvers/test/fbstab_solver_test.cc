@@ -0,0 +1,140 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+// Adds a linear MPC problem for a discretized double integrator to @p prog,
+// and returns its stage variables.
+FbstabSolver::StageVariables AddDoubleIntegratorMpc(int N,
+                                                    MathematicalProgram* prog) {
+  const double dt = 0.1;
+  Eigen::Matrix2d A;
+  A << 1, dt, 0, 1;
+  const Eigen::Vector2d B(0, dt);
+  FbstabSolver::StageVariables stage_variables;
+  for (int k = 0; k <= N; ++k) {
+    stage_variables.states.push_back(prog->NewContinuousVariables(2, "x"));
+    stage_variables.inputs.push_back(prog->NewContinuousVariables(1, "u"));
+  }
+  const auto& x = stage_variables.states;
+  const auto& u = stage_variables.inputs;
+  prog->AddLinearEqualityConstraint(x[0] == Eigen::Vector2d(1, 0));
+  for (int k = 0; k < N; ++k) {
+    prog->AddLinearEqualityConstraint(x[k + 1] == A * x[k] + B * u[k]);
+    prog->AddQuadraticCost(
+        x[k].cast<symbolic::Expression>().squaredNorm() +
+        0.1 * u[k].cast<symbolic::Expression>().squaredNorm());
+  }
+  prog->AddQuadraticCost(
+      10 * x[N].cast<symbolic::Expression>().squaredNorm());
+  // Like DirectTranscription, constrains the final input to match the
+  // penultimate one.
+  prog->AddLinearEqualityConstraint(u[N - 1] == u[N]);
+  return stage_variables;
+}
+
+GTEST_TEST(FbstabSolverTest, UnconstrainedMpc) {
+  MathematicalProgram prog;
+  const FbstabSolver::StageVariables stage_variables =
+      AddDoubleIntegratorMpc(20, &prog);
+  FbstabSolver solver(stage_variables);
+  const MathematicalProgramResult result = solver.Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_id(), FbstabSolver::id());
+  EXPECT_EQ(result.get_solver_details<FbstabSolver>().exit_flag, 0);
+
+  // Without the inequality constraints, the problem is an equality constrained
+  // QP.
+  const MathematicalProgramResult expected =
+      EqualityConstrainedQPSolver().Solve(prog);
+  ASSERT_TRUE(expected.is_success());
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), expected.get_x_val(), 1E-5));
+  EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), 1E-5);
+}
+
+GTEST_TEST(FbstabSolverTest, InputLimits) {
+  MathematicalProgram prog;
+  const int N = 20;
+  const FbstabSolver::StageVariables stage_variables =
+      AddDoubleIntegratorMpc(N, &prog);
+  for (int k = 0; k <= N; ++k) {
+    prog.AddBoundingBoxConstraint(-1, 1, stage_variables.inputs[k]);
+  }
+  const MathematicalProgramResult result =
+      FbstabSolver(stage_variables).Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  const double tol = 1E-5;
+  for (int k = 0; k < N; ++k) {
+    const double u = result.GetSolution(stage_variables.inputs[k](0));
+    EXPECT_LE(std::abs(u), 1 + tol);
+    EXPECT_TRUE(CompareMatrices(
+        result.GetSolution(stage_variables.states[k + 1]),
+        (Eigen::Matrix2d() << 1, 0.1, 0, 1).finished() *
+                result.GetSolution(stage_variables.states[k]) +
+            Eigen::Vector2d(0, 0.1 * u),
+        tol));
+  }
+  // The initial state is far enough, that the first input saturates.
+  EXPECT_NEAR(result.GetSolution(stage_variables.inputs[0](0)), -1, tol);
+  EXPECT_EQ(result.GetSolution(stage_variables.inputs[N](0)),
+            result.GetSolution(stage_variables.inputs[N - 1](0)));
+}
+
+GTEST_TEST(FbstabSolverTest, WarmStart) {
+  MathematicalProgram prog;
+  const int N = 20;
+  const FbstabSolver::StageVariables stage_variables =
+      AddDoubleIntegratorMpc(N, &prog);
+  for (int k = 0; k <= N; ++k) {
+    prog.AddBoundingBoxConstraint(-1, 1, stage_variables.inputs[k]);
+  }
+  FbstabSolver solver(stage_variables);
+  const MathematicalProgramResult cold = solver.Solve(prog);
+  ASSERT_TRUE(cold.is_success());
+
+  // Starting at the solution takes no more iterations and finds it again.
+  const MathematicalProgramResult warm =
+      solver.Solve(prog, cold.get_x_val(), std::nullopt);
+  ASSERT_TRUE(warm.is_success());
+  EXPECT_LE(warm.get_solver_details<FbstabSolver>().newton_iters,
+            cold.get_solver_details<FbstabSolver>().newton_iters);
+  EXPECT_TRUE(CompareMatrices(warm.get_x_val(), cold.get_x_val(), 1E-5));
+
+  // The dual solution isn't reported.
+  EXPECT_THROW(
+      warm.GetDualSolution(prog.bounding_box_constraints()[0]),
+      std::invalid_argument);
+}
+
+GTEST_TEST(FbstabSolverTest, NotStageStructured) {
+  MathematicalProgram prog;
+  const FbstabSolver::StageVariables stage_variables =
+      AddDoubleIntegratorMpc(5, &prog);
+  // A cost coupling the states of the stages 1 and 3.
+  prog.AddQuadraticCost(
+      (stage_variables.states[1] - stage_variables.states[3]).squaredNorm());
+  const MathematicalProgramResult result =
+      FbstabSolver(stage_variables).Solve(prog);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kInvalidInput);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      FbstabSolver({{stage_variables.states[0]}, {stage_variables.inputs[0]}}),
+      std::invalid_argument,
+      "FbstabSolver: expects the states and inputs of at least two stages, got "
+      "1 states and 1 inputs.");
+}
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
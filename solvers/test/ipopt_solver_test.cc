@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -153,6 +154,44 @@ GTEST_TEST(IpoptSolverTest, AcceptableResult) {
   }
 }
 
+// With CommonSolverOption::kMaxThreads > 1, the thread-safe costs and
+// constraints (here, everything but the nonlinear constraint) are evaluated
+// concurrently. The iterates, hence the solution, must not change.
+GTEST_TEST(IpoptSolverTest, MaxThreads) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<8>();
+  Eigen::Matrix<double, 8, 1> x_expected;
+  for (int i = 0; i < 4; ++i) {
+    // The point closest to c in the disk of radius 2 is 2c/|c|.
+    const Eigen::Vector2d c(i + 3, 4 - i);
+    const auto x_i = x.segment<2>(2 * i);
+    prog.AddQuadraticCost((x_i - c).squaredNorm());
+    prog.AddLorentzConeConstraint(
+        Vector3<symbolic::Expression>(2, x_i(0), x_i(1)));
+    x_expected.segment<2>(2 * i) = 2 * c.normalized();
+  }
+  prog.AddLinearConstraint(x(1) + x(3) <= 10);
+  prog.AddConstraint(x(0) * x(2) + x(4) * x(6) <= 100);
+  prog.SetInitialGuessForAllVariables(Eigen::VectorXd::Ones(8));
+
+  IpoptSolver solver;
+  if (solver.available()) {
+    const MathematicalProgramResult result = solver.Solve(prog);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, 1E-6));
+    for (const int max_threads : {2, 4, 8}) {
+      SolverOptions options;
+      options.SetOption(CommonSolverOption::kMaxThreads, max_threads);
+      const MathematicalProgramResult result_parallel =
+          solver.Solve(prog, std::nullopt, options);
+      ASSERT_TRUE(result_parallel.is_success());
+      EXPECT_TRUE(CompareMatrices(result_parallel.GetSolution(x),
+                                  result.GetSolution(x), 1E-12));
+      EXPECT_EQ(result_parallel.get_optimal_cost(), result.get_optimal_cost());
+    }
+  }
+}
+
 GTEST_TEST(IpoptSolverTest, QPDualSolution1) {
   IpoptSolver solver;
   TestQPDualSolution1(solver, 1e-5);
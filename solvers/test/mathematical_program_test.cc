@@ -196,6 +196,38 @@ GTEST_TEST(TestMathematicalProgram, TestConstructor) {
   EXPECT_EQ(prog.num_vars(), 0);
 }
 
+GTEST_TEST(TestMathematicalProgram, StructureRevision) {
+  MathematicalProgram prog;
+  const MathematicalProgram other_prog;
+  EXPECT_NE(prog.structure_revision(), other_prog.structure_revision());
+
+  int64_t revision = prog.structure_revision();
+  auto x = prog.NewContinuousVariables<2>();
+  EXPECT_NE(prog.structure_revision(), revision);
+
+  revision = prog.structure_revision();
+  auto cost = prog.AddQuadraticCost(x(0) * x(0) + x(1));
+  EXPECT_NE(prog.structure_revision(), revision);
+
+  revision = prog.structure_revision();
+  auto constraint = prog.AddLinearConstraint(x(0) + x(1) <= 1);
+  EXPECT_NE(prog.structure_revision(), revision);
+
+  revision = prog.structure_revision();
+  prog.AddBoundingBoxConstraint(0, 1, x);
+  EXPECT_NE(prog.structure_revision(), revision);
+
+  // Updating the coefficients through the bindings keeps the structure.
+  revision = prog.structure_revision();
+  constraint.evaluator()->UpdateCoefficients(
+      Eigen::RowVector2d(1, 2), Vector1d(0), Vector1d(3));
+  cost.evaluator()->UpdateCoefficients(Matrix2d::Identity(), Vector2d(1, 0));
+  EXPECT_EQ(prog.structure_revision(), revision);
+
+  // A clone has its own revision.
+  EXPECT_NE(prog.Clone()->structure_revision(), revision);
+}
+
 GTEST_TEST(TestAddVariable, TestAddContinuousVariables1) {
   // Adds a dynamic-sized matrix of continuous variables.
   MathematicalProgram prog;
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -176,6 +178,63 @@ GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
     EXPECT_NE(result.get_solver_details<OsqpSolver>().status_val, OSQP_SOLVED);
   }
 }
+
+GTEST_TEST(OsqpSolverTest, Session) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(0));
+  auto constraint = prog.AddLinearConstraint(x(0) + x(1) >= 1);
+
+  OsqpSolverSession session;
+  OsqpSolver solver;
+  if (session.available()) {
+    const double tol = 1E-5;
+    MathematicalProgramResult result = session.Solve(prog);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(session.reused_workspace());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(0.25, 0.75), tol));
+    const int first_iter = result.get_solver_details<OsqpSolver>().iter;
+
+    // Solving the same problem again reuses the workspace, and the solve is
+    // warm-started from the previous solution.
+    result = session.Solve(prog);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(session.reused_workspace());
+    EXPECT_LE(result.get_solver_details<OsqpSolver>().iter, first_iter);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(0.25, 0.75), tol));
+
+    // Changing the bounds and the values of P, q and A keeps the sparsity
+    // pattern, so the workspace is still reused.
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(1, 2), Vector1d(2),
+        Vector1d(std::numeric_limits<double>::infinity()));
+    cost.evaluator()->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(0, 1));
+    result = session.Solve(prog);
+    EXPECT_TRUE(session.reused_workspace());
+    const MathematicalProgramResult expected = solver.Solve(prog);
+    EXPECT_EQ(result.get_solution_result(), expected.get_solution_result());
+    EXPECT_TRUE(
+        CompareMatrices(result.GetSolution(x), expected.GetSolution(x), tol));
+    EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), tol);
+
+    // A new constraint changes the sparsity pattern of A, so the workspace is
+    // set up again.
+    prog.AddLinearConstraint(x(0) <= 0);
+    result = session.Solve(prog);
+    EXPECT_FALSE(session.reused_workspace());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                solver.Solve(prog).GetSolution(x), tol));
+
+    // After Reset(), the workspace is set up again.
+    session.Reset();
+    result = session.Solve(prog);
+    EXPECT_FALSE(session.reused_workspace());
+    EXPECT_TRUE(result.is_success());
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,161 @@
+#include "drake/solvers/presolve.h"
+
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+const double kTol = 1E-6;
+
+SolverOptions PresolveOptions(int presolve) {
+  SolverOptions options;
+  options.SetOption(CommonSolverOption::kPresolve, presolve);
+  return options;
+}
+
+GTEST_TEST(PresolveTest, RedundantRowsAndFixedVariable) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddQuadraticCost((x(0) - 3) * (x(0) - 3) + (x(1) - 3) * (x(1) - 3) +
+                        x(0) * x(2));
+  // The second row is the first one scaled by 2, with a tighter bound.
+  const auto row1 = prog.AddLinearConstraint(x(0) + x(1) <= 3);
+  const auto row2 = prog.AddLinearConstraint(2 * x(0) + 2 * x(1) <= 4);
+  // A row with a single variable, which becomes a bound.
+  const auto row3 = prog.AddLinearConstraint(3 * x(0) >= -5);
+  // x(2) is fixed, and eliminated.
+  const auto equality = prog.AddLinearEqualityConstraint(x(2) == 1);
+  const auto bounding_box = prog.AddBoundingBoxConstraint(-10, 10, x(1));
+  prog.SetVariableScaling(x(1), 2);
+  prog.SetVariableScaling(x(2), 3);
+
+  const Presolver presolver(prog);
+  EXPECT_TRUE(presolver.has_reductions());
+  EXPECT_FALSE(presolver.is_infeasible());
+  EXPECT_EQ(presolver.num_removed_rows(), 3);
+  EXPECT_EQ(presolver.num_eliminated_variables(), 1);
+  const MathematicalProgram& presolved_prog = presolver.presolved_program();
+  EXPECT_EQ(presolved_prog.num_vars(), 2);
+  EXPECT_EQ(presolved_prog.linear_constraints().size(), 1);
+  EXPECT_TRUE(presolved_prog.linear_equality_constraints().empty());
+  EXPECT_EQ(presolved_prog.bounding_box_constraints().size(), 1);
+  // The scaling of x(1) is kept, at its index in the presolved program, and
+  // the one of the eliminated x(2) is dropped.
+  const std::unordered_map<int, double> expected_scaling{
+      {presolved_prog.FindDecisionVariableIndex(x(1)), 2}};
+  EXPECT_EQ(presolved_prog.GetVariableScaling(), expected_scaling);
+
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  const MathematicalProgramResult result =
+      solver.Solve(prog, std::nullopt, PresolveOptions(1));
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_id(), OsqpSolver::id());
+  // With x(2) = 1, the cost is (x₀-3)² + (x₁-3)² + x₀, and the second row is
+  // active.
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                              Eigen::Vector3d(0.75, 1.25, 1), kTol));
+  EXPECT_NEAR(result.get_optimal_cost(), 8.875, kTol);
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(row1),
+                              Eigen::VectorXd::Zero(1), kTol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(row2),
+                              Eigen::VectorXd::Constant(1, -1.75), kTol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(row3),
+                              Eigen::VectorXd::Zero(1), kTol));
+  // The dual solution of x(2) = 1 is ∂cost/∂x₂ = x₀.
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(equality),
+                              Eigen::VectorXd::Constant(1, 0.75), kTol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(bounding_box),
+                              Eigen::VectorXd::Zero(1), kTol));
+
+  // Matches the solution without the presolve.
+  const MathematicalProgramResult expected =
+      solver.Solve(prog, std::nullopt, PresolveOptions(0));
+  ASSERT_TRUE(expected.is_success());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), expected.GetSolution(x),
+                              1E-5));
+  EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), 1E-5);
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(equality),
+                              expected.GetDualSolution(equality), 1E-5));
+}
+
+GTEST_TEST(PresolveTest, AllVariablesEliminated) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost(x(0) * x(0) + x(1));
+  const auto bounding_box =
+      prog.AddBoundingBoxConstraint(Eigen::Vector2d(2, 1),
+                                    Eigen::Vector2d(2, 3), x);
+  // With x(0) fixed, this row becomes x(1) ≥ 3.
+  const auto row = prog.AddLinearConstraint(x(0) + x(1) >= 5);
+
+  const Presolver presolver(prog);
+  EXPECT_EQ(presolver.num_eliminated_variables(), 2);
+  EXPECT_EQ(presolver.presolved_program().num_vars(), 0);
+
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  // The program is solved without calling the solver.
+  const MathematicalProgramResult result =
+      solver.Solve(prog, std::nullopt, PresolveOptions(1));
+  ASSERT_TRUE(result.is_success());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), Eigen::Vector2d(2, 3)));
+  EXPECT_EQ(result.get_optimal_cost(), 7);
+  // The row determines the lower bound of x(1), hence its dual solution is
+  // ∂cost/∂x₁ = 1, and the bound of x(0) gets ∂cost/∂x₀ - 1 = 3.
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(row),
+                              Eigen::VectorXd::Constant(1, 1), kTol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(bounding_box),
+                              Eigen::Vector2d(3, 0), kTol));
+}
+
+GTEST_TEST(PresolveTest, Infeasible) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddLinearConstraint(x(0) + x(1) <= 1);
+  prog.AddLinearConstraint(-2 * x(0) - 2 * x(1) <= -4);
+  prog.AddQuadraticCost(x(0) * x(0));
+
+  const Presolver presolver(prog);
+  EXPECT_TRUE(presolver.has_reductions());
+  EXPECT_TRUE(presolver.is_infeasible());
+
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  const MathematicalProgramResult result =
+      solver.Solve(prog, std::nullopt, PresolveOptions(1));
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+  EXPECT_EQ(result.get_optimal_cost(),
+            MathematicalProgram::kGlobalInfeasibleCost);
+}
+
+GTEST_TEST(PresolveTest, NonlinearConstraintsAreKept) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddBoundingBoxConstraint(1, 1, x(0));
+  // x(0) appears in a Lorentz cone constraint, so it is not eliminated.
+  prog.AddLorentzConeConstraint(x.cast<symbolic::Expression>());
+  prog.AddLinearCost(x(1) + x(2));
+
+  const Presolver presolver(prog);
+  EXPECT_FALSE(presolver.has_reductions());
+  EXPECT_EQ(presolver.num_eliminated_variables(), 0);
+}
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
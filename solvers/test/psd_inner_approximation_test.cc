@@ -0,0 +1,132 @@
+#include "drake/solvers/psd_inner_approximation.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/scs_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+// min trace(CX) s.t. X ⪰ 0, trace(X) = 1, whose optimal cost is the smallest
+// eigenvalue of C.
+class PsdInnerApproximationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    X_ = prog_.NewSymmetricContinuousVariables<2>("X");
+    prog_.AddPositiveSemidefiniteConstraint(X_);
+    prog_.AddLinearEqualityConstraint(X_(0, 0) + X_(1, 1) == 1);
+    prog_.AddLinearCost(X_(0, 0) + 4 * X_(0, 1) + 5 * X_(1, 1));
+    options_.solver_id = ScsSolver::id();
+  }
+
+  // Checks that the solution is feasible for the semidefinite program.
+  void CheckFeasible(const MathematicalProgramResult& result) const {
+    const Eigen::Matrix2d X = result.GetSolution(X_);
+    EXPECT_NEAR(X.trace(), 1, kTol);
+    EXPECT_GE(Eigen::SelfAdjointEigenSolver<Eigen::Matrix2d>(X)
+                  .eigenvalues()
+                  .minCoeff(),
+              -kTol);
+  }
+
+  const double kTol{1E-4};
+  // The smallest eigenvalue of C = [1 2; 2 5].
+  const double kOptimalCost{3 - 2 * std::sqrt(2)};
+  MathematicalProgram prog_;
+  MatrixDecisionVariable<2, 2> X_;
+  PsdInnerApproximationOptions options_;
+};
+
+TEST_F(PsdInnerApproximationTest, DiagonallyDominant) {
+  if (!ScsSolver::is_available()) {
+    return;
+  }
+  options_.type = PsdInnerApproximation::kDiagonallyDominant;
+  // Without a change of basis, the best diagonally dominant X has the cost 1.
+  options_.max_iterations = 1;
+  const MathematicalProgramResult first_result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  ASSERT_TRUE(first_result.is_success());
+  EXPECT_NEAR(first_result.get_optimal_cost(), 1, kTol);
+  CheckFeasible(first_result);
+
+  // The changes of basis approach the optimal cost from above.
+  options_.max_iterations = 10;
+  const MathematicalProgramResult result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_LT(result.get_optimal_cost(), 0.5);
+  EXPECT_GE(result.get_optimal_cost(), kOptimalCost - kTol);
+  CheckFeasible(result);
+}
+
+TEST_F(PsdInnerApproximationTest, ScaledDiagonallyDominant) {
+  if (!ScsSolver::is_available()) {
+    return;
+  }
+  // A 2 x 2 matrix is scaled diagonally dominant iff it is positive
+  // semidefinite.
+  options_.type = PsdInnerApproximation::kScaledDiagonallyDominant;
+  options_.max_iterations = 1;
+  const MathematicalProgramResult result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_NEAR(result.get_optimal_cost(), kOptimalCost, kTol);
+  CheckFeasible(result);
+}
+
+TEST_F(PsdInnerApproximationTest, SolverOptions) {
+  if (!ScsSolver::is_available()) {
+    return;
+  }
+  // The options stored in the program are used.
+  prog_.SetSolverOption(ScsSolver::id(), "max_iters", 1);
+  options_.max_iterations = 1;
+  const MathematicalProgramResult result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  EXPECT_FALSE(result.is_success());
+  EXPECT_EQ(result.get_solver_details<ScsSolver>().iter, 1);
+
+  // The options in PsdInnerApproximationOptions take precedence.
+  options_.solver_options = SolverOptions();
+  options_.solver_options->SetOption(ScsSolver::id(), "max_iters", 10000);
+  const MathematicalProgramResult merged_result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  ASSERT_TRUE(merged_result.is_success());
+  EXPECT_NEAR(merged_result.get_optimal_cost(), kOptimalCost, kTol);
+}
+
+TEST_F(PsdInnerApproximationTest, VisualizationCallback) {
+  if (!IpoptSolver::is_available()) {
+    return;
+  }
+  int num_calls = 0;
+  prog_.AddVisualizationCallback(
+      [&num_calls](const Eigen::Ref<const Eigen::VectorXd>& x) {
+        EXPECT_EQ(x.size(), 3);
+        ++num_calls;
+      },
+      Vector3<symbolic::Variable>(X_(0, 0), X_(0, 1), X_(1, 1)));
+  options_.type = PsdInnerApproximation::kDiagonallyDominant;
+  options_.max_iterations = 1;
+  options_.solver_id = IpoptSolver::id();
+  const MathematicalProgramResult result =
+      SolveWithPsdInnerApproximation(prog_, options_);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_NEAR(result.get_optimal_cost(), 1, kTol);
+  EXPECT_GT(num_calls, 0);
+}
+
+TEST_F(PsdInnerApproximationTest, InvalidOptions) {
+  options_.max_iterations = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(SolveWithPsdInnerApproximation(prog_, options_),
+                              std::exception, ".*max_iterations > 0.*");
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
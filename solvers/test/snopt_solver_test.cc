@@ -406,6 +406,44 @@ GTEST_TEST(SnoptTest, AutoDiffOnlyCost) {
   }
 }
 
+// Solving with CommonSolverOption::kMaxThreads > 1 evaluates the thread-safe
+// bindings concurrently, and must give the same solution as the sequential
+// solve. Each pair (x₂ᵢ, x₂ᵢ₊₁) is pulled towards cᵢ, outside of the disk of
+// radius 2, so the optimal solution is 2cᵢ/|cᵢ|. The quadratic costs and the
+// Lorentz cones are thread safe, the (inactive) nonlinear constraint is not.
+GTEST_TEST(SnoptTest, MaxThreads) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<8>();
+  Eigen::Matrix<double, 8, 1> x_expected;
+  for (int i = 0; i < 4; ++i) {
+    const Eigen::Vector2d c(i + 3, 4 - i);
+    const auto x_i = x.segment<2>(2 * i);
+    prog.AddQuadraticCost((x_i - c).squaredNorm());
+    prog.AddLorentzConeConstraint(
+        Vector3<symbolic::Expression>(2, x_i(0), x_i(1)));
+    x_expected.segment<2>(2 * i) = 2 * c.normalized();
+  }
+  prog.AddConstraint(x(0) * x(2) + x(4) * x(6) <= 100);
+  prog.SetInitialGuessForAllVariables(Eigen::VectorXd::Ones(8));
+
+  SnoptSolver solver;
+  if (solver.available()) {
+    const MathematicalProgramResult result = solver.Solve(prog);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, 1E-6));
+    SolverOptions options;
+    options.SetOption(CommonSolverOption::kMaxThreads, 4);
+    for (int repeat = 0; repeat < 3; ++repeat) {
+      const MathematicalProgramResult result_parallel =
+          solver.Solve(prog, std::nullopt, options);
+      ASSERT_TRUE(result_parallel.is_success());
+      EXPECT_TRUE(CompareMatrices(result_parallel.GetSolution(x),
+                                  result.GetSolution(x), 1E-12));
+      EXPECT_EQ(result_parallel.get_optimal_cost(), result.get_optimal_cost());
+    }
+  }
+}
+
 GTEST_TEST(SnoptTest, VariableScaling1) {
   // Linear cost and bounding box constraint
   MathematicalProgram prog;
@@ -145,6 +145,32 @@ GTEST_TEST(SolverOptionsTest, SetOptionError) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       solver_options.SetOption(CommonSolverOption::kPrintToConsole, 2),
       std::runtime_error, "kPrintToConsole expects value either 0 or 1");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kMaxThreads, 0),
+      std::runtime_error, "kMaxThreads expects a positive value");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kMaxThreads, 2.0),
+      std::runtime_error,
+      "SolverOptions::SetOption support kMaxThreads only with int value.");
+}
+
+GTEST_TEST(SolverOptionsTest, GetMaxThreads) {
+  SolverOptions solver_options;
+  EXPECT_EQ(internal::GetMaxThreads(solver_options), 1);
+  solver_options.SetOption(CommonSolverOption::kMaxThreads, 4);
+  EXPECT_EQ(internal::GetMaxThreads(solver_options), 4);
+}
+
+GTEST_TEST(SolverOptionsTest, IsPresolveEnabled) {
+  SolverOptions solver_options;
+  EXPECT_FALSE(internal::IsPresolveEnabled(solver_options));
+  solver_options.SetOption(CommonSolverOption::kPresolve, 1);
+  EXPECT_TRUE(internal::IsPresolveEnabled(solver_options));
+  solver_options.SetOption(CommonSolverOption::kPresolve, 0);
+  EXPECT_FALSE(internal::IsPresolveEnabled(solver_options));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kPresolve, 2),
+      std::runtime_error, "kPresolve expects value either 0 or 1");
 }
 }  // namespace solvers
 }  // namespace drake
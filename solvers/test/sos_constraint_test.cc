@@ -3,6 +3,8 @@
 #include "drake/solvers/mathematical_program.h"
 /* clang-format on */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic.h"
@@ -279,6 +281,46 @@ TEST_F(SosConstraintTest, AddSosConstraintMultivariate2) {
   CheckPositiveDefiniteMatrix(Q, m, e);
 }
 
+// Finds the global minimum of f(x₀, x₁) = x₀⁴ + x₁⁴ − 2x₀² − 2x₁², which is
+// -2, through max c s.t. f(x₀, x₁) - c is sum-of-squares. The Gram matrix is
+// split on the cliques of its term sparsity pattern.
+TEST_F(SosConstraintTest, AddSparseSosConstraint) {
+  const auto& x0 = x_(0);
+  const auto& x1 = x_(1);
+  const auto& c = c_(0);
+  prog_.AddCost(-c);
+  const symbolic::Expression e =
+      pow(x0, 4) + pow(x1, 4) - 2 * x0 * x0 - 2 * x1 * x1 - c;
+  const auto grams = prog_.AddSparseSosConstraint(e);
+  // The cliques are {1, x₀², x₁²}, {x₀}, {x₁} and {x₀x₁}.
+  ASSERT_EQ(grams.size(), 4);
+  int max_clique_size = 0;
+  for (const auto& [Q, m] : grams) {
+    max_clique_size = std::max(max_clique_size, static_cast<int>(m.rows()));
+  }
+  EXPECT_EQ(max_clique_size, 3);
+
+  result_ = Solve(prog_);
+  ASSERT_TRUE(result_.is_success());
+  EXPECT_NEAR(result_.GetSolution(c), -2, 1E-5);
+  const double eps = 1E-6;
+  symbolic::Polynomial sos_poly{};
+  for (const auto& [Q, m] : grams) {
+    const Eigen::MatrixXd Q_val = result_.GetSolution(Q);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Q_val);
+    EXPECT_TRUE((es.eigenvalues().array() >= -eps).all());
+    for (int i = 0; i < Q_val.rows(); ++i) {
+      for (int j = 0; j < Q_val.cols(); ++j) {
+        sos_poly.AddProduct(Q_val(i, j), m(i) * m(j));
+      }
+    }
+  }
+  const symbolic::Polynomial diff_poly =
+      (sos_poly - symbolic::Polynomial(result_.GetSolution(e)))
+          .RemoveTermsWithSmallCoefficients(eps);
+  EXPECT_PRED2(symbolic::test::PolyEqual, diff_poly, symbolic::Polynomial{});
+}
+
 TEST_F(SosConstraintTest, SynthesizeLyapunovFunction) {
   // Find the Lyapunov function V(x) for system:
   //
@@ -5,6 +5,7 @@
 #include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/math/quadratic_form.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/psd_inner_approximation.h"
 #include "drake/solvers/solve.h"
 
 namespace drake {
@@ -23,6 +24,26 @@ using symbolic::Variables;
 
 namespace {
 
+// Adds the constraint that p is SOS to prog.
+void AddSosConstraint(const Polynomial& p,
+                      const RegionOfAttractionOptions& options,
+                      MathematicalProgram* prog) {
+  if (options.use_chordal_decomposition) {
+    prog->AddSparseSosConstraint(p);
+  } else {
+    prog->AddSosConstraint(p);
+  }
+}
+
+solvers::MathematicalProgramResult SolveSosProgram(
+    const MathematicalProgram& prog, const RegionOfAttractionOptions& options) {
+  if (options.psd_inner_approximation) {
+    return solvers::SolveWithPsdInnerApproximation(
+        prog, *options.psd_inner_approximation);
+  }
+  return Solve(prog);
+}
+
 // Assumes V positive semi-definite at the origin.
 // If the Hessian of Vdot is negative definite at the origin, then we use
 // Vdot = 0 => V >= rho (or x=0) via
@@ -31,7 +52,8 @@ namespace {
 // If we cannot confirm negative definiteness, then we must ask instead for
 // Vdot >=0 => V >= rho (or x=0).
 Expression FixedLyapunovConvex(const solvers::VectorXIndeterminate& x,
-                               const Expression& V, const Expression& Vdot) {
+                               const Expression& V, const Expression& Vdot,
+                               const RegionOfAttractionOptions& options) {
   // Check if the Hessian of Vdot is negative definite.
   Environment env;
   for (int i = 0; i < x.size(); i++) {
@@ -90,18 +112,19 @@ Expression FixedLyapunovConvex(const solvers::VectorXIndeterminate& x,
 
   // Want (V-rho)(x'x)^d and Lambda*Vdot to be the same degree.
   const int d = std::floor((lambda_degree + Vdot_degree - V_degree) / 2);
-  prog.AddSosConstraint(
+  AddSosConstraint(
       ((V_balanced - rho) * Polynomial(pow((x.transpose() * x)[0], d)) -
-       lambda * Vdot_balanced));
+       lambda * Vdot_balanced),
+      options, &prog);
 
   // If Vdot is indefinite, then the linearization does not inform us about the
   // local stability.  Add "lambda(x) is SOS" to confirm this local stability.
   if (!Vdot_is_locally_negative_definite) {
-    prog.AddSosConstraint(lambda);
+    AddSosConstraint(lambda, options, &prog);
   }
 
   prog.AddCost(-rho);
-  const auto result = Solve(prog);
+  const auto result = SolveSosProgram(prog, options);
 
   DRAKE_THROW_UNLESS(result.is_success());
 
@@ -176,8 +199,8 @@ Expression RegionOfAttraction(const System<double>& system,
     DRAKE_THROW_UNLESS(V.GetVariables().IsSubsetOf(Variables(x_bar)));
 
     // Check that V is positive definite.
-    prog.AddSosConstraint(V);
-    const auto result = Solve(prog);
+    AddSosConstraint(prog.MakePolynomial(V), options, &prog);
+    const auto result = SolveSosProgram(prog, options);
     DRAKE_THROW_UNLESS(result.is_success());
   } else {
     // Solve a Lyapunov equation to find a candidate.
@@ -189,7 +212,7 @@ Expression RegionOfAttraction(const System<double>& system,
 
   const Expression Vdot = V.Jacobian(x_bar).dot(f);
 
-  V = FixedLyapunovConvex(x_bar, V, Vdot);
+  V = FixedLyapunovConvex(x_bar, V, Vdot, options);
 
   // Put V back into global coordinates.
   Substitution subs;
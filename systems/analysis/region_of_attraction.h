@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
+
 #include "drake/common/symbolic.h"
+#include "drake/solvers/psd_inner_approximation.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
 
@@ -27,6 +30,23 @@ struct RegionOfAttractionOptions {
    * system.
    */
   VectorX<symbolic::Variable> state_variables{};
+
+  /** If true, the sums-of-squares constraints are imposed with
+   * MathematicalProgram::AddSparseSosConstraint(), which splits the Gram
+   * matrices along the chordal term sparsity of the polynomials. This is much
+   * cheaper for systems with many states, but the certified region of
+   * attraction can be smaller.
+   */
+  bool use_chordal_decomposition{false};
+
+  /** If set, the sums-of-squares programs are solved with
+   * solvers::SolveWithPsdInnerApproximation(), namely as a sequence of linear
+   * programs (DSOS) or second order cone programs (SDSOS) instead of
+   * semidefinite programs. This scales to systems with many more states, but
+   * the certified region of attraction can be smaller.
+   */
+  std::optional<solvers::PsdInnerApproximationOptions>
+      psd_inner_approximation{};
 };
 
 /**
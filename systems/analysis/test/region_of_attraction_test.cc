@@ -34,6 +34,48 @@ GTEST_TEST(RegionOfAttractionTest, CubicPolynomialTest) {
   EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
 }
 
+// The cubic polynomial again, with the chordal decomposition of the Gram
+// matrices. The polynomials of this example have dense term sparsity, hence
+// the region of attraction is the same.
+GTEST_TEST(RegionOfAttractionTest, ChordalDecomposition) {
+  Variable x("x");
+  const auto system =
+      SymbolicVectorSystemBuilder().state(x).dynamics(-x + pow(x, 3)).Build();
+  const auto context = system->CreateDefaultContext();
+
+  RegionOfAttractionOptions options;
+  options.lyapunov_candidate = x * x;
+  options.state_variables = Vector1<Variable>(x);
+  options.use_chordal_decomposition = true;
+
+  const Expression V = RegionOfAttraction(*system, *context, options);
+  const Polynomial V_expected{x * x};
+  EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
+}
+
+// The cubic polynomial again, solved as a sequence of second order cone
+// programs. The multiplier lambda(x) = x² / 2 certifies the true region of
+// attraction with a scaled diagonally dominant Gram matrix.
+GTEST_TEST(RegionOfAttractionTest, PsdInnerApproximation) {
+  Variable x("x");
+  const auto system =
+      SymbolicVectorSystemBuilder().state(x).dynamics(-x + pow(x, 3)).Build();
+  const auto context = system->CreateDefaultContext();
+
+  RegionOfAttractionOptions options;
+  options.lyapunov_candidate = x * x;
+  options.state_variables = Vector1<Variable>(x);
+  options.psd_inner_approximation = solvers::PsdInnerApproximationOptions{};
+
+  const Expression V = RegionOfAttraction(*system, *context, options);
+  // V = x² / rho, where rho ≤ 1 since the approximation is conservative.
+  const double rho_inverse = V.Evaluate(symbolic::Environment{{x, 1}});
+  EXPECT_GE(rho_inverse, 1 - 1e-4);
+  EXPECT_LE(rho_inverse, 1.01);
+  EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(
+      Polynomial(rho_inverse * x * x), 1e-6));
+}
+
 // Cubic again, but shifted to a non-zero equilibrium.
 GTEST_TEST(RegionOfAttractionTest, ShiftedCubicPolynomialTest) {
   Variable x("x");
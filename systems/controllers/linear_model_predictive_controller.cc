@@ -4,7 +4,7 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
+#include "drake/solvers/fbstab_solver.h"
 #include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
@@ -107,7 +107,14 @@ VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
       base_context.get_discrete_state().get_vector().CopyToVector();
   prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
 
-  const auto result = Solve(prog);
+  // The state and input at each sample time form a stage of the QP.
+  solvers::FbstabSolver::StageVariables stage_variables;
+  for (int i = 0; i < kNumSampleTimes; ++i) {
+    stage_variables.states.push_back(prog.state(i));
+    stage_variables.inputs.push_back(prog.input(i));
+  }
+  const auto result =
+      solvers::FbstabSolver(std::move(stage_variables)).Solve(prog);
   DRAKE_DEMAND(result.is_success());
 
   return prog.GetInputSamples(result).col(0);
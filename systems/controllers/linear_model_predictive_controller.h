@@ -25,7 +25,8 @@ namespace controllers {
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
 /// desired states and inputs, respectively.  Note that the present
 /// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// information between steps.  The QP is solved by solvers::FbstabSolver,
+/// which exploits its stage structure with a Riccati recursion.
 ///
 /// @tparam_double_only
 /// @ingroup control_systems
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -51,6 +54,17 @@ using ImageExpr = Image<PixelType::kExpr>;
 ///
 /// The origin of image coordinate system is on the left-upper corner.
 ///
+/// Copies of an image share their pixel data (copy-on-write), so copying an
+/// image (e.g., into an output port's value or a downstream system's cache) is
+/// cheap regardless of its size. The pixels are only duplicated when a copy
+/// that shares them is accessed through the non-const at() or mutable_data().
+/// Const access never copies, and separate Image objects sharing the same
+/// pixels may be read and written from different threads. Note that the
+/// pointer returned by the non-const at() must not be written through after
+/// the image has been copied (the copy would see the change); call at() again
+/// instead. Loops that write many pixels should call mutable_data() once and
+/// index the returned pointer, rather than pay for the check in every at().
+///
 /// @tparam kPixelType The pixel type enum that denotes the pixel format and the
 /// data type of a channel.
 template <PixelType kPixelType>
@@ -93,7 +107,8 @@ class Image {
   /// @param initial_value A value set to all the channels in all the pixels
   Image(int width, int height, T initial_value)
       : width_(width), height_(height),
-        data_(width * height * kNumChannels, initial_value) {
+        data_(std::make_shared<std::vector<T>>(width * height * kNumChannels,
+                                               initial_value)) {
     DRAKE_ASSERT(width > 0);
     DRAKE_ASSERT(height > 0);
   }
@@ -119,8 +134,15 @@ class Image {
     DRAKE_ASSERT(width > 0);
     DRAKE_ASSERT(height > 0);
 
-    data_.resize(width * height * kNumChannels);
-    std::fill(data_.begin(), data_.end(), 0);
+    const int new_size = width * height * kNumChannels;
+    if (data_ != nullptr && data_.use_count() == 1) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      data_->resize(new_size);
+      std::fill(data_->begin(), data_->end(), 0);
+    } else {
+      // The old pixels are about to be discarded; don't copy them.
+      data_ = std::make_shared<std::vector<T>>(new_size, 0);
+    }
     width_ = width;
     height_ = height;
   }
@@ -135,10 +157,14 @@ class Image {
   /// uint8_t green = image.at(x, y)[1];
   /// uint8_t blue  = image.at(x, y)[2];
   /// uint8_t alpha = image.at(x, y)[3];
+  ///
+  /// If the pixels are shared with copies of this image, this image first gets
+  /// its own copy of them (see MakeUnique()).
   T* at(int x, int y) {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    MakeUnique();
+    return data_->data() + (x + y * width_) * kNumChannels;
   }
 
   /// Const version of at() method.  See the document for the non-const version
@@ -146,13 +172,38 @@ class Image {
   const T* at(int x, int y) const {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    return data_->data() + (x + y * width_) * kNumChannels;
+  }
+
+  /// Gives this image its own copy of its pixels, if they are shared with
+  /// copies of this image. The copies keep the previous pixels.
+  void MakeUnique() {
+    if (data_ == nullptr) {
+      return;
+    }
+    if (data_.use_count() > 1) {
+      data_ = std::make_shared<std::vector<T>>(*data_);
+    } else {
+      // Orders the upcoming writes after the reads of any copy that has just
+      // released the pixels on another thread.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+  }
+
+  /// Calls MakeUnique(), and returns the channels of all the pixels, with the
+  /// pixel (x, y) at offset (x + y * width()) * kNumChannels; i.e., at(0, 0).
+  /// Returns nullptr for a zero-sized image.
+  T* mutable_data() {
+    MakeUnique();
+    return data_ == nullptr ? nullptr : data_->data();
   }
 
  private:
   reset_after_move<int> width_;
   reset_after_move<int> height_;
-  std::vector<T> data_;
+  // The pixels, shared among copies of this image until one of them is
+  // modified. Null for a zero-sized image.
+  std::shared_ptr<std::vector<T>> data_;
 };
 
 // TODO(jwnimmer-tri) Deprecate these float-only constants; code should be
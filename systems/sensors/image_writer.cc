@@ -15,6 +15,7 @@
 #include <vtkTIFFWriter.h>
 
 #include "drake/common/filesystem.h"
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace systems {
@@ -82,6 +83,97 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
+namespace internal {
+
+ImageWriteQueue::ImageWriteQueue(const ImageWriterAsyncParams& params)
+    : params_(params) {
+  if (params_.num_threads <= 0) {
+    throw std::logic_error(
+        "ImageWriter: the number of writing threads must be positive");
+  }
+  if (params_.max_queued_images <= 0) {
+    throw std::logic_error(
+        "ImageWriter: the maximum number of queued images must be positive");
+  }
+  for (int i = 0; i < params_.num_threads; ++i) {
+    workers_.emplace_back([this]() { Run(); });
+  }
+}
+
+ImageWriteQueue::~ImageWriteQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  task_queued_.notify_all();
+  // The workers only return once the queue is empty.
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ImageWriteQueue::Push(std::function<void()> task) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto is_full = [this]() {
+    return static_cast<int>(tasks_.size()) >= params_.max_queued_images;
+  };
+  if (is_full()) {
+    switch (params_.queue_full_policy) {
+      case ImageWriterAsyncParams::QueueFullPolicy::kBlock:
+        task_taken_.wait(lock, [&is_full]() { return !is_full(); });
+        break;
+      case ImageWriterAsyncParams::QueueFullPolicy::kDropNewest:
+        ++num_dropped_;
+        return;
+      case ImageWriterAsyncParams::QueueFullPolicy::kDropOldest:
+        tasks_.pop_front();
+        ++num_dropped_;
+        break;
+    }
+  }
+  tasks_.push_back(std::move(task));
+  lock.unlock();
+  task_queued_.notify_one();
+}
+
+void ImageWriteQueue::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock, [this]() { return tasks_.empty() && num_running_ == 0; });
+}
+
+int ImageWriteQueue::num_dropped() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_dropped_;
+}
+
+void ImageWriteQueue::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    task_queued_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+    if (tasks_.empty()) return;
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    ++num_running_;
+    task_taken_.notify_one();
+    lock.unlock();
+    // There is no caller to propagate a failure to; report it and move on to
+    // the next image.
+    try {
+      task();
+    } catch (const std::exception& e) {
+      drake::log()->error("ImageWriter: failed to write an image: {}",
+                          e.what());
+    }
+    lock.lock();
+    --num_running_;
+    if (tasks_.empty() && num_running_ == 0) {
+      idle_.notify_all();
+    }
+  }
+}
+
+}  // namespace internal
+
 ImageWriter::ImageWriter() {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
@@ -92,6 +184,21 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kDepth32F] = ".tiff";
 }
 
+ImageWriter::ImageWriter(const ImageWriterAsyncParams& async_params)
+    : ImageWriter() {
+  queue_ = std::make_unique<internal::ImageWriteQueue>(async_params);
+}
+
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::Flush() const {
+  if (queue_ != nullptr) queue_->Flush();
+}
+
+int ImageWriter::num_dropped_images() const {
+  return queue_ != nullptr ? queue_->num_dropped() : 0;
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -163,9 +270,18 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name =
+      MakeFileName(data.format, data.pixel_type, context.get_time(),
+                   port.get_name(), data.count++);
+  if (queue_ == nullptr) {
+    SaveToFileHelper(image, file_name);
+  } else {
+    // The port's value may change as soon as this event returns, so the queued
+    // task owns a copy of the image.
+    queue_->Push([image, file_name = std::move(file_name)]() {
+      SaveToFileHelper(image, file_name);
+    });
+  }
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
@@ -6,7 +6,13 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -46,6 +52,88 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path);
 
 //@}
 
+/** The parameters that make an ImageWriter write its images asynchronously.
+ See ImageWriter::ImageWriter(const ImageWriterAsyncParams&).  */
+struct ImageWriterAsyncParams {
+  /** What an %ImageWriter does with a published image when the queue of images
+   waiting to be written is already full.  */
+  enum class QueueFullPolicy {
+    /** Block the publishing (i.e., simulation) thread until there is room in
+     the queue. No image is lost.  */
+    kBlock,
+    /** Discard the newly published image.  */
+    kDropNewest,
+    /** Discard the oldest image waiting in the queue to make room for the newly
+     published one.  */
+    kDropOldest,
+  };
+
+  /** The number of background threads that encode and write images. Must be
+   positive.  */
+  int num_threads{1};
+
+  /** The maximum number of published images waiting to be written. Must be
+   positive.  */
+  int max_queued_images{8};
+
+  /** The policy applied when an image is published into a full queue.  */
+  QueueFullPolicy queue_full_policy{QueueFullPolicy::kBlock};
+};
+
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+
+// A bounded queue of tasks (e.g., encoding and writing one image) that are run
+// in order of arrival by a pool of worker threads. The policy for a full queue
+// and the sizes of the queue and the pool are given by ImageWriterAsyncParams.
+// The destructor runs all of the queued tasks before joining the workers.
+class ImageWriteQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriteQueue)
+
+  // @throws std::logic_error if the number of threads or the queue size in
+  // `params` is not positive.
+  explicit ImageWriteQueue(const ImageWriterAsyncParams& params);
+
+  ~ImageWriteQueue();
+
+  // Adds the given task to the queue. If the queue is full, the task either
+  // waits for room, is discarded, or replaces the oldest queued task, per the
+  // queue-full policy.
+  void Push(std::function<void()> task);
+
+  // Blocks until every task that was accepted by Push() has completed.
+  void Flush();
+
+  // Returns the number of tasks that were discarded because the queue was full.
+  int num_dropped() const;
+
+ private:
+  // The loop run by each of the worker threads.
+  void Run();
+
+  const ImageWriterAsyncParams params_;
+
+  mutable std::mutex mutex_;
+  // Signaled when a task is queued or the workers need to stop.
+  std::condition_variable task_queued_;
+  // Signaled when a worker removes a task from the queue.
+  std::condition_variable task_taken_;
+  // Signaled when the queue is empty and no task is running.
+  std::condition_variable idle_;
+
+  // The following are guarded by mutex_.
+  std::deque<std::function<void()>> tasks_;
+  int num_running_{0};
+  int num_dropped_{0};
+  bool stopping_{false};
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace internal
+#endif
+
 /** A system for periodically writing images to the file system. The system does
  not have a fixed set of input ports; the system can have an arbitrary number of
  image input ports. Each input port is independently configured with respect to:
@@ -77,14 +165,50 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ <h3>Synchronous and asynchronous writing</h3>
+
+ By default, each image is encoded and written to disk inside the publish event
+ that captures it, so the simulation waits on the encoder. An %ImageWriter
+ constructed with ImageWriterAsyncParams instead copies the published image into
+ a bounded queue and returns immediately; a pool of background threads encodes
+ and writes the queued images. When images are published faster than they can
+ be written, the queue fills up and ImageWriterAsyncParams::queue_full_policy
+ determines whether the simulation waits (backpressure) or images are dropped.
+ The file names are computed at publish time, so they (and the `count` format
+ argument) are the same in both modes, except that dropped images leave gaps.
+ Images still in the queue are written before the %ImageWriter is destroyed; use
+ Flush() to wait for them sooner (e.g., before reading the files back).  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
-  /** Constructs default instance with no image ports.  */
+  /** Constructs default instance with no image ports. Images are written
+   synchronously, inside the publish event.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports that writes images
+   asynchronously, as configured by `async_params`.
+   @throws std::logic_error if the number of threads or the queue size in
+                            `async_params` is not positive.  */
+  explicit ImageWriter(const ImageWriterAsyncParams& async_params);
+
+  /** Writes any images still waiting in the queue before destruction.  */
+  ~ImageWriter() override;
+
+  /** Reports if this writer writes images asynchronously.  */
+  bool is_async() const { return queue_ != nullptr; }
+
+  /** Blocks until every image published so far has been written to disk. Does
+   nothing for a synchronous writer.  */
+  void Flush() const;
+
+  /** Returns the number of published images that were discarded, instead of
+   written, because the queue was full. Always zero for a synchronous writer or
+   the QueueFullPolicy::kBlock policy.  */
+  int num_dropped_images() const;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -250,6 +374,9 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // The queue of images waiting to be written; null for a synchronous writer.
+  std::unique_ptr<internal::ImageWriteQueue> queue_;
 };
 
 }  // namespace sensors
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <set>
 #include <string>
 #include <utility>
 
@@ -35,9 +36,11 @@ RgbdSensor::RgbdSensor(FrameId parent_id,
                        const CameraProperties& color_properties,
                        const DepthCameraProperties& depth_properties,
                        const CameraPoses& camera_poses,
-                       bool show_window)
+                       bool show_window,
+                       RenderMode render_mode)
     : parent_frame_id_(parent_id),
       show_window_(show_window),
+      render_mode_(render_mode),
       color_camera_info_(color_properties.width, color_properties.height,
                          color_properties.fov_y),
       depth_camera_info_(depth_properties.width, depth_properties.height,
@@ -52,11 +55,28 @@ RgbdSensor::RgbdSensor(FrameId parent_id,
 
   ImageRgba8U color_image(color_camera_info_.width(),
                           color_camera_info_.height());
+  ImageDepth32F depth32(depth_camera_info_.width(),
+                        depth_camera_info_.height());
+  ImageLabel16I label_image(color_camera_info_.width(),
+                            color_camera_info_.height());
+
+  // The rendered images are cached so that the output ports derived from the
+  // same rendering (e.g., both depth images) don't render it again.
+  const std::set<DependencyTicket> query_ticket{
+      query_object_input_port_->ticket()};
+  if (render_mode_ == RenderMode::kFused) {
+    fused_images_cache_entry_ = &this->DeclareCacheEntry(
+        "fused images", FusedImages{color_image, depth32, label_image},
+        &RgbdSensor::CalcFusedImages, query_ticket);
+  } else {
+    depth_image_32F_cache_entry_ = &this->DeclareCacheEntry(
+        "depth image 32F", depth32, &RgbdSensor::CalcRenderedDepthImage32F,
+        query_ticket);
+  }
+
   color_image_port_ = &this->DeclareAbstractOutputPort(
       "color_image", color_image, &RgbdSensor::CalcColorImage);
 
-  ImageDepth32F depth32(depth_camera_info_.width(),
-                        depth_camera_info_.height());
   depth_image_32F_port_ = &this->DeclareAbstractOutputPort(
       "depth_image_32f", depth32, &RgbdSensor::CalcDepthImage32F);
 
@@ -65,13 +85,12 @@ RgbdSensor::RgbdSensor(FrameId parent_id,
   depth_image_16U_port_ = &this->DeclareAbstractOutputPort(
       "depth_image_16u", depth16, &RgbdSensor::CalcDepthImage16U);
 
-  ImageLabel16I label_image(color_camera_info_.width(),
-                            color_camera_info_.height());
   label_image_port_ = &this->DeclareAbstractOutputPort(
       "label_image", label_image, &RgbdSensor::CalcLabelImage);
 
   X_WB_pose_port_ = &this->DeclareVectorOutputPort(
-      "X_WB", rendering::PoseVector<double>(), &RgbdSensor::CalcX_WB);
+      "X_WB", rendering::PoseVector<double>(),
+      &RgbdSensor::CalcX_WBPoseVector);
 
   const float kMaxValidDepth16UInMM =
       (std::numeric_limits<uint16_t>::max() - 1) / 1000.;
@@ -109,6 +128,11 @@ const OutputPort<double>& RgbdSensor::X_WB_output_port() const {
 
 void RgbdSensor::CalcColorImage(const Context<double>& context,
                                 ImageRgba8U* color_image) const {
+  if (render_mode_ == RenderMode::kFused) {
+    *color_image =
+        fused_images_cache_entry_->Eval<FusedImages>(context).color;
+    return;
+  }
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderColorImage(color_properties_, parent_frame_id_,
                                 X_PB_ * X_BC_, show_window_, color_image);
@@ -116,36 +140,71 @@ void RgbdSensor::CalcColorImage(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
                                    ImageDepth32F* depth_image) const {
-  const QueryObject<double>& query_object = get_query_object(context);
-  query_object.RenderDepthImage(depth_properties_, parent_frame_id_,
-                                X_PB_ * X_BD_, depth_image);
+  *depth_image = EvalDepthImage32F(context);
 }
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
-  ImageDepth32F depth32(depth_image->width(), depth_image->height());
-  CalcDepthImage32F(context, &depth32);
-  ConvertDepth32FTo16U(depth32, depth_image);
+  ConvertDepth32FTo16U(EvalDepthImage32F(context), depth_image);
 }
 
 void RgbdSensor::CalcLabelImage(const Context<double>& context,
                                 ImageLabel16I* label_image) const {
+  if (render_mode_ == RenderMode::kFused) {
+    *label_image =
+        fused_images_cache_entry_->Eval<FusedImages>(context).label;
+    return;
+  }
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderLabelImage(color_properties_, parent_frame_id_,
                                 X_PB_ * X_BC_, show_window_, label_image);
 }
 
-void RgbdSensor::CalcX_WB(
-    const Context<double>& context,
-    rendering::PoseVector<double>* pose_vector) const {
-  // Calculates X_WB.
-  RigidTransformd X_WB;
+void RgbdSensor::CalcFusedImages(const Context<double>& context,
+                                 FusedImages* images) const {
+  const QueryObject<double>& query_object = get_query_object(context);
+  const RigidTransformd X_WB = CalcX_WB(query_object);
+  geometry::render::RenderImageBatch batch;
+  batch.color.push_back(
+      {color_properties_, X_WB * X_BC_, show_window_, &images->color});
+  batch.depth.push_back({depth_properties_, X_WB * X_BD_, &images->depth});
+  batch.label.push_back(
+      {color_properties_, X_WB * X_BC_, show_window_, &images->label});
+  query_object.RenderImages(batch);
+}
+
+void RgbdSensor::CalcRenderedDepthImage32F(const Context<double>& context,
+                                           ImageDepth32F* depth_image) const {
+  const QueryObject<double>& query_object = get_query_object(context);
+  query_object.RenderDepthImage(depth_properties_, parent_frame_id_,
+                                X_PB_ * X_BD_, depth_image);
+}
+
+const ImageDepth32F& RgbdSensor::EvalDepthImage32F(
+    const Context<double>& context) const {
+  if (render_mode_ == RenderMode::kFused) {
+    return fused_images_cache_entry_->Eval<FusedImages>(context).depth;
+  }
+  return depth_image_32F_cache_entry_->Eval<ImageDepth32F>(context);
+}
+
+RigidTransformd RgbdSensor::CalcX_WB(
+    const QueryObject<double>& query_object) const {
   if (parent_frame_id_ == SceneGraph<double>::world_frame_id()) {
-    X_WB = X_PB_;
-  } else {
-    const QueryObject<double>& query_object = get_query_object(context);
-    X_WB = query_object.X_WF(parent_frame_id_) * X_PB_;
+    return X_PB_;
   }
+  return query_object.X_WF(parent_frame_id_) * X_PB_;
+}
+
+void RgbdSensor::CalcX_WBPoseVector(
+    const Context<double>& context,
+    rendering::PoseVector<double>* pose_vector) const {
+  // A sensor affixed to the world doesn't need its query object input, which
+  // might not even be connected.
+  const RigidTransformd X_WB =
+      parent_frame_id_ == SceneGraph<double>::world_frame_id()
+          ? X_PB_
+          : CalcX_WB(get_query_object(context));
 
   Translation3d trans{X_WB.translation()};
   pose_vector->set_translation(trans);
@@ -158,10 +217,11 @@ void RgbdSensor::ConvertDepth32FTo16U(const ImageDepth32F& d32,
   // Convert to mm and 16bits.
   const float kDepth16UOverflowDistance =
       std::numeric_limits<uint16_t>::max() / 1000.;
+  uint16_t* depth16 = d16->mutable_data();
   for (int w = 0; w < d16->width(); w++) {
     for (int h = 0; h < d16->height(); h++) {
       const double dist = std::min(d32.at(w, h)[0], kDepth16UOverflowDistance);
-      d16->at(w, h)[0] = static_cast<uint16_t>(dist * 1000);
+      depth16[w + h * d16->width()] = static_cast<uint16_t>(dist * 1000);
     }
   }
 }
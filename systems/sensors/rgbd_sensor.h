@@ -104,6 +104,22 @@ class RgbdSensor final : public LeafSystem<double> {
     math::RigidTransformd X_BD;
   };
 
+  /** Specifies how the sensor's images are rendered.  */
+  enum class RenderMode {
+    /** Each image is rendered when its own output port is evaluated. The two
+     depth images share a single rendering.  */
+    kSeparate,
+    /** Evaluating any of the image output ports renders the color, depth, and
+     label images together, with a single request to the render engines (see
+     geometry::QueryObject::RenderImages()), and caches them for the other
+     image output ports. Render engines can share work among the images of a
+     single request (e.g., geometry::render::RenderEngineCpu rasterizes the
+     depth and label images once when the color and depth cameras coincide).
+     This is the cheaper mode when all of the images are consumed, but the
+     render engines must support all three image types.  */
+    kFused,
+  };
+
   /** Constructs an %RgbdSensor whose frame `B` is rigidly affixed to the frame
    P, indicated by `parent_id`, and with the given camera properties. The camera
    will move as frame P moves. For a stationary camera, use the frame id from
@@ -122,13 +138,16 @@ class RgbdSensor final : public LeafSystem<double> {
                          three frames will be aligned and coincident.
    @param show_window    A flag for showing a visible window. If this is false,
                          off-screen rendering is executed. The default is false.
+   @param render_mode    Specifies how the images are rendered. The default is
+                         RenderMode::kSeparate.
    */
   RgbdSensor(geometry::FrameId parent_id,
              const math::RigidTransformd& X_PB,
              const geometry::render::CameraProperties& color_properties,
              const geometry::render::DepthCameraProperties& depth_properties,
              const CameraPoses& camera_poses = {},
-             bool show_window = false);
+             bool show_window = false,
+             RenderMode render_mode = RenderMode::kSeparate);
 
   /** Constructs an %RgbdSensor in the same way as the above overload, but
    using the `CameraProperties` portion of `properties` for color (and label)
@@ -138,10 +157,10 @@ class RgbdSensor final : public LeafSystem<double> {
              const math::RigidTransformd& X_PB,
              const geometry::render::DepthCameraProperties& properties,
              const CameraPoses& camera_poses = {},
-             bool show_window = false)
-    : RgbdSensor(
-          parent_id, X_PB, properties, properties, camera_poses, show_window)
-      {}
+             bool show_window = false,
+             RenderMode render_mode = RenderMode::kSeparate)
+    : RgbdSensor(parent_id, X_PB, properties, properties, camera_poses,
+                 show_window, render_mode) {}
 
   ~RgbdSensor() = default;
 
@@ -153,6 +172,24 @@ class RgbdSensor final : public LeafSystem<double> {
   /** Returns the depth sensor's info.  */
   const CameraInfo& depth_camera_info() const { return depth_camera_info_; }
 
+  /** Returns the intrinsic properties of the color (and label) camera.  */
+  const geometry::render::CameraProperties& color_properties() const {
+    return color_properties_;
+  }
+
+  /** Returns the intrinsic properties of the depth camera.  */
+  const geometry::render::DepthCameraProperties& depth_properties() const {
+    return depth_properties_;
+  }
+
+  /** Returns true if a window is shown for the color and label cameras.  */
+  bool show_window() const { return show_window_; }
+
+  /** Returns `X_PB`, the pose of the base frame B in its parent frame P.  */
+  const math::RigidTransformd& X_PB() const {
+    return X_PB_;
+  }
+
   /** Returns `X_BC`.  */
   const math::RigidTransformd& X_BC() const {
     return X_BC_;
@@ -163,9 +200,24 @@ class RgbdSensor final : public LeafSystem<double> {
     return X_BD_;
   }
 
+  /** Returns how the images are rendered.  */
+  RenderMode render_mode() const { return render_mode_; }
+
   /** Returns the id of the frame to which the base is affixed.  */
   geometry::FrameId parent_frame_id() const { return parent_frame_id_; }
 
+  /** Calculates the pose of the sensor's base frame B in the world frame W,
+   given the poses reported by `query_object`.  */
+  math::RigidTransformd CalcX_WB(
+      const geometry::QueryObject<double>& query_object) const;
+
+  /** Converts a single channel, float depth image (with depths in meters) to a
+   single channel, unsigned uint16_t depth image (with depths in millimeters),
+   as reported by the `depth_image_16u` output port. The depths which can't be
+   represented saturate to the largest uint16_t value.  */
+  static void ConvertDepth32FTo16U(const ImageDepth32F& d32,
+                                   ImageDepth16U* d16);
+
   /** Returns the geometry::QueryObject<double>-valued input port.  */
   const InputPort<double>& query_object_input_port() const;
 
@@ -190,7 +242,12 @@ class RgbdSensor final : public LeafSystem<double> {
   const OutputPort<double>& X_WB_output_port() const;
 
  private:
-  friend class RgbdSensorTester;
+  // The images rendered together in RenderMode::kFused.
+  struct FusedImages {
+    ImageRgba8U color;
+    ImageDepth32F depth;
+    ImageLabel16I label;
+  };
 
   // The calculator methods for the four output ports.
   void CalcColorImage(const Context<double>& context,
@@ -201,13 +258,19 @@ class RgbdSensor final : public LeafSystem<double> {
                          ImageDepth16U* depth_image) const;
   void CalcLabelImage(const Context<double>& context,
                       ImageLabel16I* label_image) const;
-  void CalcX_WB(const Context<double>& context,
-                rendering::PoseVector<double>* pose_vector) const;
+  void CalcX_WBPoseVector(const Context<double>& context,
+                          rendering::PoseVector<double>* pose_vector) const;
 
-  // Convert a single channel, float depth image (with depths in meters) to a
-  // single channel, unsigned uint16_t depth image (with depths in millimeters).
-  static void ConvertDepth32FTo16U(const ImageDepth32F& d32,
-                                   ImageDepth16U* d16);
+  // The calculator methods for the cache entries of the rendered images; only
+  // the entry of the sensor's render mode is declared.
+  void CalcFusedImages(const Context<double>& context,
+                       FusedImages* images) const;
+  void CalcRenderedDepthImage32F(const Context<double>& context,
+                                 ImageDepth32F* depth_image) const;
+
+  // Returns the rendered depth image, from whichever cache entry holds it in
+  // the current render mode.
+  const ImageDepth32F& EvalDepthImage32F(const Context<double>& context) const;
 
   // Extract the query object from the given context (via the appropriate input
   // port.
@@ -220,12 +283,15 @@ class RgbdSensor final : public LeafSystem<double> {
   const OutputPort<double>* depth_image_16U_port_{};
   const OutputPort<double>* label_image_port_{};
   const OutputPort<double>* X_WB_pose_port_{};
+  const CacheEntry* fused_images_cache_entry_{};
+  const CacheEntry* depth_image_32F_cache_entry_{};
 
   // The identifier for the parent frame `P`.
   const geometry::FrameId parent_frame_id_;
 
   // If true, a window will be shown for the camera.
   const bool show_window_;
+  const RenderMode render_mode_;
   const CameraInfo color_camera_info_;
   const CameraInfo depth_camera_info_;
   const geometry::render::CameraProperties color_properties_;
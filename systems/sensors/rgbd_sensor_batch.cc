@@ -0,0 +1,149 @@
+#include "drake/systems/sensors/rgbd_sensor_batch.h"
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/geometry/render/render_engine.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::QueryObject;
+using geometry::render::RenderImageBatch;
+using math::RigidTransformd;
+using std::vector;
+
+RgbdSensorBatch::RgbdSensorBatch(
+    vector<std::unique_ptr<RgbdSensor>> sensors)
+    : sensors_(std::move(sensors)) {
+  DRAKE_THROW_UNLESS(!sensors_.empty());
+  for (const auto& sensor : sensors_) {
+    DRAKE_THROW_UNLESS(sensor != nullptr);
+  }
+
+  query_object_input_port_ = &this->DeclareAbstractInputPort(
+      "geometry_query", Value<geometry::QueryObject<double>>{});
+
+  Images images;
+  for (const auto& sensor : sensors_) {
+    const CameraInfo& color_info = sensor->color_camera_info();
+    const CameraInfo& depth_info = sensor->depth_camera_info();
+    images.color.emplace_back(color_info.width(), color_info.height());
+    images.depth.emplace_back(depth_info.width(), depth_info.height());
+    images.label.emplace_back(color_info.width(), color_info.height());
+  }
+  images_cache_entry_ = &this->DeclareCacheEntry(
+      "images", images, &RgbdSensorBatch::CalcImages,
+      {query_object_input_port_->ticket()});
+
+  for (int i = 0; i < num_sensors(); ++i) {
+    color_image_ports_.push_back(&this->DeclareAbstractOutputPort(
+        fmt::format("color_image_{}", i),
+        [image = images.color[i]]() { return AbstractValue::Make(image); },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageRgba8U>() =
+              images_cache_entry_->Eval<Images>(context).color[i];
+        },
+        {images_cache_entry_->ticket()}));
+
+    depth_image_32F_ports_.push_back(&this->DeclareAbstractOutputPort(
+        fmt::format("depth_image_32f_{}", i),
+        [image = images.depth[i]]() { return AbstractValue::Make(image); },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageDepth32F>() =
+              images_cache_entry_->Eval<Images>(context).depth[i];
+        },
+        {images_cache_entry_->ticket()}));
+
+    const ImageDepth16U depth16(images.depth[i].width(),
+                                images.depth[i].height());
+    depth_image_16U_ports_.push_back(&this->DeclareAbstractOutputPort(
+        fmt::format("depth_image_16u_{}", i),
+        [depth16]() { return AbstractValue::Make(depth16); },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          RgbdSensor::ConvertDepth32FTo16U(
+              images_cache_entry_->Eval<Images>(context).depth[i],
+              &output->get_mutable_value<ImageDepth16U>());
+        },
+        {images_cache_entry_->ticket()}));
+
+    label_image_ports_.push_back(&this->DeclareAbstractOutputPort(
+        fmt::format("label_image_{}", i),
+        [image = images.label[i]]() { return AbstractValue::Make(image); },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageLabel16I>() =
+              images_cache_entry_->Eval<Images>(context).label[i];
+        },
+        {images_cache_entry_->ticket()}));
+
+    X_WB_pose_ports_.push_back(&this->DeclareVectorOutputPort(
+        fmt::format("X_WB_{}", i), rendering::PoseVector<double>(),
+        [this, i](const Context<double>& context, BasicVector<double>* output) {
+          const RigidTransformd X_WB =
+              sensors_[i]->CalcX_WB(get_query_object(context));
+          auto& pose_vector =
+              dynamic_cast<rendering::PoseVector<double>&>(*output);
+          pose_vector.set_translation(
+              Eigen::Translation3d{X_WB.translation()});
+          pose_vector.set_rotation(X_WB.rotation().ToQuaternion());
+        }));
+  }
+}
+
+const InputPort<double>& RgbdSensorBatch::query_object_input_port() const {
+  return *query_object_input_port_;
+}
+
+const OutputPort<double>& RgbdSensorBatch::color_image_output_port(
+    int i) const {
+  return *color_image_ports_.at(i);
+}
+
+const OutputPort<double>& RgbdSensorBatch::depth_image_32F_output_port(
+    int i) const {
+  return *depth_image_32F_ports_.at(i);
+}
+
+const OutputPort<double>& RgbdSensorBatch::depth_image_16U_output_port(
+    int i) const {
+  return *depth_image_16U_ports_.at(i);
+}
+
+const OutputPort<double>& RgbdSensorBatch::label_image_output_port(
+    int i) const {
+  return *label_image_ports_.at(i);
+}
+
+const OutputPort<double>& RgbdSensorBatch::X_WB_output_port(int i) const {
+  return *X_WB_pose_ports_.at(i);
+}
+
+void RgbdSensorBatch::CalcImages(const Context<double>& context,
+                                 Images* images) const {
+  const QueryObject<double>& query_object = get_query_object(context);
+  RenderImageBatch batch;
+  for (int i = 0; i < num_sensors(); ++i) {
+    const RgbdSensor& sensor = *sensors_[i];
+    const RigidTransformd X_WB = sensor.CalcX_WB(query_object);
+    const RigidTransformd X_WC = X_WB * sensor.X_BC();
+    batch.color.push_back({sensor.color_properties(), X_WC,
+                           sensor.show_window(), &images->color[i]});
+    batch.depth.push_back({sensor.depth_properties(), X_WB * sensor.X_BD(),
+                           &images->depth[i]});
+    batch.label.push_back({sensor.color_properties(), X_WC,
+                           sensor.show_window(), &images->label[i]});
+  }
+  query_object.RenderImages(batch);
+}
+
+const QueryObject<double>& RgbdSensorBatch::get_query_object(
+    const Context<double>& context) const {
+  return query_object_input_port().Eval<QueryObject<double>>(context);
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
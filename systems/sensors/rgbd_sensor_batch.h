@@ -0,0 +1,119 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/query_object.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/framework/cache_entry.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/rendering/pose_vector.h"
+#include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/rgbd_sensor.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** A group of RgbdSensor%s, attached to the same geometry::SceneGraph, whose
+ images are rendered together. The color, depth, and label images of all of
+ the sensors are rendered with a single call to
+ geometry::QueryObject::RenderImages(), so that the render engine can share the
+ work that doesn't depend on the camera (e.g., preparing the geometry, or
+ rasterizing a sensor's depth and label images together) among all of the
+ images, instead of repeating it for each one as separate %RgbdSensor systems
+ would. As a consequence, evaluating any of the image output ports renders all
+ of the images.
+
+ @system{RgbdSensorBatch,
+    @input_port{geometry_query},
+    @output_port{color_image_0}
+    @output_port{depth_image_32f_0}
+    @output_port{depth_image_16u_0}
+    @output_port{label_image_0}
+    @output_port{X_WB_0}
+    @output_port{...}
+    @output_port{color_image_N-1}
+    @output_port{depth_image_32f_N-1}
+    @output_port{depth_image_16u_N-1}
+    @output_port{label_image_N-1}
+    @output_port{X_WB_N-1}
+ }
+
+ The output ports of the i-th sensor have the same meaning and formats as the
+ ports of the same name of that RgbdSensor. The given sensors only describe the
+ cameras; they are owned by, but are not part of, this system and their own
+ ports are never evaluated.
+
+ @ingroup sensor_systems  */
+class RgbdSensorBatch final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RgbdSensorBatch)
+
+  /** Constructs the batch of the given `sensors`. The i-th sensor's images are
+   reported on the output ports with suffix `_i`.
+   @throws std::exception if `sensors` is empty or contains null pointers.  */
+  explicit RgbdSensorBatch(std::vector<std::unique_ptr<RgbdSensor>> sensors);
+
+  /** Returns the number of sensors in the batch.  */
+  int num_sensors() const { return static_cast<int>(sensors_.size()); }
+
+  /** Returns the i-th sensor of the batch.  */
+  const RgbdSensor& sensor(int i) const { return *sensors_.at(i); }
+
+  /** Returns the geometry::QueryObject<double>-valued input port.  */
+  const InputPort<double>& query_object_input_port() const;
+
+  /** Returns the abstract-valued output port that contains the i-th sensor's
+   ImageRgba8U.  */
+  const OutputPort<double>& color_image_output_port(int i) const;
+
+  /** Returns the abstract-valued output port that contains the i-th sensor's
+   ImageDepth32F.  */
+  const OutputPort<double>& depth_image_32F_output_port(int i) const;
+
+  /** Returns the abstract-valued output port that contains the i-th sensor's
+   ImageDepth16U.  */
+  const OutputPort<double>& depth_image_16U_output_port(int i) const;
+
+  /** Returns the abstract-valued output port that contains the i-th sensor's
+   ImageLabel16I.  */
+  const OutputPort<double>& label_image_output_port(int i) const;
+
+  /** Returns the vector-valued output port that contains the i-th sensor's
+   `X_WB` as a rendering::PoseVector.  */
+  const OutputPort<double>& X_WB_output_port(int i) const;
+
+ private:
+  // The images of all of the sensors, indexed like sensors_.
+  struct Images {
+    std::vector<ImageRgba8U> color;
+    std::vector<ImageDepth32F> depth;
+    std::vector<ImageLabel16I> label;
+  };
+
+  // The calculator method for the cache entry that holds the images.
+  void CalcImages(const Context<double>& context, Images* images) const;
+
+  // Extract the query object from the given context (via the appropriate input
+  // port).
+  const geometry::QueryObject<double>& get_query_object(
+      const Context<double>& context) const;
+
+  const std::vector<std::unique_ptr<RgbdSensor>> sensors_;
+
+  const InputPort<double>* query_object_input_port_{};
+  std::vector<const OutputPort<double>*> color_image_ports_;
+  std::vector<const OutputPort<double>*> depth_image_32F_ports_;
+  std::vector<const OutputPort<double>*> depth_image_16U_ports_;
+  std::vector<const OutputPort<double>*> label_image_ports_;
+  std::vector<const OutputPort<double>*> X_WB_pose_ports_;
+
+  // Holds the Images, all of which are rendered together.
+  const CacheEntry* images_cache_entry_{};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
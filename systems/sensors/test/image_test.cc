@@ -1,5 +1,7 @@
 #include "drake/systems/sensors/image.h"
 
+#include <utility>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -171,6 +173,58 @@ GTEST_TEST(TestImage, ResizeTest) {
   EXPECT_EQ(dut.size(), kWidthResized * kHeightResized * kNumChannels);
 }
 
+// Copies share their pixels until one of them is accessed through the
+// non-const at() or mutable_data(), or MakeUnique() is called on it.
+GTEST_TEST(TestImage, CopyOnWriteTest) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  ImageRgba8U copy = image;
+  ImageRgba8U assigned;
+  assigned = image;
+  const uint8_t* pixels = std::as_const(image).at(0, 0);
+  EXPECT_EQ(std::as_const(copy).at(0, 0), pixels);
+  EXPECT_EQ(std::as_const(assigned).at(0, 0), pixels);
+
+  // Making the original unique gives it its own pixels; the copies keep
+  // theirs.
+  uint8_t* unique_pixels = image.mutable_data();
+  EXPECT_NE(unique_pixels, pixels);
+  EXPECT_EQ(image.at(0, 0), unique_pixels);
+  image.at(1, 2)[3] = 7;
+  EXPECT_EQ(std::as_const(copy).at(0, 0), pixels);
+  EXPECT_EQ(std::as_const(image).at(1, 2)[3], 7);
+  EXPECT_EQ(std::as_const(copy).at(1, 2)[3], kInitialValue);
+
+  // Writing a shared copy through the non-const at() gives it its own pixels.
+  ImageRgba8U written = copy;
+  written.at(1, 2)[3] = 8;
+  EXPECT_NE(std::as_const(written).at(0, 0), pixels);
+  EXPECT_EQ(std::as_const(written).at(1, 2)[3], 8);
+  EXPECT_EQ(std::as_const(copy).at(1, 2)[3], kInitialValue);
+  written = ImageRgba8U();
+
+  // Once a single image owns the pixels, MakeUnique() and at() keep them, such
+  // that the pointers into them stay valid.
+  image.MakeUnique();
+  EXPECT_EQ(image.mutable_data(), unique_pixels);
+  assigned = ImageRgba8U();
+  copy.at(1, 2)[3] = 9;
+  EXPECT_EQ(std::as_const(copy).at(0, 0), pixels);
+  EXPECT_EQ(std::as_const(copy).at(1, 2)[3], 9);
+
+  // Resizing a shared image doesn't affect its copies.
+  assigned = copy;
+  assigned.resize(2, 3);
+  EXPECT_EQ(std::as_const(assigned).at(1, 2)[0], 0);
+  EXPECT_EQ(copy.width(), kWidth);
+  EXPECT_EQ(std::as_const(copy).at(1, 2)[3], 9);
+  EXPECT_EQ(std::as_const(copy).at(0, 0), pixels);
+
+  // A zero-sized image has no pixels.
+  ImageRgba8U empty;
+  empty.MakeUnique();
+  EXPECT_EQ(empty.mutable_data(), nullptr);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -3,8 +3,12 @@
 #include <unistd.h>
 
 #include <fstream>
+#include <future>
+#include <memory>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -246,9 +250,16 @@ class ImageWriterTest : public ::testing::Test {
     return result;
   }
 
+  // Writes a single image through a port of the given type. If `async` is
+  // true, the writer is asynchronous and the port's value is changed before
+  // the image is flushed to disk, to confirm the queued image is a copy.
   template <PixelType kPixelType>
-  static void TestWritingImageOnPort() {
-    ImageWriter writer;
+  static void TestWritingImageOnPort(bool async = false) {
+    std::unique_ptr<ImageWriter> writer_ptr =
+        async ? std::make_unique<ImageWriter>(ImageWriterAsyncParams{})
+              : std::make_unique<ImageWriter>();
+    ImageWriter& writer = *writer_ptr;
+    EXPECT_EQ(writer.is_async(), async);
     ImageWriterTester tester(writer);
 
     // Values for port declaration.
@@ -273,8 +284,13 @@ class ImageWriterTest : public ::testing::Test {
     filesystem::path expected_file(expected_name);
     EXPECT_FALSE(filesystem::exists(expected_file));
     writer.Publish(*context, events->get_publish_events());
+    if (async) {
+      port.FixValue(context.get(), Image<kPixelType>(4, 1));
+      writer.Flush();
+    }
     EXPECT_TRUE(filesystem::exists(expected_file));
     EXPECT_EQ(1, tester.port_count(port.get_index()));
+    EXPECT_EQ(0, writer.num_dropped_images());
     add_file_for_cleanup(expected_file.string());
 
     EXPECT_TRUE(MatchesFileOnDisk(expected_name, image));
@@ -657,6 +673,109 @@ TEST_F(ImageWriterTest, WritesDepthImage) {
   TestWritingImageOnPort<PixelType::kDepth32F>();
 }
 
+// Confirms that asynchronous writers write the same files.
+TEST_F(ImageWriterTest, WritesImagesAsync) {
+  TestWritingImageOnPort<PixelType::kRgba8U>(true);
+  TestWritingImageOnPort<PixelType::kLabel16I>(true);
+  TestWritingImageOnPort<PixelType::kDepth32F>(true);
+}
+
+// Confirms that destroying an asynchronous writer writes the queued images.
+TEST_F(ImageWriterTest, AsyncWriterFlushesOnDestruction) {
+  ImageWriterAsyncParams params;
+  params.num_threads = 2;
+  params.max_queued_images = 4;
+  auto writer = std::make_unique<ImageWriter>(params);
+  ImageWriterTester tester(*writer);
+  filesystem::path path(temp_dir());
+  path.append("async_{count:03}");
+  const auto& port = writer->DeclareImageInputPort<PixelType::kRgba8U>(
+      "port", path.string(), 0.1, 0.0);
+  auto events = writer->AllocateCompositeEventCollection();
+  auto context = writer->AllocateContext();
+  port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+  writer->CalcNextUpdateTime(*context, events.get());
+
+  const int kNumImages = 10;
+  std::vector<std::string> file_names;
+  for (int i = 0; i < kNumImages; ++i) {
+    file_names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U,
+        context->get_time(), "port", i));
+    add_file_for_cleanup(file_names.back());
+    writer->Publish(*context, events->get_publish_events());
+  }
+  // The default policy blocks instead of dropping images.
+  EXPECT_EQ(0, writer->num_dropped_images());
+  writer.reset();
+  for (const auto& file_name : file_names) {
+    EXPECT_TRUE(MatchesFileOnDisk(file_name, test_image<PixelType::kRgba8U>()));
+  }
+}
+
+// Confirms the queue-full policies of the asynchronous writing queue. A single
+// worker is held by a blocking task while the queue (of size two) receives
+// three more tasks.
+GTEST_TEST(ImageWriteQueueTest, QueueFullPolicies) {
+  using Policy = ImageWriterAsyncParams::QueueFullPolicy;
+  auto run_tasks = [](Policy policy, int* num_dropped) {
+    ImageWriterAsyncParams params;
+    params.num_threads = 1;
+    params.max_queued_images = 2;
+    params.queue_full_policy = policy;
+    internal::ImageWriteQueue queue(params);
+
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    queue.Push([&started, released]() {
+      started.set_value();
+      released.wait();
+    });
+    started.get_future().wait();
+
+    // The tasks all run on the single worker, one at a time.
+    std::vector<int> ran;
+    auto make_task = [&ran](int i) {
+      return [&ran, i]() { ran.push_back(i); };
+    };
+    queue.Push(make_task(1));
+    queue.Push(make_task(2));
+    // With the blocking policy, the third push has to wait for the worker, so
+    // it is done on another thread.
+    std::thread pusher([&queue, &make_task]() { queue.Push(make_task(3)); });
+    if (policy != Policy::kBlock) pusher.join();
+    release.set_value();
+    if (policy == Policy::kBlock) pusher.join();
+    queue.Flush();
+    *num_dropped = queue.num_dropped();
+    return ran;
+  };
+
+  int num_dropped{};
+  EXPECT_EQ(run_tasks(Policy::kBlock, &num_dropped),
+            std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(num_dropped, 0);
+  EXPECT_EQ(run_tasks(Policy::kDropNewest, &num_dropped),
+            std::vector<int>({1, 2}));
+  EXPECT_EQ(num_dropped, 1);
+  EXPECT_EQ(run_tasks(Policy::kDropOldest, &num_dropped),
+            std::vector<int>({2, 3}));
+  EXPECT_EQ(num_dropped, 1);
+}
+
+GTEST_TEST(ImageWriteQueueTest, BadParameters) {
+  ImageWriterAsyncParams params;
+  params.num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{params}, std::logic_error,
+                              ".*number of writing threads must be positive");
+  params.num_threads = 1;
+  params.max_queued_images = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ImageWriter{params}, std::logic_error,
+      ".*maximum number of queued images must be positive");
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
@@ -0,0 +1,139 @@
+#include "drake/systems/sensors/rgbd_sensor_batch.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/render/camera_properties.h"
+#include "drake/geometry/render/render_engine_cpu_factory.h"
+#include "drake/geometry/render/render_label.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::GeometryId;
+using geometry::GeometryInstance;
+using geometry::PerceptionProperties;
+using geometry::SceneGraph;
+using geometry::SourceId;
+using geometry::Sphere;
+using geometry::render::DepthCameraProperties;
+using geometry::render::MakeRenderEngineCpu;
+using geometry::render::RenderEngineCpuParams;
+using geometry::render::RenderLabel;
+using math::RigidTransformd;
+using std::make_unique;
+using std::unique_ptr;
+using std::vector;
+
+const char kRendererName[] = "renderer";
+
+template <typename ImageType>
+bool SamePixels(const ImageType& image1, const ImageType& image2) {
+  return image1.width() == image2.width() &&
+         image1.height() == image2.height() &&
+         std::equal(image1.at(0, 0), image1.at(0, 0) + image1.size(),
+                    image2.at(0, 0));
+}
+
+// Confirms that the batch reports the same images as individual RgbdSensors
+// with the same cameras.
+GTEST_TEST(RgbdSensorBatchTest, MatchesIndividualSensors) {
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  scene_graph->AddRenderer(kRendererName,
+                           MakeRenderEngineCpu(RenderEngineCpuParams{}));
+  const SourceId source_id = scene_graph->RegisterSource("test");
+  const GeometryId sphere_id = scene_graph->RegisterAnchoredGeometry(
+      source_id, make_unique<GeometryInstance>(
+                     RigidTransformd(Vector3d(0, 0, 2)),
+                     make_unique<Sphere>(0.5), "sphere"));
+  PerceptionProperties properties;
+  properties.AddProperty("label", "id", RenderLabel(3));
+  scene_graph->AssignRole(source_id, sphere_id, properties);
+
+  // Two sensors with different poses and intrinsics, both looking along the
+  // world's +z axis toward the sphere.
+  const vector<RigidTransformd> X_WBs{RigidTransformd(Vector3d(0, 0, 0)),
+                                      RigidTransformd(Vector3d(0.2, 0.1, 0))};
+  const vector<DepthCameraProperties> cameras{
+      {64, 48, M_PI / 4, kRendererName, 0.1, 10},
+      {32, 24, M_PI / 6, kRendererName, 0.1, 10}};
+  auto make_sensor = [&](int i) {
+    return make_unique<RgbdSensor>(SceneGraph<double>::world_frame_id(),
+                                   X_WBs[i], cameras[i]);
+  };
+  vector<unique_ptr<RgbdSensor>> sensors;
+  vector<const RgbdSensor*> individual_sensors;
+  for (int i = 0; i < 2; ++i) {
+    sensors.push_back(make_sensor(i));
+    individual_sensors.push_back(builder.AddSystem(make_sensor(i)));
+    builder.Connect(scene_graph->get_query_output_port(),
+                    individual_sensors[i]->query_object_input_port());
+  }
+  auto* batch = builder.AddSystem<RgbdSensorBatch>(std::move(sensors));
+  builder.Connect(scene_graph->get_query_output_port(),
+                  batch->query_object_input_port());
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  ASSERT_EQ(batch->num_sensors(), 2);
+  const Context<double>& batch_context =
+      diagram->GetSubsystemContext(*batch, *context);
+  for (int i = 0; i < 2; ++i) {
+    const RgbdSensor& sensor = *individual_sensors[i];
+    const Context<double>& sensor_context =
+        diagram->GetSubsystemContext(sensor, *context);
+    EXPECT_EQ(batch->sensor(i).depth_camera_info().width(), cameras[i].width);
+
+    const auto& depth = batch->depth_image_32F_output_port(i)
+                            .Eval<ImageDepth32F>(batch_context);
+    EXPECT_TRUE(SamePixels(depth, sensor.depth_image_32F_output_port()
+                                      .Eval<ImageDepth32F>(sensor_context)));
+    // The sphere is in the middle of the image.
+    EXPECT_LT(depth.at(depth.width() / 2, depth.height() / 2)[0], 2.f);
+
+    EXPECT_TRUE(SamePixels(
+        batch->depth_image_16U_output_port(i).Eval<ImageDepth16U>(
+            batch_context),
+        sensor.depth_image_16U_output_port().Eval<ImageDepth16U>(
+            sensor_context)));
+
+    const auto& label =
+        batch->label_image_output_port(i).Eval<ImageLabel16I>(batch_context);
+    EXPECT_TRUE(SamePixels(label, sensor.label_image_output_port()
+                                      .Eval<ImageLabel16I>(sensor_context)));
+    EXPECT_EQ(label.at(label.width() / 2, label.height() / 2)[0], 3);
+
+    EXPECT_TRUE(CompareMatrices(
+        batch->X_WB_output_port(i).Eval(batch_context),
+        sensor.X_WB_output_port().Eval(sensor_context)));
+  }
+}
+
+GTEST_TEST(RgbdSensorBatchTest, BadSensors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RgbdSensorBatch(vector<unique_ptr<RgbdSensor>>{}), std::exception,
+      ".*!sensors_.empty().*");
+  vector<unique_ptr<RgbdSensor>> sensors;
+  sensors.push_back(nullptr);
+  DRAKE_EXPECT_THROWS_MESSAGE(RgbdSensorBatch(std::move(sensors)),
+                              std::exception, ".*sensor != nullptr.*");
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
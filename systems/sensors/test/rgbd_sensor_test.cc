@@ -56,15 +56,6 @@ std::ostream& operator<<(std::ostream& out, const CameraInfo& info) {
   return out;
 }
 
-// Helper class for exercising private methods in RgbdSensor.
-class RgbdSensorTester {
- public:
-  static void ConvertDepth32FTo16U(const ImageDepth32F& d32,
-                                   ImageDepth16U* d16) {
-    RgbdSensor::ConvertDepth32FTo16U(d32, d16);
-  }
-};
-
 namespace {
 
 using Eigen::AngleAxisd;
@@ -181,6 +172,52 @@ class RgbdSensorTest : public ::testing::Test {
     return result;
   }
 
+  // Creates an anchored sensor with the given render mode and confirms the
+  // images that are rendered when its output ports are evaluated.
+  void TestRenderMode(RgbdSensor::RenderMode render_mode) {
+    const RigidTransformd X_WB(RollPitchYawd(M_PI / 2, 0, 0),
+                               Vector3d(1, 2, 3));
+    auto make_sensor = [this, &X_WB, render_mode](SceneGraph<double>*) {
+      return make_unique<RgbdSensor>(
+          SceneGraph<double>::world_frame_id(), X_WB, color_properties_,
+          depth_properties_, RgbdSensor::CameraPoses{}, false, render_mode);
+    };
+    MakeCameraDiagram(make_sensor);
+    EXPECT_EQ(sensor_->render_mode(), render_mode);
+    // Besides those of the output ports, the sensor only declares the cache
+    // entry of the images rendered in its mode.
+    EXPECT_EQ(sensor_->num_cache_entries(), sensor_->num_output_ports() + 1);
+    EXPECT_TRUE(ValidateConstruction(scene_graph_->world_frame_id(), X_WB));
+
+    // A context with caching enabled, whose render engine hasn't rendered yet.
+    auto context = diagram_->CreateDefaultContext();
+    const DummyRenderEngine& engine =
+        GeometryStateTester<double>::GetDummyRenderEngine(
+            &diagram_->GetMutableSubsystemContext(*scene_graph_,
+                                                  context.get()),
+            kRendererName);
+    const Context<double>& sensor_context =
+        diagram_->GetSubsystemContext(*sensor_, *context);
+
+    // Both depth images come from a single rendering.
+    sensor_->depth_image_32F_output_port().Eval<ImageDepth32F>(sensor_context);
+    sensor_->depth_image_16U_output_port().Eval<ImageDepth16U>(sensor_context);
+    EXPECT_EQ(engine.num_depth_renders(), 1);
+
+    // In the fused mode, the color and label images have been rendered along
+    // with the depth images, in a single batch.
+    const int num_fused = render_mode == RgbdSensor::RenderMode::kFused;
+    EXPECT_EQ(engine.num_batch_renders(), num_fused);
+    EXPECT_EQ(engine.num_color_renders(), num_fused);
+    EXPECT_EQ(engine.num_label_renders(), num_fused);
+
+    sensor_->color_image_output_port().Eval<ImageRgba8U>(sensor_context);
+    sensor_->label_image_output_port().Eval<ImageLabel16I>(sensor_context);
+    EXPECT_EQ(engine.num_color_renders(), 1);
+    EXPECT_EQ(engine.num_label_renders(), 1);
+    EXPECT_EQ(engine.num_depth_renders(), 1);
+  }
+
   CameraProperties color_properties_;
   DepthCameraProperties depth_properties_;
   unique_ptr<Diagram<double>> diagram_;
@@ -266,6 +303,12 @@ TEST_F(RgbdSensorTest, ConstructFrameFixedCamera) {
   };
   EXPECT_TRUE(
       ValidateConstruction(frame.id(), X_WC_expected, pre_render_callback));
+
+  const auto& query_object =
+      sensor_->query_object_input_port().Eval<QueryObject<double>>(
+          *sensor_context_);
+  EXPECT_TRUE(CompareMatrices(sensor_->CalcX_WB(query_object).GetAsMatrix4(),
+                              (X_WP * X_PB).GetAsMatrix4()));
 }
 
 TEST_F(RgbdSensorTest, ConstructCameraWithNonTrivialOffsets) {
@@ -283,6 +326,10 @@ TEST_F(RgbdSensorTest, ConstructCameraWithNonTrivialOffsets) {
       depth_properties_, RgbdSensor::CameraPoses{X_BC, X_BD});
   EXPECT_TRUE(CompareMatrices(sensor.X_BC().matrix(), X_BC.matrix()));
   EXPECT_TRUE(CompareMatrices(sensor.X_BD().matrix(), X_BD.matrix()));
+  EXPECT_TRUE(CompareMatrices(sensor.X_PB().matrix(), X_WB.matrix()));
+  EXPECT_EQ(sensor.color_properties().width, color_properties_.width);
+  EXPECT_EQ(sensor.depth_properties().z_far, depth_properties_.z_far);
+  EXPECT_FALSE(sensor.show_window());
 }
 
 // We don't explicitly test any of the image outputs. Most of the image outputs
@@ -315,13 +362,24 @@ TEST_F(RgbdSensorTest, DepthImage32FTo16U) {
 
   // Perform conversion.
   ImageDepth16U depth16(1, 4);
-  RgbdSensorTester::ConvertDepth32FTo16U(depth32, &depth16);
+  RgbdSensor::ConvertDepth32FTo16U(depth32, &depth16);
 
   for (int c = 0; c < 4; ++c) {
     EXPECT_EQ(*depth16.at(0, c), expected_depths[c]);
   }
 }
 
+// Confirms that each render mode renders the images with the expected camera
+// pose and renders no more images than it should. Unlike the other tests, this
+// relies on caching.
+TEST_F(RgbdSensorTest, SeparateRenderMode) {
+  TestRenderMode(RgbdSensor::RenderMode::kSeparate);
+}
+
+TEST_F(RgbdSensorTest, FusedRenderMode) {
+  TestRenderMode(RgbdSensor::RenderMode::kFused);
+}
+
 // Tests that the discrete sensor is properly constructed.
 GTEST_TEST(RgbdSensorDiscrete, Construction) {
   DepthCameraProperties properties(640, 480, M_PI / 4, "render", 0.1, 10);
@@ -40,9 +40,6 @@ DirectCollocationConstraint::DirectCollocationConstraint(
       system_(System<double>::ToAutoDiffXd(system)),
       context_(system_->CreateDefaultContext()),
       input_port_(system_->get_input_port_selection(input_port_index)),
-      // Don't allocate the input port value until we're past the point
-      // where we might throw.
-      derivatives_(system_->AllocateTimeDerivatives()),
       num_states_(num_states),
       num_inputs_(num_inputs) {
   if (!assume_non_continuous_states_are_fixed) {
@@ -62,23 +59,52 @@ DirectCollocationConstraint::DirectCollocationConstraint(
           "Port requested for differentiation is abstract, and differentiation "
           "of abstract ports is not supported.");
     }
+  }
+
+  // Each DoEval() call uses its own Scratch, and System<AutoDiffXd> may be
+  // evaluated concurrently with distinct contexts.
+  set_is_thread_safe(true);
+}
 
+std::unique_ptr<DirectCollocationConstraint::Scratch>
+DirectCollocationConstraint::AcquireScratch() const {
+  {
+    std::lock_guard<std::mutex> lock(scratch_pool_mutex_);
+    if (!scratch_pool_.empty()) {
+      std::unique_ptr<Scratch> scratch = std::move(scratch_pool_.back());
+      scratch_pool_.pop_back();
+      return scratch;
+    }
+  }
+  auto scratch = std::make_unique<Scratch>();
+  scratch->context = context_->Clone();
+  if (input_port_) {
     // Provide a fixed value for the input port and keep an alias around.
-    input_port_value_ = &input_port_->FixValue(
-        context_.get(),
+    scratch->input_port_value = &input_port_->FixValue(
+        scratch->context.get(),
         system_->AllocateInputVector(*input_port_)->get_value());
   }
+  scratch->derivatives = system_->AllocateTimeDerivatives();
+  return scratch;
+}
+
+void DirectCollocationConstraint::ReleaseScratch(
+    std::unique_ptr<Scratch> scratch) const {
+  std::lock_guard<std::mutex> lock(scratch_pool_mutex_);
+  scratch_pool_.push_back(std::move(scratch));
 }
 
 void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
                                            const AutoDiffVecXd& input,
+                                           Scratch* scratch,
                                            AutoDiffVecXd* xdot) const {
   if (input_port_) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
+    scratch->input_port_value->GetMutableVectorData<AutoDiffXd>()
+        ->SetFromVector(input);
   }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  scratch->context->get_mutable_continuous_state().SetFromVector(state);
+  system_->CalcTimeDerivatives(*scratch->context, scratch->derivatives.get());
+  *xdot = scratch->derivatives->CopyToVector();
 }
 
 void DirectCollocationConstraint::DoEval(
@@ -108,20 +134,20 @@ void DirectCollocationConstraint::DoEval(
   // TODO(sam.creasey): Use caching (when it arrives) to avoid recomputing
   // the dynamics.  Currently the dynamics evaluated here as {u1,x1} are
   // recomputed in the next constraint as {u0,x0}.
+  std::unique_ptr<Scratch> scratch = AcquireScratch();
   AutoDiffVecXd xdot0;
-  dynamics(x0, u0, &xdot0);
-  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
+  dynamics(x0, u0, scratch.get(), &xdot0);
 
   AutoDiffVecXd xdot1;
-  dynamics(x1, u1, &xdot1);
-  const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
+  dynamics(x1, u1, scratch.get(), &xdot1);
 
   // Cubic interpolation to get xcol and xdotcol.
   const AutoDiffVecXd xcol = 0.5 * (x0 + x1) + h / 8 * (xdot0 - xdot1);
   const AutoDiffVecXd xdotcol = -1.5 * (x0 - x1) / h - .25 * (xdot0 + xdot1);
 
   AutoDiffVecXd g;
-  dynamics(xcol, 0.5 * (u0 + u1), &g);
+  dynamics(xcol, 0.5 * (u0 + u1), scratch.get(), &g);
+  ReleaseScratch(std::move(scratch));
   *y = xdotcol - g;
 }
 
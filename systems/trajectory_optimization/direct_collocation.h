@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <variant>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/constraint.h"
@@ -128,14 +130,31 @@ class DirectCollocationConstraint : public solvers::Constraint {
               VectorX<symbolic::Expression>* y) const override;
 
  private:
+  // The context (and its fixed input value) and derivatives used to evaluate
+  // the dynamics. Each DoEval() call acquires its own Scratch, such that the
+  // constraint can be evaluated concurrently on several threads.
+  struct Scratch {
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    FixedInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+  };
+
+  // Returns a Scratch from the pool, or a newly allocated one if the pool is
+  // empty.
+  std::unique_ptr<Scratch> AcquireScratch() const;
+
+  // Returns @p scratch to the pool, for reuse by the later DoEval() calls.
+  void ReleaseScratch(std::unique_ptr<Scratch> scratch) const;
+
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
-                AutoDiffVecXd* xdot) const;
+                Scratch* scratch, AutoDiffVecXd* xdot) const;
 
   const std::unique_ptr<System<AutoDiffXd>> system_;
+  // The prototype for the context in each Scratch.
   std::unique_ptr<Context<AutoDiffXd>> context_;
   const InputPort<AutoDiffXd>* input_port_{nullptr};
-  FixedInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  mutable std::mutex scratch_pool_mutex_;
+  mutable std::vector<std::unique_ptr<Scratch>> scratch_pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
@@ -315,6 +315,10 @@ GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   const Eigen::VectorXd val = prog.EvalBindingAtInitialGuess(binding);
   EXPECT_EQ(val.size(), 2);
   EXPECT_TRUE(val.isZero());
+
+  // Each evaluation uses its own scratch context, so the constraint can be
+  // evaluated concurrently.
+  EXPECT_TRUE(constraint->is_thread_safe());
 }
 
 // Almost any optimization with MultibodyPlant will need the input port
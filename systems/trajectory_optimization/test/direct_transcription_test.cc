@@ -13,6 +13,7 @@
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/fbstab_solver.h"
 #include "drake/solvers/snopt_solver.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/primitives/linear_system.h"
@@ -379,6 +380,40 @@ GTEST_TEST(DirectTranscriptionTest, DiscreteTimeLinearSystemTest) {
   }
 }
 
+// The linear MPC problem, whose stages are the states and inputs at each sample
+// time, has the stage structure expected by FbstabSolver.
+GTEST_TEST(DirectTranscriptionTest, FbstabSolverTest) {
+  Eigen::Matrix2d A;
+  // clang-format off
+  A << 1, 0.1,
+       0, 1;
+  // clang-format on
+  const Eigen::Vector2d B(0, 0.1);
+  const Eigen::MatrixXd C(0, 2), D(0, 1);
+  const double kTimeStep = .1;
+  LinearSystem<double> system(A, B, C, D, kTimeStep);
+
+  const auto context = system.CreateDefaultContext();
+  const int kNumSampleTimes = 10;
+  DirectTranscription prog(&system, *context, kNumSampleTimes);
+  prog.AddRunningCost(prog.state().cast<symbolic::Expression>().squaredNorm() +
+                      prog.input().cast<symbolic::Expression>().squaredNorm());
+  prog.AddLinearConstraint(prog.initial_state() == Eigen::Vector2d(1, 0));
+
+  solvers::FbstabSolver::StageVariables stage_variables;
+  for (int i = 0; i < kNumSampleTimes; i++) {
+    stage_variables.states.push_back(prog.state(i));
+    stage_variables.inputs.push_back(prog.input(i));
+  }
+  const solvers::MathematicalProgramResult result =
+      solvers::FbstabSolver(stage_variables).Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  const solvers::MathematicalProgramResult expected = solvers::Solve(prog);
+  ASSERT_TRUE(expected.is_success());
+  EXPECT_TRUE(CompareMatrices(prog.GetInputSamples(result),
+                              prog.GetInputSamples(expected), 1e-5));
+}
+
 // This example tests the TimeVaryingLinearSystem overload of the
 // constructor.
 GTEST_TEST(DirectTranscriptionTest, TimeVaryingLinearSystemTest) {
@@ -75,6 +75,7 @@
     "//multibody/benchmarks/kuka_iiwa_robot",
     "//multibody/benchmarks/mass_damper_spring",
     "//multibody/benchmarks/pendulum",
+    "//multibody/codegen",
     "//multibody/constraint",
     "//multibody/hydroelastics",
     "//multibody/inverse_kinematics",
@@ -369,8 +369,9 @@ def _impl(repository_ctx):
         hdrs = [
             "vtkCleanPolyData.h",
             "vtkFiltersCoreModule.h",
+            "vtkQuadricDecimation.h",
+            "vtkTriangleFilter.h",
         ],
-        visibility = ["//visibility:private"],
         deps = [
             ":vtkCommonCore",
             ":vtkCommonDataModel",